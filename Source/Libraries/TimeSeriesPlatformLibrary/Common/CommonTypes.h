@@ -216,6 +216,12 @@ namespace GSF
         return boost::make_shared<T>(p1, p2, p3, p4, p5);
     }
 
+    template<class T, class P1, class P2, class P3, class P4, class P5, class P6>
+    SharedPtr<T> NewSharedPtr(P1 p1, P2 p2, P3 p3, P4 p4, P5 p5, P6 p6)
+    {
+        return boost::make_shared<T>(p1, p2, p3, p4, p5, p6);
+    }
+
     template<class T, class S>
     SharedPtr<T> CastSharedPtr(SharedPtr<S> const& source)
     {
@@ -352,24 +358,21 @@ namespace GSF
         }
     };
 
+    // Copies source stream buffer to sink in blocks, see Compression.h for buffer compression
     template<class T, class TElem = char>
     void CopyStream(T* source, std::vector<uint8_t>& sink)
     {
-        std::istreambuf_iterator<TElem> it{ source };
-        std::istreambuf_iterator<TElem> eos{};
+        TElem buffer[8192];
+        std::streamsize count;
 
-        for (; it != eos; ++it)
-            sink.push_back(static_cast<uint8_t>(*it));
+        while ((count = source->sgetn(buffer, sizeof(buffer) / sizeof(TElem))) > 0)
+            sink.insert(sink.end(), reinterpret_cast<const uint8_t*>(buffer), reinterpret_cast<const uint8_t*>(buffer + count));
     }
 
     template<class T, class TElem = char>
     void CopyStream(T& source, std::vector<uint8_t>& sink)
     {
-        std::istreambuf_iterator<TElem> it{ source };
-        std::istreambuf_iterator<TElem> eos{};
-
-        for (; it != eos; ++it)
-            sink.push_back(static_cast<uint8_t>(*it));
+        CopyStream<std::basic_streambuf<TElem>, TElem>(source.rdbuf(), sink);
     }
 
     template<class T>
@@ -0,0 +1,135 @@
+//******************************************************************************************************
+//  Compression.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "Compression.h"
+
+using namespace std;
+using namespace GSF;
+
+static constexpr size_t StreamBlockSize = 64 * 1024;
+
+// Reads filtered stream in large blocks directly into output, growing output as needed
+static void ReadStream(StreamBuffer& streamBuffer, vector<uint8_t>& output, const size_t sizeEstimate)
+{
+    size_t position = output.size();
+    output.resize(position + max(sizeEstimate, StreamBlockSize));
+
+    while (true)
+    {
+        if (position == output.size())
+            output.resize(position + max(position / 2, StreamBlockSize));
+
+        const streamsize count = streamBuffer.sgetn(reinterpret_cast<char*>(output.data() + position), static_cast<streamsize>(output.size() - position));
+
+        if (count <= 0)
+            break;
+
+        position += static_cast<size_t>(count);
+    }
+
+    output.resize(position);
+}
+
+static void Compress(const uint8_t* buffer, const size_t length, vector<uint8_t>& output, const int32_t level)
+{
+    const MemoryStream memoryStream(buffer, 0, ConvertUInt32(length));
+    StreamBuffer streamBuffer;
+
+    streamBuffer.push(GZipCompressor(boost::iostreams::gzip_params(level)), StreamBlockSize);
+    streamBuffer.push(memoryStream);
+
+    // Text heavy payloads, e.g., XML meta-data, typically compress to well under a quarter of their size
+    ReadStream(streamBuffer, output, length / 4);
+}
+
+void GSF::GZipCompress(const uint8_t* buffer, const size_t length, vector<uint8_t>& output, const int32_t level, const int32_t maxThreads)
+{
+    const size_t blockCount = (length + ParallelCompressionBlockSize - 1) / ParallelCompressionBlockSize;
+    const size_t threadCount = min(blockCount, static_cast<size_t>(max(maxThreads, 1)));
+
+    if (threadCount < 2)
+    {
+        Compress(buffer, length, output, level);
+        return;
+    }
+
+    // Each block is compressed as a separate gzip member, members are appended in block order
+    vector<vector<uint8_t>> blocks(blockCount);
+    vector<Thread> threads;
+
+    threads.reserve(threadCount);
+
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back([&, i]
+        {
+            for (size_t j = i; j < blockCount; j += threadCount)
+            {
+                const size_t offset = j * ParallelCompressionBlockSize;
+                Compress(buffer + offset, min(ParallelCompressionBlockSize, length - offset), blocks[j], level);
+            }
+        });
+    }
+
+    size_t compressedLength = 0;
+
+    for (size_t i = 0; i < threadCount; i++)
+        threads[i].join();
+
+    for (const auto& block : blocks)
+        compressedLength += block.size();
+
+    output.reserve(output.size() + compressedLength);
+
+    for (const auto& block : blocks)
+        output.insert(output.end(), block.begin(), block.end());
+}
+
+void GSF::GZipCompress(const vector<uint8_t>& buffer, vector<uint8_t>& output, const int32_t level, const int32_t maxThreads)
+{
+    GZipCompress(buffer.data(), buffer.size(), output, level, maxThreads);
+}
+
+void GSF::GZipDecompress(const uint8_t* buffer, const size_t length, vector<uint8_t>& output, size_t sizeHint)
+{
+    // Last four bytes of gzip data hold uncompressed size, modulo 2^32, of the final member,
+    // estimate is limited to maximum deflate compression ratio in case data is not valid
+    if (sizeHint == 0 && length >= 18)
+    {
+        sizeHint = static_cast<size_t>(buffer[length - 4]) | static_cast<size_t>(buffer[length - 3]) << 8 | static_cast<size_t>(buffer[length - 2]) << 16 | static_cast<size_t>(buffer[length - 1]) << 24;
+        sizeHint = min(sizeHint, length * 1032);
+    }
+
+    const MemoryStream memoryStream(buffer, 0, ConvertUInt32(length));
+    StreamBuffer streamBuffer;
+
+    streamBuffer.push(GZipDecompressor(), StreamBlockSize);
+    streamBuffer.push(memoryStream);
+
+    ReadStream(streamBuffer, output, sizeHint);
+}
+
+void GSF::GZipDecompress(const vector<uint8_t>& buffer, vector<uint8_t>& output, const size_t sizeHint)
+{
+    GZipDecompress(buffer.data(), buffer.size(), output, sizeHint);
+}
@@ -0,0 +1,49 @@
+//******************************************************************************************************
+//  Compression.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __COMMON_COMPRESSION_H
+#define __COMMON_COMPRESSION_H
+
+#include "CommonTypes.h"
+
+namespace GSF
+{
+    // Compression level that selects the zlib default, other levels range from 1 (fastest) to 9 (smallest)
+    static constexpr int32_t DefaultCompressionLevel = -1;
+
+    // Size of the blocks that are compressed in parallel when multiple compression threads are allowed
+    static constexpr size_t ParallelCompressionBlockSize = 1024 * 1024;
+
+    // Compresses a buffer to gzip format, appending the result to output. When maxThreads is greater than one, buffers
+    // larger than the parallel compression block size are compressed in blocks on multiple threads; result is then a
+    // series of gzip members, which is valid gzip format, but not all decompressors read past the first member.
+    void GZipCompress(const uint8_t* buffer, size_t length, std::vector<uint8_t>& output, int32_t level = DefaultCompressionLevel, int32_t maxThreads = 1);
+    void GZipCompress(const std::vector<uint8_t>& buffer, std::vector<uint8_t>& output, int32_t level = DefaultCompressionLevel, int32_t maxThreads = 1);
+
+    // Decompresses a gzip buffer, appending the result to output. Output is pre-allocated from size hint, when
+    // provided, or otherwise from the uncompressed size recorded in the gzip trailer.
+    void GZipDecompress(const uint8_t* buffer, size_t length, std::vector<uint8_t>& output, size_t sizeHint = 0);
+    void GZipDecompress(const std::vector<uint8_t>& buffer, std::vector<uint8_t>& output, size_t sizeHint = 0);
+}
+
+#endif
@@ -0,0 +1,280 @@
+//******************************************************************************************************
+//  Metrics.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "Metrics.h"
+#include "Convert.h"
+
+using namespace std;
+using namespace GSF;
+
+MetricCounter::MetricCounter() :
+    m_value(0ULL)
+{
+}
+
+void MetricCounter::Add(const uint64_t count)
+{
+    m_value.fetch_add(count, memory_order_relaxed);
+}
+
+uint64_t MetricCounter::GetValue() const
+{
+    return m_value.load(memory_order_relaxed);
+}
+
+void MetricCounter::Reset()
+{
+    m_value.store(0ULL, memory_order_relaxed);
+}
+
+MetricGauge::MetricGauge(function<int64_t()> sampler) :
+    m_value(0LL),
+    m_sampler(std::move(sampler))
+{
+}
+
+void MetricGauge::Add(const int64_t value)
+{
+    m_value.fetch_add(value, memory_order_relaxed);
+}
+
+void MetricGauge::SetValue(const int64_t value)
+{
+    m_value.store(value, memory_order_relaxed);
+}
+
+int64_t MetricGauge::GetValue() const
+{
+    if (m_sampler != nullptr)
+        return m_sampler();
+
+    return m_value.load(memory_order_relaxed);
+}
+
+MetricHistogramSnapshot::MetricHistogramSnapshot() :
+    Count(0ULL),
+    Sum(0ULL),
+    Maximum(0ULL)
+{
+}
+
+float64_t MetricHistogramSnapshot::GetMean() const
+{
+    if (Count == 0ULL)
+        return 0.0;
+
+    return static_cast<float64_t>(Sum) / static_cast<float64_t>(Count);
+}
+
+uint64_t MetricHistogramSnapshot::GetPercentile(const float64_t percentile) const
+{
+    if (Count == 0ULL)
+        return 0ULL;
+
+    const array<uint64_t, MetricHistogram::BucketCount>& bounds = MetricHistogram::GetBucketBounds();
+    const uint64_t target = max<uint64_t>(1ULL, static_cast<uint64_t>(ceil(percentile * static_cast<float64_t>(Count))));
+    uint64_t total = 0ULL;
+
+    for (size_t i = 0; i < BucketCounts.size(); i++)
+    {
+        total += BucketCounts[i];
+
+        // Bucket bounds overestimate values, so result is limited to observed maximum
+        if (total >= target)
+            return min(bounds[i], Maximum);
+    }
+
+    return Maximum;
+}
+
+MetricHistogram::MetricHistogram() :
+    m_sum(0ULL),
+    m_maximum(0ULL)
+{
+    for (auto& bucket : m_buckets)
+        bucket.store(0ULL, memory_order_relaxed);
+}
+
+void MetricHistogram::Record(const uint64_t microseconds)
+{
+    const array<uint64_t, BucketCount>& bounds = GetBucketBounds();
+    const size_t index = lower_bound(bounds.begin(), bounds.end(), microseconds) - bounds.begin();
+
+    m_buckets[index].fetch_add(1ULL, memory_order_relaxed);
+    m_sum.fetch_add(microseconds, memory_order_relaxed);
+
+    uint64_t maximum = m_maximum.load(memory_order_relaxed);
+
+    while (microseconds > maximum && !m_maximum.compare_exchange_weak(maximum, microseconds, memory_order_relaxed))
+    {
+    }
+}
+
+MetricHistogramSnapshot MetricHistogram::GetSnapshot() const
+{
+    MetricHistogramSnapshot snapshot;
+
+    snapshot.BucketCounts.reserve(BucketCount);
+
+    for (const auto& bucket : m_buckets)
+    {
+        const uint64_t count = bucket.load(memory_order_relaxed);
+        snapshot.BucketCounts.push_back(count);
+        snapshot.Count += count;
+    }
+
+    // Count is derived from buckets so percentiles are consistent with a concurrently updated histogram
+    snapshot.Sum = m_sum.load(memory_order_relaxed);
+    snapshot.Maximum = m_maximum.load(memory_order_relaxed);
+
+    return snapshot;
+}
+
+void MetricHistogram::Reset()
+{
+    for (auto& bucket : m_buckets)
+        bucket.store(0ULL, memory_order_relaxed);
+
+    m_sum.store(0ULL, memory_order_relaxed);
+    m_maximum.store(0ULL, memory_order_relaxed);
+}
+
+const array<uint64_t, MetricHistogram::BucketCount>& MetricHistogram::GetBucketBounds()
+{
+    static const array<uint64_t, BucketCount> bounds =
+    {
+        1ULL, 2ULL, 5ULL,
+        10ULL, 20ULL, 50ULL,
+        100ULL, 200ULL, 500ULL,
+        1000ULL, 2000ULL, 5000ULL,
+        10000ULL, 20000ULL, 50000ULL,
+        100000ULL, 200000ULL, 500000ULL,
+        1000000ULL,
+        UInt64::MaxValue
+    };
+
+    return bounds;
+}
+
+MetricTimer::MetricTimer(MetricHistogram& histogram) :
+    m_histogram(histogram),
+    m_startTime(chrono::steady_clock::now())
+{
+}
+
+MetricTimer::~MetricTimer()
+{
+    const auto elapsed = chrono::steady_clock::now() - m_startTime;
+    m_histogram.Record(static_cast<uint64_t>(chrono::duration_cast<chrono::microseconds>(elapsed).count()));
+}
+
+MetricsSnapshot::MetricsSnapshot() :
+    Timestamp(0LL)
+{
+}
+
+vector<pair<string, float64_t>> MetricsSnapshot::GetValues() const
+{
+    vector<pair<string, float64_t>> values;
+
+    values.reserve(Counters.size() + Gauges.size() + Histograms.size() * 5);
+
+    for (const auto& counter : Counters)
+        values.emplace_back(counter.first, static_cast<float64_t>(counter.second));
+
+    for (const auto& gauge : Gauges)
+        values.emplace_back(gauge.first, static_cast<float64_t>(gauge.second));
+
+    for (const auto& histogram : Histograms)
+    {
+        const MetricHistogramSnapshot& snapshot = histogram.second;
+
+        values.emplace_back(histogram.first + ".Count", static_cast<float64_t>(snapshot.Count));
+        values.emplace_back(histogram.first + ".Mean", snapshot.GetMean());
+        values.emplace_back(histogram.first + ".P50", static_cast<float64_t>(snapshot.GetPercentile(0.50)));
+        values.emplace_back(histogram.first + ".P99", static_cast<float64_t>(snapshot.GetPercentile(0.99)));
+        values.emplace_back(histogram.first + ".Max", static_cast<float64_t>(snapshot.Maximum));
+    }
+
+    return values;
+}
+
+MetricCounterPtr MetricsRegistry::GetCounter(const string& name)
+{
+    ScopeLock lock(m_lock);
+    MetricCounterPtr& counter = m_counters[name];
+
+    if (counter == nullptr)
+        counter = NewSharedPtr<MetricCounter>();
+
+    return counter;
+}
+
+MetricGaugePtr MetricsRegistry::GetGauge(const string& name)
+{
+    ScopeLock lock(m_lock);
+    MetricGaugePtr& gauge = m_gauges[name];
+
+    if (gauge == nullptr)
+        gauge = NewSharedPtr<MetricGauge>();
+
+    return gauge;
+}
+
+MetricHistogramPtr MetricsRegistry::GetHistogram(const string& name)
+{
+    ScopeLock lock(m_lock);
+    MetricHistogramPtr& histogram = m_histograms[name];
+
+    if (histogram == nullptr)
+        histogram = NewSharedPtr<MetricHistogram>();
+
+    return histogram;
+}
+
+MetricGaugePtr MetricsRegistry::RegisterGauge(const string& name, function<int64_t()> sampler)
+{
+    ScopeLock lock(m_lock);
+    MetricGaugePtr gauge = NewSharedPtr<MetricGauge>(std::move(sampler));
+    m_gauges[name] = gauge;
+    return gauge;
+}
+
+MetricsSnapshot MetricsRegistry::GetSnapshot() const
+{
+    MetricsSnapshot snapshot;
+    ScopeLock lock(m_lock);
+
+    snapshot.Timestamp = ToTicks(UtcNow());
+
+    for (const auto& counter : m_counters)
+        snapshot.Counters.emplace(counter.first, counter.second->GetValue());
+
+    for (const auto& gauge : m_gauges)
+        snapshot.Gauges.emplace(gauge.first, gauge.second->GetValue());
+
+    for (const auto& histogram : m_histograms)
+        snapshot.Histograms.emplace(histogram.first, histogram.second->GetSnapshot());
+
+    return snapshot;
+}
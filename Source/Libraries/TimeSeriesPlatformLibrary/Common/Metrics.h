@@ -0,0 +1,162 @@
+//******************************************************************************************************
+//  Metrics.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __COMMON_METRICS_H
+#define __COMMON_METRICS_H
+
+#include "CommonTypes.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+
+namespace GSF
+{
+    // Monotonically increasing event counter, safe to update and read from any thread
+    class MetricCounter // NOLINT
+    {
+    private:
+        std::atomic<uint64_t> m_value;
+
+    public:
+        MetricCounter();
+
+        void Add(uint64_t count = 1ULL);
+        uint64_t GetValue() const;
+        void Reset();
+    };
+
+    typedef SharedPtr<MetricCounter> MetricCounterPtr;
+
+    // Instantaneous value, e.g., a queue depth, safe to update and read from any thread.
+    // When a sampler function is defined, value is sampled on read instead of being tracked.
+    class MetricGauge // NOLINT
+    {
+    private:
+        std::atomic<int64_t> m_value;
+        std::function<int64_t()> m_sampler;
+
+    public:
+        MetricGauge(std::function<int64_t()> sampler = nullptr);
+
+        void Add(int64_t value);
+        void SetValue(int64_t value);
+        int64_t GetValue() const;
+    };
+
+    typedef SharedPtr<MetricGauge> MetricGaugePtr;
+
+    // Point-in-time copy of histogram state
+    struct MetricHistogramSnapshot
+    {
+        uint64_t Count;
+        uint64_t Sum;
+        uint64_t Maximum;
+        std::vector<uint64_t> BucketCounts;
+
+        MetricHistogramSnapshot();
+
+        // Gets mean of recorded values
+        float64_t GetMean() const;
+
+        // Gets upper bound of the bucket that contains the specified percentile, e.g., 0.99
+        uint64_t GetPercentile(float64_t percentile) const;
+    };
+
+    // Histogram of durations, in microseconds, recorded into fixed buckets with
+    // a 1-2-5 progression from 1 microsecond to 1 second. Recording is lock-free.
+    class MetricHistogram // NOLINT
+    {
+    public:
+        static constexpr const size_t BucketCount = 20;
+
+    private:
+        std::array<std::atomic<uint64_t>, BucketCount> m_buckets;
+        std::atomic<uint64_t> m_sum;
+        std::atomic<uint64_t> m_maximum;
+
+    public:
+        MetricHistogram();
+
+        void Record(uint64_t microseconds);
+        MetricHistogramSnapshot GetSnapshot() const;
+        void Reset();
+
+        // Gets inclusive upper bound of each bucket, last bucket is unbounded
+        static const std::array<uint64_t, BucketCount>& GetBucketBounds();
+    };
+
+    typedef SharedPtr<MetricHistogram> MetricHistogramPtr;
+
+    // Records elapsed time of a scope into a histogram
+    class MetricTimer // NOLINT
+    {
+    private:
+        MetricHistogram& m_histogram;
+        const std::chrono::steady_clock::time_point m_startTime;
+
+    public:
+        MetricTimer(MetricHistogram& histogram);
+        ~MetricTimer();
+    };
+
+    // Point-in-time copy of all metrics in a registry
+    struct MetricsSnapshot
+    {
+        int64_t Timestamp;
+        std::map<std::string, uint64_t> Counters;
+        std::map<std::string, int64_t> Gauges;
+        std::map<std::string, MetricHistogramSnapshot> Histograms;
+
+        MetricsSnapshot();
+
+        // Flattens snapshot into named values. Histograms are expanded into
+        // Count, Mean, P50, P99 and Max values, e.g., "EncodeTime.P99".
+        std::vector<std::pair<std::string, float64_t>> GetValues() const;
+    };
+
+    // Named collection of metrics. Metrics are created on first request and never removed,
+    // so callers should resolve metrics once and update the returned instances directly.
+    class MetricsRegistry // NOLINT
+    {
+    private:
+        std::map<std::string, MetricCounterPtr> m_counters;
+        std::map<std::string, MetricGaugePtr> m_gauges;
+        std::map<std::string, MetricHistogramPtr> m_histograms;
+        mutable GSF::Mutex m_lock;
+
+    public:
+        MetricCounterPtr GetCounter(const std::string& name);
+        MetricGaugePtr GetGauge(const std::string& name);
+        MetricHistogramPtr GetHistogram(const std::string& name);
+
+        // Defines a gauge whose value is sampled from the provided function when read
+        MetricGaugePtr RegisterGauge(const std::string& name, std::function<int64_t()> sampler);
+
+        MetricsSnapshot GetSnapshot() const;
+    };
+
+    typedef SharedPtr<MetricsRegistry> MetricsRegistryPtr;
+}
+
+#endif
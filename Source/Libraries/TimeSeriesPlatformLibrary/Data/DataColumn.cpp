@@ -24,9 +24,12 @@
 #include "DataColumn.h"
 #include "DataTable.h"
 #include "DataSet.h"
+#include "../FilterExpressions/FilterExpressionParser.h"
 
 using namespace std;
+using namespace GSF;
 using namespace GSF::Data;
+using namespace GSF::FilterExpressions;
 
 const char* GSF::Data::DataTypeAcronym[] =
 {
@@ -60,7 +63,9 @@ DataColumn::DataColumn(DataTablePtr parent, string name, DataType type, string e
     m_type(type),
     m_expression(std::move(expression)),
     m_computed(!m_expression.empty()),
-    m_index(-1)
+    m_index(-1),
+    m_sourceColumnsResolved(false),
+    m_resolvingSourceColumns(false)
 {
     if (m_parent == nullptr)
         throw DataSetException("DataTable parent is null");
@@ -97,3 +102,154 @@ int32_t DataColumn::Index() const
 {
     return m_index;
 }
+
+const ExpressionTreePtr& DataColumn::CompiledExpression()
+{
+    ScopeLock lock(m_compiledExpressionLock);
+
+    if (m_computed && m_compiledExpression == nullptr)
+    {
+        FilterExpressionParserPtr parser = NewSharedPtr<FilterExpressionParser>(m_expression);
+
+        parser->SetDataSet(m_parent->Parent());
+        parser->SetPrimaryTableName(m_parent->Name());
+        parser->SetTrackFilteredSignalIDs(false);
+        parser->SetTrackFilteredRows(false);
+
+        const auto expressionTrees = parser->GetExpressionTrees();
+
+        if (expressionTrees.empty())
+            throw DataSetException("Expression defined for computed DataColumn \"" + m_name + " for table \"" + m_parent->Name() + "\" cannot produce a value");
+
+        m_compiledExpression = expressionTrees[0];
+    }
+
+    return m_compiledExpression;
+}
+
+ValueExpressionPtr DataColumn::EvaluateExpression(const DataRowPtr& row)
+{
+    ExpressionTreePtr expressionTree = nullptr;
+
+    {
+        ScopeLock lock(m_evaluationTreesLock);
+
+        if (!m_evaluationTrees.empty())
+        {
+            expressionTree = std::move(m_evaluationTrees.back());
+            m_evaluationTrees.pop_back();
+        }
+    }
+
+    if (expressionTree == nullptr)
+        expressionTree = CompiledExpression()->Clone();
+
+    // Tree is only returned for reuse after a successful evaluation
+    ValueExpressionPtr result = expressionTree->Evaluate(row);
+
+    ScopeLock lock(m_evaluationTreesLock);
+    m_evaluationTrees.push_back(std::move(expressionTree));
+
+    return result;
+}
+
+static void FindColumnExpressions(const ExpressionPtr& expression, vector<DataColumnPtr>& columns)
+{
+    if (expression == nullptr)
+        return;
+
+    switch (expression->Type)
+    {
+        case ExpressionType::Column:
+            columns.push_back(CastSharedPtr<ColumnExpression>(expression)->DataColumn);
+            break;
+        case ExpressionType::Unary:
+            FindColumnExpressions(CastSharedPtr<UnaryExpression>(expression)->Value, columns);
+            break;
+        case ExpressionType::InList:
+        {
+            const InListExpressionPtr inListExpression = CastSharedPtr<InListExpression>(expression);
+            FindColumnExpressions(inListExpression->Value, columns);
+
+            for (const ExpressionPtr& argument : *inListExpression->Arguments)
+                FindColumnExpressions(argument, columns);
+
+            break;
+        }
+        case ExpressionType::Function:
+            for (const ExpressionPtr& argument : *CastSharedPtr<FunctionExpression>(expression)->Arguments)
+                FindColumnExpressions(argument, columns);
+
+            break;
+        case ExpressionType::Operator:
+        {
+            const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
+            FindColumnExpressions(operatorExpression->LeftValue, columns);
+            FindColumnExpressions(operatorExpression->RightValue, columns);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+const vector<int32_t>& DataColumn::SourceColumns()
+{
+    if (!m_computed || m_sourceColumnsResolved)
+        return m_sourceColumns;
+
+    if (m_resolvingSourceColumns)
+        throw DataSetException("Expression defined for computed DataColumn \"" + m_name + "\" for table \"" + m_parent->Name() + "\" has a circular reference");
+
+    m_resolvingSourceColumns = true;
+
+    try
+    {
+        vector<DataColumnPtr> columns;
+        FindColumnExpressions(CompiledExpression()->Root, columns);
+
+        for (const DataColumnPtr& column : columns)
+        {
+            if (column->Computed())
+            {
+                const vector<int32_t>& sourceColumns = column->SourceColumns();
+                m_sourceColumns.insert(m_sourceColumns.end(), sourceColumns.begin(), sourceColumns.end());
+            }
+            else
+            {
+                m_sourceColumns.push_back(column->Index());
+            }
+        }
+    }
+    catch (...)
+    {
+        m_sourceColumns.clear();
+        m_resolvingSourceColumns = false;
+        throw;
+    }
+
+    sort(m_sourceColumns.begin(), m_sourceColumns.end());
+    m_sourceColumns.erase(unique(m_sourceColumns.begin(), m_sourceColumns.end()), m_sourceColumns.end());
+
+    m_resolvingSourceColumns = false;
+    m_sourceColumnsResolved = true;
+
+    return m_sourceColumns;
+}
+
+DataColumnHandle::DataColumnHandle() :
+    Index(-1),
+    Type(DataType::String)
+{
+}
+
+DataColumnHandle::DataColumnHandle(const int32_t index, const DataType type) :
+    Index(index),
+    Type(type)
+{
+}
+
+bool DataColumnHandle::IsValid() const
+{
+    return Index > -1;
+}
@@ -26,6 +26,16 @@
 
 #include "../Common/CommonTypes.h"
 
+namespace GSF {
+namespace FilterExpressions
+{
+    class ExpressionTree;
+    typedef GSF::SharedPtr<ExpressionTree> ExpressionTreePtr;
+
+    class ValueExpression;
+    typedef GSF::SharedPtr<ValueExpression> ValueExpressionPtr;
+}}
+
 namespace GSF {
 namespace Data
 {
@@ -54,6 +64,9 @@ namespace Data
     class DataTable;
     typedef GSF::SharedPtr<DataTable> DataTablePtr;
 
+    class DataRow;
+    typedef GSF::SharedPtr<DataRow> DataRowPtr;
+
     class DataColumn;
     typedef GSF::SharedPtr<DataColumn> DataColumnPtr;
 
@@ -66,6 +79,13 @@ namespace Data
         std::string m_expression;
         bool m_computed;
         int32_t m_index;
+        GSF::FilterExpressions::ExpressionTreePtr m_compiledExpression;
+        GSF::Mutex m_compiledExpressionLock;
+        std::vector<GSF::FilterExpressions::ExpressionTreePtr> m_evaluationTrees;
+        GSF::Mutex m_evaluationTreesLock;
+        std::vector<int32_t> m_sourceColumns;
+        bool m_sourceColumnsResolved;
+        bool m_resolvingSourceColumns;
 
     public:
         DataColumn(DataTablePtr parent, std::string name, DataType type, std::string expression = std::string{});
@@ -83,10 +103,36 @@ namespace Data
 
         int32_t Index() const;
 
+        // Gets expression tree of a computed column, null for stored columns. Expression is parsed once, on
+        // first use, and the tree is shared by all rows of the table. Shared tree is not evaluated directly
+        // since evaluation state is kept in tree, use EvaluateExpression.
+        const GSF::FilterExpressions::ExpressionTreePtr& CompiledExpression();
+
+        // Evaluates computed column expression for row. Rows can be evaluated on multiple threads at once,
+        // each concurrent evaluation uses its own copy of expression tree and copies are reused.
+        GSF::FilterExpressions::ValueExpressionPtr EvaluateExpression(const DataRowPtr& row);
+
+        // Gets sorted indexes of stored columns that a computed column value depends on, directly or through
+        // other computed columns
+        const std::vector<int32_t>& SourceColumns();
+
         static const DataColumnPtr NullPtr;
 
         friend class DataTable;
     };
+
+    // Column index and type resolved once from a DataTable for repeated row access without name lookups.
+    // Handles for columns that do not exist in a table are invalid, values read with them are null.
+    struct DataColumnHandle
+    {
+        int32_t Index;
+        DataType Type;
+
+        DataColumnHandle();
+        DataColumnHandle(int32_t index, DataType type);
+
+        bool IsValid() const;
+    };
 }}
 
 #endif
\ No newline at end of file
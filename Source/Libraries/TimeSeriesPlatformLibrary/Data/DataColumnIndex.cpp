@@ -0,0 +1,101 @@
+//******************************************************************************************************
+//  DataColumnIndex.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "DataColumnIndex.h"
+#include "DataSet.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+
+static const datetime_t DateTimeEpoch(boost::gregorian::date(1970, 1, 1));
+
+size_t DateTimeHash::operator()(const datetime_t& value) const
+{
+    if (value.is_special())
+        return 0;
+
+    return hash<int64_t>()((value - DateTimeEpoch).ticks());
+}
+
+size_t DecimalHash::operator()(const decimal_t& value) const
+{
+    // Equal decimals convert to equal doubles, so hash stays consistent with decimal equality
+    return hash<float64_t>()(value.convert_to<float64_t>());
+}
+
+DataColumnIndex::DataColumnIndex(DataColumnIndexType type) :
+    m_type(type)
+{
+}
+
+DataColumnIndex::~DataColumnIndex() = default;
+
+DataColumnIndexType DataColumnIndex::Type() const
+{
+    return m_type;
+}
+
+bool DataColumnIndex::IsUnique() const
+{
+    return m_type == DataColumnIndexType::UniqueHash;
+}
+
+DataColumnIndexPtr DataColumnIndex::Create(DataType dataType, DataColumnIndexType type)
+{
+    switch (dataType)
+    {
+        case DataType::String:
+            return NewSharedPtr<TypedDataColumnIndex<string>>(type);
+        case DataType::Boolean:
+            return NewSharedPtr<TypedDataColumnIndex<bool>>(type);
+        case DataType::DateTime:
+            return NewSharedPtr<TypedDataColumnIndex<datetime_t>>(type);
+        case DataType::Single:
+            return NewSharedPtr<TypedDataColumnIndex<float32_t>>(type);
+        case DataType::Double:
+            return NewSharedPtr<TypedDataColumnIndex<float64_t>>(type);
+        case DataType::Decimal:
+            return NewSharedPtr<TypedDataColumnIndex<decimal_t>>(type);
+        case DataType::Guid:
+            return NewSharedPtr<TypedDataColumnIndex<Guid>>(type);
+        case DataType::Int8:
+            return NewSharedPtr<TypedDataColumnIndex<int8_t>>(type);
+        case DataType::Int16:
+            return NewSharedPtr<TypedDataColumnIndex<int16_t>>(type);
+        case DataType::Int32:
+            return NewSharedPtr<TypedDataColumnIndex<int32_t>>(type);
+        case DataType::Int64:
+            return NewSharedPtr<TypedDataColumnIndex<int64_t>>(type);
+        case DataType::UInt8:
+            return NewSharedPtr<TypedDataColumnIndex<uint8_t>>(type);
+        case DataType::UInt16:
+            return NewSharedPtr<TypedDataColumnIndex<uint16_t>>(type);
+        case DataType::UInt32:
+            return NewSharedPtr<TypedDataColumnIndex<uint32_t>>(type);
+        case DataType::UInt64:
+            return NewSharedPtr<TypedDataColumnIndex<uint64_t>>(type);
+        default:
+            throw DataSetException("Unexpected column data type encountered");
+    }
+}
@@ -0,0 +1,276 @@
+//******************************************************************************************************
+//  DataColumnIndex.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __DATA_COLUMN_INDEX_H
+#define __DATA_COLUMN_INDEX_H
+
+#include "../Common/CommonTypes.h"
+#include "DataColumnStorage.h"
+
+namespace GSF {
+namespace Data
+{
+    enum class DataColumnIndexType
+    {
+        // Hash index for equality lookups
+        Hash,
+        // Hash index for equality lookups that rejects duplicate values
+        UniqueHash,
+        // Sorted index for equality and range lookups
+        Ordered
+    };
+
+    struct DateTimeHash
+    {
+        size_t operator()(const GSF::datetime_t& value) const;
+    };
+
+    struct DecimalHash
+    {
+        size_t operator()(const GSF::decimal_t& value) const;
+    };
+
+    // Defines column data type, storage and key comparison for values of a column type. String keys
+    // are case-insensitive, matching string equality in filter expressions.
+    template<class T>
+    struct DataColumnKey;
+
+    template<class T>
+    struct DataColumnKeyBase
+    {
+        typedef TypedDataColumnStorage<T> Storage;
+        typedef std::hash<T> Hash;
+        typedef std::equal_to<T> Equal;
+        typedef std::less<T> Less;
+    };
+
+    template<> struct DataColumnKey<std::string>
+    {
+        typedef StringDataColumnStorage Storage;
+        typedef GSF::StringHash Hash;
+        typedef GSF::StringEqual Equal;
+        typedef GSF::StringComparer Less;
+        static constexpr DataType Type = DataType::String;
+    };
+
+    template<> struct DataColumnKey<bool> : DataColumnKeyBase<bool> { static constexpr DataType Type = DataType::Boolean; };
+    template<> struct DataColumnKey<GSF::datetime_t> : DataColumnKeyBase<GSF::datetime_t> { typedef DateTimeHash Hash; static constexpr DataType Type = DataType::DateTime; };
+    template<> struct DataColumnKey<GSF::float32_t> : DataColumnKeyBase<GSF::float32_t> { static constexpr DataType Type = DataType::Single; };
+    template<> struct DataColumnKey<GSF::float64_t> : DataColumnKeyBase<GSF::float64_t> { static constexpr DataType Type = DataType::Double; };
+    template<> struct DataColumnKey<GSF::decimal_t> : DataColumnKeyBase<GSF::decimal_t> { typedef DecimalHash Hash; static constexpr DataType Type = DataType::Decimal; };
+    template<> struct DataColumnKey<GSF::Guid> : DataColumnKeyBase<GSF::Guid> { static constexpr DataType Type = DataType::Guid; };
+    template<> struct DataColumnKey<int8_t> : DataColumnKeyBase<int8_t> { static constexpr DataType Type = DataType::Int8; };
+    template<> struct DataColumnKey<int16_t> : DataColumnKeyBase<int16_t> { static constexpr DataType Type = DataType::Int16; };
+    template<> struct DataColumnKey<int32_t> : DataColumnKeyBase<int32_t> { static constexpr DataType Type = DataType::Int32; };
+    template<> struct DataColumnKey<int64_t> : DataColumnKeyBase<int64_t> { static constexpr DataType Type = DataType::Int64; };
+    template<> struct DataColumnKey<uint8_t> : DataColumnKeyBase<uint8_t> { static constexpr DataType Type = DataType::UInt8; };
+    template<> struct DataColumnKey<uint16_t> : DataColumnKeyBase<uint16_t> { static constexpr DataType Type = DataType::UInt16; };
+    template<> struct DataColumnKey<uint32_t> : DataColumnKeyBase<uint32_t> { static constexpr DataType Type = DataType::UInt32; };
+    template<> struct DataColumnKey<uint64_t> : DataColumnKeyBase<uint64_t> { static constexpr DataType Type = DataType::UInt64; };
+
+    class DataColumnIndex;
+    typedef GSF::SharedPtr<DataColumnIndex> DataColumnIndexPtr;
+
+    // Index of the rows of a DataTable by the values of a column. Entries map values to row positions
+    // within the table, null values are not indexed.
+    class DataColumnIndex // NOLINT
+    {
+    private:
+        DataColumnIndexType m_type;
+
+    public:
+        DataColumnIndex(DataColumnIndexType type);
+        virtual ~DataColumnIndex();
+
+        DataColumnIndexType Type() const;
+
+        bool IsUnique() const;
+
+        // Determines if value at storage slot can be added without violating uniqueness
+        virtual bool CanAdd(const DataColumnStorage& storage, int32_t slot) const = 0;
+
+        virtual void Add(const DataColumnStorage& storage, int32_t slot, int32_t position) = 0;
+        virtual void Remove(const DataColumnStorage& storage, int32_t slot, int32_t position) = 0;
+
+        // Gets positions of indexed rows ordered by value, rows with equal values are in row order.
+        // Only ordered indexes keep entries sorted, other index types add no positions.
+        virtual void GetOrderedPositions(bool ascending, std::vector<int32_t>& positions) const = 0;
+
+        // Creates index for values of the specified data type
+        static DataColumnIndexPtr Create(DataType dataType, DataColumnIndexType type);
+    };
+
+    template<class T>
+    class TypedDataColumnIndex : public DataColumnIndex // NOLINT
+    {
+    private:
+        typedef DataColumnKey<T> Key;
+        typedef typename Key::Storage Storage;
+
+        std::unordered_multimap<T, int32_t, typename Key::Hash, typename Key::Equal> m_hashEntries;
+        std::multimap<T, int32_t, typename Key::Less> m_orderedEntries;
+
+        template<class TEntries>
+        static void RemoveEntry(TEntries& entries, const T& value, int32_t position)
+        {
+            const auto range = entries.equal_range(value);
+
+            for (auto iterator = range.first; iterator != range.second; ++iterator)
+            {
+                if (iterator->second == position)
+                {
+                    entries.erase(iterator);
+                    return;
+                }
+            }
+        }
+
+    public:
+        TypedDataColumnIndex(DataColumnIndexType type) : DataColumnIndex(type)
+        {
+        }
+
+        bool Contains(const T& value) const
+        {
+            if (Type() == DataColumnIndexType::Ordered)
+                return m_orderedEntries.find(value) != m_orderedEntries.end();
+
+            return m_hashEntries.find(value) != m_hashEntries.end();
+        }
+
+        bool CanAdd(const DataColumnStorage& storage, int32_t slot) const override
+        {
+            return !IsUnique() || storage.IsNull(slot) || !Contains(static_cast<const Storage&>(storage).GetValue(slot));
+        }
+
+        void Add(const DataColumnStorage& storage, int32_t slot, int32_t position) override
+        {
+            if (storage.IsNull(slot))
+                return;
+
+            const T value = static_cast<const Storage&>(storage).GetValue(slot);
+
+            if (Type() == DataColumnIndexType::Ordered)
+                m_orderedEntries.emplace(value, position);
+            else
+                m_hashEntries.emplace(value, position);
+        }
+
+        void Remove(const DataColumnStorage& storage, int32_t slot, int32_t position) override
+        {
+            if (storage.IsNull(slot))
+                return;
+
+            const T value = static_cast<const Storage&>(storage).GetValue(slot);
+
+            if (Type() == DataColumnIndexType::Ordered)
+                RemoveEntry(m_orderedEntries, value, position);
+            else
+                RemoveEntry(m_hashEntries, value, position);
+        }
+
+        void GetOrderedPositions(bool ascending, std::vector<int32_t>& positions) const override
+        {
+            auto groupBegin = ascending ? m_orderedEntries.begin() : m_orderedEntries.end();
+
+            // Entries with equal values are grouped, each group is visited in value order then sorted by position
+            while (ascending ? groupBegin != m_orderedEntries.end() : groupBegin != m_orderedEntries.begin())
+            {
+                auto groupEnd = groupBegin;
+
+                if (ascending)
+                    groupEnd = m_orderedEntries.upper_bound(groupBegin->first);
+                else
+                    groupBegin = m_orderedEntries.lower_bound(std::prev(groupEnd)->first);
+
+                const size_t start = positions.size();
+
+                for (auto iterator = groupBegin; iterator != groupEnd; ++iterator)
+                    positions.push_back(iterator->second);
+
+                std::sort(positions.begin() + start, positions.end());
+
+                if (ascending)
+                    groupBegin = groupEnd;
+            }
+        }
+
+        // Gets positions of rows matching value, in row order
+        void Find(const T& value, std::vector<int32_t>& positions) const
+        {
+            const size_t start = positions.size();
+
+            if (Type() == DataColumnIndexType::Ordered)
+            {
+                const auto range = m_orderedEntries.equal_range(value);
+
+                for (auto iterator = range.first; iterator != range.second; ++iterator)
+                    positions.push_back(iterator->second);
+            }
+            else
+            {
+                const auto range = m_hashEntries.equal_range(value);
+
+                for (auto iterator = range.first; iterator != range.second; ++iterator)
+                    positions.push_back(iterator->second);
+            }
+
+            std::sort(positions.begin() + start, positions.end());
+        }
+
+        // Gets positions of rows with values within range, ordered by value, null bounds are open
+        void FindRange(const T* lower, bool lowerInclusive, const T* upper, bool upperInclusive, std::vector<int32_t>& positions) const
+        {
+            auto begin = m_orderedEntries.begin();
+            auto end = m_orderedEntries.end();
+
+            if (lower != nullptr)
+                begin = lowerInclusive ? m_orderedEntries.lower_bound(*lower) : m_orderedEntries.upper_bound(*lower);
+
+            if (upper != nullptr)
+                end = upperInclusive ? m_orderedEntries.upper_bound(*upper) : m_orderedEntries.lower_bound(*upper);
+
+            // Range is empty when bounds are reversed, or equal with an exclusive bound, in which case begin follows end
+            if (lower != nullptr && upper != nullptr)
+            {
+                const typename Key::Less less;
+
+                if (less(*upper, *lower) || (!less(*lower, *upper) && !(lowerInclusive && upperInclusive)))
+                    return;
+            }
+
+            for (auto iterator = begin; iterator != end; ++iterator)
+                positions.push_back(iterator->second);
+        }
+
+        // Gets positions of rows with string values that start with prefix, case-insensitive, ordered by value.
+        // Values sharing a prefix are adjacent in the ordered index so only matching entries are visited.
+        void FindPrefix(const std::string& prefix, std::vector<int32_t>& positions) const
+        {
+            for (auto iterator = m_orderedEntries.lower_bound(prefix); iterator != m_orderedEntries.end() && GSF::StartsWith(iterator->first, prefix); ++iterator)
+                positions.push_back(iterator->second);
+        }
+    };
+}}
+
+#endif
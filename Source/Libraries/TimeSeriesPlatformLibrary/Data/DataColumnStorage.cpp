@@ -0,0 +1,272 @@
+//******************************************************************************************************
+//  DataColumnStorage.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "DataColumnStorage.h"
+#include "DataSet.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+
+// Values longer than half of a chunk are stored in a chunk of their own
+static constexpr uint32_t StringChunkSize = 64 * 1024;
+static constexpr uint32_t NoChunk = UINT32_MAX;
+
+DataColumnStorage::DataColumnStorage() :
+    m_count(0)
+{
+}
+
+DataColumnStorage::~DataColumnStorage() = default;
+
+int32_t DataColumnStorage::Count() const
+{
+    return m_count;
+}
+
+void DataColumnStorage::Resize(int32_t count)
+{
+    m_valueMask.resize((static_cast<size_t>(count) + 63) / 64);
+
+    // Clear any value bits beyond new count so that slots are null if count grows again
+    if (count < m_count && count % 64 != 0)
+        m_valueMask[count / 64] &= (1ULL << (count % 64)) - 1ULL;
+
+    m_count = count;
+}
+
+bool DataColumnStorage::IsNull(int32_t index) const
+{
+    return (m_valueMask[index / 64] & 1ULL << (index % 64)) == 0ULL;
+}
+
+uint64_t DataColumnStorage::ValueBits(int32_t word) const
+{
+    return m_valueMask[word];
+}
+
+void DataColumnStorage::SetNull(int32_t index)
+{
+    m_valueMask[index / 64] &= ~(1ULL << (index % 64));
+}
+
+void DataColumnStorage::SetHasValue(int32_t index)
+{
+    m_valueMask[index / 64] |= 1ULL << (index % 64);
+}
+
+DataColumnStoragePtr DataColumnStorage::Create(DataType type)
+{
+    switch (type)
+    {
+        case DataType::String:
+            return NewSharedPtr<StringDataColumnStorage>();
+        case DataType::Boolean:
+            return NewSharedPtr<TypedDataColumnStorage<bool>>();
+        case DataType::DateTime:
+            return NewSharedPtr<TypedDataColumnStorage<datetime_t>>();
+        case DataType::Single:
+            return NewSharedPtr<TypedDataColumnStorage<float32_t>>();
+        case DataType::Double:
+            return NewSharedPtr<TypedDataColumnStorage<float64_t>>();
+        case DataType::Decimal:
+            return NewSharedPtr<TypedDataColumnStorage<decimal_t>>();
+        case DataType::Guid:
+            return NewSharedPtr<TypedDataColumnStorage<Guid>>();
+        case DataType::Int8:
+            return NewSharedPtr<TypedDataColumnStorage<int8_t>>();
+        case DataType::Int16:
+            return NewSharedPtr<TypedDataColumnStorage<int16_t>>();
+        case DataType::Int32:
+            return NewSharedPtr<TypedDataColumnStorage<int32_t>>();
+        case DataType::Int64:
+            return NewSharedPtr<TypedDataColumnStorage<int64_t>>();
+        case DataType::UInt8:
+            return NewSharedPtr<TypedDataColumnStorage<uint8_t>>();
+        case DataType::UInt16:
+            return NewSharedPtr<TypedDataColumnStorage<uint16_t>>();
+        case DataType::UInt32:
+            return NewSharedPtr<TypedDataColumnStorage<uint32_t>>();
+        case DataType::UInt64:
+            return NewSharedPtr<TypedDataColumnStorage<uint64_t>>();
+        default:
+            throw DataSetException("Unexpected column data type encountered");
+    }
+}
+
+StringDataColumnStorage::StringDataColumnStorage() :
+    m_currentChunk(NoChunk)
+{
+}
+
+uint32_t StringDataColumnStorage::NewChunk(const uint32_t capacity)
+{
+    uint32_t chunkIndex;
+
+    if (m_freeChunks.empty())
+    {
+        chunkIndex = ConvertUInt32(m_chunks.size());
+        m_chunks.emplace_back();
+    }
+    else
+    {
+        chunkIndex = m_freeChunks.back();
+        m_freeChunks.pop_back();
+    }
+
+    Chunk& chunk = m_chunks[chunkIndex];
+    chunk.Data.reset(new char[capacity]);
+    chunk.Capacity = capacity;
+    chunk.Size = 0;
+    chunk.UsedLength = 0;
+
+    return chunkIndex;
+}
+
+void StringDataColumnStorage::ReleaseValue(int32_t index)
+{
+    const uint32_t chunkIndex = m_chunkIndexes[index];
+
+    if (IsNull(index) || chunkIndex == NoChunk)
+        return;
+
+    Chunk& chunk = m_chunks[chunkIndex];
+    chunk.UsedLength -= m_lengths[index];
+    m_chunkIndexes[index] = NoChunk;
+
+    if (chunk.UsedLength > 0)
+        return;
+
+    // Space of current chunk is reused once its values are all released, other chunks are freed
+    if (chunkIndex == m_currentChunk)
+    {
+        chunk.Size = 0;
+    }
+    else
+    {
+        chunk.Data.reset();
+        m_freeChunks.push_back(chunkIndex);
+    }
+}
+
+void StringDataColumnStorage::Resize(int32_t count)
+{
+    for (int32_t i = count; i < m_count; i++)
+        ReleaseValue(i);
+
+    DataColumnStorage::Resize(count);
+    m_chunkIndexes.resize(count, NoChunk);
+    m_offsets.resize(count);
+    m_lengths.resize(count);
+}
+
+void StringDataColumnStorage::SetNull(int32_t index)
+{
+    ReleaseValue(index);
+    DataColumnStorage::SetNull(index);
+}
+
+const char* StringDataColumnStorage::GetData(int32_t index) const
+{
+    const uint32_t chunkIndex = m_chunkIndexes[index];
+
+    if (IsNull(index) || chunkIndex == NoChunk)
+        return "";
+
+    return m_chunks[chunkIndex].Data.get() + m_offsets[index];
+}
+
+uint32_t StringDataColumnStorage::GetLength(int32_t index) const
+{
+    return IsNull(index) ? 0U : m_lengths[index];
+}
+
+string StringDataColumnStorage::GetValue(int32_t index) const
+{
+    return string(GetData(index), GetLength(index));
+}
+
+void StringDataColumnStorage::CopyValue(const DataColumnStorage& source, int32_t sourceIndex, int32_t index)
+{
+    if (source.IsNull(sourceIndex))
+    {
+        SetNull(index);
+        return;
+    }
+
+    if (&source == this && sourceIndex == index)
+        return;
+
+    // Source characters are not moved by assignment, even when copied within the same column
+    const StringDataColumnStorage& storage = static_cast<const StringDataColumnStorage&>(source);
+    SetValue(index, string_view(storage.GetData(sourceIndex), storage.GetLength(sourceIndex)));
+}
+
+void StringDataColumnStorage::SetValue(int32_t index, string_view value)
+{
+    const uint32_t length = ConvertUInt32(value.size());
+
+    // Values that fit within the space of the existing value are replaced in place
+    if (!IsNull(index) && length > 0 && length <= m_lengths[index])
+    {
+        copy(value.begin(), value.end(), m_chunks[m_chunkIndexes[index]].Data.get() + m_offsets[index]);
+        m_chunks[m_chunkIndexes[index]].UsedLength -= m_lengths[index] - length;
+        m_lengths[index] = length;
+        return;
+    }
+
+    ReleaseValue(index);
+
+    uint32_t chunkIndex = NoChunk;
+    uint32_t offset = 0;
+
+    if (length > StringChunkSize / 2)
+    {
+        chunkIndex = NewChunk(length);
+    }
+    else if (length > 0)
+    {
+        if (m_currentChunk == NoChunk || m_chunks[m_currentChunk].Capacity - m_chunks[m_currentChunk].Size < length)
+        {
+            // Current chunk is left to be freed when its last value is released
+            m_currentChunk = NewChunk(StringChunkSize);
+        }
+
+        chunkIndex = m_currentChunk;
+    }
+
+    if (chunkIndex != NoChunk)
+    {
+        Chunk& chunk = m_chunks[chunkIndex];
+        offset = chunk.Size;
+        copy(value.begin(), value.end(), chunk.Data.get() + offset);
+        chunk.Size += length;
+        chunk.UsedLength += length;
+    }
+
+    m_chunkIndexes[index] = chunkIndex;
+    m_offsets[index] = offset;
+    m_lengths[index] = length;
+
+    SetHasValue(index);
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+//******************************************************************************************************
+//  DataColumnStorage.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __DATA_COLUMN_STORAGE_H
+#define __DATA_COLUMN_STORAGE_H
+
+#include "../Common/CommonTypes.h"
+#include "DataColumn.h"
+#include <string_view>
+
+namespace GSF {
+namespace Data
+{
+    class DataColumnStorage;
+    typedef GSF::SharedPtr<DataColumnStorage> DataColumnStoragePtr;
+
+    // Contiguous storage of the values of a DataTable column, one slot per row. Assigned values are
+    // tracked with a bitmap so that nullable values do not need separate allocations.
+    class DataColumnStorage // NOLINT
+    {
+    private:
+        std::vector<uint64_t> m_valueMask;
+
+    protected:
+        int32_t m_count;
+
+        void SetHasValue(int32_t index);
+
+    public:
+        DataColumnStorage();
+        virtual ~DataColumnStorage();
+
+        int32_t Count() const;
+
+        // Sets number of value slots, new slots are null
+        virtual void Resize(int32_t count);
+
+        bool IsNull(int32_t index) const;
+        virtual void SetNull(int32_t index);
+
+        // Gets assigned value bits of the 64 slots starting at slot word * 64, bits of null slots are clear
+        uint64_t ValueBits(int32_t word) const;
+
+        // Copies value from storage of the same data type
+        virtual void CopyValue(const DataColumnStorage& source, int32_t sourceIndex, int32_t index) = 0;
+
+        // Creates storage for values of the specified data type
+        static DataColumnStoragePtr Create(DataType type);
+    };
+
+    template<class T>
+    class TypedDataColumnStorage : public DataColumnStorage // NOLINT
+    {
+    private:
+        std::vector<T> m_values;
+
+    public:
+        void Resize(int32_t count) override
+        {
+            DataColumnStorage::Resize(count);
+            m_values.resize(count);
+        }
+
+        T GetValue(int32_t index) const
+        {
+            return m_values[index];
+        }
+
+        void SetValue(int32_t index, const T& value)
+        {
+            m_values[index] = value;
+            SetHasValue(index);
+        }
+
+        void CopyValue(const DataColumnStorage& source, int32_t sourceIndex, int32_t index) override
+        {
+            if (source.IsNull(sourceIndex))
+                SetNull(index);
+            else
+                SetValue(index, static_cast<const TypedDataColumnStorage&>(source).m_values[sourceIndex]);
+        }
+    };
+
+    // String values are packed into fixed size character chunks that are never moved or compacted, so
+    // value characters stay in place while other values in the column are assigned. Replaced values leave
+    // unused space in their chunk, a chunk is released once none of its values are in use.
+    class StringDataColumnStorage : public DataColumnStorage // NOLINT
+    {
+    private:
+        struct Chunk
+        {
+            std::unique_ptr<char[]> Data;
+            uint32_t Capacity;
+            uint32_t Size;
+            uint32_t UsedLength;
+        };
+
+        std::vector<Chunk> m_chunks;
+        std::vector<uint32_t> m_freeChunks;
+        uint32_t m_currentChunk;
+        std::vector<uint32_t> m_chunkIndexes;
+        std::vector<uint32_t> m_offsets;
+        std::vector<uint32_t> m_lengths;
+
+        uint32_t NewChunk(uint32_t capacity);
+        void ReleaseValue(int32_t index);
+
+    public:
+        StringDataColumnStorage();
+
+        void Resize(int32_t count) override;
+
+        void SetNull(int32_t index) override;
+
+        void CopyValue(const DataColumnStorage& source, int32_t sourceIndex, int32_t index) override;
+
+        // Pointer to value characters, valid until value at index is assigned or set to null
+        const char* GetData(int32_t index) const;
+        uint32_t GetLength(int32_t index) const;
+
+        std::string GetValue(int32_t index) const;
+        void SetValue(int32_t index, std::string_view value);
+    };
+}}
+
+#endif
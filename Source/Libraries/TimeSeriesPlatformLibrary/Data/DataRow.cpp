@@ -26,7 +26,7 @@
 #include "DataRow.h"
 #include "DataTable.h"
 #include "DataSet.h"
-#include "../FilterExpressions/FilterExpressionParser.h"
+#include "../FilterExpressions/ExpressionTree.h"
 
 using namespace std;
 using namespace GSF;
@@ -37,26 +37,19 @@ const DataRowPtr DataRow::NullPtr = nullptr;
 
 DataRow::DataRow(DataTablePtr parent) :
     m_parent(std::move(parent)),
-    m_values(m_parent->ColumnCount())
+    m_index(-1)
 {
     if (m_parent == nullptr)
         throw DataSetException("DataTable parent is null");
 
-    for (uint32_t i = 0; i < m_values.size(); i++)
-        m_values[i] = nullptr;
+    m_index = m_parent->AllocateRowStorage();
 }
 
 DataRow::~DataRow()
 {
-    for (uint32_t i = 0; i < m_values.size(); i++)
-    {
-        const DataColumnPtr column = m_parent->Column(i);
-
-        if (column != nullptr && column->Computed())
-            delete static_cast<FilterExpressionParser*>(m_values[i]);
-        else
-            free(m_values[i]);
-    }
+    // Added rows are owned by table, so only rows that were never added release their storage
+    if (m_parent->m_rowPositions[m_index] < 0)
+        m_parent->ReleaseRowStorage(m_index);
 }
 
 int32_t DataRow::GetColumnIndex(const string& columnName) const
@@ -69,21 +62,22 @@ int32_t DataRow::GetColumnIndex(const string& columnName) const
     return column->Index();
 }
 
-DataColumnPtr DataRow::ValidateColumnType(const int32_t columnIndex, DataType targetType, bool read) const
+static void ThrowColumnTypeMismatch(const DataColumnPtr& column, DataType targetType, bool read)
 {
-    const DataColumnPtr column = m_parent->Column(columnIndex);
+    stringstream errorMessageStream;
+    errorMessageStream << "Cannot" << (read ? " read " : " assign ") << "\"" << EnumName(targetType)  << "\" value" << (read ? " from " : " to ") << "DataColumn \"" << column->Name() << "\" for table \"" << column->Parent()->Name() << "\", column data type is \"" << EnumName(column->Type()) << "\"";
+    throw DataSetException(errorMessageStream.str());
+}
+
+const DataColumnPtr& DataRow::ValidateColumnType(const int32_t columnIndex, DataType targetType, bool read) const
+{
+    const DataColumnPtr& column = m_parent->Column(columnIndex);
 
     if (column == nullptr)
         throw DataSetException("Column index " + ToString(columnIndex) + " is out of range for table \"" + m_parent->Name() + "\"");
 
-    const DataType columnType = column->Type();
-
-    if (columnType != targetType)
-    {
-        stringstream errorMessageStream;
-        errorMessageStream << "Cannot" << (read ? " read " : " assign ") << "\"" << EnumName(targetType)  << "\" value" << (read ? " from " : " to ") << "DataColumn \"" << column->Name() << "\" for table \"" << m_parent->Name() << "\", column data type is \"" << EnumName(columnType) << "\"";
-        throw DataSetException(errorMessageStream.str());
-    }
+    if (column->Type() != targetType)
+        ThrowColumnTypeMismatch(column, targetType, read);
 
     if (!read && column->Computed())
         throw DataSetException("Cannot assign value to DataColumn \"" + column->Name() + " for table \"" + m_parent->Name() + "\", column is computed with an expression");
@@ -91,42 +85,25 @@ DataColumnPtr DataRow::ValidateColumnType(const int32_t columnIndex, DataType ta
     return column;
 }
 
-ExpressionTreePtr DataRow::GetExpressionTree(const DataColumnPtr& column)
+const DataColumnPtr& DataRow::ValidateColumnHandle(const DataColumnHandle& column, DataType targetType) const
 {
-    const int columnIndex = column->Index();
+    if (!column.IsValid())
+        return DataColumn::NullPtr;
 
-    if (m_values[columnIndex] == nullptr)
-    {
-        const DataTablePtr& dataTable = column->Parent();
-        FilterExpressionParser* parser = new FilterExpressionParser(column->Expression());
-
-        parser->SetDataSet(dataTable->Parent());
-        parser->SetPrimaryTableName(dataTable->Name());
-        parser->SetTrackFilteredSignalIDs(false);
-        parser->SetTrackFilteredRows(false);
-
-        const auto expressionTrees = parser->GetExpressionTrees();
-
-        if (expressionTrees.empty())
-        {
-            delete parser;
-            throw DataSetException("Expression defined for computed DataColumn \"" + column->Name() + " for table \"" + m_parent->Name() + "\" cannot produce a value");
-        }
-
-        m_values[columnIndex] = parser;
-
-        return expressionTrees[0];
-    }
+    return ValidateColumnType(column.Index, targetType, true);
+}
 
-   return static_cast<FilterExpressionParser*>(m_values[columnIndex])->GetExpressionTrees()[0];
+template<class T>
+T& DataRow::GetStorage(const int32_t columnIndex) const
+{
+    return static_cast<T&>(*m_parent->m_columnStorage[columnIndex]);
 }
 
-Object DataRow::GetComputedValue(const DataColumnPtr& column, DataType targetType)
+Object DataRow::EvaluateComputedValue(const DataColumnPtr& column, DataType targetType)
 {
     try
     {
-        const ExpressionTreePtr& expressionTree = GetExpressionTree(column);
-        const ValueExpressionPtr& sourceValue = expressionTree->Evaluate(shared_from_this());
+        const ValueExpressionPtr sourceValue = column->EvaluateExpression(shared_from_this());
 
         switch (sourceValue->ValueType)
         {
@@ -443,20 +420,49 @@ Object DataRow::GetComputedValue(const DataColumnPtr& column, DataType targetTyp
     }
 }
 
+template<class T>
+T DataRow::GetComputedValue(const DataColumnPtr& column, DataType targetType)
+{
+    const DataColumnStoragePtr& values = m_parent->m_computedStorage[column->Index()];
+
+    if (values == nullptr)
+        return Cast<T>(EvaluateComputedValue(column, targetType));
+
+    typename DataColumnKey<T>::Storage& storage = static_cast<typename DataColumnKey<T>::Storage&>(*values);
+
+    // Null marks a value that has not been computed since row was created or its source values changed
+    {
+        ReaderLock readLock(m_parent->m_computedValuesLock);
+
+        if (!storage.IsNull(m_index))
+            return storage.GetValue(m_index);
+    }
+
+    // Value is computed outside of lock, so rows can be evaluated on multiple threads at once
+    const T value = Cast<T>(EvaluateComputedValue(column, targetType));
+
+    WriterLock writeLock(m_parent->m_computedValuesLock);
+
+    if (storage.IsNull(m_index))
+        storage.SetValue(m_index, value);
+
+    return storage.GetValue(m_index);
+}
+
 template<class T>
 Nullable<T> DataRow::GetValue(const int32_t columnIndex, DataType targetType)
 {
     const DataColumnPtr& column = ValidateColumnType(columnIndex, targetType, true);
 
     if (column->Computed())
-        return Cast<T>(GetComputedValue(column, targetType));
+        return GetComputedValue<T>(column, targetType);
 
-    T* value = static_cast<T*>(m_values[columnIndex]);
+    const TypedDataColumnStorage<T>& storage = GetStorage<TypedDataColumnStorage<T>>(columnIndex);
 
-    if (value)
-        return *value;
+    if (storage.IsNull(m_index))
+        return nullptr;
 
-    return nullptr;
+    return storage.GetValue(m_index);
 }
 
 template<class T>
@@ -464,19 +470,58 @@ void DataRow::SetValue(const int32_t columnIndex, const Nullable<T>& value, Data
 {
     ValidateColumnType(columnIndex, targetType);
 
-    // Free any existing value on updates
-    free(m_values[columnIndex]);
+    typename DataColumnKey<T>::Storage& storage = GetStorage<typename DataColumnKey<T>::Storage>(columnIndex);
+    const DataColumnIndexPtr& index = m_parent->m_indexes[columnIndex];
+    const int32_t position = m_parent->m_rowPositions[m_index];
 
-    if (value.HasValue())
+    // Index entries only exist for rows that have been added to the table
+    const bool indexed = index != nullptr && position > -1;
+
+    if (indexed && value.HasValue())
     {
-        uint8_t* copy = static_cast<uint8_t*>(malloc(sizeof(T)));
-        memcpy(copy, &value.Value, sizeof(T)); //-V575
-        m_values[columnIndex] = copy;
+        // Keys that compare as equal, e.g., strings differing only in case, keep their index entry
+        if (!storage.IsNull(m_index) && typename DataColumnKey<T>::Equal()(storage.GetValue(m_index), value.GetValueOrDefault()))
+        {
+            storage.SetValue(m_index, value.GetValueOrDefault());
+            m_parent->InvalidateComputedValues(columnIndex, m_index);
+            return;
+        }
+
+        if (index->IsUnique() && static_cast<const TypedDataColumnIndex<T>&>(*index).Contains(value.GetValueOrDefault()))
+            throw DataSetException("Value for column \"" + m_parent->m_columns[columnIndex]->Name() + "\" violates unique index of table \"" + m_parent->Name() + "\"");
     }
+
+    if (indexed)
+        index->Remove(storage, m_index, position);
+
+    if (value.HasValue())
+        storage.SetValue(m_index, value.GetValueOrDefault());
     else
-    {
-        m_values[columnIndex] = nullptr;
-    }
+        storage.SetNull(m_index);
+
+    if (indexed)
+        index->Add(storage, m_index, position);
+
+    m_parent->InvalidateComputedValues(columnIndex, m_index);
+}
+
+template<class T>
+T DataRow::GetValue(const DataColumnHandle& column, DataType targetType, const T& defaultValue)
+{
+    const DataColumnPtr& dataColumn = ValidateColumnHandle(column, targetType);
+
+    if (dataColumn == nullptr)
+        return defaultValue;
+
+    if (dataColumn->Computed())
+        return GetComputedValue<T>(dataColumn, targetType);
+
+    const TypedDataColumnStorage<T>& storage = GetStorage<TypedDataColumnStorage<T>>(column.Index);
+
+    if (storage.IsNull(m_index))
+        return defaultValue;
+
+    return storage.GetValue(m_index);
 }
 
 const DataTablePtr& DataRow::Parent() const
@@ -605,14 +650,14 @@ Nullable<string> DataRow::ValueAsString(const int32_t columnIndex)
     const DataColumnPtr& column = ValidateColumnType(columnIndex, DataType::String, true);
 
     if (column->Computed())
-        return Cast<string>(GetComputedValue(column, DataType::String));
+        return GetComputedValue<string>(column, DataType::String);
 
-    const char* value  = static_cast<const char*>(m_values[columnIndex]);
+    const StringDataColumnStorage& storage = GetStorage<StringDataColumnStorage>(columnIndex);
 
-    if (value)
-        return string(value);
+    if (storage.IsNull(m_index))
+        return nullptr;
 
-    return nullptr;
+    return storage.GetValue(m_index);
 }
 
 Nullable<string> DataRow::ValueAsString(const string& columnName)
@@ -622,23 +667,7 @@ Nullable<string> DataRow::ValueAsString(const string& columnName)
 
 void DataRow::SetStringValue(const int32_t columnIndex, const Nullable<string>& value)
 {
-    ValidateColumnType(columnIndex, DataType::String);
-
-    // Free any existing value on updates
-    free(m_values[columnIndex]);
-
-    if (value.HasValue())
-    {
-        const string& strval = value.GetValueOrDefault();
-        const uint32_t length = ConvertUInt32(strval.size() + 1);
-        char* copy = static_cast<char*>(malloc(length * sizeof(char)));
-        strcpy_s(copy, length, strval.c_str());
-        m_values[columnIndex] = copy;
-    }
-    else
-    {
-        m_values[columnIndex] = nullptr;
-    }
+    SetValue<string>(columnIndex, value, DataType::String);
 }
 
 void DataRow::SetStringValue(const string& columnName, const Nullable<string>& value)
@@ -648,17 +677,7 @@ void DataRow::SetStringValue(const string& columnName, const Nullable<string>& v
 
 Nullable<bool> DataRow::ValueAsBoolean(const int32_t columnIndex)
 {
-    const DataColumnPtr& column = ValidateColumnType(columnIndex, DataType::Boolean, true);
-
-    if (column->Computed())
-        return Cast<bool>(GetComputedValue(column, DataType::Boolean));
-
-    uint8_t* value = static_cast<uint8_t*>(m_values[columnIndex]);
-    
-    if (value)
-        return *value != 0;
-    
-    return nullptr;
+    return GetValue<bool>(columnIndex, DataType::Boolean);
 }
 
 Nullable<bool> DataRow::ValueAsBoolean(const string& columnName)
@@ -668,21 +687,7 @@ Nullable<bool> DataRow::ValueAsBoolean(const string& columnName)
 
 void DataRow::SetBooleanValue(const int32_t columnIndex, const Nullable<bool>& value)
 {
-    ValidateColumnType(columnIndex, DataType::Boolean);
-
-    // Free any existing value on updates
-    free(m_values[columnIndex]);
-
-    if (value.HasValue())
-    {
-        uint8_t* copy = static_cast<uint8_t*>(malloc(1));
-        *copy = value.GetValueOrDefault() ? 1 : 0; //-V522
-        m_values[columnIndex] = copy;
-    }
-    else
-    {
-        m_values[columnIndex] = nullptr;
-    }
+    SetValue<bool>(columnIndex, value, DataType::Boolean);
 }
 
 void DataRow::SetBooleanValue(const string& columnName, const Nullable<bool>& value)
@@ -752,17 +757,7 @@ void DataRow::SetDoubleValue(const string& columnName, const Nullable<float64_t>
 
 Nullable<decimal_t> DataRow::ValueAsDecimal(const int32_t columnIndex)
 {
-    const DataColumnPtr& column = ValidateColumnType(columnIndex, DataType::Decimal, true);
-
-    if (column->Computed())
-        return Cast<decimal_t>(GetComputedValue(column, DataType::Decimal));
-
-    const char* value = static_cast<const char*>(m_values[columnIndex]);
-
-    if (value)
-        return decimal_t(value);
-
-    return nullptr;
+    return GetValue<decimal_t>(columnIndex, DataType::Decimal);
 }
 
 Nullable<decimal_t> DataRow::ValueAsDecimal(const string& columnName)
@@ -772,25 +767,7 @@ Nullable<decimal_t> DataRow::ValueAsDecimal(const string& columnName)
 
 void DataRow::SetDecimalValue(const int32_t columnIndex, const Nullable<decimal_t>& value)
 {
-    ValidateColumnType(columnIndex, DataType::Decimal);
-
-    // Free any existing value on updates
-    free(m_values[columnIndex]);
-
-    if (value.HasValue())
-    {
-        // The boost decimal type has a very complex internal representation,
-        // although slower, it's safer just to store this as a string for now
-        const string& strval = value.GetValueOrDefault().str();
-        const uint32_t length = ConvertUInt32(strval.size() + 1);
-        char* copy = static_cast<char*>(malloc(length * sizeof(char)));
-        strcpy_s(copy, length, strval.c_str());
-        m_values[columnIndex] = copy;
-    }
-    else
-    {
-        m_values[columnIndex] = nullptr;
-    }
+    SetValue<decimal_t>(columnIndex, value, DataType::Decimal);
 }
 
 void DataRow::SetDecimalValue(const string& columnName, const Nullable<decimal_t>& value)
@@ -800,21 +777,7 @@ void DataRow::SetDecimalValue(const string& columnName, const Nullable<decimal_t
 
 Nullable<GSF::Guid> DataRow::ValueAsGuid(const int32_t columnIndex)
 {
-    const DataColumnPtr& column = ValidateColumnType(columnIndex, DataType::Guid, true);
-
-    if (column->Computed())
-        return Cast<GSF::Guid>(GetComputedValue(column, DataType::Guid));
-
-    int8_t* data = static_cast<int8_t*>(m_values[columnIndex]);
-
-    if (data)
-    {
-        GSF::Guid value;
-        memcpy(value.data, data, 16);
-        return value;
-    }
-
-    return nullptr;
+    return GetValue<GSF::Guid>(columnIndex, DataType::Guid);
 }
 
 Nullable<GSF::Guid> DataRow::ValueAsGuid(const string& columnName)
@@ -824,21 +787,7 @@ Nullable<GSF::Guid> DataRow::ValueAsGuid(const string& columnName)
 
 void DataRow::SetGuidValue(const int32_t columnIndex, const Nullable<GSF::Guid>& value)
 {
-    ValidateColumnType(columnIndex, DataType::Guid);
-
-    // Free any existing value on updates
-    free(m_values[columnIndex]);
-
-    if (value.HasValue())
-    {
-        int8_t* copy = static_cast<int8_t*>(malloc(16));
-        memcpy(copy, value.GetValueOrDefault().data, 16); //-V575
-        m_values[columnIndex] = copy;
-    }
-    else
-    {
-        m_values[columnIndex] = nullptr;
-    }
+    SetValue<GSF::Guid>(columnIndex, value, DataType::Guid);
 }
 
 void DataRow::SetGuidValue(const string& columnName, const Nullable<GSF::Guid>& value)
@@ -1004,4 +953,115 @@ void DataRow::SetUInt64Value(const int32_t columnIndex, const Nullable<uint64_t>
 void DataRow::SetUInt64Value(const string& columnName, const Nullable<uint64_t>& value)
 {
     SetUInt64Value(GetColumnIndex(columnName), value);
-}
\ No newline at end of file
+}
+
+bool DataRow::IsNull(const DataColumnHandle& column)
+{
+    if (!column.IsValid())
+        return true;
+
+    const DataColumnPtr& dataColumn = m_parent->Column(column.Index);
+
+    if (dataColumn == nullptr || dataColumn->Computed())
+        return IsNull(column.Index);
+
+    return m_parent->m_columnStorage[column.Index]->IsNull(m_index);
+}
+
+string_view DataRow::GetStringValue(const DataColumnHandle& column)
+{
+    const DataColumnPtr& dataColumn = ValidateColumnHandle(column, DataType::String);
+
+    if (dataColumn == nullptr)
+        return {};
+
+    if (dataColumn->Computed())
+    {
+        if (m_parent->m_computedStorage[column.Index] == nullptr)
+            throw DataSetException("Cannot read string view from computed DataColumn \"" + dataColumn->Name() + "\" for table \"" + m_parent->Name() + "\", column is not materialized");
+
+        // Materialized values stay in place while other rows are computed, until a source column of the row changes
+        GetComputedValue<string>(dataColumn, DataType::String);
+
+        ReaderLock readLock(m_parent->m_computedValuesLock);
+        const StringDataColumnStorage& storage = static_cast<const StringDataColumnStorage&>(*m_parent->m_computedStorage[column.Index]);
+        return { storage.GetData(m_index), storage.GetLength(m_index) };
+    }
+
+    const StringDataColumnStorage& storage = GetStorage<StringDataColumnStorage>(column.Index);
+
+    if (storage.IsNull(m_index))
+        return {};
+
+    return { storage.GetData(m_index), storage.GetLength(m_index) };
+}
+
+bool DataRow::GetBooleanValue(const DataColumnHandle& column, const bool defaultValue)
+{
+    return GetValue<bool>(column, DataType::Boolean, defaultValue);
+}
+
+datetime_t DataRow::GetDateTimeValue(const DataColumnHandle& column, const datetime_t& defaultValue)
+{
+    return GetValue<datetime_t>(column, DataType::DateTime, defaultValue);
+}
+
+float32_t DataRow::GetSingleValue(const DataColumnHandle& column, const float32_t defaultValue)
+{
+    return GetValue<float32_t>(column, DataType::Single, defaultValue);
+}
+
+float64_t DataRow::GetDoubleValue(const DataColumnHandle& column, const float64_t defaultValue)
+{
+    return GetValue<float64_t>(column, DataType::Double, defaultValue);
+}
+
+decimal_t DataRow::GetDecimalValue(const DataColumnHandle& column, const decimal_t& defaultValue)
+{
+    return GetValue<decimal_t>(column, DataType::Decimal, defaultValue);
+}
+
+GSF::Guid DataRow::GetGuidValue(const DataColumnHandle& column, const GSF::Guid& defaultValue)
+{
+    return GetValue<GSF::Guid>(column, DataType::Guid, defaultValue);
+}
+
+int8_t DataRow::GetInt8Value(const DataColumnHandle& column, const int8_t defaultValue)
+{
+    return GetValue<int8_t>(column, DataType::Int8, defaultValue);
+}
+
+int16_t DataRow::GetInt16Value(const DataColumnHandle& column, const int16_t defaultValue)
+{
+    return GetValue<int16_t>(column, DataType::Int16, defaultValue);
+}
+
+int32_t DataRow::GetInt32Value(const DataColumnHandle& column, const int32_t defaultValue)
+{
+    return GetValue<int32_t>(column, DataType::Int32, defaultValue);
+}
+
+int64_t DataRow::GetInt64Value(const DataColumnHandle& column, const int64_t defaultValue)
+{
+    return GetValue<int64_t>(column, DataType::Int64, defaultValue);
+}
+
+uint8_t DataRow::GetUInt8Value(const DataColumnHandle& column, const uint8_t defaultValue)
+{
+    return GetValue<uint8_t>(column, DataType::UInt8, defaultValue);
+}
+
+uint16_t DataRow::GetUInt16Value(const DataColumnHandle& column, const uint16_t defaultValue)
+{
+    return GetValue<uint16_t>(column, DataType::UInt16, defaultValue);
+}
+
+uint32_t DataRow::GetUInt32Value(const DataColumnHandle& column, const uint32_t defaultValue)
+{
+    return GetValue<uint32_t>(column, DataType::UInt32, defaultValue);
+}
+
+uint64_t DataRow::GetUInt64Value(const DataColumnHandle& column, const uint64_t defaultValue)
+{
+    return GetValue<uint64_t>(column, DataType::UInt64, defaultValue);
+}
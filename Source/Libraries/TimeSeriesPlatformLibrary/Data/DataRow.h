@@ -27,6 +27,7 @@
 #include "../Common/CommonTypes.h"
 #include "../Common/Nullable.h"
 #include "DataColumn.h"
+#include <string_view>
 
 namespace GSF {
 namespace FilterExpressions
@@ -49,23 +50,34 @@ namespace Data
     class DataRow;
     typedef GSF::SharedPtr<DataRow> DataRowPtr;
 
+    // Represents a row of a DataTable, row values are held by the column storage of the parent table
     class DataRow : public GSF::EnableSharedThisPtr<DataRow> // NOLINT
     {
     private:
         DataTablePtr m_parent;
-        std::vector<void*> m_values;
+        int32_t m_index;
 
         int32_t GetColumnIndex(const std::string& columnName) const;
-        DataColumnPtr ValidateColumnType(int32_t columnIndex, DataType targetType, bool read = false) const;
+        const DataColumnPtr& ValidateColumnType(int32_t columnIndex, DataType targetType, bool read = false) const;
+        const DataColumnPtr& ValidateColumnHandle(const DataColumnHandle& column, DataType targetType) const;
 
-        GSF::FilterExpressions::ExpressionTreePtr GetExpressionTree(const DataColumnPtr& column);
-        GSF::Object GetComputedValue(const DataColumnPtr& column, DataType targetType);
+        template<class T>
+        T& GetStorage(int32_t columnIndex) const;
+
+        GSF::Object EvaluateComputedValue(const DataColumnPtr& column, DataType targetType);
+
+        // Gets computed value, from materialized storage when column is materialized
+        template<class T>
+        T GetComputedValue(const DataColumnPtr& column, DataType targetType);
 
         template<class T>
         GSF::Nullable<T> GetValue(int32_t columnIndex, DataType targetType);
 
         template<class T>
         void SetValue(int32_t columnIndex, const GSF::Nullable<T>& value, DataType targetType);
+
+        template<class T>
+        T GetValue(const DataColumnHandle& column, DataType targetType, const T& defaultValue);
     public:
         DataRow(DataTablePtr parent);
         ~DataRow();
@@ -152,6 +164,29 @@ namespace Data
         void SetUInt64Value(int32_t columnIndex, const GSF::Nullable<uint64_t>& value);
         void SetUInt64Value(const std::string& columnName, const GSF::Nullable<uint64_t>& value);
 
+        // Typed accessors for column handles, values are read directly from column storage without copying
+        // through nullable values. Null values, and values of invalid handles, return the default value.
+        bool IsNull(const DataColumnHandle& column);
+
+        // String view remains valid until the value of the row is assigned or the row is removed, assignments
+        // to other rows do not move the characters. Computed columns can only be read as views when
+        // materialized, otherwise use ValueAsString instead
+        std::string_view GetStringValue(const DataColumnHandle& column);
+        bool GetBooleanValue(const DataColumnHandle& column, bool defaultValue = false);
+        GSF::datetime_t GetDateTimeValue(const DataColumnHandle& column, const GSF::datetime_t& defaultValue = GSF::Empty::DateTime);
+        GSF::float32_t GetSingleValue(const DataColumnHandle& column, GSF::float32_t defaultValue = 0.0F);
+        GSF::float64_t GetDoubleValue(const DataColumnHandle& column, GSF::float64_t defaultValue = 0.0);
+        GSF::decimal_t GetDecimalValue(const DataColumnHandle& column, const GSF::decimal_t& defaultValue = GSF::decimal_t(0));
+        GSF::Guid GetGuidValue(const DataColumnHandle& column, const GSF::Guid& defaultValue = GSF::Empty::Guid);
+        int8_t GetInt8Value(const DataColumnHandle& column, int8_t defaultValue = 0);
+        int16_t GetInt16Value(const DataColumnHandle& column, int16_t defaultValue = 0);
+        int32_t GetInt32Value(const DataColumnHandle& column, int32_t defaultValue = 0);
+        int64_t GetInt64Value(const DataColumnHandle& column, int64_t defaultValue = 0LL);
+        uint8_t GetUInt8Value(const DataColumnHandle& column, uint8_t defaultValue = 0U);
+        uint16_t GetUInt16Value(const DataColumnHandle& column, uint16_t defaultValue = 0U);
+        uint32_t GetUInt32Value(const DataColumnHandle& column, uint32_t defaultValue = 0U);
+        uint64_t GetUInt64Value(const DataColumnHandle& column, uint64_t defaultValue = 0ULL);
+
         static const DataRowPtr NullPtr;
 
         friend class DataTable;
@@ -23,6 +23,8 @@
 
 #include "DataSet.h"
 #include "../Common/pugixml.hpp"
+#include "../Common/Convert.h"
+#include "../Common/EndianConverter.h"
 
 using namespace std;
 using namespace pugi;
@@ -63,6 +65,8 @@ const string DataSet::XmlSchemaNamespace = "http://www.w3.org/2001/XMLSchema";
 
 const string DataSet::ExtXmlSchemaDataNamespace = "urn:schemas-microsoft-com:xml-msdata";
 
+const uint8_t DataSet::BinarySignature[4] = { 'G', 'S', 'F', 'B' };
+
 DataSet::DataSet() = default;
 
 DataSet::~DataSet() = default;
@@ -204,6 +208,43 @@ DataSetPtr DataSet::FromXml(const pugi::xml_document& document)
     return dataSet;
 }
 
+void DataSet::ReadBinary(const vector<uint8_t>& buffer)
+{
+    ReadBinary(buffer.data(), ConvertUInt32(buffer.size()));
+}
+
+void DataSet::ReadBinary(const uint8_t* buffer, uint32_t length)
+{
+    if (!IsBinary(buffer, length))
+        throw DataSetException("Failed to load binary data set from buffer: invalid signature");
+
+    ParseBinary(buffer, length);
+}
+
+void DataSet::WriteBinary(vector<uint8_t>& buffer) const
+{
+    GenerateBinary(buffer);
+}
+
+DataSetPtr DataSet::FromBinary(const vector<uint8_t>& buffer)
+{
+    DataSetPtr dataSet = NewSharedPtr<DataSet>();
+    dataSet->ReadBinary(buffer);
+    return dataSet;
+}
+
+DataSetPtr DataSet::FromBinary(const uint8_t* buffer, uint32_t length)
+{
+    DataSetPtr dataSet = NewSharedPtr<DataSet>();
+    dataSet->ReadBinary(buffer, length);
+    return dataSet;
+}
+
+bool DataSet::IsBinary(const uint8_t* buffer, uint32_t length)
+{
+    return length > sizeof(BinarySignature) && memcmp(buffer, BinarySignature, sizeof(BinarySignature)) == 0;
+}
+
 void DataSet::ParseXml(const xml_document& document)
 {
     // Find root node
@@ -809,4 +850,422 @@ void DataSet::GenerateXml(xml_document& document, const string& dataSetName) con
             }
         }
     }
-}
\ No newline at end of file
+}
+
+// Binary data set format, all values are big-endian:
+//   signature ("GSFB"), version (uint8)
+//   string count (uint32), then each string as byte length (uint32) followed by UTF-8 bytes
+//   table count (uint32), then for each table:
+//     name (string index), column count (uint32)
+//     for each column: data type (uint8), name (string index), expression (string index)
+//     row count (uint32)
+//     for each non-computed column: null bitmap, one bit per row, then a typed array of non-null values
+// String and Decimal values are string indexes, DateTime values are microseconds since Unix epoch and Guid values are 16 bytes.
+static const uint8_t BinaryVersion = 1;
+static const int64_t NullDateTime = Int64::MinValue;
+static const datetime_t BinaryDateTimeEpoch(boost::gregorian::date(1970, 1, 1));
+
+class BinaryStringTable
+{
+private:
+    vector<const string*> m_strings;
+    unordered_map<string, uint32_t> m_indexes;
+
+public:
+    uint32_t GetIndex(const string& value)
+    {
+        const auto result = m_indexes.emplace(value, ConvertUInt32(m_strings.size()));
+
+        if (result.second)
+            m_strings.push_back(&result.first->first);
+
+        return result.first->second;
+    }
+
+    void Write(vector<uint8_t>& buffer) const
+    {
+        EndianConverter::WriteBigEndianBytes(buffer, ConvertUInt32(m_strings.size()));
+
+        for (const string* value : m_strings)
+        {
+            EndianConverter::WriteBigEndianBytes(buffer, ConvertUInt32(value->size()));
+            buffer.insert(buffer.end(), value->begin(), value->end());
+        }
+    }
+};
+
+class BinaryBufferReader
+{
+private:
+    const uint8_t* m_buffer;
+    const uint32_t m_length;
+    uint32_t m_offset;
+
+    void Validate(const uint32_t length) const
+    {
+        if (length > m_length - m_offset)
+            throw DataSetException("Failed to parse binary data set: unexpected end of buffer");
+    }
+
+public:
+    BinaryBufferReader(const uint8_t* buffer, const uint32_t length) :
+        m_buffer(buffer),
+        m_length(length),
+        m_offset(0)
+    {
+    }
+
+    template<class T>
+    T Read()
+    {
+        Validate(sizeof(T));
+        const T value = EndianConverter::ToBigEndian<T>(m_buffer, m_offset);
+        m_offset += sizeof(T);
+        return value;
+    }
+
+    const uint8_t* ReadBytes(const uint32_t length)
+    {
+        Validate(length);
+        const uint8_t* value = m_buffer + m_offset;
+        m_offset += length;
+        return value;
+    }
+
+    uint32_t Remaining() const
+    {
+        return m_length - m_offset;
+    }
+};
+
+template<class T>
+static void WriteBinaryValues(vector<uint8_t>& buffer, const vector<DataRowPtr>& rows, const int32_t columnIndex, Nullable<T> (DataRow::*getValue)(int32_t))
+{
+    for (const auto& row : rows)
+    {
+        if (!row->IsNull(columnIndex))
+            EndianConverter::WriteBigEndianBytes(buffer, ((*row).*getValue)(columnIndex).GetValueOrDefault());
+    }
+}
+
+template<class T>
+static void ReadBinaryValues(BinaryBufferReader& reader, const vector<DataRowPtr>& rows, const vector<bool>& nulls, const int32_t columnIndex, void (DataRow::*setValue)(int32_t, const Nullable<T>&))
+{
+    for (size_t i = 0; i < rows.size(); i++)
+    {
+        if (!nulls[i])
+            ((*rows[i]).*setValue)(columnIndex, reader.Read<T>());
+    }
+}
+
+void DataSet::ParseBinary(const uint8_t* buffer, uint32_t length)
+{
+    BinaryBufferReader reader(buffer, length);
+    reader.ReadBytes(sizeof(BinarySignature));
+
+    const uint8_t version = reader.Read<uint8_t>();
+
+    if (version != BinaryVersion)
+        throw DataSetException("Failed to parse binary data set: unsupported version " + ToString(static_cast<int32_t>(version)));
+
+    // Read string table
+    const uint32_t stringCount = reader.Read<uint32_t>();
+    vector<string> strings;
+
+    strings.reserve(min(stringCount, length));
+
+    for (uint32_t i = 0; i < stringCount; i++)
+    {
+        const uint32_t stringLength = reader.Read<uint32_t>();
+        const char* value = reinterpret_cast<const char*>(reader.ReadBytes(stringLength));
+        strings.emplace_back(value, stringLength);
+    }
+
+    const auto readString = [&reader, &strings]() -> const string&
+    {
+        const uint32_t index = reader.Read<uint32_t>();
+
+        if (index >= strings.size())
+            throw DataSetException("Failed to parse binary data set: invalid string index");
+
+        return strings[index];
+    };
+
+    const uint32_t tableCount = reader.Read<uint32_t>();
+
+    for (uint32_t i = 0; i < tableCount; i++)
+    {
+        const DataTablePtr table = CreateTable(readString());
+        const uint32_t columnCount = reader.Read<uint32_t>();
+
+        for (uint32_t j = 0; j < columnCount; j++)
+        {
+            const uint8_t dataType = reader.Read<uint8_t>();
+
+            if (dataType > static_cast<uint8_t>(DataType::UInt64))
+                throw DataSetException("Failed to parse binary data set: unexpected column data type encountered");
+
+            const string& columnName = readString();
+            const string& columnExpression = readString();
+
+            table->AddColumn(table->CreateColumn(columnName, static_cast<DataType>(dataType), columnExpression));
+        }
+
+        const uint32_t rowCount = reader.Read<uint32_t>();
+        uint64_t serializedColumnCount = 0ULL;
+
+        for (int32_t columnIndex = 0; columnIndex < table->ColumnCount(); columnIndex++)
+        {
+            if (!table->Column(columnIndex)->Computed())
+                serializedColumnCount++;
+        }
+
+        // Each serialized column has a null bitmap for all rows, so row count must fit in remaining buffer before rows are allocated.
+        // Rows of tables without serialized columns take no space, so their count is limited to buffer length instead.
+        if (serializedColumnCount * ((rowCount + 7ULL) / 8ULL) > reader.Remaining() || (serializedColumnCount == 0ULL && rowCount > length))
+            throw DataSetException("Failed to parse binary data set: row count " + ToString(rowCount) + " exceeds remaining buffer");
+
+        vector<DataRowPtr> rows;
+        vector<bool> nulls(rowCount);
+
+        rows.reserve(rowCount);
+
+        for (uint32_t j = 0; j < rowCount; j++)
+            rows.push_back(table->CreateRow());
+
+        for (int32_t columnIndex = 0; columnIndex < table->ColumnCount(); columnIndex++)
+        {
+            const DataColumnPtr& column = table->Column(columnIndex);
+
+            // Computed values are not serialized
+            if (column->Computed())
+                continue;
+
+            const uint8_t* bitmap = reader.ReadBytes((rowCount + 7) / 8);
+
+            for (uint32_t j = 0; j < rowCount; j++)
+                nulls[j] = (bitmap[j / 8] & (1 << (j % 8))) != 0;
+
+            switch (column->Type())
+            {
+                case DataType::String:
+                    for (uint32_t j = 0; j < rowCount; j++)
+                    {
+                        if (!nulls[j])
+                            rows[j]->SetStringValue(columnIndex, readString());
+                    }
+                    break;
+                case DataType::Boolean:
+                    for (uint32_t j = 0; j < rowCount; j++)
+                    {
+                        if (!nulls[j])
+                            rows[j]->SetBooleanValue(columnIndex, reader.Read<uint8_t>() != 0);
+                    }
+                    break;
+                case DataType::DateTime:
+                    for (uint32_t j = 0; j < rowCount; j++)
+                    {
+                        if (nulls[j])
+                            continue;
+
+                        const int64_t microseconds = reader.Read<int64_t>();
+                        rows[j]->SetDateTimeValue(columnIndex, microseconds == NullDateTime ? Empty::DateTime : BinaryDateTimeEpoch + boost::posix_time::microseconds(microseconds));
+                    }
+                    break;
+                case DataType::Single:
+                    ReadBinaryValues<float32_t>(reader, rows, nulls, columnIndex, &DataRow::SetSingleValue);
+                    break;
+                case DataType::Double:
+                    ReadBinaryValues<float64_t>(reader, rows, nulls, columnIndex, &DataRow::SetDoubleValue);
+                    break;
+                case DataType::Decimal:
+                    for (uint32_t j = 0; j < rowCount; j++)
+                    {
+                        if (!nulls[j])
+                            rows[j]->SetDecimalValue(columnIndex, decimal_t(readString()));
+                    }
+                    break;
+                case DataType::Guid:
+                    for (uint32_t j = 0; j < rowCount; j++)
+                    {
+                        if (nulls[j])
+                            continue;
+
+                        Guid value;
+                        memcpy(value.data, reader.ReadBytes(16), 16);
+                        rows[j]->SetGuidValue(columnIndex, value);
+                    }
+                    break;
+                case DataType::Int8:
+                    ReadBinaryValues<int8_t>(reader, rows, nulls, columnIndex, &DataRow::SetInt8Value);
+                    break;
+                case DataType::Int16:
+                    ReadBinaryValues<int16_t>(reader, rows, nulls, columnIndex, &DataRow::SetInt16Value);
+                    break;
+                case DataType::Int32:
+                    ReadBinaryValues<int32_t>(reader, rows, nulls, columnIndex, &DataRow::SetInt32Value);
+                    break;
+                case DataType::Int64:
+                    ReadBinaryValues<int64_t>(reader, rows, nulls, columnIndex, &DataRow::SetInt64Value);
+                    break;
+                case DataType::UInt8:
+                    ReadBinaryValues<uint8_t>(reader, rows, nulls, columnIndex, &DataRow::SetUInt8Value);
+                    break;
+                case DataType::UInt16:
+                    ReadBinaryValues<uint16_t>(reader, rows, nulls, columnIndex, &DataRow::SetUInt16Value);
+                    break;
+                case DataType::UInt32:
+                    ReadBinaryValues<uint32_t>(reader, rows, nulls, columnIndex, &DataRow::SetUInt32Value);
+                    break;
+                case DataType::UInt64:
+                    ReadBinaryValues<uint64_t>(reader, rows, nulls, columnIndex, &DataRow::SetUInt64Value);
+                    break;
+                default:
+                    throw DataSetException("Unexpected column data type encountered");
+            }
+        }
+
+        for (const auto& row : rows)
+            table->AddRow(row);
+
+        AddOrUpdateTable(table);
+    }
+}
+
+void DataSet::GenerateBinary(vector<uint8_t>& buffer) const
+{
+    const vector<DataTablePtr> tables = Tables();
+    BinaryStringTable strings;
+    vector<uint8_t> body;
+
+    EndianConverter::WriteBigEndianBytes(body, ConvertUInt32(tables.size()));
+
+    for (auto const& table : tables)
+    {
+        EndianConverter::WriteBigEndianBytes(body, strings.GetIndex(table->Name()));
+        EndianConverter::WriteBigEndianBytes(body, static_cast<uint32_t>(table->ColumnCount()));
+
+        for (int32_t columnIndex = 0; columnIndex < table->ColumnCount(); columnIndex++)
+        {
+            const DataColumnPtr& column = table->Column(columnIndex);
+
+            body.push_back(static_cast<uint8_t>(column->Type()));
+            EndianConverter::WriteBigEndianBytes(body, strings.GetIndex(column->Name()));
+            EndianConverter::WriteBigEndianBytes(body, strings.GetIndex(column->Computed() ? column->Expression() : string{}));
+        }
+
+        vector<DataRowPtr> rows;
+        rows.reserve(table->RowCount());
+
+        for (int32_t rowIndex = 0; rowIndex < table->RowCount(); rowIndex++)
+        {
+            const DataRowPtr& row = table->Row(rowIndex);
+
+            if (row != nullptr)
+                rows.push_back(row);
+        }
+
+        EndianConverter::WriteBigEndianBytes(body, ConvertUInt32(rows.size()));
+
+        for (int32_t columnIndex = 0; columnIndex < table->ColumnCount(); columnIndex++)
+        {
+            const DataColumnPtr& column = table->Column(columnIndex);
+
+            // Computed values are not serialized
+            if (column->Computed())
+                continue;
+
+            const size_t bitmapOffset = body.size();
+            body.resize(bitmapOffset + (rows.size() + 7) / 8);
+
+            for (size_t i = 0; i < rows.size(); i++)
+            {
+                if (rows[i]->IsNull(columnIndex))
+                    body[bitmapOffset + i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+            }
+
+            switch (column->Type())
+            {
+                case DataType::String:
+                    for (const auto& row : rows)
+                    {
+                        if (!row->IsNull(columnIndex))
+                            EndianConverter::WriteBigEndianBytes(body, strings.GetIndex(row->ValueAsString(columnIndex).GetValueOrDefault()));
+                    }
+                    break;
+                case DataType::Boolean:
+                    for (const auto& row : rows)
+                    {
+                        if (!row->IsNull(columnIndex))
+                            body.push_back(row->ValueAsBoolean(columnIndex).GetValueOrDefault() ? 1 : 0);
+                    }
+                    break;
+                case DataType::DateTime:
+                    for (const auto& row : rows)
+                    {
+                        if (row->IsNull(columnIndex))
+                            continue;
+
+                        const datetime_t value = row->ValueAsDateTime(columnIndex).GetValueOrDefault();
+                        EndianConverter::WriteBigEndianBytes(body, value.is_special() ? NullDateTime : (value - BinaryDateTimeEpoch).total_microseconds());
+                    }
+                    break;
+                case DataType::Single:
+                    WriteBinaryValues<float32_t>(body, rows, columnIndex, &DataRow::ValueAsSingle);
+                    break;
+                case DataType::Double:
+                    WriteBinaryValues<float64_t>(body, rows, columnIndex, &DataRow::ValueAsDouble);
+                    break;
+                case DataType::Decimal:
+                    for (const auto& row : rows)
+                    {
+                        if (!row->IsNull(columnIndex))
+                            EndianConverter::WriteBigEndianBytes(body, strings.GetIndex(row->ValueAsDecimal(columnIndex).GetValueOrDefault().str()));
+                    }
+                    break;
+                case DataType::Guid:
+                    for (const auto& row : rows)
+                    {
+                        if (row->IsNull(columnIndex))
+                            continue;
+
+                        const Guid value = row->ValueAsGuid(columnIndex).GetValueOrDefault();
+                        body.insert(body.end(), value.begin(), value.end());
+                    }
+                    break;
+                case DataType::Int8:
+                    WriteBinaryValues<int8_t>(body, rows, columnIndex, &DataRow::ValueAsInt8);
+                    break;
+                case DataType::Int16:
+                    WriteBinaryValues<int16_t>(body, rows, columnIndex, &DataRow::ValueAsInt16);
+                    break;
+                case DataType::Int32:
+                    WriteBinaryValues<int32_t>(body, rows, columnIndex, &DataRow::ValueAsInt32);
+                    break;
+                case DataType::Int64:
+                    WriteBinaryValues<int64_t>(body, rows, columnIndex, &DataRow::ValueAsInt64);
+                    break;
+                case DataType::UInt8:
+                    WriteBinaryValues<uint8_t>(body, rows, columnIndex, &DataRow::ValueAsUInt8);
+                    break;
+                case DataType::UInt16:
+                    WriteBinaryValues<uint16_t>(body, rows, columnIndex, &DataRow::ValueAsUInt16);
+                    break;
+                case DataType::UInt32:
+                    WriteBinaryValues<uint32_t>(body, rows, columnIndex, &DataRow::ValueAsUInt32);
+                    break;
+                case DataType::UInt64:
+                    WriteBinaryValues<uint64_t>(body, rows, columnIndex, &DataRow::ValueAsUInt64);
+                    break;
+                default:
+                    throw DataSetException("Unexpected column data type encountered");
+            }
+        }
+    }
+
+    // String table precedes tables so that readers can resolve string indexes in a single pass
+    buffer.insert(buffer.end(), begin(BinarySignature), end(BinarySignature));
+    buffer.push_back(BinaryVersion);
+    strings.Write(buffer);
+    buffer.insert(buffer.end(), body.begin(), body.end());
+}
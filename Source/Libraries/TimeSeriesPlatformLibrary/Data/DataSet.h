@@ -56,6 +56,8 @@ namespace Data
 
         void ParseXml(const pugi::xml_document& document);
         void GenerateXml(pugi::xml_document& document, const std::string& dataSetName) const;
+        void ParseBinary(const uint8_t* buffer, uint32_t length);
+        void GenerateBinary(std::vector<uint8_t>& buffer) const;
 
     public:
          DataSet();
@@ -91,8 +93,22 @@ namespace Data
         static DataSetPtr FromXml(const uint8_t* buffer, uint32_t length);
         static DataSetPtr FromXml(const pugi::xml_document& document);
 
+        // Binary format stores tables as typed column arrays with a shared string table, it
+        // is more compact and faster to parse than XML but is only readable by this library
+        void ReadBinary(const std::vector<uint8_t>& buffer);
+        void ReadBinary(const uint8_t* buffer, uint32_t length);
+
+        void WriteBinary(std::vector<uint8_t>& buffer) const;
+
+        static DataSetPtr FromBinary(const std::vector<uint8_t>& buffer);
+        static DataSetPtr FromBinary(const uint8_t* buffer, uint32_t length);
+
+        // Determines if buffer starts with binary data set signature
+        static bool IsBinary(const uint8_t* buffer, uint32_t length);
+
         static const std::string XmlSchemaNamespace;
         static const std::string ExtXmlSchemaDataNamespace;
+        static const uint8_t BinarySignature[4];
     };
 }}
 
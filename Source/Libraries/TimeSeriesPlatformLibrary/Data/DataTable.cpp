@@ -32,7 +32,8 @@ const DataTablePtr DataTable::NullPtr = nullptr;
 
 DataTable::DataTable(DataSetPtr parent, string name) :
     m_parent(std::move(parent)),
-    m_name(std::move(name))
+    m_name(std::move(name)),
+    m_storageCount(0)
 {
     if (m_parent == nullptr)
         throw DataSetException("DataSet parent is null");
@@ -54,6 +55,19 @@ void DataTable::AddColumn(DataColumnPtr column)
 {
     column->m_index = ConvertInt32(m_columns.size());
     m_columnIndexes.insert(pair<string, int32_t>(column->Name(), column->m_index));
+
+    // Computed column values are derived from other columns so they need no storage
+    DataColumnStoragePtr storage = nullptr;
+
+    if (!column->Computed())
+    {
+        storage = DataColumnStorage::Create(column->Type());
+        storage->Resize(m_storageCount);
+    }
+
+    m_columnStorage.push_back(std::move(storage));
+    m_indexes.push_back(nullptr);
+    m_computedStorage.push_back(nullptr);
     m_columns.push_back(std::move(column));
 }
 
@@ -85,6 +99,16 @@ const DataColumnPtr& DataTable::operator[](int32_t index) const
     return Column(index);
 }
 
+DataColumnHandle DataTable::ColumnHandle(const string& columnName) const
+{
+    const DataColumnPtr& column = Column(columnName);
+
+    if (column == nullptr)
+        return {};
+
+    return { column->m_index, column->m_type };
+}
+
 DataColumnPtr DataTable::CreateColumn(const string& name, DataType type, string expression)
 {
     return NewSharedPtr<DataColumn, DataTablePtr, string, DataType>(shared_from_this(), name, type, std::move(expression));
@@ -110,6 +134,34 @@ const DataRowPtr& DataTable::Row(int32_t index)
 
 void DataTable::AddRow(DataRowPtr row)
 {
+    if (row == nullptr)
+        throw DataSetException("Cannot add null DataRow to table \"" + m_name + "\"");
+
+    if (row->m_parent.get() != this)
+        throw DataSetException("DataRow was created for a different DataTable, use CloneRow to copy rows between tables");
+
+    const int32_t slot = row->m_index;
+
+    if (m_rowPositions[slot] > -1)
+        throw DataSetException("DataRow has already been added to table \"" + m_name + "\"");
+
+    const int32_t position = ConvertInt32(m_rows.size());
+    const int32_t columnCount = ConvertInt32(m_columns.size());
+
+    // Validate all unique indexes before any index is modified
+    for (int32_t i = 0; i < columnCount; i++)
+    {
+        if (m_indexes[i] != nullptr && !m_indexes[i]->CanAdd(*m_columnStorage[i], slot))
+            throw DataSetException("Value for column \"" + m_columns[i]->Name() + "\" violates unique index of table \"" + m_name + "\"");
+    }
+
+    for (int32_t i = 0; i < columnCount; i++)
+    {
+        if (m_indexes[i] != nullptr)
+            m_indexes[i]->Add(*m_columnStorage[i], slot, position);
+    }
+
+    m_rowPositions[slot] = position;
     m_rows.push_back(std::move(row));
 }
 
@@ -123,8 +175,20 @@ DataRowPtr DataTable::CloneRow(const DataRowPtr& source)
     DataRowPtr row = CreateRow();
     const int32_t columnCount = ConvertInt32(m_columns.size());
 
+    const DataTablePtr& sourceTable = source->m_parent;
+
     for (int32_t i = 0; i < columnCount; i++)
     {
+        const DataColumnStoragePtr& storage = m_columnStorage[i];
+        const DataColumnStorage* sourceStorage = i < sourceTable->ColumnCount() ? sourceTable->m_columnStorage[i].get() : nullptr;
+
+        // Stored values of matching types are copied directly between column storage
+        if (storage != nullptr && sourceStorage != nullptr && sourceTable->m_columns[i]->m_type == m_columns[i]->m_type)
+        {
+            storage->CopyValue(*sourceStorage, source->m_index, row->m_index);
+            continue;
+        }
+
         switch (m_columns[i]->m_type)
         {
             case DataType::String:
@@ -184,3 +248,257 @@ int32_t DataTable::RowCount() const
 {
     return ConvertInt32(m_rows.size());
 }
+
+int32_t DataTable::RowPosition(const DataRowPtr& row) const
+{
+    if (row == nullptr || row->m_parent.get() != this)
+        return -1;
+
+    return m_rowPositions[row->m_index];
+}
+
+void DataTable::GetRowSlots(vector<int32_t>& slots) const
+{
+    const size_t offset = slots.size();
+
+    // Inverts slot positions rather than reading slot of each row object
+    slots.resize(offset + m_rows.size());
+
+    for (int32_t slot = 0; slot < m_storageCount; slot++)
+    {
+        const int32_t position = m_rowPositions[slot];
+
+        if (position > -1)
+            slots[offset + position] = slot;
+    }
+}
+
+const DataColumnStorage* DataTable::ColumnStorage(const DataColumnHandle& column) const
+{
+    if (!column.IsValid() || column.Index >= ConvertInt32(m_columnStorage.size()))
+        return nullptr;
+
+    return m_columnStorage[column.Index].get();
+}
+
+int32_t DataTable::AllocateRowStorage()
+{
+    if (!m_freeSlots.empty())
+    {
+        const int32_t slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        return slot;
+    }
+
+    for (const DataColumnStoragePtr& storage : m_columnStorage)
+    {
+        if (storage != nullptr)
+            storage->Resize(m_storageCount + 1);
+    }
+
+    for (const int32_t columnIndex : m_materializedColumns)
+        m_computedStorage[columnIndex]->Resize(m_storageCount + 1);
+
+    m_rowPositions.push_back(-1);
+
+    return m_storageCount++;
+}
+
+void DataTable::ReleaseRowStorage(const int32_t slot)
+{
+    // Values are cleared on release so a row that reuses slot starts with all values null
+    for (const DataColumnStoragePtr& storage : m_columnStorage)
+    {
+        if (storage != nullptr)
+            storage->SetNull(slot);
+    }
+
+    for (const int32_t columnIndex : m_materializedColumns)
+        m_computedStorage[columnIndex]->SetNull(slot);
+
+    m_freeSlots.push_back(slot);
+}
+
+void DataTable::InvalidateComputedValues(const int32_t columnIndex, const int32_t slot)
+{
+    for (const int32_t computedIndex : m_materializedColumns)
+    {
+        const vector<int32_t>& sourceColumns = m_columns[computedIndex]->SourceColumns();
+
+        if (binary_search(sourceColumns.begin(), sourceColumns.end(), columnIndex))
+            m_computedStorage[computedIndex]->SetNull(slot);
+    }
+}
+
+const DataColumnStorage& DataTable::ValidateLookupColumn(const DataColumnHandle& column, DataType keyType) const
+{
+    if (!column.IsValid() || column.Index >= ConvertInt32(m_columns.size()))
+        throw DataSetException("Column handle is not valid for table \"" + m_name + "\"");
+
+    const DataColumnPtr& dataColumn = m_columns[column.Index];
+
+    if (dataColumn->m_type != keyType)
+        throw DataSetException("Cannot search column \"" + dataColumn->Name() + "\" with a value of type \"" + string(EnumName(keyType)) + "\", column type is \"" + string(EnumName(dataColumn->m_type)) + "\"");
+
+    if (m_columnStorage[column.Index] == nullptr)
+        throw DataSetException("Cannot search computed column \"" + dataColumn->Name() + "\"");
+
+    return *m_columnStorage[column.Index];
+}
+
+void DataTable::CreateIndex(const string& columnName, DataColumnIndexType type)
+{
+    const DataColumnPtr& column = Column(columnName);
+
+    if (column == nullptr)
+        throw DataSetException("Column name \"" + columnName + "\" was not found in table \"" + m_name + "\"");
+
+    const DataColumnStoragePtr& storage = m_columnStorage[column->m_index];
+
+    if (storage == nullptr)
+        throw DataSetException("Cannot index computed column \"" + columnName + "\"");
+
+    DataColumnIndexPtr index = DataColumnIndex::Create(column->m_type, type);
+
+    for (int32_t position = 0; position < ConvertInt32(m_rows.size()); position++)
+    {
+        const int32_t slot = m_rows[position]->m_index;
+
+        if (!index->CanAdd(*storage, slot))
+            throw DataSetException("Cannot create unique index on column \"" + columnName + "\", table \"" + m_name + "\" contains duplicate values");
+
+        index->Add(*storage, slot, position);
+    }
+
+    m_indexes[column->m_index] = std::move(index);
+}
+
+void DataTable::RemoveIndex(const string& columnName)
+{
+    const DataColumnPtr& column = Column(columnName);
+
+    if (column != nullptr)
+        m_indexes[column->m_index] = nullptr;
+}
+
+void DataTable::MaterializeColumn(const string& columnName)
+{
+    const DataColumnPtr& column = Column(columnName);
+
+    if (column == nullptr)
+        throw DataSetException("Column name \"" + columnName + "\" was not found in table \"" + m_name + "\"");
+
+    if (!column->Computed())
+        throw DataSetException("Cannot materialize column \"" + columnName + "\", column is not computed");
+
+    if (m_computedStorage[column->m_index] != nullptr)
+        return;
+
+    // Resolve dependencies up front so that invalid expressions fail here rather than on first read
+    column->SourceColumns();
+
+    // Storage values start as null, i.e., not yet computed, computed values are never null
+    DataColumnStoragePtr storage = DataColumnStorage::Create(column->m_type);
+    storage->Resize(m_storageCount);
+
+    m_computedStorage[column->m_index] = std::move(storage);
+    m_materializedColumns.push_back(column->m_index);
+
+    // Values of existing rows are read, which fills storage, so that later reads do not write to storage,
+    // a value that fails to evaluate is left to be reported by first read of row
+    for (const DataRowPtr& row : m_rows)
+    {
+        try
+        {
+            row->IsNull(column->m_index);
+        }
+        catch (...)
+        {
+        }
+    }
+}
+
+bool DataTable::IsMaterialized(const DataColumnHandle& column) const
+{
+    return column.IsValid() && column.Index < ConvertInt32(m_computedStorage.size()) && m_computedStorage[column.Index] != nullptr;
+}
+
+vector<DataRowPtr> DataTable::FindRowsWithPrefix(const DataColumnHandle& column, const string& prefix) const
+{
+    const StringDataColumnStorage& storage = static_cast<const StringDataColumnStorage&>(ValidateLookupColumn(column, DataType::String));
+    const DataColumnIndexPtr& index = m_indexes[column.Index];
+    vector<int32_t> positions;
+
+    if (index != nullptr && index->Type() == DataColumnIndexType::Ordered)
+    {
+        static_cast<const TypedDataColumnIndex<string>&>(*index).FindPrefix(prefix, positions);
+        sort(positions.begin(), positions.end());
+    }
+    else
+    {
+        for (int32_t position = 0; position < ConvertInt32(m_rows.size()); position++)
+        {
+            const int32_t slot = m_rows[position]->m_index;
+
+            if (!storage.IsNull(slot) && StartsWith(storage.GetValue(slot), prefix))
+                positions.push_back(position);
+        }
+    }
+
+    vector<DataRowPtr> rows;
+    rows.reserve(positions.size());
+
+    for (const int32_t position : positions)
+        rows.push_back(m_rows[position]);
+
+    return rows;
+}
+
+bool DataTable::TryGetOrderedRows(const DataColumnHandle& column, const bool ascending, vector<DataRowPtr>& rows) const
+{
+    const DataColumnIndexPtr& index = Index(column);
+
+    if (index == nullptr || index->Type() != DataColumnIndexType::Ordered)
+        return false;
+
+    const DataColumnStorage& storage = *m_columnStorage[column.Index];
+    vector<int32_t> positions;
+
+    positions.reserve(m_rows.size());
+    index->GetOrderedPositions(ascending, positions);
+
+    // Null values are not indexed, they are added in row order before or after indexed values
+    vector<DataRowPtr> nullRows;
+
+    if (positions.size() < m_rows.size())
+    {
+        for (const DataRowPtr& row : m_rows)
+        {
+            if (storage.IsNull(row->m_index))
+                nullRows.push_back(row);
+        }
+    }
+
+    rows.reserve(rows.size() + m_rows.size());
+
+    if (ascending)
+        rows.insert(rows.end(), nullRows.begin(), nullRows.end());
+
+    for (const int32_t position : positions)
+        rows.push_back(m_rows[position]);
+
+    if (!ascending)
+        rows.insert(rows.end(), nullRows.begin(), nullRows.end());
+
+    return true;
+}
+
+const DataColumnIndexPtr& DataTable::Index(const DataColumnHandle& column) const
+{
+    static const DataColumnIndexPtr NullIndex = nullptr;
+
+    if (!column.IsValid() || column.Index >= ConvertInt32(m_indexes.size()))
+        return NullIndex;
+
+    return m_indexes[column.Index];
+}
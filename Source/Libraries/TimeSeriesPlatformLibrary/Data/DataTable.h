@@ -26,6 +26,8 @@
 
 #include "../Common/CommonTypes.h"
 #include "DataColumn.h"
+#include "DataColumnStorage.h"
+#include "DataColumnIndex.h"
 #include "DataRow.h"
 
 namespace GSF {
@@ -46,7 +48,30 @@ namespace Data
         std::string m_name;
         GSF::StringMap<int32_t> m_columnIndexes;
         std::vector<DataColumnPtr> m_columns;
+        std::vector<DataColumnStoragePtr> m_columnStorage;
         std::vector<DataRowPtr> m_rows;
+        std::vector<DataColumnIndexPtr> m_indexes;
+        std::vector<int32_t> m_rowPositions;
+        std::vector<DataColumnStoragePtr> m_computedStorage;
+        std::vector<int32_t> m_materializedColumns;
+        GSF::SharedMutex m_computedValuesLock;
+        std::vector<int32_t> m_freeSlots;
+        int32_t m_storageCount;
+
+        // Allocates a storage slot in each column for a new row, reusing released slots first
+        int32_t AllocateRowStorage();
+
+        // Releases storage slot of a row that was never added to table so a new row can reuse it
+        void ReleaseRowStorage(int32_t slot);
+
+        // Clears materialized values, for row storage slot, of computed columns that depend on column
+        void InvalidateComputedValues(int32_t columnIndex, int32_t slot);
+
+        const DataColumnStorage& ValidateLookupColumn(const DataColumnHandle& column, DataType keyType) const;
+
+        // Gets positions, in row order, of rows with column values within range, null bounds are open
+        template<class T>
+        void FindPositions(const DataColumnHandle& column, const T* lower, bool lowerInclusive, const T* upper, bool upperInclusive, std::vector<int32_t>& positions) const;
 
     public:
         DataTable(DataSetPtr parent, std::string name);
@@ -66,6 +91,9 @@ namespace Data
 
         const DataColumnPtr& operator[](int32_t index) const;
 
+        // Gets handle for typed row access, handle is invalid when column does not exist
+        DataColumnHandle ColumnHandle(const std::string& columnName) const;
+
         DataColumnPtr CreateColumn(const std::string& name, DataType type, std::string expression = std::string{});
 
         DataColumnPtr CloneColumn(const DataColumnPtr& source);
@@ -74,6 +102,9 @@ namespace Data
 
         const DataRowPtr& Row(int32_t index);
 
+        // Adds row created by this table, row values are stored by the table that created the row, so rows of
+        // other tables must be copied with CloneRow. Throws DataSetException for a null row, a row of another
+        // table, a row that was already added or a row that violates a unique index.
         void AddRow(DataRowPtr row);
 
         DataRowPtr CreateRow();
@@ -82,9 +113,147 @@ namespace Data
 
         int32_t RowCount() const;
 
+        // Gets position of row within table, -1 when row has not been added to table
+        int32_t RowPosition(const DataRowPtr& row) const;
+
+        // Gets storage slots of rows in row order, values of a row are at its slot in column storage
+        void GetRowSlots(std::vector<int32_t>& slots) const;
+
+        // Gets storage of a stored column for reading values a column at a time, null for computed columns
+        // or invalid handles. Storage remains valid until rows or columns of table are changed.
+        const DataColumnStorage* ColumnStorage(const DataColumnHandle& column) const;
+
+        // Creates an index on a stored column, replacing any existing index for the column. Rows are
+        // indexed as they are added to the table and re-indexed when their column value changes.
+        void CreateIndex(const std::string& columnName, DataColumnIndexType type = DataColumnIndexType::Hash);
+
+        void RemoveIndex(const std::string& columnName);
+
+        // Gets index for column, null when column is not indexed
+        const DataColumnIndexPtr& Index(const DataColumnHandle& column) const;
+
+        // Materializes values of a computed column into column storage so expression is evaluated once per row,
+        // cached values are re-evaluated after any column the expression depends on changes. Expressions that use
+        // time functions, e.g., NOW(), keep the value computed on first read. Values of rows in table are computed
+        // here, values of rows added or changed later are computed on first read, which can be on any thread.
+        void MaterializeColumn(const std::string& columnName);
+
+        bool IsMaterialized(const DataColumnHandle& column) const;
+
+        // Lookups use the column index when one exists, otherwise rows are scanned. Value type must match
+        // column type, e.g., std::string for String columns, and string values compare case-insensitively.
+        template<class T>
+        const DataRowPtr& FindRow(const DataColumnHandle& column, const T& value) const;
+
+        template<class T>
+        std::vector<DataRowPtr> FindRows(const DataColumnHandle& column, const T& value) const;
+
+        // Gets rows, in row order, with column values within range, null bounds are open
+        template<class T>
+        std::vector<DataRowPtr> FindRowsInRange(const DataColumnHandle& column, const T* lower, bool lowerInclusive, const T* upper, bool upperInclusive) const;
+
+        // Gets rows, in row order, with string column values that start with prefix, case-insensitive.
+        // An ordered column index is used when one exists, otherwise rows are scanned.
+        std::vector<DataRowPtr> FindRowsWithPrefix(const DataColumnHandle& column, const std::string& prefix) const;
+
+        // Gets all rows ordered by column value from an ordered column index, rows with null values sort first in
+        // ascending order and rows with equal values are in row order. Returns false when column has no ordered index.
+        bool TryGetOrderedRows(const DataColumnHandle& column, bool ascending, std::vector<DataRowPtr>& rows) const;
+
         static const DataTablePtr NullPtr;
+
+        friend class DataRow;
     };
 
+    template<class T>
+    void DataTable::FindPositions(const DataColumnHandle& column, const T* lower, bool lowerInclusive, const T* upper, bool upperInclusive, std::vector<int32_t>& positions) const
+    {
+        typedef DataColumnKey<T> Key;
+        const DataColumnStorage& storage = ValidateLookupColumn(column, Key::Type);
+        const DataColumnIndexPtr& index = m_indexes[column.Index];
+        const bool equality = lower != nullptr && lower == upper && lowerInclusive && upperInclusive;
+
+        if (index != nullptr && (equality || index->Type() == DataColumnIndexType::Ordered))
+        {
+            const TypedDataColumnIndex<T>& typedIndex = static_cast<const TypedDataColumnIndex<T>&>(*index);
+
+            if (equality)
+            {
+                typedIndex.Find(*lower, positions);
+            }
+            else
+            {
+                typedIndex.FindRange(lower, lowerInclusive, upper, upperInclusive, positions);
+                std::sort(positions.begin(), positions.end());
+            }
+
+            return;
+        }
+
+        const typename Key::Storage& typedStorage = static_cast<const typename Key::Storage&>(storage);
+        const typename Key::Equal equal;
+        const typename Key::Less less;
+
+        for (int32_t position = 0; position < ConvertInt32(m_rows.size()); position++)
+        {
+            const int32_t slot = m_rows[position]->m_index;
+
+            if (typedStorage.IsNull(slot))
+                continue;
+
+            const T value = typedStorage.GetValue(slot);
+
+            if (equality)
+            {
+                if (equal(value, *lower))
+                    positions.push_back(position);
+
+                continue;
+            }
+
+            if (lower != nullptr && (lowerInclusive ? less(value, *lower) : !less(*lower, value)))
+                continue;
+
+            if (upper != nullptr && (upperInclusive ? less(*upper, value) : !less(value, *upper)))
+                continue;
+
+            positions.push_back(position);
+        }
+    }
+
+    template<class T>
+    const DataRowPtr& DataTable::FindRow(const DataColumnHandle& column, const T& value) const
+    {
+        std::vector<int32_t> positions;
+        FindPositions<T>(column, &value, true, &value, true, positions);
+
+        if (positions.empty())
+            return DataRow::NullPtr;
+
+        return m_rows[positions[0]];
+    }
+
+    template<class T>
+    std::vector<DataRowPtr> DataTable::FindRows(const DataColumnHandle& column, const T& value) const
+    {
+        return FindRowsInRange<T>(column, &value, true, &value, true);
+    }
+
+    template<class T>
+    std::vector<DataRowPtr> DataTable::FindRowsInRange(const DataColumnHandle& column, const T* lower, bool lowerInclusive, const T* upper, bool upperInclusive) const
+    {
+        std::vector<int32_t> positions;
+        FindPositions<T>(column, lower, lowerInclusive, upper, upperInclusive, positions);
+
+        std::vector<DataRowPtr> rows;
+        rows.reserve(positions.size());
+
+        for (const int32_t position : positions)
+            rows.push_back(m_rows[position]);
+
+        return rows;
+    }
+
     typedef GSF::SharedPtr<DataTable> DataTablePtr;
 }}
 
@@ -0,0 +1,681 @@
+//******************************************************************************************************
+//  BatchEvaluator.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "BatchEvaluator.h"
+#include "CompiledExpression.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+using namespace GSF::FilterExpressions;
+
+enum class BatchOperation
+{
+    Scan,
+    Row,
+    Not,
+    And,
+    Or
+};
+
+struct BatchEvaluator::BatchNode
+{
+    BatchOperation Operation = BatchOperation::Scan;
+    BatchNodePtr LeftValue;
+    BatchNodePtr RightValue;
+    ColumnScan Scan;
+    CompiledExpressionPtr Compiled;
+    Bitmap Values;
+    Bitmap Nulls;
+};
+
+// Gets expression value type of column values, Undefined for columns without a static value type
+static ExpressionValueType GetColumnValueType(const DataType type)
+{
+    switch (type)
+    {
+        case DataType::String:
+            return ExpressionValueType::String;
+        case DataType::Boolean:
+            return ExpressionValueType::Boolean;
+        case DataType::DateTime:
+            return ExpressionValueType::DateTime;
+        case DataType::Single:
+        case DataType::Double:
+            return ExpressionValueType::Double;
+        case DataType::Decimal:
+            return ExpressionValueType::Decimal;
+        case DataType::Guid:
+            return ExpressionValueType::Guid;
+        case DataType::Int8:
+        case DataType::Int16:
+        case DataType::Int32:
+        case DataType::UInt8:
+        case DataType::UInt16:
+            return ExpressionValueType::Int32;
+        case DataType::Int64:
+        case DataType::UInt32:
+            return ExpressionValueType::Int64;
+        default:
+            return ExpressionValueType::Undefined;
+    }
+}
+
+// Gets operator that gives the same result with operands swapped
+static ExpressionOperatorType MirrorOperator(const ExpressionOperatorType operatorType)
+{
+    switch (operatorType)
+    {
+        case ExpressionOperatorType::LessThan:
+            return ExpressionOperatorType::GreaterThan;
+        case ExpressionOperatorType::LessThanOrEqual:
+            return ExpressionOperatorType::GreaterThanOrEqual;
+        case ExpressionOperatorType::GreaterThan:
+            return ExpressionOperatorType::LessThan;
+        case ExpressionOperatorType::GreaterThanOrEqual:
+            return ExpressionOperatorType::LessThanOrEqual;
+        default:
+            return operatorType;
+    }
+}
+
+// Tests value of each row that is not null, results are packed into bitmaps 64 rows per word. When
+// slots are empty, slot of each row is its position so null bits are read a word at a time.
+template<class TTest>
+static void ScanColumn(const DataColumnStorage& storage, const vector<int32_t>& slots, const int32_t count, vector<uint64_t>& values, vector<uint64_t>& nulls, const TTest& test)
+{
+    for (int32_t word = 0; word * 64 < count; word++)
+    {
+        const int32_t start = word * 64;
+        const int32_t end = min(count, start + 64);
+        uint64_t valueBits = 0ULL, nullBits = 0ULL;
+
+        if (slots.empty())
+        {
+            const uint64_t assignedBits = storage.ValueBits(word);
+
+            for (int32_t i = start; i < end; i++)
+            {
+                const uint64_t bit = 1ULL << (i - start);
+
+                if ((assignedBits & bit) != 0ULL && test(i))
+                    valueBits |= bit;
+            }
+
+            nullBits = ~assignedBits;
+        }
+        else
+        {
+            for (int32_t i = start; i < end; i++)
+            {
+                const int32_t slot = slots[i];
+                const uint64_t bit = 1ULL << (i - start);
+
+                if (storage.IsNull(slot))
+                    nullBits |= bit;
+                else if (test(slot))
+                    valueBits |= bit;
+            }
+        }
+
+        values[word] = valueBits;
+        nulls[word] = nullBits;
+    }
+}
+
+template<class TTest>
+static function<void(const vector<int32_t>&, int32_t, vector<uint64_t>&, vector<uint64_t>&)> CreateScan(const DataColumnStorage& storage, TTest test)
+{
+    const DataColumnStorage* columnStorage = &storage;
+
+    return [columnStorage, test](const vector<int32_t>& slots, const int32_t count, vector<uint64_t>& values, vector<uint64_t>& nulls)
+    {
+        ScanColumn(*columnStorage, slots, count, values, nulls, test);
+    };
+}
+
+// Compares column values to a literal, column values are converted to their expression value type
+// then to comparison value type, the same as row evaluation
+template<class TColumn, class TValue, class T>
+static function<void(const vector<int32_t>&, int32_t, vector<uint64_t>&, vector<uint64_t>&)> CreateComparison(const DataColumnStorage& storage, const ExpressionOperatorType operatorType, const T& literal)
+{
+    const TypedDataColumnStorage<TColumn>* typedStorage = static_cast<const TypedDataColumnStorage<TColumn>*>(&storage);
+
+    const auto value = [typedStorage](const int32_t slot)
+    {
+        return static_cast<T>(static_cast<TValue>(typedStorage->GetValue(slot)));
+    };
+
+    switch (operatorType)
+    {
+        case ExpressionOperatorType::LessThan:
+            return CreateScan(storage, [value, literal](const int32_t slot) { return value(slot) < literal; });
+        case ExpressionOperatorType::LessThanOrEqual:
+            return CreateScan(storage, [value, literal](const int32_t slot) { return value(slot) <= literal; });
+        case ExpressionOperatorType::GreaterThan:
+            return CreateScan(storage, [value, literal](const int32_t slot) { return value(slot) > literal; });
+        case ExpressionOperatorType::GreaterThanOrEqual:
+            return CreateScan(storage, [value, literal](const int32_t slot) { return value(slot) >= literal; });
+        case ExpressionOperatorType::Equal:
+        case ExpressionOperatorType::EqualExactMatch:
+            return CreateScan(storage, [value, literal](const int32_t slot) { return value(slot) == literal; });
+        case ExpressionOperatorType::NotEqual:
+        case ExpressionOperatorType::NotEqualExactMatch:
+            return CreateScan(storage, [value, literal](const int32_t slot) { return value(slot) != literal; });
+        default:
+            return nullptr;
+    }
+}
+
+template<class T>
+static function<void(const vector<int32_t>&, int32_t, vector<uint64_t>&, vector<uint64_t>&)> CreateNumericComparison(const DataType columnType, const DataColumnStorage& storage, const ExpressionOperatorType operatorType, const T& literal)
+{
+    switch (columnType)
+    {
+        case DataType::Int8:
+            return CreateComparison<int8_t, int32_t>(storage, operatorType, literal);
+        case DataType::Int16:
+            return CreateComparison<int16_t, int32_t>(storage, operatorType, literal);
+        case DataType::Int32:
+            return CreateComparison<int32_t, int32_t>(storage, operatorType, literal);
+        case DataType::UInt8:
+            return CreateComparison<uint8_t, int32_t>(storage, operatorType, literal);
+        case DataType::UInt16:
+            return CreateComparison<uint16_t, int32_t>(storage, operatorType, literal);
+        case DataType::Int64:
+            return CreateComparison<int64_t, int64_t>(storage, operatorType, literal);
+        case DataType::UInt32:
+            return CreateComparison<uint32_t, int64_t>(storage, operatorType, literal);
+        case DataType::Single:
+            return CreateComparison<float32_t, float64_t>(storage, operatorType, literal);
+        case DataType::Double:
+            return CreateComparison<float64_t, float64_t>(storage, operatorType, literal);
+        case DataType::Decimal:
+            return CreateComparison<decimal_t, decimal_t>(storage, operatorType, literal);
+        default:
+            return nullptr;
+    }
+}
+
+// String equality ignores case unless exact match is requested, ordering always ignores case
+static function<void(const vector<int32_t>&, int32_t, vector<uint64_t>&, vector<uint64_t>&)> CreateStringComparison(const DataColumnStorage& storage, const ExpressionOperatorType operatorType, const string& literal)
+{
+    const StringDataColumnStorage* stringStorage = static_cast<const StringDataColumnStorage*>(&storage);
+
+    const auto value = [stringStorage](const int32_t slot)
+    {
+        return string_view(stringStorage->GetData(slot), stringStorage->GetLength(slot));
+    };
+
+    switch (operatorType)
+    {
+        case ExpressionOperatorType::LessThan:
+            return CreateScan(storage, [value, literal](const int32_t slot) { return CompareIgnoreCase(value(slot), literal) < 0; });
+        case ExpressionOperatorType::LessThanOrEqual:
+            return CreateScan(storage, [value, literal](const int32_t slot) { return CompareIgnoreCase(value(slot), literal) <= 0; });
+        case ExpressionOperatorType::GreaterThan:
+            return CreateScan(storage, [value, literal](const int32_t slot) { return CompareIgnoreCase(value(slot), literal) > 0; });
+        case ExpressionOperatorType::GreaterThanOrEqual:
+            return CreateScan(storage, [value, literal](const int32_t slot) { return CompareIgnoreCase(value(slot), literal) >= 0; });
+        case ExpressionOperatorType::Equal:
+            return CreateScan(storage, [value, literal](const int32_t slot) { return IsEqualIgnoreCase(value(slot), literal); });
+        case ExpressionOperatorType::EqualExactMatch:
+            return CreateScan(storage, [value, literal](const int32_t slot) { return value(slot) == literal; });
+        case ExpressionOperatorType::NotEqual:
+            return CreateScan(storage, [value, literal](const int32_t slot) { return !IsEqualIgnoreCase(value(slot), literal); });
+        case ExpressionOperatorType::NotEqualExactMatch:
+            return CreateScan(storage, [value, literal](const int32_t slot) { return value(slot) != literal; });
+        default:
+            return nullptr;
+    }
+}
+
+BatchEvaluator::BatchEvaluator(ExpressionTree& expressionTree) :
+    m_expressionTree(expressionTree),
+    m_rowCount(0)
+{
+}
+
+bool BatchEvaluator::TryGetMatchingPositions(vector<int32_t>& positions)
+{
+    if (m_expressionTree.Root == nullptr)
+        return false;
+
+    m_rowNodes.clear();
+
+    const BatchNodePtr root = Plan(m_expressionTree.Root);
+
+    // Root that needs row evaluation gains nothing from batch evaluation
+    if (root == nullptr || root->Operation == BatchOperation::Row)
+        return false;
+
+    const DataTablePtr& table = m_expressionTree.Table();
+
+    m_rowCount = table->RowCount();
+    m_slots.clear();
+    table->GetRowSlots(m_slots);
+
+    // Slots are only needed when rows are not stored in row order
+    bool slotsInRowOrder = true;
+
+    for (int32_t i = 0; i < m_rowCount && slotsInRowOrder; i++)
+        slotsInRowOrder = m_slots[i] == i;
+
+    if (slotsInRowOrder)
+        m_slots.clear();
+
+    EvaluateRows();
+    Evaluate(*root);
+
+    const int32_t count = m_rowCount;
+    const int32_t wordCount = ConvertInt32(root->Values.size());
+
+    // Rows match when result is true and not Null
+    for (int32_t word = 0; word < wordCount; word++)
+    {
+        uint64_t bits = root->Values[word] & ~root->Nulls[word];
+
+        for (int32_t position = word * 64; bits != 0ULL && position < count; position++, bits >>= 1)
+        {
+            if ((bits & 1ULL) != 0ULL)
+                positions.push_back(position);
+        }
+    }
+
+    return true;
+}
+
+BatchEvaluator::BatchNodePtr BatchEvaluator::Plan(const ExpressionPtr& expression)
+{
+    BatchNodePtr node = nullptr;
+
+    switch (expression->Type)
+    {
+        case ExpressionType::Value:
+            node = PlanValue(expression);
+            break;
+        case ExpressionType::Column:
+            node = PlanColumn(expression);
+            break;
+        case ExpressionType::Unary:
+        {
+            const UnaryExpressionPtr unaryExpression = CastSharedPtr<UnaryExpression>(expression);
+
+            if (unaryExpression->UnaryType != ExpressionUnaryType::Not)
+                break;
+
+            const BatchNodePtr value = Plan(unaryExpression->Value);
+
+            if (value == nullptr)
+                break;
+
+            node = NewSharedPtr<BatchNode>();
+            node->Operation = BatchOperation::Not;
+            node->LeftValue = value;
+            break;
+        }
+        case ExpressionType::Operator:
+        {
+            const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
+
+            switch (operatorExpression->OperatorType)
+            {
+                case ExpressionOperatorType::And:
+                case ExpressionOperatorType::Or:
+                {
+                    const size_t rowNodeCount = m_rowNodes.size();
+                    const BatchNodePtr leftValue = Plan(operatorExpression->LeftValue);
+                    const BatchNodePtr rightValue = leftValue == nullptr ? nullptr : Plan(operatorExpression->RightValue);
+
+                    if (leftValue == nullptr || rightValue == nullptr)
+                    {
+                        // Operation is evaluated per row as a whole
+                        m_rowNodes.resize(rowNodeCount);
+                        break;
+                    }
+
+                    node = NewSharedPtr<BatchNode>();
+                    node->Operation = operatorExpression->OperatorType == ExpressionOperatorType::And ? BatchOperation::And : BatchOperation::Or;
+                    node->LeftValue = leftValue;
+                    node->RightValue = rightValue;
+                    break;
+                }
+                case ExpressionOperatorType::IsNull:
+                case ExpressionOperatorType::IsNotNull:
+                    node = PlanNullTest(operatorExpression);
+                    break;
+                default:
+                    node = PlanComparison(operatorExpression);
+                    break;
+            }
+
+            break;
+        }
+        default:
+            break;
+    }
+
+    if (node == nullptr)
+        node = PlanRowEvaluation(expression);
+
+    return node;
+}
+
+BatchEvaluator::BatchNodePtr BatchEvaluator::PlanComparison(const OperatorExpressionPtr& expression) const
+{
+    ExpressionOperatorType operatorType = expression->OperatorType;
+
+    switch (operatorType)
+    {
+        case ExpressionOperatorType::LessThan:
+        case ExpressionOperatorType::LessThanOrEqual:
+        case ExpressionOperatorType::GreaterThan:
+        case ExpressionOperatorType::GreaterThanOrEqual:
+        case ExpressionOperatorType::Equal:
+        case ExpressionOperatorType::EqualExactMatch:
+        case ExpressionOperatorType::NotEqual:
+        case ExpressionOperatorType::NotEqualExactMatch:
+            break;
+        default:
+            return nullptr;
+    }
+
+    ExpressionPtr columnExpression = expression->LeftValue;
+    ExpressionPtr valueExpression = expression->RightValue;
+
+    // Literal on left is compared with mirrored operator
+    if (columnExpression->Type == ExpressionType::Value)
+    {
+        swap(columnExpression, valueExpression);
+        operatorType = MirrorOperator(operatorType);
+    }
+
+    const DataColumnStorage* storage = GetColumnStorage(columnExpression);
+
+    if (storage == nullptr || valueExpression->Type != ExpressionType::Value)
+        return nullptr;
+
+    const DataType columnType = CastSharedPtr<ColumnExpression>(columnExpression)->DataColumn->Type();
+    const ExpressionValueType columnValueType = GetColumnValueType(columnType);
+    ValueExpressionPtr literal = CastSharedPtr<ValueExpression>(valueExpression);
+
+    // Comparisons with Null are left to row evaluation
+    if (columnValueType == ExpressionValueType::Undefined || literal->ValueType == ExpressionValueType::Undefined || literal->IsNull())
+        return nullptr;
+
+    ExpressionValueType valueType;
+
+    try
+    {
+        const bool columnIsLeft = columnExpression == expression->LeftValue;
+        const ExpressionValueType leftValueType = columnIsLeft ? columnValueType : literal->ValueType;
+        const ExpressionValueType rightValueType = columnIsLeft ? literal->ValueType : columnValueType;
+
+        valueType = m_expressionTree.DeriveComparisonOperationValueType(expression->OperatorType, leftValueType, rightValueType);
+        literal = m_expressionTree.Convert(literal, valueType);
+    }
+    catch (...)
+    {
+        // Operation errors are reported by row evaluation
+        return nullptr;
+    }
+
+    // Column values are only converted between numeric types, other conversions are left to row evaluation
+    if (columnValueType != valueType && !(IsNumericType(columnValueType) && IsNumericType(valueType)))
+        return nullptr;
+
+    ColumnScan scan;
+
+    switch (valueType)
+    {
+        case ExpressionValueType::Boolean:
+            scan = CreateComparison<bool, bool>(*storage, operatorType, literal->ValueAsBoolean());
+            break;
+        case ExpressionValueType::Int32:
+            scan = CreateNumericComparison(columnType, *storage, operatorType, literal->ValueAsInt32());
+            break;
+        case ExpressionValueType::Int64:
+            scan = CreateNumericComparison(columnType, *storage, operatorType, literal->ValueAsInt64());
+            break;
+        case ExpressionValueType::Decimal:
+            scan = CreateNumericComparison(columnType, *storage, operatorType, literal->ValueAsDecimal());
+            break;
+        case ExpressionValueType::Double:
+            scan = CreateNumericComparison(columnType, *storage, operatorType, literal->ValueAsDouble());
+            break;
+        case ExpressionValueType::String:
+            scan = CreateStringComparison(*storage, operatorType, literal->ValueAsString());
+            break;
+        case ExpressionValueType::Guid:
+            scan = CreateComparison<Guid, Guid>(*storage, operatorType, literal->ValueAsGuid());
+            break;
+        case ExpressionValueType::DateTime:
+            scan = CreateComparison<datetime_t, datetime_t>(*storage, operatorType, literal->ValueAsDateTime());
+            break;
+        default:
+            break;
+    }
+
+    if (scan == nullptr)
+        return nullptr;
+
+    BatchNodePtr node = NewSharedPtr<BatchNode>();
+    node->Scan = std::move(scan);
+    return node;
+}
+
+BatchEvaluator::BatchNodePtr BatchEvaluator::PlanNullTest(const OperatorExpressionPtr& expression) const
+{
+    const DataColumnStorage* storage = GetColumnStorage(expression->LeftValue);
+
+    // Null tests of columns without a static value type are left to row evaluation
+    if (storage == nullptr || GetColumnValueType(CastSharedPtr<ColumnExpression>(expression->LeftValue)->DataColumn->Type()) == ExpressionValueType::Undefined)
+        return nullptr;
+
+    const bool isNotNull = expression->OperatorType == ExpressionOperatorType::IsNotNull;
+
+    // Null test result is never Null
+    BatchNodePtr node = NewSharedPtr<BatchNode>();
+
+    node->Scan = [storage, isNotNull](const vector<int32_t>& slots, const int32_t count, Bitmap& values, Bitmap& nulls)
+    {
+        ScanColumn(*storage, slots, count, values, nulls, [](int32_t) { return true; });
+
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            values[i] = isNotNull ? values[i] : nulls[i];
+            nulls[i] = 0ULL;
+        }
+    };
+
+    return node;
+}
+
+BatchEvaluator::BatchNodePtr BatchEvaluator::PlanColumn(const ExpressionPtr& expression) const
+{
+    const DataColumnStorage* storage = GetColumnStorage(expression);
+
+    if (storage == nullptr || CastSharedPtr<ColumnExpression>(expression)->DataColumn->Type() != DataType::Boolean)
+        return nullptr;
+
+    const TypedDataColumnStorage<bool>* booleanStorage = static_cast<const TypedDataColumnStorage<bool>*>(storage);
+
+    BatchNodePtr node = NewSharedPtr<BatchNode>();
+    node->Scan = CreateScan(*storage, [booleanStorage](const int32_t slot) { return booleanStorage->GetValue(slot); });
+    return node;
+}
+
+BatchEvaluator::BatchNodePtr BatchEvaluator::PlanValue(const ExpressionPtr& expression) const
+{
+    const ValueExpressionPtr value = CastSharedPtr<ValueExpression>(expression);
+
+    if (value->ValueType != ExpressionValueType::Boolean)
+        return nullptr;
+
+    const bool isNull = value->IsNull();
+    const bool result = !isNull && value->ValueAsBoolean();
+
+    BatchNodePtr node = NewSharedPtr<BatchNode>();
+
+    node->Scan = [isNull, result](const vector<int32_t>&, int32_t, Bitmap& values, Bitmap& nulls)
+    {
+        fill(values.begin(), values.end(), result ? ~0ULL : 0ULL);
+        fill(nulls.begin(), nulls.end(), isNull ? ~0ULL : 0ULL);
+    };
+
+    return node;
+}
+
+BatchEvaluator::BatchNodePtr BatchEvaluator::PlanRowEvaluation(const ExpressionPtr& expression)
+{
+    const CompiledExpressionPtr compiled = ExpressionCompiler(m_expressionTree).Compile(expression);
+
+    // Only boolean results can be combined with batch results
+    if (compiled == nullptr || compiled->ValueType != ExpressionValueType::Boolean)
+        return nullptr;
+
+    BatchNodePtr node = NewSharedPtr<BatchNode>();
+    node->Operation = BatchOperation::Row;
+    node->Compiled = compiled;
+    m_rowNodes.push_back(node);
+
+    return node;
+}
+
+const DataColumnStorage* BatchEvaluator::GetColumnStorage(const ExpressionPtr& expression) const
+{
+    if (expression->Type != ExpressionType::Column)
+        return nullptr;
+
+    const DataColumnPtr& column = CastSharedPtr<ColumnExpression>(expression)->DataColumn;
+
+    if (column == nullptr || column->Computed())
+        return nullptr;
+
+    return m_expressionTree.Table()->ColumnStorage(DataColumnHandle(column->Index(), column->Type()));
+}
+
+void BatchEvaluator::EvaluateRows()
+{
+    if (m_rowNodes.empty())
+        return;
+
+    const DataTablePtr& table = m_expressionTree.Table();
+    const int32_t count = m_rowCount;
+    const size_t wordCount = (static_cast<size_t>(m_rowCount) + 63) / 64;
+
+    for (const BatchNodePtr& node : m_rowNodes)
+    {
+        node->Values.assign(wordCount, 0ULL);
+        node->Nulls.assign(wordCount, 0ULL);
+    }
+
+    // Rows are evaluated in order, and sub-expressions in expression order, so that
+    // the first error raised is the same as for row evaluation
+    try
+    {
+        for (int32_t i = 0; i < count; i++)
+        {
+            const DataRowPtr& row = table->Row(i);
+            const uint64_t bit = 1ULL << (i % 64);
+
+            m_expressionTree.m_currentRow = row;
+
+            for (const BatchNodePtr& node : m_rowNodes)
+            {
+                bool isNull = false;
+
+                if (node->Compiled->EvaluateBoolean(row, isNull))
+                    node->Values[i / 64] |= bit;
+
+                if (isNull)
+                    node->Nulls[i / 64] |= bit;
+            }
+        }
+
+        m_expressionTree.m_currentRow = nullptr;
+    }
+    catch (...)
+    {
+        m_expressionTree.m_currentRow = nullptr;
+        throw;
+    }
+}
+
+void BatchEvaluator::Evaluate(BatchNode& node) const
+{
+    const size_t wordCount = (static_cast<size_t>(m_rowCount) + 63) / 64;
+
+    switch (node.Operation)
+    {
+        case BatchOperation::Scan:
+            node.Values.resize(wordCount);
+            node.Nulls.resize(wordCount);
+            node.Scan(m_slots, m_rowCount, node.Values, node.Nulls);
+            break;
+        case BatchOperation::Row:
+            break;
+        case BatchOperation::Not:
+        {
+            BatchNode& value = *node.LeftValue;
+            Evaluate(value);
+
+            // NOT of Null is Null
+            node.Values.resize(wordCount);
+            node.Nulls = std::move(value.Nulls);
+
+            for (size_t i = 0; i < wordCount; i++)
+                node.Values[i] = ~value.Values[i];
+
+            break;
+        }
+        case BatchOperation::And:
+        case BatchOperation::Or:
+        {
+            BatchNode& leftValue = *node.LeftValue;
+            BatchNode& rightValue = *node.RightValue;
+            Evaluate(leftValue);
+            Evaluate(rightValue);
+
+            // If left or right value is Null, result is Null
+            node.Values.resize(wordCount);
+            node.Nulls.resize(wordCount);
+
+            if (node.Operation == BatchOperation::And)
+            {
+                for (size_t i = 0; i < wordCount; i++)
+                    node.Values[i] = leftValue.Values[i] & rightValue.Values[i];
+            }
+            else
+            {
+                for (size_t i = 0; i < wordCount; i++)
+                    node.Values[i] = leftValue.Values[i] | rightValue.Values[i];
+            }
+
+            for (size_t i = 0; i < wordCount; i++)
+                node.Nulls[i] = leftValue.Nulls[i] | rightValue.Nulls[i];
+
+            break;
+        }
+    }
+}
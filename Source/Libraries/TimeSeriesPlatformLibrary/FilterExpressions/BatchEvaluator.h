@@ -0,0 +1,76 @@
+//******************************************************************************************************
+//  BatchEvaluator.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __BATCH_EVALUATOR_H
+#define __BATCH_EVALUATOR_H
+
+#include "ExpressionTree.h"
+#include <functional>
+
+namespace GSF {
+namespace FilterExpressions
+{
+    // Evaluates a filter expression for all rows of its table a column at a time, rather than a row at a time,
+    // producing the positions of matching rows. Comparisons of stored columns to literals, IS NULL tests, boolean
+    // columns, NOT, AND and OR are evaluated directly over column storage into value and null bitmaps, 64 rows per
+    // word. Other boolean sub-expressions are compiled and evaluated for each row, in row order, so results and
+    // errors are the same as evaluating the expression for each row.
+    class BatchEvaluator
+    {
+    private:
+        typedef std::vector<uint64_t> Bitmap;
+        // Scans column values of rows into bitmaps, slots of rows are empty when rows are stored in row order
+        typedef std::function<void(const std::vector<int32_t>&, int32_t, Bitmap&, Bitmap&)> ColumnScan;
+
+        struct BatchNode;
+        typedef GSF::SharedPtr<BatchNode> BatchNodePtr;
+
+        ExpressionTree& m_expressionTree;
+        std::vector<int32_t> m_slots;
+        int32_t m_rowCount;
+        std::vector<BatchNodePtr> m_rowNodes;
+
+        BatchNodePtr Plan(const ExpressionPtr& expression);
+        BatchNodePtr PlanComparison(const OperatorExpressionPtr& expression) const;
+        BatchNodePtr PlanNullTest(const OperatorExpressionPtr& expression) const;
+        BatchNodePtr PlanColumn(const ExpressionPtr& expression) const;
+        BatchNodePtr PlanValue(const ExpressionPtr& expression) const;
+        BatchNodePtr PlanRowEvaluation(const ExpressionPtr& expression);
+
+        // Gets storage of a stored column expression, null when expression is not a stored column
+        const GSF::Data::DataColumnStorage* GetColumnStorage(const ExpressionPtr& expression) const;
+
+        void EvaluateRows();
+        void Evaluate(BatchNode& node) const;
+
+    public:
+        BatchEvaluator(ExpressionTree& expressionTree);
+
+        // Gets positions of rows that match expression in row order, returns false when expression cannot
+        // be evaluated in batch, e.g., root expression is not boolean, so rows need to be evaluated one at
+        // a time. Caller starts evaluation pass with ExpressionTree::BeginEvaluation.
+        bool TryGetMatchingPositions(std::vector<int32_t>& positions);
+    };
+}}
+
+#endif
@@ -0,0 +1,1719 @@
+//******************************************************************************************************
+//  CompiledExpression.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "CompiledExpression.h"
+#include "ExpressionOptimizer.h"
+#include <unordered_set>
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+using namespace GSF::FilterExpressions;
+
+namespace GSF {
+namespace FilterExpressions
+{
+    template<class T>
+    constexpr ExpressionValueType ValueTypeOf()
+    {
+        if constexpr (is_same_v<T, bool>)
+            return ExpressionValueType::Boolean;
+        else if constexpr (is_same_v<T, int32_t>)
+            return ExpressionValueType::Int32;
+        else if constexpr (is_same_v<T, int64_t>)
+            return ExpressionValueType::Int64;
+        else if constexpr (is_same_v<T, decimal_t>)
+            return ExpressionValueType::Decimal;
+        else if constexpr (is_same_v<T, float64_t>)
+            return ExpressionValueType::Double;
+        else if constexpr (is_same_v<T, Guid>)
+            return ExpressionValueType::Guid;
+        else
+            return ExpressionValueType::DateTime;
+    }
+
+    // Evaluates expression as target type, numeric conversions match ExpressionTree::Convert
+    template<class T>
+    T EvaluateAs(const CompiledExpression& expression, const DataRowPtr& row, bool& isNull)
+    {
+        if constexpr (is_same_v<T, Guid>)
+        {
+            return expression.EvaluateGuid(row, isNull);
+        }
+        else if constexpr (is_same_v<T, datetime_t>)
+        {
+            return expression.EvaluateDateTime(row, isNull);
+        }
+        else if constexpr (is_same_v<T, bool>)
+        {
+            switch (expression.ValueType)
+            {
+                case ExpressionValueType::Boolean:
+                    return expression.EvaluateBoolean(row, isNull);
+                case ExpressionValueType::Int32:
+                    return expression.EvaluateInt32(row, isNull) == 0;
+                case ExpressionValueType::Int64:
+                    return expression.EvaluateInt64(row, isNull) == 0LL;
+                case ExpressionValueType::Decimal:
+                    return expression.EvaluateDecimal(row, isNull) == decimal_t(0);
+                case ExpressionValueType::Double:
+                    return expression.EvaluateDouble(row, isNull) == 0.0; //-V550
+                default:
+                    throw ExpressionTreeException("Unexpected expression value type encountered");
+            }
+        }
+        else
+        {
+            switch (expression.ValueType)
+            {
+                case ExpressionValueType::Boolean:
+                    return static_cast<T>(expression.EvaluateBoolean(row, isNull) ? 1 : 0);
+                case ExpressionValueType::Int32:
+                    return static_cast<T>(expression.EvaluateInt32(row, isNull));
+                case ExpressionValueType::Int64:
+                    return static_cast<T>(expression.EvaluateInt64(row, isNull));
+                case ExpressionValueType::Decimal:
+                    return static_cast<T>(expression.EvaluateDecimal(row, isNull));
+                case ExpressionValueType::Double:
+                    return static_cast<T>(expression.EvaluateDouble(row, isNull));
+                default:
+                    throw ExpressionTreeException("Unexpected expression value type encountered");
+            }
+        }
+    }
+
+    // Base class for nodes with a single result type, routes typed evaluation to EvaluateValue
+    template<class T>
+    class TypedCompiledExpression : public CompiledExpression // NOLINT
+    {
+    public:
+        TypedCompiledExpression() :
+            CompiledExpression(ValueTypeOf<T>())
+        {
+        }
+
+        virtual T EvaluateValue(const DataRowPtr& row, bool& isNull) const = 0;
+
+        bool EvaluateBoolean(const DataRowPtr& row, bool& isNull) const override
+        {
+            if constexpr (is_same_v<T, bool>)
+                return EvaluateValue(row, isNull);
+            else
+                return CompiledExpression::EvaluateBoolean(row, isNull);
+        }
+
+        int32_t EvaluateInt32(const DataRowPtr& row, bool& isNull) const override
+        {
+            if constexpr (is_same_v<T, int32_t>)
+                return EvaluateValue(row, isNull);
+            else
+                return CompiledExpression::EvaluateInt32(row, isNull);
+        }
+
+        int64_t EvaluateInt64(const DataRowPtr& row, bool& isNull) const override
+        {
+            if constexpr (is_same_v<T, int64_t>)
+                return EvaluateValue(row, isNull);
+            else
+                return CompiledExpression::EvaluateInt64(row, isNull);
+        }
+
+        decimal_t EvaluateDecimal(const DataRowPtr& row, bool& isNull) const override
+        {
+            if constexpr (is_same_v<T, decimal_t>)
+                return EvaluateValue(row, isNull);
+            else
+                return CompiledExpression::EvaluateDecimal(row, isNull);
+        }
+
+        float64_t EvaluateDouble(const DataRowPtr& row, bool& isNull) const override
+        {
+            if constexpr (is_same_v<T, float64_t>)
+                return EvaluateValue(row, isNull);
+            else
+                return CompiledExpression::EvaluateDouble(row, isNull);
+        }
+    };
+
+    // Literal value, values converted at compile time are also literals
+    class CompiledConstant : public CompiledExpression // NOLINT
+    {
+    private:
+        const ValueExpressionPtr m_value;
+        const bool m_isNull;
+        bool m_booleanValue = false;
+        int32_t m_int32Value = 0;
+        int64_t m_int64Value = 0LL;
+        decimal_t m_decimalValue;
+        float64_t m_doubleValue = 0.0;
+        string m_stringValue;
+        Guid m_guidValue;
+        datetime_t m_dateTimeValue;
+
+    public:
+        explicit CompiledConstant(ValueExpressionPtr value) :
+            CompiledExpression(value->ValueType),
+            m_value(std::move(value)),
+            m_isNull(m_value->IsNull())
+        {
+            if (m_isNull)
+                return;
+
+            switch (ValueType)
+            {
+                case ExpressionValueType::Boolean:
+                    m_booleanValue = m_value->ValueAsBoolean();
+                    break;
+                case ExpressionValueType::Int32:
+                    m_int32Value = m_value->ValueAsInt32();
+                    break;
+                case ExpressionValueType::Int64:
+                    m_int64Value = m_value->ValueAsInt64();
+                    break;
+                case ExpressionValueType::Decimal:
+                    m_decimalValue = m_value->ValueAsDecimal();
+                    break;
+                case ExpressionValueType::Double:
+                    m_doubleValue = m_value->ValueAsDouble();
+                    break;
+                case ExpressionValueType::String:
+                    m_stringValue = m_value->ValueAsString();
+                    break;
+                case ExpressionValueType::Guid:
+                    m_guidValue = m_value->ValueAsGuid();
+                    break;
+                case ExpressionValueType::DateTime:
+                    m_dateTimeValue = m_value->ValueAsDateTime();
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        const ValueExpressionPtr& Value() const
+        {
+            return m_value;
+        }
+
+        ValueExpressionPtr Evaluate(const DataRowPtr&) const override
+        {
+            return m_value;
+        }
+
+        bool EvaluateBoolean(const DataRowPtr&, bool& isNull) const override
+        {
+            isNull = m_isNull;
+            return m_booleanValue;
+        }
+
+        int32_t EvaluateInt32(const DataRowPtr&, bool& isNull) const override
+        {
+            isNull = m_isNull;
+            return m_int32Value;
+        }
+
+        int64_t EvaluateInt64(const DataRowPtr&, bool& isNull) const override
+        {
+            isNull = m_isNull;
+            return m_int64Value;
+        }
+
+        decimal_t EvaluateDecimal(const DataRowPtr&, bool& isNull) const override
+        {
+            isNull = m_isNull;
+            return m_decimalValue;
+        }
+
+        float64_t EvaluateDouble(const DataRowPtr&, bool& isNull) const override
+        {
+            isNull = m_isNull;
+            return m_doubleValue;
+        }
+
+        Guid EvaluateGuid(const DataRowPtr&, bool& isNull) const override
+        {
+            isNull = m_isNull;
+            return m_guidValue;
+        }
+
+        datetime_t EvaluateDateTime(const DataRowPtr&, bool& isNull) const override
+        {
+            isNull = m_isNull;
+            return m_dateTimeValue;
+        }
+
+        string_view EvaluateString(const DataRowPtr&, bool& isNull, string&) const override
+        {
+            isNull = m_isNull;
+            return m_stringValue;
+        }
+    };
+
+    // Column value, column data types are mapped to expression value types as in ExpressionTree::EvaluateColumn
+    class CompiledColumn : public CompiledExpression // NOLINT
+    {
+    private:
+        const DataColumnPtr m_column;
+        const DataColumnHandle m_handle;
+
+        static ExpressionValueType GetValueType(const DataColumnPtr& column)
+        {
+            switch (column->Type())
+            {
+                case DataType::String:
+                    return ExpressionValueType::String;
+                case DataType::Boolean:
+                    return ExpressionValueType::Boolean;
+                case DataType::DateTime:
+                    return ExpressionValueType::DateTime;
+                case DataType::Single:
+                case DataType::Double:
+                    return ExpressionValueType::Double;
+                case DataType::Decimal:
+                    return ExpressionValueType::Decimal;
+                case DataType::Guid:
+                    return ExpressionValueType::Guid;
+                case DataType::Int8:
+                case DataType::Int16:
+                case DataType::Int32:
+                case DataType::UInt8:
+                case DataType::UInt16:
+                    return ExpressionValueType::Int32;
+                case DataType::Int64:
+                case DataType::UInt32:
+                    return ExpressionValueType::Int64;
+                default:
+                    throw ExpressionTreeException("Unexpected column data type encountered");
+            }
+        }
+
+        template<class T>
+        static T GetValue(const Nullable<T>& value, bool& isNull)
+        {
+            isNull = !value.HasValue();
+            return value.GetValueOrDefault();
+        }
+
+    public:
+        explicit CompiledColumn(DataColumnPtr column) :
+            CompiledExpression(GetValueType(column)),
+            m_column(std::move(column)),
+            m_handle(m_column->Index(), m_column->Type())
+        {
+        }
+
+        bool EvaluateBoolean(const DataRowPtr& row, bool& isNull) const override
+        {
+            return GetValue(row->ValueAsBoolean(m_handle.Index), isNull);
+        }
+
+        int32_t EvaluateInt32(const DataRowPtr& row, bool& isNull) const override
+        {
+            switch (m_handle.Type)
+            {
+                case DataType::Int8:
+                    return GetValue(CastAsNullable<int32_t>(row->ValueAsInt8(m_handle.Index)), isNull);
+                case DataType::Int16:
+                    return GetValue(CastAsNullable<int32_t>(row->ValueAsInt16(m_handle.Index)), isNull);
+                case DataType::UInt8:
+                    return GetValue(CastAsNullable<int32_t>(row->ValueAsUInt8(m_handle.Index)), isNull);
+                case DataType::UInt16:
+                    return GetValue(CastAsNullable<int32_t>(row->ValueAsUInt16(m_handle.Index)), isNull);
+                default:
+                    return GetValue(row->ValueAsInt32(m_handle.Index), isNull);
+            }
+        }
+
+        int64_t EvaluateInt64(const DataRowPtr& row, bool& isNull) const override
+        {
+            if (m_handle.Type == DataType::UInt32)
+                return GetValue(CastAsNullable<int64_t>(row->ValueAsUInt32(m_handle.Index)), isNull);
+
+            return GetValue(row->ValueAsInt64(m_handle.Index), isNull);
+        }
+
+        decimal_t EvaluateDecimal(const DataRowPtr& row, bool& isNull) const override
+        {
+            return GetValue(row->ValueAsDecimal(m_handle.Index), isNull);
+        }
+
+        float64_t EvaluateDouble(const DataRowPtr& row, bool& isNull) const override
+        {
+            if (m_handle.Type == DataType::Single)
+                return GetValue(CastAsNullable<float64_t>(row->ValueAsSingle(m_handle.Index)), isNull);
+
+            return GetValue(row->ValueAsDouble(m_handle.Index), isNull);
+        }
+
+        Guid EvaluateGuid(const DataRowPtr& row, bool& isNull) const override
+        {
+            return GetValue(row->ValueAsGuid(m_handle.Index), isNull);
+        }
+
+        datetime_t EvaluateDateTime(const DataRowPtr& row, bool& isNull) const override
+        {
+            return GetValue(row->ValueAsDateTime(m_handle.Index), isNull);
+        }
+
+        string_view EvaluateString(const DataRowPtr& row, bool& isNull, string& buffer) const override
+        {
+            // Stored strings are viewed in place, computed strings are copied to buffer
+            if (!m_column->Computed())
+            {
+                isNull = row->IsNull(m_handle);
+                return row->GetStringValue(m_handle);
+            }
+
+            buffer = GetValue(row->ValueAsString(m_handle.Index), isNull);
+            return buffer;
+        }
+    };
+
+    class CompiledUnary : public CompiledExpression // NOLINT
+    {
+    private:
+        const ExpressionUnaryType m_unaryType;
+        const CompiledExpressionPtr m_value;
+
+        template<class T>
+        T Calculate(T value) const
+        {
+            switch (m_unaryType)
+            {
+                case ExpressionUnaryType::Plus:
+                    return +value;
+                case ExpressionUnaryType::Minus:
+                    return -value;
+                default:
+                    if constexpr (is_integral_v<T>)
+                        return ~value;
+                    else
+                        throw ExpressionTreeException("Unexpected unary type encountered");
+            }
+        }
+
+    public:
+        CompiledUnary(const ExpressionUnaryType unaryType, CompiledExpressionPtr value) :
+            CompiledExpression(value->ValueType),
+            m_unaryType(unaryType),
+            m_value(std::move(value))
+        {
+        }
+
+        bool EvaluateBoolean(const DataRowPtr& row, bool& isNull) const override
+        {
+            return !m_value->EvaluateBoolean(row, isNull);
+        }
+
+        int32_t EvaluateInt32(const DataRowPtr& row, bool& isNull) const override
+        {
+            return Calculate(m_value->EvaluateInt32(row, isNull));
+        }
+
+        int64_t EvaluateInt64(const DataRowPtr& row, bool& isNull) const override
+        {
+            return Calculate(m_value->EvaluateInt64(row, isNull));
+        }
+
+        decimal_t EvaluateDecimal(const DataRowPtr& row, bool& isNull) const override
+        {
+            return Calculate(m_value->EvaluateDecimal(row, isNull));
+        }
+
+        float64_t EvaluateDouble(const DataRowPtr& row, bool& isNull) const override
+        {
+            return Calculate(m_value->EvaluateDouble(row, isNull));
+        }
+
+        static bool IsSupported(const ExpressionUnaryType unaryType, const ExpressionValueType valueType)
+        {
+            switch (valueType)
+            {
+                case ExpressionValueType::Boolean:
+                    return unaryType == ExpressionUnaryType::Not;
+                case ExpressionValueType::Int32:
+                case ExpressionValueType::Int64:
+                    return true;
+                case ExpressionValueType::Decimal:
+                case ExpressionValueType::Double:
+                    return unaryType != ExpressionUnaryType::Not;
+                default:
+                    return false;
+            }
+        }
+    };
+
+    // Arithmetic and bitwise operations, operands are converted to operation value type
+    template<class T>
+    class CompiledArithmetic : public TypedCompiledExpression<T> // NOLINT
+    {
+    private:
+        const ExpressionOperatorType m_operatorType;
+        const CompiledExpressionPtr m_leftValue;
+        const CompiledExpressionPtr m_rightValue;
+
+    public:
+        CompiledArithmetic(const ExpressionOperatorType operatorType, CompiledExpressionPtr leftValue, CompiledExpressionPtr rightValue) :
+            m_operatorType(operatorType),
+            m_leftValue(std::move(leftValue)),
+            m_rightValue(std::move(rightValue))
+        {
+        }
+
+        T EvaluateValue(const DataRowPtr& row, bool& isNull) const override
+        {
+            bool leftIsNull = false, rightIsNull = false;
+            const T left = EvaluateAs<T>(*m_leftValue, row, leftIsNull);
+            const T right = EvaluateAs<T>(*m_rightValue, row, rightIsNull);
+
+            // If left or right value is Null, result is Null
+            isNull = leftIsNull || rightIsNull;
+
+            if (isNull)
+                return T();
+
+            switch (m_operatorType)
+            {
+                case ExpressionOperatorType::Multiply:
+                    return left * right;
+                case ExpressionOperatorType::Divide:
+                    return left / right;
+                case ExpressionOperatorType::Add:
+                    return left + right;
+                case ExpressionOperatorType::Subtract:
+                    return left - right;
+                default:
+                    if constexpr (is_integral_v<T>)
+                    {
+                        switch (m_operatorType)
+                        {
+                            case ExpressionOperatorType::Modulus:
+                                return left % right;
+                            case ExpressionOperatorType::BitwiseAnd:
+                                return left & right;
+                            case ExpressionOperatorType::BitwiseOr:
+                                return left | right;
+                            case ExpressionOperatorType::BitwiseXor:
+                                return left ^ right;
+                            default:
+                                break;
+                        }
+                    }
+
+                    throw ExpressionTreeException("Unexpected operator type encountered");
+            }
+        }
+    };
+
+    // Comparison operations, operands are converted to operation value type
+    template<class T>
+    class CompiledComparison : public TypedCompiledExpression<bool> // NOLINT
+    {
+    private:
+        const ExpressionOperatorType m_operatorType;
+        const CompiledExpressionPtr m_leftValue;
+        const CompiledExpressionPtr m_rightValue;
+
+    public:
+        CompiledComparison(const ExpressionOperatorType operatorType, CompiledExpressionPtr leftValue, CompiledExpressionPtr rightValue) :
+            m_operatorType(operatorType),
+            m_leftValue(std::move(leftValue)),
+            m_rightValue(std::move(rightValue))
+        {
+        }
+
+        bool EvaluateValue(const DataRowPtr& row, bool& isNull) const override
+        {
+            bool leftIsNull = false, rightIsNull = false;
+            const T left = EvaluateAs<T>(*m_leftValue, row, leftIsNull);
+            const T right = EvaluateAs<T>(*m_rightValue, row, rightIsNull);
+
+            // If left or right value is Null, result is Null
+            isNull = leftIsNull || rightIsNull;
+
+            if (isNull)
+                return false;
+
+            switch (m_operatorType)
+            {
+                case ExpressionOperatorType::LessThan:
+                    return left < right;
+                case ExpressionOperatorType::LessThanOrEqual:
+                    return left <= right;
+                case ExpressionOperatorType::GreaterThan:
+                    return left > right;
+                case ExpressionOperatorType::GreaterThanOrEqual:
+                    return left >= right;
+                case ExpressionOperatorType::Equal:
+                case ExpressionOperatorType::EqualExactMatch:
+                    return left == right;
+                case ExpressionOperatorType::NotEqual:
+                case ExpressionOperatorType::NotEqualExactMatch:
+                    return left != right;
+                default:
+                    throw ExpressionTreeException("Unexpected operator type encountered");
+            }
+        }
+    };
+
+    // String comparisons, equality ignores case unless exact match is requested, ordering always ignores case
+    class CompiledStringComparison : public TypedCompiledExpression<bool> // NOLINT
+    {
+    private:
+        const ExpressionOperatorType m_operatorType;
+        const CompiledExpressionPtr m_leftValue;
+        const CompiledExpressionPtr m_rightValue;
+
+        static bool IsEqual(const string_view& left, const string_view& right, const bool ignoreCase)
+        {
+            return ignoreCase ? IsEqualIgnoreCase(left, right) : left == right;
+        }
+
+        static int32_t Compare(const string_view& left, const string_view& right)
+        {
+            return CompareIgnoreCase(left, right);
+        }
+
+    public:
+        CompiledStringComparison(const ExpressionOperatorType operatorType, CompiledExpressionPtr leftValue, CompiledExpressionPtr rightValue) :
+            m_operatorType(operatorType),
+            m_leftValue(std::move(leftValue)),
+            m_rightValue(std::move(rightValue))
+        {
+        }
+
+        bool EvaluateValue(const DataRowPtr& row, bool& isNull) const override
+        {
+            bool leftIsNull = false, rightIsNull = false;
+            string leftBuffer, rightBuffer;
+            const string_view left = m_leftValue->EvaluateString(row, leftIsNull, leftBuffer);
+            const string_view right = m_rightValue->EvaluateString(row, rightIsNull, rightBuffer);
+
+            // If left or right value is Null, result is Null
+            isNull = leftIsNull || rightIsNull;
+
+            if (isNull)
+                return false;
+
+            switch (m_operatorType)
+            {
+                case ExpressionOperatorType::LessThan:
+                    return Compare(left, right) < 0;
+                case ExpressionOperatorType::LessThanOrEqual:
+                    return Compare(left, right) <= 0;
+                case ExpressionOperatorType::GreaterThan:
+                    return Compare(left, right) > 0;
+                case ExpressionOperatorType::GreaterThanOrEqual:
+                    return Compare(left, right) >= 0;
+                case ExpressionOperatorType::Equal:
+                    return IsEqual(left, right, true);
+                case ExpressionOperatorType::EqualExactMatch:
+                    return IsEqual(left, right, false);
+                case ExpressionOperatorType::NotEqual:
+                    return !IsEqual(left, right, true);
+                case ExpressionOperatorType::NotEqualExactMatch:
+                    return !IsEqual(left, right, false);
+                default:
+                    throw ExpressionTreeException("Unexpected operator type encountered");
+            }
+        }
+    };
+
+    class CompiledStringConcatenation : public CompiledExpression // NOLINT
+    {
+    private:
+        const CompiledExpressionPtr m_leftValue;
+        const CompiledExpressionPtr m_rightValue;
+
+    public:
+        CompiledStringConcatenation(CompiledExpressionPtr leftValue, CompiledExpressionPtr rightValue) :
+            CompiledExpression(ExpressionValueType::String),
+            m_leftValue(std::move(leftValue)),
+            m_rightValue(std::move(rightValue))
+        {
+        }
+
+        string_view EvaluateString(const DataRowPtr& row, bool& isNull, string& buffer) const override
+        {
+            bool leftIsNull = false, rightIsNull = false;
+            string leftBuffer, rightBuffer;
+            const string_view left = m_leftValue->EvaluateString(row, leftIsNull, leftBuffer);
+            const string_view right = m_rightValue->EvaluateString(row, rightIsNull, rightBuffer);
+
+            // If left or right value is Null, result is Null
+            isNull = leftIsNull || rightIsNull;
+
+            if (isNull)
+                return {};
+
+            buffer.reserve(left.size() + right.size());
+            buffer.assign(left);
+            buffer.append(right);
+
+            return buffer;
+        }
+    };
+
+    // AND and OR operations, like the expression tree, both operands are always evaluated
+    class CompiledLogical : public TypedCompiledExpression<bool> // NOLINT
+    {
+    private:
+        const ExpressionOperatorType m_operatorType;
+        const CompiledExpressionPtr m_leftValue;
+        const CompiledExpressionPtr m_rightValue;
+
+    public:
+        CompiledLogical(const ExpressionOperatorType operatorType, CompiledExpressionPtr leftValue, CompiledExpressionPtr rightValue) :
+            m_operatorType(operatorType),
+            m_leftValue(std::move(leftValue)),
+            m_rightValue(std::move(rightValue))
+        {
+        }
+
+        bool EvaluateValue(const DataRowPtr& row, bool& isNull) const override
+        {
+            bool leftIsNull = false, rightIsNull = false;
+            const bool left = m_leftValue->EvaluateBoolean(row, leftIsNull);
+            const bool right = m_rightValue->EvaluateBoolean(row, rightIsNull);
+
+            // If left or right value is Null, result is Null
+            isNull = leftIsNull || rightIsNull;
+
+            return m_operatorType == ExpressionOperatorType::And ? left && right : left || right;
+        }
+    };
+
+    class CompiledIsNull : public TypedCompiledExpression<bool> // NOLINT
+    {
+    private:
+        const CompiledExpressionPtr m_value;
+        const bool m_hasNotKeyword;
+
+    public:
+        CompiledIsNull(CompiledExpressionPtr value, const bool hasNotKeyword) :
+            m_value(std::move(value)),
+            m_hasNotKeyword(hasNotKeyword)
+        {
+        }
+
+        bool EvaluateValue(const DataRowPtr& row, bool& isNull) const override
+        {
+            isNull = false;
+            return m_value->EvaluateIsNull(row) != m_hasNotKeyword;
+        }
+    };
+
+    // LIKE operation with pattern parsed at compile time
+    class CompiledLike : public TypedCompiledExpression<bool> // NOLINT
+    {
+    private:
+        const CompiledExpressionPtr m_value;
+        const LikePattern m_pattern;
+        const bool m_ignoreCase;
+        const bool m_hasNotKeyword;
+
+    public:
+        CompiledLike(const ExpressionOperatorType operatorType, CompiledExpressionPtr value, LikePattern pattern) :
+            m_value(std::move(value)),
+            m_pattern(std::move(pattern)),
+            m_ignoreCase(operatorType == ExpressionOperatorType::Like || operatorType == ExpressionOperatorType::NotLike),
+            m_hasNotKeyword(operatorType == ExpressionOperatorType::NotLike || operatorType == ExpressionOperatorType::NotLikeExactMatch)
+        {
+        }
+
+        bool EvaluateValue(const DataRowPtr& row, bool& isNull) const override
+        {
+            string buffer;
+            const string_view value = m_value->EvaluateString(row, isNull, buffer);
+
+            // If left value is Null, result is Null
+            if (isNull)
+                return false;
+
+            return m_pattern.IsMatch(value, m_ignoreCase) != m_hasNotKeyword;
+        }
+    };
+
+    // IN list operation, argument comparisons are compiled as equality comparisons with the test value
+    class CompiledInList : public TypedCompiledExpression<bool> // NOLINT
+    {
+    private:
+        const CompiledExpressionPtr m_value;
+        const vector<CompiledExpressionPtr> m_comparisons;
+        const bool m_hasNotKeyword;
+
+    public:
+        CompiledInList(CompiledExpressionPtr value, vector<CompiledExpressionPtr> comparisons, const bool hasNotKeyword) :
+            m_value(std::move(value)),
+            m_comparisons(std::move(comparisons)),
+            m_hasNotKeyword(hasNotKeyword)
+        {
+        }
+
+        bool EvaluateValue(const DataRowPtr& row, bool& isNull) const override
+        {
+            // If in list test value is Null, result is Null
+            isNull = m_value->EvaluateIsNull(row);
+
+            if (isNull)
+                return false;
+
+            for (const CompiledExpressionPtr& comparison : m_comparisons)
+            {
+                bool comparisonIsNull = false;
+
+                if (comparison->EvaluateBoolean(row, comparisonIsNull) && !comparisonIsNull)
+                    return !m_hasNotKeyword;
+            }
+
+            return m_hasNotKeyword;
+        }
+    };
+
+    // Equality test of a value against literal IN list values converted to comparison type, values are hashed once
+    template<class T, class THash = hash<T>>
+    class CompiledInListValues : public TypedCompiledExpression<bool> // NOLINT
+    {
+    private:
+        const CompiledExpressionPtr m_value;
+        const unordered_set<T, THash> m_values;
+
+    public:
+        CompiledInListValues(CompiledExpressionPtr value, unordered_set<T, THash> values) :
+            m_value(std::move(value)),
+            m_values(std::move(values))
+        {
+        }
+
+        bool EvaluateValue(const DataRowPtr& row, bool& isNull) const override
+        {
+            const T value = EvaluateAs<T>(*m_value, row, isNull);
+
+            if (isNull)
+                return false;
+
+            return m_values.find(value) != m_values.end();
+        }
+    };
+
+    // Equality test of a string value against literal IN list values, values ignore case unless exact match is requested
+    template<class THash, class TEqual>
+    class CompiledStringInListValues : public TypedCompiledExpression<bool> // NOLINT
+    {
+    private:
+        const CompiledExpressionPtr m_value;
+        const vector<string> m_strings;
+        unordered_set<string_view, THash, TEqual> m_values;
+
+    public:
+        CompiledStringInListValues(CompiledExpressionPtr value, vector<string> strings) :
+            m_value(std::move(value)),
+            m_strings(std::move(strings))
+        {
+            m_values.insert(m_strings.begin(), m_strings.end());
+        }
+
+        bool EvaluateValue(const DataRowPtr& row, bool& isNull) const override
+        {
+            string buffer;
+            const string_view value = m_value->EvaluateString(row, isNull, buffer);
+
+            if (isNull)
+                return false;
+
+            return m_values.find(value) != m_values.end();
+        }
+    };
+
+    // RegExMatch or RegExVal function with a literal regular expression, expression is constructed once
+    class CompiledRegEx : public CompiledExpression // NOLINT
+    {
+    private:
+        const CompiledExpressionPtr m_testValue;
+        const regex m_expression;
+        const bool m_returnMatchedValue;
+
+    public:
+        CompiledRegEx(CompiledExpressionPtr testValue, regex expression, const bool returnMatchedValue) :
+            CompiledExpression(returnMatchedValue ? ExpressionValueType::String : ExpressionValueType::Boolean),
+            m_testValue(std::move(testValue)),
+            m_expression(std::move(expression)),
+            m_returnMatchedValue(returnMatchedValue)
+        {
+        }
+
+        // RegExMatch returns boolean result for if there was a matched value
+        bool EvaluateBoolean(const DataRowPtr& row, bool& isNull) const override
+        {
+            if (m_returnMatchedValue)
+                return CompiledExpression::EvaluateBoolean(row, isNull);
+
+            string buffer;
+            const string_view testText = m_testValue->EvaluateString(row, isNull, buffer);
+
+            return !isNull && regex_search(testText.begin(), testText.end(), m_expression);
+        }
+
+        // RegExVal returns any matched value, otherwise empty string
+        string_view EvaluateString(const DataRowPtr& row, bool& isNull, string& buffer) const override
+        {
+            if (!m_returnMatchedValue)
+                return CompiledExpression::EvaluateString(row, isNull, buffer);
+
+            const string_view testText = m_testValue->EvaluateString(row, isNull, buffer);
+            match_results<string_view::const_iterator> match;
+
+            if (isNull || !regex_search(testText.begin(), testText.end(), match, m_expression))
+                return {};
+
+            return testText.substr(match.position(0), match.length(0));
+        }
+    };
+
+    // Function evaluated by expression tree that always produces values of the same type
+    class CompiledFunction : public CompiledExpression // NOLINT
+    {
+    private:
+        const ExpressionCompiler m_compiler;
+        const ExpressionPtr m_expression;
+
+        ValueExpressionPtr EvaluateFunction(bool& isNull) const
+        {
+            ValueExpressionPtr result = m_compiler.Evaluate(m_expression, ValueType);
+
+            if (result->ValueType != ValueType)
+                throw ExpressionTreeException("Unexpected expression value type encountered");
+
+            isNull = result->IsNull();
+            return result;
+        }
+
+    public:
+        CompiledFunction(const ExpressionCompiler& compiler, ExpressionPtr expression, const ExpressionValueType valueType) :
+            CompiledExpression(valueType),
+            m_compiler(compiler),
+            m_expression(std::move(expression))
+        {
+        }
+
+        ValueExpressionPtr Evaluate(const DataRowPtr&) const override
+        {
+            return m_compiler.Evaluate(m_expression, ValueType);
+        }
+
+        bool EvaluateBoolean(const DataRowPtr&, bool& isNull) const override
+        {
+            const ValueExpressionPtr result = EvaluateFunction(isNull);
+            return !isNull && result->ValueAsBoolean();
+        }
+
+        int32_t EvaluateInt32(const DataRowPtr&, bool& isNull) const override
+        {
+            const ValueExpressionPtr result = EvaluateFunction(isNull);
+            return isNull ? 0 : result->ValueAsInt32();
+        }
+
+        string_view EvaluateString(const DataRowPtr&, bool& isNull, string& buffer) const override
+        {
+            const ValueExpressionPtr result = EvaluateFunction(isNull);
+
+            if (!isNull)
+                buffer = result->ValueAsString();
+
+            return buffer;
+        }
+
+        // Gets value type of functions whose results, including Null results, always have the same type
+        static bool TryGetValueType(const ExpressionFunctionType functionType, ExpressionValueType& valueType)
+        {
+            switch (functionType)
+            {
+                case ExpressionFunctionType::Contains:
+                case ExpressionFunctionType::EndsWith:
+                case ExpressionFunctionType::IsDate:
+                case ExpressionFunctionType::IsGuid:
+                case ExpressionFunctionType::IsInteger:
+                case ExpressionFunctionType::IsNumeric:
+                case ExpressionFunctionType::RegExMatch:
+                case ExpressionFunctionType::StartsWith:
+                    valueType = ExpressionValueType::Boolean;
+                    return true;
+                case ExpressionFunctionType::IndexOf:
+                case ExpressionFunctionType::LastIndexOf:
+                case ExpressionFunctionType::Len:
+                case ExpressionFunctionType::StrCmp:
+                case ExpressionFunctionType::StrCount:
+                    valueType = ExpressionValueType::Int32;
+                    return true;
+                case ExpressionFunctionType::Lower:
+                case ExpressionFunctionType::RegExVal:
+                case ExpressionFunctionType::Reverse:
+                case ExpressionFunctionType::SubStr:
+                case ExpressionFunctionType::Trim:
+                case ExpressionFunctionType::TrimLeft:
+                case ExpressionFunctionType::TrimRight:
+                case ExpressionFunctionType::Upper:
+                    valueType = ExpressionValueType::String;
+                    return true;
+                default:
+                    return false;
+            }
+        }
+    };
+
+    // Expression evaluated by expression tree
+    class CompiledReference : public CompiledExpression // NOLINT
+    {
+    private:
+        const ExpressionCompiler m_compiler;
+        const ExpressionPtr m_expression;
+        const ExpressionValueType m_targetValueType;
+
+    public:
+        CompiledReference(const ExpressionCompiler& compiler, ExpressionPtr expression, const ExpressionValueType targetValueType) :
+            CompiledExpression(ExpressionValueType::Undefined),
+            m_compiler(compiler),
+            m_expression(std::move(expression)),
+            m_targetValueType(targetValueType)
+        {
+        }
+
+        ValueExpressionPtr Evaluate(const DataRowPtr&) const override
+        {
+            return m_compiler.Evaluate(m_expression, m_targetValueType);
+        }
+    };
+
+    // Row independent expression that depends on current time, i.e., uses Now() or UtcNow(),
+    // expression is evaluated by expression tree once per evaluation pass
+    class CompiledEvaluationConstant : public CompiledExpression // NOLINT
+    {
+    private:
+        const ExpressionCompiler m_compiler;
+        const ExpressionPtr m_expression;
+        const ExpressionValueType m_targetValueType;
+        mutable SharedPtr<CompiledConstant> m_value;
+        mutable uint64_t m_evaluationPass;
+
+        const CompiledConstant& Value() const
+        {
+            if (m_evaluationPass != m_compiler.EvaluationPass())
+            {
+                const ValueExpressionPtr value = m_compiler.Evaluate(m_expression, m_targetValueType);
+
+                if (value->ValueType != ValueType)
+                    throw ExpressionTreeException("Current time based expression changed value type from \"" + string(EnumName(ValueType)) + "\" to \"" + string(EnumName(value->ValueType)) + "\"");
+
+                m_value = NewSharedPtr<CompiledConstant>(value);
+                m_evaluationPass = m_compiler.EvaluationPass();
+            }
+
+            return *m_value;
+        }
+
+    public:
+        CompiledEvaluationConstant(const ExpressionCompiler& compiler, ExpressionPtr expression, const ExpressionValueType targetValueType, const ValueExpressionPtr& value) :
+            CompiledExpression(value->ValueType),
+            m_compiler(compiler),
+            m_expression(std::move(expression)),
+            m_targetValueType(targetValueType),
+            m_value(NewSharedPtr<CompiledConstant>(value)),
+            m_evaluationPass(compiler.EvaluationPass())
+        {
+        }
+
+        ValueExpressionPtr Evaluate(const DataRowPtr& row) const override
+        {
+            return Value().Evaluate(row);
+        }
+
+        bool EvaluateBoolean(const DataRowPtr& row, bool& isNull) const override
+        {
+            return Value().EvaluateBoolean(row, isNull);
+        }
+
+        int32_t EvaluateInt32(const DataRowPtr& row, bool& isNull) const override
+        {
+            return Value().EvaluateInt32(row, isNull);
+        }
+
+        int64_t EvaluateInt64(const DataRowPtr& row, bool& isNull) const override
+        {
+            return Value().EvaluateInt64(row, isNull);
+        }
+
+        decimal_t EvaluateDecimal(const DataRowPtr& row, bool& isNull) const override
+        {
+            return Value().EvaluateDecimal(row, isNull);
+        }
+
+        float64_t EvaluateDouble(const DataRowPtr& row, bool& isNull) const override
+        {
+            return Value().EvaluateDouble(row, isNull);
+        }
+
+        Guid EvaluateGuid(const DataRowPtr& row, bool& isNull) const override
+        {
+            return Value().EvaluateGuid(row, isNull);
+        }
+
+        datetime_t EvaluateDateTime(const DataRowPtr& row, bool& isNull) const override
+        {
+            return Value().EvaluateDateTime(row, isNull);
+        }
+
+        string_view EvaluateString(const DataRowPtr& row, bool& isNull, string& buffer) const override
+        {
+            return Value().EvaluateString(row, isNull, buffer);
+        }
+    };
+
+    // Operator with compiled operands whose result type is only known at run-time,
+    // operation is applied by expression tree on evaluated operand values
+    class CompiledOperatorReference : public CompiledExpression // NOLINT
+    {
+    private:
+        const ExpressionCompiler m_compiler;
+        const ExpressionOperatorType m_operatorType;
+        const CompiledExpressionPtr m_leftValue;
+        const CompiledExpressionPtr m_rightValue;
+
+    public:
+        CompiledOperatorReference(const ExpressionCompiler& compiler, const ExpressionOperatorType operatorType, CompiledExpressionPtr leftValue, CompiledExpressionPtr rightValue) :
+            CompiledExpression(ExpressionValueType::Undefined),
+            m_compiler(compiler),
+            m_operatorType(operatorType),
+            m_leftValue(std::move(leftValue)),
+            m_rightValue(std::move(rightValue))
+        {
+        }
+
+        ValueExpressionPtr Evaluate(const DataRowPtr& row) const override
+        {
+            const ValueExpressionPtr leftValue = m_leftValue->Evaluate(row);
+            const ValueExpressionPtr rightValue = m_rightValue->Evaluate(row);
+
+            return m_compiler.EvaluateOperator(m_operatorType, leftValue, rightValue);
+        }
+    };
+}}
+
+CompiledExpression::CompiledExpression(const ExpressionValueType valueType) :
+    ValueType(valueType)
+{
+}
+
+CompiledExpression::~CompiledExpression() = default;
+
+bool CompiledExpression::HasStaticType() const
+{
+    return ValueType != ExpressionValueType::Undefined;
+}
+
+ValueExpressionPtr CompiledExpression::Evaluate(const DataRowPtr& row) const
+{
+    bool isNull = false;
+    Object value;
+
+    switch (ValueType)
+    {
+        case ExpressionValueType::Boolean:
+        {
+            const bool result = EvaluateBoolean(row, isNull);
+
+            if (!isNull)
+                return result ? ExpressionTree::True : ExpressionTree::False;
+
+            break;
+        }
+        case ExpressionValueType::Int32:
+            value = EvaluateInt32(row, isNull);
+            break;
+        case ExpressionValueType::Int64:
+            value = EvaluateInt64(row, isNull);
+            break;
+        case ExpressionValueType::Decimal:
+            value = EvaluateDecimal(row, isNull);
+            break;
+        case ExpressionValueType::Double:
+            value = EvaluateDouble(row, isNull);
+            break;
+        case ExpressionValueType::String:
+        {
+            string buffer;
+            const string_view result = EvaluateString(row, isNull, buffer);
+            value = string(result);
+            break;
+        }
+        case ExpressionValueType::Guid:
+            value = EvaluateGuid(row, isNull);
+            break;
+        case ExpressionValueType::DateTime:
+            value = EvaluateDateTime(row, isNull);
+            break;
+        default:
+            throw ExpressionTreeException("Unexpected expression value type encountered");
+    }
+
+    if (isNull)
+        return ExpressionTree::NullValue(ValueType);
+
+    return NewSharedPtr<ValueExpression>(ValueType, value);
+}
+
+bool CompiledExpression::EvaluateBoolean(const DataRowPtr&, bool&) const
+{
+    throw ExpressionTreeException("Cannot evaluate \"" + string(EnumName(ValueType)) + "\" expression as \"Boolean\"");
+}
+
+int32_t CompiledExpression::EvaluateInt32(const DataRowPtr&, bool&) const
+{
+    throw ExpressionTreeException("Cannot evaluate \"" + string(EnumName(ValueType)) + "\" expression as \"Int32\"");
+}
+
+int64_t CompiledExpression::EvaluateInt64(const DataRowPtr&, bool&) const
+{
+    throw ExpressionTreeException("Cannot evaluate \"" + string(EnumName(ValueType)) + "\" expression as \"Int64\"");
+}
+
+decimal_t CompiledExpression::EvaluateDecimal(const DataRowPtr&, bool&) const
+{
+    throw ExpressionTreeException("Cannot evaluate \"" + string(EnumName(ValueType)) + "\" expression as \"Decimal\"");
+}
+
+float64_t CompiledExpression::EvaluateDouble(const DataRowPtr&, bool&) const
+{
+    throw ExpressionTreeException("Cannot evaluate \"" + string(EnumName(ValueType)) + "\" expression as \"Double\"");
+}
+
+Guid CompiledExpression::EvaluateGuid(const DataRowPtr&, bool&) const
+{
+    throw ExpressionTreeException("Cannot evaluate \"" + string(EnumName(ValueType)) + "\" expression as \"Guid\"");
+}
+
+datetime_t CompiledExpression::EvaluateDateTime(const DataRowPtr&, bool&) const
+{
+    throw ExpressionTreeException("Cannot evaluate \"" + string(EnumName(ValueType)) + "\" expression as \"DateTime\"");
+}
+
+string_view CompiledExpression::EvaluateString(const DataRowPtr&, bool&, string&) const
+{
+    throw ExpressionTreeException("Cannot evaluate \"" + string(EnumName(ValueType)) + "\" expression as \"String\"");
+}
+
+bool CompiledExpression::EvaluateIsNull(const DataRowPtr& row) const
+{
+    bool isNull = false;
+
+    switch (ValueType)
+    {
+        case ExpressionValueType::Boolean:
+            EvaluateBoolean(row, isNull);
+            break;
+        case ExpressionValueType::Int32:
+            EvaluateInt32(row, isNull);
+            break;
+        case ExpressionValueType::Int64:
+            EvaluateInt64(row, isNull);
+            break;
+        case ExpressionValueType::Decimal:
+            EvaluateDecimal(row, isNull);
+            break;
+        case ExpressionValueType::Double:
+            EvaluateDouble(row, isNull);
+            break;
+        case ExpressionValueType::String:
+        {
+            string buffer;
+            EvaluateString(row, isNull, buffer);
+            break;
+        }
+        case ExpressionValueType::Guid:
+            EvaluateGuid(row, isNull);
+            break;
+        case ExpressionValueType::DateTime:
+            EvaluateDateTime(row, isNull);
+            break;
+        default:
+            isNull = Evaluate(row)->IsNull();
+            break;
+    }
+
+    return isNull;
+}
+
+ExpressionCompiler::ExpressionCompiler(const ExpressionTree& expressionTree) :
+    m_expressionTree(expressionTree)
+{
+}
+
+CompiledExpressionPtr ExpressionCompiler::Compile(const ExpressionPtr& expression, const ExpressionValueType targetValueType) const
+{
+    if (expression == nullptr)
+        return NewSharedPtr<CompiledConstant>(ExpressionTree::NullValue(targetValueType));
+
+    // Sub-expressions that only depend on current time are evaluated once per evaluation pass,
+    // value type is taken from initial evaluation
+    if (ExpressionOptimizer::GetDependency(expression) == ExpressionDependency::Evaluation)
+    {
+        ValueExpressionPtr value;
+
+        try
+        {
+            value = Evaluate(expression, targetValueType);
+        }
+        catch (...)
+        {
+            // Expression that fails to evaluate is compiled as-is so that error is reported on evaluation
+        }
+
+        if (value != nullptr)
+            return NewSharedPtr<CompiledEvaluationConstant>(*this, expression, targetValueType, value);
+    }
+
+    switch (expression->Type)
+    {
+        case ExpressionType::Value:
+        {
+            const ValueExpressionPtr valueExpression = CastSharedPtr<ValueExpression>(expression);
+
+            // Change Undefined NULL values to Nullable of target type
+            if (valueExpression->ValueType == ExpressionValueType::Undefined)
+                return NewSharedPtr<CompiledConstant>(ExpressionTree::NullValue(targetValueType));
+
+            return NewSharedPtr<CompiledConstant>(valueExpression);
+        }
+        case ExpressionType::Column:
+        {
+            const DataColumnPtr& column = CastSharedPtr<ColumnExpression>(expression)->DataColumn;
+
+            // UInt64 values map to Int64 or Double depending on value, so type is only known at run-time
+            if (column != nullptr && column->Type() != DataType::UInt64)
+                return NewSharedPtr<CompiledColumn>(column);
+
+            break;
+        }
+        case ExpressionType::Unary:
+        {
+            const UnaryExpressionPtr unaryExpression = CastSharedPtr<UnaryExpression>(expression);
+            const CompiledExpressionPtr value = Compile(unaryExpression->Value);
+
+            if (value->HasStaticType() && CompiledUnary::IsSupported(unaryExpression->UnaryType, value->ValueType))
+                return NewSharedPtr<CompiledUnary>(unaryExpression->UnaryType, value);
+
+            break;
+        }
+        case ExpressionType::InList:
+        {
+            const InListExpressionPtr inListExpression = CastSharedPtr<InListExpression>(expression);
+            const CompiledExpressionPtr value = Compile(inListExpression->Value);
+            const ExpressionOperatorType operatorType = inListExpression->ExactMatch ? ExpressionOperatorType::EqualExactMatch : ExpressionOperatorType::Equal;
+            vector<CompiledExpressionPtr> comparisons;
+            map<ExpressionValueType, vector<CompiledExpressionPtr>> literalValues;
+            vector<ExpressionValueType> literalValueTypes;
+
+            if (!value->HasStaticType())
+                break;
+
+            for (const ExpressionPtr& argument : *inListExpression->Arguments)
+            {
+                const CompiledExpressionPtr argumentValue = Compile(argument);
+
+                if (!argumentValue->HasStaticType())
+                    break;
+
+                const CompiledExpressionPtr comparison = CompileComparison(operatorType, value, argumentValue);
+
+                if (comparison == nullptr)
+                    break;
+
+                comparisons.push_back(comparison);
+
+                // Literals are grouped by comparison type, converted values of each type are tested with a single lookup
+                if (dynamic_cast<const CompiledConstant*>(argumentValue.get()) != nullptr)
+                {
+                    const ExpressionValueType valueType = m_expressionTree.DeriveComparisonOperationValueType(operatorType, value->ValueType, argumentValue->ValueType);
+                    literalValues[valueType].push_back(CompileConversion(argumentValue, valueType));
+                    literalValueTypes.push_back(valueType);
+                }
+                else
+                {
+                    literalValueTypes.push_back(ExpressionValueType::Undefined);
+                }
+            }
+
+            if (comparisons.size() != inListExpression->Arguments->size())
+                break;
+
+            map<ExpressionValueType, CompiledExpressionPtr> lookups;
+
+            for (const auto& literalGroup : literalValues)
+            {
+                if (literalGroup.second.size() < 2)
+                    continue;
+
+                const CompiledExpressionPtr lookup = CompileInListValues(value, literalGroup.first, literalGroup.second, inListExpression->ExactMatch);
+
+                if (lookup != nullptr)
+                    lookups[literalGroup.first] = lookup;
+            }
+
+            vector<CompiledExpressionPtr> evaluations;
+
+            // Lookup for a group of literals replaces comparison of first literal in group, argument order is otherwise unchanged
+            for (size_t i = 0; i < comparisons.size(); i++)
+            {
+                const auto lookup = lookups.find(literalValueTypes[i]);
+
+                if (lookup == lookups.end())
+                {
+                    evaluations.push_back(comparisons[i]);
+                }
+                else if (lookup->second != nullptr)
+                {
+                    evaluations.push_back(lookup->second);
+                    lookup->second = nullptr;
+                }
+            }
+
+            return NewSharedPtr<CompiledInList>(value, evaluations, inListExpression->HasNotKeyword);
+        }
+        case ExpressionType::Operator:
+        {
+            const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
+            const CompiledExpressionPtr leftValue = Compile(operatorExpression->LeftValue);
+            const CompiledExpressionPtr rightValue = Compile(operatorExpression->RightValue);
+            const CompiledExpressionPtr compiledExpression = CompileOperator(operatorExpression, leftValue, rightValue);
+
+            if (compiledExpression != nullptr)
+                return compiledExpression;
+
+            return NewSharedPtr<CompiledOperatorReference>(*this, operatorExpression->OperatorType, leftValue, rightValue);
+        }
+        case ExpressionType::Function:
+        {
+            const FunctionExpressionPtr functionExpression = CastSharedPtr<FunctionExpression>(expression);
+            ExpressionValueType valueType;
+
+            if (functionExpression->FunctionType == ExpressionFunctionType::RegExMatch || functionExpression->FunctionType == ExpressionFunctionType::RegExVal)
+            {
+                const CompiledExpressionPtr compiledExpression = CompileRegEx(functionExpression);
+
+                if (compiledExpression != nullptr)
+                    return compiledExpression;
+            }
+
+            if (CompiledFunction::TryGetValueType(functionExpression->FunctionType, valueType))
+                return NewSharedPtr<CompiledFunction>(*this, expression, valueType);
+
+            break;
+        }
+        default:
+            break;
+    }
+
+    return NewSharedPtr<CompiledReference>(*this, expression, targetValueType);
+}
+
+CompiledExpressionPtr ExpressionCompiler::CompileOperator(const OperatorExpressionPtr& expression, const CompiledExpressionPtr& leftValue, const CompiledExpressionPtr& rightValue) const
+{
+    const ExpressionOperatorType operatorType = expression->OperatorType;
+
+    switch (operatorType)
+    {
+        case ExpressionOperatorType::IsNull:
+        case ExpressionOperatorType::IsNotNull:
+            if (!rightValue->HasStaticType())
+                return nullptr;
+
+            return NewSharedPtr<CompiledIsNull>(leftValue, operatorType == ExpressionOperatorType::IsNotNull);
+        case ExpressionOperatorType::Like:
+        case ExpressionOperatorType::LikeExactMatch:
+        case ExpressionOperatorType::NotLike:
+        case ExpressionOperatorType::NotLikeExactMatch:
+            return CompileLike(operatorType, leftValue, rightValue);
+        case ExpressionOperatorType::And:
+        case ExpressionOperatorType::Or:
+            if (leftValue->ValueType != ExpressionValueType::Boolean || rightValue->ValueType != ExpressionValueType::Boolean)
+                return nullptr;
+
+            return NewSharedPtr<CompiledLogical>(operatorType, leftValue, rightValue);
+        default:
+            break;
+    }
+
+    // Operation value type is derived from operand value types, so these need to be known at compile time
+    if (!leftValue->HasStaticType() || !rightValue->HasStaticType())
+        return nullptr;
+
+    ExpressionValueType valueType;
+
+    try
+    {
+        valueType = m_expressionTree.DeriveOperationValueType(operatorType, leftValue->ValueType, rightValue->ValueType);
+    }
+    catch (const ExpressionTreeException&)
+    {
+        // Invalid operations are reported by expression tree evaluation
+        return nullptr;
+    }
+
+    switch (operatorType)
+    {
+        case ExpressionOperatorType::Multiply:
+        case ExpressionOperatorType::Divide:
+        case ExpressionOperatorType::Modulus:
+        case ExpressionOperatorType::Add:
+        case ExpressionOperatorType::Subtract:
+        case ExpressionOperatorType::BitwiseAnd:
+        case ExpressionOperatorType::BitwiseOr:
+        case ExpressionOperatorType::BitwiseXor:
+            switch (valueType)
+            {
+                case ExpressionValueType::Int32:
+                    return NewSharedPtr<CompiledArithmetic<int32_t>>(operatorType, leftValue, rightValue);
+                case ExpressionValueType::Int64:
+                    return NewSharedPtr<CompiledArithmetic<int64_t>>(operatorType, leftValue, rightValue);
+                case ExpressionValueType::Decimal:
+                    return NewSharedPtr<CompiledArithmetic<decimal_t>>(operatorType, leftValue, rightValue);
+                case ExpressionValueType::Double:
+                    return NewSharedPtr<CompiledArithmetic<float64_t>>(operatorType, leftValue, rightValue);
+                case ExpressionValueType::String:
+                    if (leftValue->ValueType == ExpressionValueType::String && rightValue->ValueType == ExpressionValueType::String)
+                        return NewSharedPtr<CompiledStringConcatenation>(leftValue, rightValue);
+
+                    return nullptr;
+                default:
+                    return nullptr;
+            }
+        case ExpressionOperatorType::LessThan:
+        case ExpressionOperatorType::LessThanOrEqual:
+        case ExpressionOperatorType::GreaterThan:
+        case ExpressionOperatorType::GreaterThanOrEqual:
+        case ExpressionOperatorType::Equal:
+        case ExpressionOperatorType::EqualExactMatch:
+        case ExpressionOperatorType::NotEqual:
+        case ExpressionOperatorType::NotEqualExactMatch:
+            return CompileComparison(operatorType, leftValue, rightValue);
+        default:
+            return nullptr;
+    }
+}
+
+CompiledExpressionPtr ExpressionCompiler::CompileComparison(const ExpressionOperatorType operatorType, CompiledExpressionPtr leftValue, CompiledExpressionPtr rightValue) const
+{
+    ExpressionValueType valueType;
+
+    try
+    {
+        valueType = m_expressionTree.DeriveComparisonOperationValueType(operatorType, leftValue->ValueType, rightValue->ValueType);
+    }
+    catch (const ExpressionTreeException&)
+    {
+        return nullptr;
+    }
+
+    leftValue = CompileConversion(leftValue, valueType);
+    rightValue = CompileConversion(rightValue, valueType);
+
+    if (leftValue == nullptr || rightValue == nullptr)
+        return nullptr;
+
+    switch (valueType)
+    {
+        case ExpressionValueType::Boolean:
+            return NewSharedPtr<CompiledComparison<bool>>(operatorType, leftValue, rightValue);
+        case ExpressionValueType::Int32:
+            return NewSharedPtr<CompiledComparison<int32_t>>(operatorType, leftValue, rightValue);
+        case ExpressionValueType::Int64:
+            return NewSharedPtr<CompiledComparison<int64_t>>(operatorType, leftValue, rightValue);
+        case ExpressionValueType::Decimal:
+            return NewSharedPtr<CompiledComparison<decimal_t>>(operatorType, leftValue, rightValue);
+        case ExpressionValueType::Double:
+            return NewSharedPtr<CompiledComparison<float64_t>>(operatorType, leftValue, rightValue);
+        case ExpressionValueType::String:
+            return NewSharedPtr<CompiledStringComparison>(operatorType, leftValue, rightValue);
+        case ExpressionValueType::Guid:
+            return NewSharedPtr<CompiledComparison<Guid>>(operatorType, leftValue, rightValue);
+        case ExpressionValueType::DateTime:
+            return NewSharedPtr<CompiledComparison<datetime_t>>(operatorType, leftValue, rightValue);
+        default:
+            return nullptr;
+    }
+}
+
+CompiledExpressionPtr ExpressionCompiler::CompileConversion(const CompiledExpressionPtr& sourceValue, const ExpressionValueType targetValueType) const
+{
+    if (sourceValue->ValueType == targetValueType)
+        return sourceValue;
+
+    // Literals are converted once, at compile time
+    const CompiledConstant* constant = dynamic_cast<const CompiledConstant*>(sourceValue.get());
+
+    if (constant != nullptr)
+    {
+        try
+        {
+            return NewSharedPtr<CompiledConstant>(m_expressionTree.Convert(constant->Value(), targetValueType));
+        }
+        catch (...)
+        {
+            // Conversion errors are reported by expression tree evaluation
+            return nullptr;
+        }
+    }
+
+    // Numeric values are converted during evaluation, other conversions, e.g., parsing strings,
+    // can fail and are left to expression tree so that errors are raised the same way
+    if (IsNumericType(sourceValue->ValueType) && IsNumericType(targetValueType))
+        return sourceValue;
+
+    return nullptr;
+}
+
+template<class T, class THash = hash<T>>
+static unordered_set<T, THash> GetLiteralValues(const vector<CompiledExpressionPtr>& literals)
+{
+    unordered_set<T, THash> values;
+
+    // Null literals never compare as equal so are not included
+    for (const CompiledExpressionPtr& literal : literals)
+    {
+        bool isNull = false;
+        const T value = EvaluateAs<T>(*literal, nullptr, isNull);
+
+        if (!isNull)
+            values.insert(value);
+    }
+
+    return values;
+}
+
+CompiledExpressionPtr ExpressionCompiler::CompileInListValues(const CompiledExpressionPtr& value, const ExpressionValueType valueType, const vector<CompiledExpressionPtr>& literals, const bool exactMatch) const
+{
+    const CompiledExpressionPtr testValue = CompileConversion(value, valueType);
+
+    if (testValue == nullptr)
+        return nullptr;
+
+    switch (valueType)
+    {
+        case ExpressionValueType::Boolean:
+            return NewSharedPtr<CompiledInListValues<bool>>(testValue, GetLiteralValues<bool>(literals));
+        case ExpressionValueType::Int32:
+            return NewSharedPtr<CompiledInListValues<int32_t>>(testValue, GetLiteralValues<int32_t>(literals));
+        case ExpressionValueType::Int64:
+            return NewSharedPtr<CompiledInListValues<int64_t>>(testValue, GetLiteralValues<int64_t>(literals));
+        case ExpressionValueType::Decimal:
+            return NewSharedPtr<CompiledInListValues<decimal_t, DecimalHash>>(testValue, GetLiteralValues<decimal_t, DecimalHash>(literals));
+        case ExpressionValueType::Double:
+            return NewSharedPtr<CompiledInListValues<float64_t>>(testValue, GetLiteralValues<float64_t>(literals));
+        case ExpressionValueType::Guid:
+            return NewSharedPtr<CompiledInListValues<Guid>>(testValue, GetLiteralValues<Guid>(literals));
+        case ExpressionValueType::DateTime:
+            return NewSharedPtr<CompiledInListValues<datetime_t, DateTimeHash>>(testValue, GetLiteralValues<datetime_t, DateTimeHash>(literals));
+        case ExpressionValueType::String:
+        {
+            vector<string> strings;
+
+            for (const CompiledExpressionPtr& literal : literals)
+            {
+                bool isNull = false;
+                string buffer;
+                const string_view literalValue = literal->EvaluateString(nullptr, isNull, buffer);
+
+                if (!isNull)
+                    strings.emplace_back(literalValue);
+            }
+
+            if (exactMatch)
+                return NewSharedPtr<CompiledStringInListValues<hash<string_view>, equal_to<string_view>>>(testValue, std::move(strings));
+
+            return NewSharedPtr<CompiledStringInListValues<IgnoreCaseHash, IgnoreCaseEqual>>(testValue, std::move(strings));
+        }
+        default:
+            return nullptr;
+    }
+}
+
+CompiledExpressionPtr ExpressionCompiler::CompileLike(const ExpressionOperatorType operatorType, const CompiledExpressionPtr& leftValue, const CompiledExpressionPtr& rightValue) const
+{
+    const CompiledConstant* pattern = dynamic_cast<const CompiledConstant*>(rightValue.get());
+
+    if (!leftValue->HasStaticType() || leftValue->ValueType != ExpressionValueType::String)
+        return nullptr;
+
+    if (pattern == nullptr || pattern->ValueType != ExpressionValueType::String || pattern->Value()->IsNull())
+        return nullptr;
+
+    try
+    {
+        return NewSharedPtr<CompiledLike>(operatorType, leftValue, LikePattern(pattern->Value()->ValueAsString()));
+    }
+    catch (const ExpressionTreeException&)
+    {
+        // Wild cards in the middle of the string are not supported, error is reported by expression tree evaluation
+        return nullptr;
+    }
+}
+
+CompiledExpressionPtr ExpressionCompiler::CompileRegEx(const FunctionExpressionPtr& expression) const
+{
+    if (expression->Arguments->size() != 2)
+        return nullptr;
+
+    const CompiledExpressionPtr regexValue = Compile(expression->Arguments->at(0), ExpressionValueType::String);
+    const CompiledExpressionPtr testValue = Compile(expression->Arguments->at(1), ExpressionValueType::String);
+    const CompiledConstant* pattern = dynamic_cast<const CompiledConstant*>(regexValue.get());
+
+    if (!testValue->HasStaticType() || testValue->ValueType != ExpressionValueType::String)
+        return nullptr;
+
+    if (pattern == nullptr || pattern->ValueType != ExpressionValueType::String || pattern->Value()->IsNull())
+        return nullptr;
+
+    try
+    {
+        return NewSharedPtr<CompiledRegEx>(testValue, regex(pattern->Value()->ValueAsString()), expression->FunctionType == ExpressionFunctionType::RegExVal);
+    }
+    catch (const regex_error&)
+    {
+        // Invalid regular expression is reported by expression tree evaluation
+        return nullptr;
+    }
+}
+
+ValueExpressionPtr ExpressionCompiler::Evaluate(const ExpressionPtr& expression, const ExpressionValueType targetValueType) const
+{
+    return m_expressionTree.Evaluate(expression, targetValueType);
+}
+
+ValueExpressionPtr ExpressionCompiler::EvaluateOperator(const ExpressionOperatorType operatorType, const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue) const
+{
+    return m_expressionTree.EvaluateOperator(operatorType, leftValue, rightValue);
+}
+
+uint64_t ExpressionCompiler::EvaluationPass() const
+{
+    return m_expressionTree.m_evaluationPass;
+}
@@ -0,0 +1,95 @@
+//******************************************************************************************************
+//  CompiledExpression.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __COMPILED_EXPRESSION_H
+#define __COMPILED_EXPRESSION_H
+
+#include "ExpressionTree.h"
+
+namespace GSF {
+namespace FilterExpressions
+{
+    // Represents an expression tree node that has been type-checked against its table schema and compiled to
+    // a closure over unboxed values. Nodes with a static value type are evaluated with the typed functions,
+    // which do not allocate value expressions; nodes whose type is only known at run-time, e.g., functions,
+    // are evaluated by the expression tree and have an Undefined value type. Compiled nodes produce the same
+    // values, and throw the same errors, as the expression tree evaluation they replace.
+    class CompiledExpression // NOLINT
+    {
+    public:
+        explicit CompiledExpression(ExpressionValueType valueType);
+        virtual ~CompiledExpression();
+
+        // Value type of results, null results included, Undefined when type is only known at run-time
+        const ExpressionValueType ValueType;
+
+        // Determines if value type is known at compile time
+        bool HasStaticType() const;
+
+        // Evaluates expression for row to a value expression
+        virtual ValueExpressionPtr Evaluate(const GSF::Data::DataRowPtr& row) const;
+
+        // Typed evaluation functions, only function for node value type is valid
+        virtual bool EvaluateBoolean(const GSF::Data::DataRowPtr& row, bool& isNull) const;
+        virtual int32_t EvaluateInt32(const GSF::Data::DataRowPtr& row, bool& isNull) const;
+        virtual int64_t EvaluateInt64(const GSF::Data::DataRowPtr& row, bool& isNull) const;
+        virtual GSF::decimal_t EvaluateDecimal(const GSF::Data::DataRowPtr& row, bool& isNull) const;
+        virtual GSF::float64_t EvaluateDouble(const GSF::Data::DataRowPtr& row, bool& isNull) const;
+        virtual GSF::Guid EvaluateGuid(const GSF::Data::DataRowPtr& row, bool& isNull) const;
+        virtual GSF::datetime_t EvaluateDateTime(const GSF::Data::DataRowPtr& row, bool& isNull) const;
+
+        // String result views row storage, a literal or the provided buffer
+        virtual std::string_view EvaluateString(const GSF::Data::DataRowPtr& row, bool& isNull, std::string& buffer) const;
+
+        // Evaluates expression for row and only returns if the result is Null
+        bool EvaluateIsNull(const GSF::Data::DataRowPtr& row) const;
+    };
+
+    // Compiles expression trees, nodes the compiler cannot type statically are delegated to the tree
+    class ExpressionCompiler
+    {
+    private:
+        const ExpressionTree& m_expressionTree;
+
+        CompiledExpressionPtr CompileOperator(const OperatorExpressionPtr& expression, const CompiledExpressionPtr& leftValue, const CompiledExpressionPtr& rightValue) const;
+        CompiledExpressionPtr CompileComparison(ExpressionOperatorType operatorType, CompiledExpressionPtr leftValue, CompiledExpressionPtr rightValue) const;
+        CompiledExpressionPtr CompileConversion(const CompiledExpressionPtr& sourceValue, ExpressionValueType targetValueType) const;
+        CompiledExpressionPtr CompileInListValues(const CompiledExpressionPtr& value, ExpressionValueType valueType, const std::vector<CompiledExpressionPtr>& literals, bool exactMatch) const;
+        CompiledExpressionPtr CompileLike(ExpressionOperatorType operatorType, const CompiledExpressionPtr& leftValue, const CompiledExpressionPtr& rightValue) const;
+        CompiledExpressionPtr CompileRegEx(const FunctionExpressionPtr& expression) const;
+
+    public:
+        ExpressionCompiler(const ExpressionTree& expressionTree);
+
+        CompiledExpressionPtr Compile(const ExpressionPtr& expression, ExpressionValueType targetValueType = ExpressionValueType::Boolean) const;
+
+        // Expression tree evaluation used by nodes that are delegated to the tree
+        ValueExpressionPtr Evaluate(const ExpressionPtr& expression, ExpressionValueType targetValueType) const;
+        ValueExpressionPtr EvaluateOperator(ExpressionOperatorType operatorType, const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue) const;
+
+        // Gets current evaluation pass of expression tree
+        uint64_t EvaluationPass() const;
+    };
+}}
+
+#endif
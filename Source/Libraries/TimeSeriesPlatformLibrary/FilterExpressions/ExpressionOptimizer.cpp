@@ -0,0 +1,358 @@
+//******************************************************************************************************
+//  ExpressionOptimizer.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "ExpressionOptimizer.h"
+#include "CompiledExpression.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::FilterExpressions;
+
+ExpressionOptimizer::ExpressionOptimizer(const ExpressionTree& expressionTree) :
+    m_expressionTree(expressionTree)
+{
+}
+
+ExpressionPtr ExpressionOptimizer::Optimize(const ExpressionPtr& expression) const
+{
+    ExpressionDependency dependency;
+    return Optimize(expression, dependency);
+}
+
+ExpressionPtr ExpressionOptimizer::Optimize(const ExpressionPtr& expression, ExpressionDependency& dependency) const
+{
+    dependency = ExpressionDependency::None;
+
+    if (expression == nullptr)
+        return nullptr;
+
+    switch (expression->Type)
+    {
+        case ExpressionType::Value:
+            return expression;
+        case ExpressionType::Column:
+            dependency = ExpressionDependency::Row;
+            return expression;
+        case ExpressionType::Unary:
+        {
+            const UnaryExpressionPtr unaryExpression = CastSharedPtr<UnaryExpression>(expression);
+            const ExpressionPtr value = Optimize(unaryExpression->Value, dependency);
+            const ExpressionPtr result = value == unaryExpression->Value ? expression : NewSharedPtr<UnaryExpression>(unaryExpression->UnaryType, value);
+
+            return dependency == ExpressionDependency::None ? Fold(result) : result;
+        }
+        case ExpressionType::InList:
+        {
+            const InListExpressionPtr inListExpression = CastSharedPtr<InListExpression>(expression);
+            const ExpressionPtr value = Optimize(inListExpression->Value, dependency);
+            const ExpressionCollectionPtr arguments = NewSharedPtr<ExpressionCollection>();
+            bool changed = value != inListExpression->Value;
+
+            for (const ExpressionPtr& argument : *inListExpression->Arguments)
+            {
+                ExpressionDependency argumentDependency;
+                arguments->push_back(Optimize(argument, argumentDependency));
+                dependency = max(dependency, argumentDependency);
+                changed = changed || arguments->back() != argument;
+            }
+
+            const ExpressionPtr result = changed ? NewSharedPtr<InListExpression>(value, arguments, inListExpression->HasNotKeyword, inListExpression->ExactMatch) : expression;
+
+            return dependency == ExpressionDependency::None ? Fold(result) : result;
+        }
+        case ExpressionType::Function:
+            return OptimizeFunction(CastSharedPtr<FunctionExpression>(expression), dependency);
+        case ExpressionType::Operator:
+        {
+            const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
+            ExpressionDependency leftDependency, rightDependency;
+            const ExpressionPtr leftValue = Optimize(operatorExpression->LeftValue, leftDependency);
+            const ExpressionPtr rightValue = Optimize(operatorExpression->RightValue, rightDependency);
+            const OperatorExpressionPtr result = leftValue == operatorExpression->LeftValue && rightValue == operatorExpression->RightValue ? operatorExpression : NewSharedPtr<OperatorExpression>(operatorExpression->OperatorType, leftValue, rightValue);
+
+            dependency = max(leftDependency, rightDependency);
+
+            if (dependency == ExpressionDependency::None && !IsIntegerDivisionTrap(result))
+            {
+                const ExpressionPtr foldedResult = Fold(result);
+
+                if (foldedResult != result)
+                    return foldedResult;
+            }
+
+            if (result->OperatorType == ExpressionOperatorType::And || result->OperatorType == ExpressionOperatorType::Or)
+            {
+                const ExpressionPtr logicalResult = OptimizeLogical(result);
+
+                if (logicalResult != result)
+                    dependency = GetDependency(logicalResult);
+
+                return logicalResult;
+            }
+
+            return result;
+        }
+        default:
+            dependency = ExpressionDependency::Row;
+            return expression;
+    }
+}
+
+ExpressionPtr ExpressionOptimizer::OptimizeFunction(const FunctionExpressionPtr& expression, ExpressionDependency& dependency) const
+{
+    const ExpressionCollection& sourceArguments = *expression->Arguments;
+
+    // IIf with a constant test is replaced by selected result expression, Null test selects right expression.
+    // Result expression that is not selected is never evaluated, so it is not optimized.
+    if (expression->FunctionType == ExpressionFunctionType::IIf && sourceArguments.size() == 3)
+    {
+        const ExpressionPtr testValue = Optimize(sourceArguments[0], dependency);
+
+        if (testValue->Type == ExpressionType::Value)
+        {
+            const ValueExpressionPtr testValueExpression = CastSharedPtr<ValueExpression>(testValue);
+
+            if (testValueExpression->ValueType == ExpressionValueType::Boolean || testValueExpression->ValueType == ExpressionValueType::Undefined)
+            {
+                const bool testResult = testValueExpression->ValueType == ExpressionValueType::Boolean && testValueExpression->ValueAsBoolean();
+                const ExpressionPtr resultValue = Optimize(sourceArguments[testResult ? 1 : 2], dependency);
+
+                // IIf evaluates result expressions with a boolean target type
+                if (resultValue->Type == ExpressionType::Value && CastSharedPtr<ValueExpression>(resultValue)->ValueType == ExpressionValueType::Undefined)
+                    return ExpressionTree::NullValue(ExpressionValueType::Boolean);
+
+                return resultValue;
+            }
+        }
+    }
+
+    const ExpressionCollectionPtr arguments = NewSharedPtr<ExpressionCollection>();
+    bool changed = false;
+
+    dependency = ExpressionDependency::None;
+
+    for (const ExpressionPtr& argument : sourceArguments)
+    {
+        ExpressionDependency argumentDependency;
+        arguments->push_back(Optimize(argument, argumentDependency));
+        dependency = max(dependency, argumentDependency);
+        changed = changed || arguments->back() != argument;
+    }
+
+    if (expression->FunctionType == ExpressionFunctionType::Now || expression->FunctionType == ExpressionFunctionType::UtcNow)
+        dependency = max(dependency, ExpressionDependency::Evaluation);
+
+    const ExpressionPtr result = changed ? NewSharedPtr<FunctionExpression>(expression->FunctionType, arguments) : expression;
+
+    return dependency == ExpressionDependency::None ? Fold(result) : result;
+}
+
+ExpressionPtr ExpressionOptimizer::OptimizeLogical(const OperatorExpressionPtr& expression) const
+{
+    const bool isAnd = expression->OperatorType == ExpressionOperatorType::And;
+    ExpressionPtr constant = expression->LeftValue;
+    ExpressionPtr operand = expression->RightValue;
+
+    if (constant->Type != ExpressionType::Value)
+        swap(constant, operand);
+
+    if (constant->Type != ExpressionType::Value || operand->Type == ExpressionType::Value)
+        return expression;
+
+    // Operands with a non-boolean type are left as-is so that type error is reported on evaluation
+    const ExpressionValueType operandValueType = GetStaticValueType(operand);
+
+    if (operandValueType != ExpressionValueType::Boolean && operandValueType != ExpressionValueType::Undefined)
+        return expression;
+
+    const ValueExpressionPtr constantValue = CastSharedPtr<ValueExpression>(constant);
+
+    // Null operand makes result Null, unless x fails to evaluate, so x is only skipped when it cannot fail
+    if (constantValue->ValueType == ExpressionValueType::Undefined || (constantValue->ValueType == ExpressionValueType::Boolean && constantValue->IsNull()))
+    {
+        if (operandValueType == ExpressionValueType::Boolean && IsNonNullable(operand))
+            return ExpressionTree::NullValue(ExpressionValueType::Boolean);
+
+        return expression;
+    }
+
+    if (constantValue->ValueType != ExpressionValueType::Boolean)
+        return expression;
+
+    const bool value = constantValue->ValueAsBoolean();
+
+    // FALSE AND x is False, TRUE OR x is True, unless x is Null which makes result Null
+    if (value != isAnd)
+    {
+        if (operandValueType == ExpressionValueType::Boolean && IsNonNullable(operand))
+            return value ? ExpressionTree::True : ExpressionTree::False;
+
+        return expression;
+    }
+
+    // TRUE AND x, and FALSE OR x, are x
+    return operandValueType == ExpressionValueType::Boolean ? operand : expression;
+}
+
+ExpressionPtr ExpressionOptimizer::Fold(const ExpressionPtr& expression) const
+{
+    try
+    {
+        const ValueExpressionPtr value = m_expressionTree.Evaluate(expression);
+
+        // Untyped Null is not folded since a literal Null takes the type of its evaluation context
+        if (value->ValueType != ExpressionValueType::Undefined)
+        {
+            // Value is read as its value type so that a value not matching its type is not folded
+            value->ToString();
+            return value;
+        }
+    }
+    catch (...)
+    {
+        // Expression that fails to evaluate is left as-is so that error is reported on evaluation
+    }
+
+    return expression;
+}
+
+bool ExpressionOptimizer::IsIntegerDivisionTrap(const OperatorExpressionPtr& expression)
+{
+    if (expression->OperatorType != ExpressionOperatorType::Divide && expression->OperatorType != ExpressionOperatorType::Modulus)
+        return false;
+
+    if (expression->RightValue == nullptr || expression->RightValue->Type != ExpressionType::Value)
+        return false;
+
+    const ValueExpressionPtr divisor = CastSharedPtr<ValueExpression>(expression->RightValue);
+
+    if (divisor->IsNull())
+        return false;
+
+    // Divisor of -1 overflows for minimum integer value
+    switch (divisor->ValueType)
+    {
+        case ExpressionValueType::Int32:
+            return divisor->ValueAsInt32() == 0 || divisor->ValueAsInt32() == -1;
+        case ExpressionValueType::Int64:
+            return divisor->ValueAsInt64() == 0LL || divisor->ValueAsInt64() == -1LL;
+        default:
+            return false;
+    }
+}
+
+bool ExpressionOptimizer::IsNonNullable(const ExpressionPtr& expression)
+{
+    if (expression == nullptr)
+        return false;
+
+    switch (expression->Type)
+    {
+        case ExpressionType::Value:
+        {
+            const ValueExpressionPtr valueExpression = CastSharedPtr<ValueExpression>(expression);
+            return valueExpression->ValueType == ExpressionValueType::Boolean && !valueExpression->IsNull();
+        }
+        case ExpressionType::Unary:
+        {
+            const UnaryExpressionPtr unaryExpression = CastSharedPtr<UnaryExpression>(expression);
+            return unaryExpression->UnaryType == ExpressionUnaryType::Not && IsNonNullable(unaryExpression->Value);
+        }
+        case ExpressionType::Operator:
+        {
+            const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
+
+            switch (operatorExpression->OperatorType)
+            {
+                // Null test of a literal or stored column value cannot fail, computed column evaluation can
+                case ExpressionOperatorType::IsNull:
+                case ExpressionOperatorType::IsNotNull:
+                {
+                    const ExpressionPtr& value = operatorExpression->LeftValue;
+
+                    if (value->Type == ExpressionType::Column)
+                        return !CastSharedPtr<ColumnExpression>(value)->DataColumn->Computed();
+
+                    return value->Type == ExpressionType::Value;
+                }
+                case ExpressionOperatorType::And:
+                case ExpressionOperatorType::Or:
+                    return IsNonNullable(operatorExpression->LeftValue) && IsNonNullable(operatorExpression->RightValue);
+                default:
+                    return false;
+            }
+        }
+        default:
+            return false;
+    }
+}
+
+ExpressionValueType ExpressionOptimizer::GetStaticValueType(const ExpressionPtr& expression) const
+{
+    const CompiledExpressionPtr compiledExpression = ExpressionCompiler(m_expressionTree).Compile(expression);
+    return compiledExpression->HasStaticType() ? compiledExpression->ValueType : ExpressionValueType::Undefined;
+}
+
+ExpressionDependency ExpressionOptimizer::GetDependency(const ExpressionPtr& expression)
+{
+    if (expression == nullptr)
+        return ExpressionDependency::None;
+
+    switch (expression->Type)
+    {
+        case ExpressionType::Value:
+            return ExpressionDependency::None;
+        case ExpressionType::Unary:
+            return GetDependency(CastSharedPtr<UnaryExpression>(expression)->Value);
+        case ExpressionType::InList:
+        {
+            const InListExpressionPtr inListExpression = CastSharedPtr<InListExpression>(expression);
+            ExpressionDependency dependency = GetDependency(inListExpression->Value);
+
+            for (const ExpressionPtr& argument : *inListExpression->Arguments)
+                dependency = max(dependency, GetDependency(argument));
+
+            return dependency;
+        }
+        case ExpressionType::Function:
+        {
+            const FunctionExpressionPtr functionExpression = CastSharedPtr<FunctionExpression>(expression);
+            ExpressionDependency dependency = ExpressionDependency::None;
+
+            if (functionExpression->FunctionType == ExpressionFunctionType::Now || functionExpression->FunctionType == ExpressionFunctionType::UtcNow)
+                dependency = ExpressionDependency::Evaluation;
+
+            for (const ExpressionPtr& argument : *functionExpression->Arguments)
+                dependency = max(dependency, GetDependency(argument));
+
+            return dependency;
+        }
+        case ExpressionType::Operator:
+        {
+            const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
+            return max(GetDependency(operatorExpression->LeftValue), GetDependency(operatorExpression->RightValue));
+        }
+        default:
+            return ExpressionDependency::Row;
+    }
+}
@@ -0,0 +1,76 @@
+//******************************************************************************************************
+//  ExpressionOptimizer.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __EXPRESSION_OPTIMIZER_H
+#define __EXPRESSION_OPTIMIZER_H
+
+#include "ExpressionTree.h"
+
+namespace GSF {
+namespace FilterExpressions
+{
+    // Defines what the value of an expression depends on, in increasing order
+    enum class ExpressionDependency
+    {
+        // Expression only depends on literal values
+        None,
+        // Expression depends on current time, i.e., Now() or UtcNow(), and is constant during an evaluation pass
+        Evaluation,
+        // Expression depends on column values
+        Row
+    };
+
+    // Simplifies expression trees before evaluation. Row independent sub-expressions are folded to literal values,
+    // AND and OR operations with constant operands are short-circuited and IIf functions with a constant test
+    // are replaced by the selected result expression. Sub-expressions that fail to evaluate are not folded so
+    // errors are still reported when a row is evaluated. Since a Null operand makes AND and OR results Null,
+    // "FALSE AND x" and "TRUE OR x" are only short-circuited when x can never be Null, and "NULL AND x" and
+    // "NULL OR x" are only folded to Null when x cannot fail.
+    class ExpressionOptimizer
+    {
+    private:
+        const ExpressionTree& m_expressionTree;
+
+        ExpressionPtr Optimize(const ExpressionPtr& expression, ExpressionDependency& dependency) const;
+        ExpressionPtr OptimizeFunction(const FunctionExpressionPtr& expression, ExpressionDependency& dependency) const;
+        ExpressionPtr OptimizeLogical(const OperatorExpressionPtr& expression) const;
+        ExpressionPtr Fold(const ExpressionPtr& expression) const;
+        ExpressionValueType GetStaticValueType(const ExpressionPtr& expression) const;
+
+        // Integer division by zero, or overflow, traps rather than throws so it is not evaluated by optimizer
+        static bool IsIntegerDivisionTrap(const OperatorExpressionPtr& expression);
+
+        // Determines if expression is a boolean that can never be Null, or fail, when evaluated, false when this
+        // cannot be determined before evaluation
+        static bool IsNonNullable(const ExpressionPtr& expression);
+
+    public:
+        ExpressionOptimizer(const ExpressionTree& expressionTree);
+
+        ExpressionPtr Optimize(const ExpressionPtr& expression) const;
+
+        static ExpressionDependency GetDependency(const ExpressionPtr& expression);
+    };
+}}
+
+#endif
@@ -22,6 +22,8 @@
 //******************************************************************************************************
 
 #include "ExpressionTree.h"
+#include "CompiledExpression.h"
+#include "ExpressionOptimizer.h"
 #include <regex>
 
 using namespace std;
@@ -622,7 +624,7 @@ ValueExpressionPtr ExpressionTree::EvaluateInList(const ExpressionPtr& expressio
 
     // If in list test value is Null, result is Null
     if (inListValue->IsNull())
-        return NullValue(inListValue->ValueType);
+        return NullValue(ExpressionValueType::Boolean);
 
     const size_t argumentCount = inListExpression->Arguments->size();
 
@@ -896,9 +898,15 @@ ValueExpressionPtr ExpressionTree::EvaluateOperator(const ExpressionPtr& express
     const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
     const ValueExpressionPtr leftValue = Evaluate(operatorExpression->LeftValue);
     const ValueExpressionPtr rightValue = Evaluate(operatorExpression->RightValue);
-    const ExpressionValueType valueType = DeriveOperationValueType(operatorExpression->OperatorType, leftValue->ValueType, rightValue->ValueType);
 
-    switch (operatorExpression->OperatorType)
+    return EvaluateOperator(operatorExpression->OperatorType, leftValue, rightValue);
+}
+
+ValueExpressionPtr ExpressionTree::EvaluateOperator(const ExpressionOperatorType operatorType, const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue) const
+{
+    const ExpressionValueType valueType = DeriveOperationValueType(operatorType, leftValue->ValueType, rightValue->ValueType);
+
+    switch (operatorType)
     {
         case ExpressionOperatorType::Multiply:
             return Multiply(leftValue, rightValue, valueType);
@@ -2768,38 +2776,12 @@ ValueExpressionPtr ExpressionTree::Like(const ValueExpressionPtr& leftValue, con
     if (rightValue->IsNull())
         throw ExpressionTreeException("Right operand of \"LIKE\" expression is null");
 
-    const string leftOperand = leftValue->ValueAsString();
-    const string rightOperand = rightValue->ValueAsString();
-
-    string testExpression = GSF::Replace(rightOperand, "%", "*", false);
-    const bool startsWithWildcard = GSF::StartsWith(testExpression, "*", false);
-    const bool endsWithWildcard = GSF::EndsWith(testExpression, "*", false);
-    const bool ignoreCase = !exactMatch;
-
-    if (startsWithWildcard)
-        testExpression = testExpression.substr(1);
-
-    if (endsWithWildcard && !testExpression.empty())
-        testExpression = testExpression.substr(0, testExpression.size() - 1);
-
-    // "*" or "**" expression means match everything
-    if (testExpression.empty())
-        return ExpressionTree::True;
-
-    // Wild cards in the middle of the string are not supported
-    if (GSF::Contains(testExpression, "*", false))
-        throw ExpressionTreeException("Right operand of \"LIKE\" expression \"" + rightOperand + "\" has an invalid pattern");
-
-    if (startsWithWildcard && GSF::EndsWith(leftOperand, testExpression, ignoreCase))
-        return ExpressionTree::True;
-
-    if (endsWithWildcard && GSF::StartsWith(leftOperand, testExpression, ignoreCase))
-        return ExpressionTree::True;
-
-    if (startsWithWildcard && endsWithWildcard && GSF::Contains(leftOperand, testExpression, ignoreCase))
-        return ExpressionTree::True;
+    const LikePattern& pattern = m_likePatternCache.GetOrAdd(rightValue->ValueAsString(), [](const string& rightOperand)
+    {
+        return LikePattern(rightOperand);
+    });
 
-    return ExpressionTree::False;
+    return pattern.IsMatch(leftValue->ValueAsString(), !exactMatch) ? ExpressionTree::True : ExpressionTree::False;
 }
 
 ValueExpressionPtr ExpressionTree::NotLike(const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue, const bool exactMatch) const
@@ -3173,12 +3155,15 @@ ValueExpressionPtr ExpressionTree::EvaluateRegEx(const string& functionName, con
     if (regexValue->IsNull() || testValue->IsNull())
         return NullValue(returnMatchedValue ? ExpressionValueType::String : ExpressionValueType::Boolean);
 
-    const string expressionText = regexValue->ValueAsString();
+    const RegexPtr& expression = m_regexCache.GetOrAdd(regexValue->ValueAsString(), [](const string& expressionText)
+    {
+        return NewSharedPtr<regex>(expressionText);
+    });
+
     const string testText = testValue->ValueAsString();
-    const regex expression(expressionText);
 
     smatch match;
-    const bool result = regex_search(testText, match, expression);
+    const bool result = regex_search(testText, match, *expression);
 
     if (returnMatchedValue)
     {
@@ -3195,6 +3180,7 @@ ValueExpressionPtr ExpressionTree::EvaluateRegEx(const string& functionName, con
 
 ExpressionTree::ExpressionTree(DataTablePtr table) :
     m_table(std::move(table)),
+    m_evaluationPass(0ULL),
     TopLimit(-1)
 {
 }
@@ -3204,10 +3190,110 @@ const DataTablePtr& ExpressionTree::Table() const
     return m_table;
 }
 
+const CompiledExpressionPtr& ExpressionTree::CompiledRoot()
+{
+    if (m_compiledRoot == nullptr || m_compiledRootSource != Root)
+    {
+        m_compiledRoot = ExpressionCompiler(*this).Compile(Root);
+        m_compiledRootSource = Root;
+    }
+
+    return m_compiledRoot;
+}
+
+void ExpressionTree::Optimize()
+{
+    Root = ExpressionOptimizer(*this).Optimize(Root);
+}
+
+ExpressionTreePtr ExpressionTree::Clone() const
+{
+    ExpressionTreePtr expressionTree = NewSharedPtr<ExpressionTree>(m_table);
+
+    expressionTree->TopLimit = TopLimit;
+    expressionTree->OrderByTerms = OrderByTerms;
+    expressionTree->Root = Root;
+
+    return expressionTree;
+}
+
+void ExpressionTree::BeginEvaluation()
+{
+    m_evaluationPass++;
+}
+
 ValueExpressionPtr ExpressionTree::Evaluate(const DataRowPtr& row)
 {
+    BeginEvaluation();
+
+    const CompiledExpressionPtr& compiledRoot = CompiledRoot();
+
+    // Current row is used by parts of expression that are evaluated by tree walker. Trees
+    // of computed columns are reused for other rows of table, so evaluated row is not retained.
+    m_currentRow = row;
+
+    try
+    {
+        ValueExpressionPtr result = compiledRoot->Evaluate(row);
+        m_currentRow = nullptr;
+        return result;
+    }
+    catch (...)
+    {
+        m_currentRow = nullptr;
+        throw;
+    }
+}
+
+bool ExpressionTree::EvaluatePredicate(const DataRowPtr& row, ExpressionValueType& resultValueType)
+{
+    const CompiledExpressionPtr& compiledRoot = CompiledRoot();
+
     m_currentRow = row;
-    return Evaluate(Root);
+
+    try
+    {
+        bool result;
+
+        if (compiledRoot->ValueType == ExpressionValueType::Boolean)
+        {
+            bool isNull = false;
+            result = compiledRoot->EvaluateBoolean(row, isNull);
+            resultValueType = ExpressionValueType::Boolean;
+            result = result && !isNull;
+        }
+        else
+        {
+            const ValueExpressionPtr resultExpression = compiledRoot->Evaluate(row);
+            resultValueType = resultExpression->ValueType;
+            result = resultValueType == ExpressionValueType::Boolean && resultExpression->ValueAsBoolean();
+        }
+
+        m_currentRow = nullptr;
+        return result;
+    }
+    catch (...)
+    {
+        m_currentRow = nullptr;
+        throw;
+    }
+}
+
+ValueExpressionPtr ExpressionTree::EvaluateReference(const DataRowPtr& row)
+{
+    m_currentRow = row;
+
+    try
+    {
+        ValueExpressionPtr result = Evaluate(Root);
+        m_currentRow = nullptr;
+        return result;
+    }
+    catch (...)
+    {
+        m_currentRow = nullptr;
+        throw;
+    }
 }
 
 const ValueExpressionPtr ExpressionTree::True = NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, true);
@@ -24,8 +24,9 @@
 #ifndef __EXPRESSION_TREE_H
 #define __EXPRESSION_TREE_H
 
-#include "../../Common/CommonTypes.h"
-#include "../../Data/DataSet.h"
+#include "../Common/CommonTypes.h"
+#include "../Data/DataSet.h"
+#include "PatternMatcher.h"
 
 namespace GSF {
 namespace FilterExpressions
@@ -278,11 +279,22 @@ namespace FilterExpressions
 
     typedef GSF::SharedPtr<OperatorExpression> OperatorExpressionPtr;
 
+    class CompiledExpression;
+    typedef GSF::SharedPtr<CompiledExpression> CompiledExpressionPtr;
+
     class ExpressionTree
     {
     private:
         GSF::Data::DataRowPtr m_currentRow;
         GSF::Data::DataTablePtr m_table;
+        CompiledExpressionPtr m_compiledRoot;
+        ExpressionPtr m_compiledRootSource;
+        uint64_t m_evaluationPass;
+        mutable PatternCache<LikePattern> m_likePatternCache;
+        mutable PatternCache<RegexPtr> m_regexCache;
+
+        // Gets compiled expression for root, expression is recompiled when root changes
+        const CompiledExpressionPtr& CompiledRoot();
 
         ValueExpressionPtr Evaluate(const ExpressionPtr& expression, ExpressionValueType targetValueType = ExpressionValueType::Boolean) const;
         ValueExpressionPtr EvaluateUnary(const ExpressionPtr& expression) const;
@@ -290,6 +302,7 @@ namespace FilterExpressions
         ValueExpressionPtr EvaluateInList(const ExpressionPtr& expression) const;
         ValueExpressionPtr EvaluateFunction(const ExpressionPtr& expression) const;
         ValueExpressionPtr EvaluateOperator(const ExpressionPtr& expression) const;
+        ValueExpressionPtr EvaluateOperator(ExpressionOperatorType operatorType, const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue) const;
 
         // Operation Value Type Selectors
         ExpressionValueType DeriveOperationValueType(ExpressionOperatorType operationType, ExpressionValueType leftValueType, ExpressionValueType rightValueType) const;
@@ -384,12 +397,39 @@ namespace FilterExpressions
 
         ExpressionPtr Root = nullptr;
 
+        // Simplifies root expression, e.g., folds constant sub-expressions, see ExpressionOptimizer
+        void Optimize();
+
+        // Creates expression tree for same table, limit, ordering and root expression without evaluation state,
+        // root expression is shared since expressions are not changed once created. Evaluation state, i.e., current
+        // row, evaluation pass, pattern caches and compiled root, belongs to each tree, so one tree is not evaluated
+        // on multiple threads at once; concurrent evaluations each use their own clone.
+        GSF::SharedPtr<ExpressionTree> Clone() const;
+
+        // Starts an evaluation pass, sub-expressions that only depend on current time, i.e., that use Now()
+        // or UtcNow(), are evaluated once per pass
+        void BeginEvaluation();
+
+        // Evaluates expression for row with compiled expression, root is compiled on first evaluation.
+        // Each evaluation is its own evaluation pass.
         ValueExpressionPtr Evaluate(const GSF::Data::DataRowPtr& row);
 
+        // Evaluates expression for row as a filter predicate without allocating a result, Null results are false.
+        // Result value type is provided so callers can validate that expression produced a boolean value.
+        // Evaluation pass is not changed, callers evaluating a set of rows start a pass with BeginEvaluation.
+        bool EvaluatePredicate(const GSF::Data::DataRowPtr& row, ExpressionValueType& resultValueType);
+
+        // Evaluates expression for row by walking expression tree, this is the reference for compiled evaluation
+        ValueExpressionPtr EvaluateReference(const GSF::Data::DataRowPtr& row);
+
         static const ValueExpressionPtr True;
         static const ValueExpressionPtr False;
         static const ValueExpressionPtr EmptyString;
         static ValueExpressionPtr NullValue(ExpressionValueType targetValueType);
+
+        friend class ExpressionCompiler;
+        friend class ExpressionOptimizer;
+        friend class BatchEvaluator;
     };
 
     typedef GSF::SharedPtr<ExpressionTree> ExpressionTreePtr;
@@ -0,0 +1,237 @@
+//******************************************************************************************************
+//  FilterExpressionCache.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "FilterExpressionCache.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+using namespace GSF::FilterExpressions;
+
+struct FilterExpressionCacheEntry
+{
+    string Key;
+    const DataSet* DataSetInstance;
+    ParsedFilterStatementsPtr Statements;
+};
+
+struct FilterExpressionCacheState
+{
+    Mutex Lock;
+    list<FilterExpressionCacheEntry> Entries;
+    unordered_map<string, list<FilterExpressionCacheEntry>::iterator> EntryIndex;
+    size_t Capacity = FilterExpressionCache::DefaultCapacity;
+    FilterExpressionCacheStatistics Statistics;
+};
+
+// Cache state is created on first use so that it is available to static initializers of other translation units
+static FilterExpressionCacheState& GetCacheState()
+{
+    static FilterExpressionCacheState cacheState;
+    return cacheState;
+}
+
+static string CreateCacheKey(const DataSetPtr& dataSet, const string& primaryTableName, const string& normalizedExpression)
+{
+    return to_string(reinterpret_cast<uintptr_t>(dataSet.get())) + '\0' + primaryTableName + '\0' + normalizedExpression;
+}
+
+static void RemoveEntry(FilterExpressionCacheState& cacheState, const list<FilterExpressionCacheEntry>::iterator entry)
+{
+    cacheState.EntryIndex.erase(entry->Key);
+    cacheState.Entries.erase(entry);
+}
+
+bool ParsedFilterStatement::IsIdentifier() const
+{
+    return !Identifier.empty();
+}
+
+bool FilterExpressionCache::TryGetStatements(const DataSetPtr& dataSet, const string& primaryTableName, const string& normalizedExpression, ParsedFilterStatementsPtr& statements)
+{
+    FilterExpressionCacheState& cacheState = GetCacheState();
+    const string key = CreateCacheKey(dataSet, primaryTableName, normalizedExpression);
+
+    ScopeLock lock(cacheState.Lock);
+    const auto entry = cacheState.EntryIndex.find(key);
+
+    if (entry == cacheState.EntryIndex.end())
+    {
+        cacheState.Statistics.Misses++;
+        return false;
+    }
+
+    // Tables of data set can be replaced, or removed, after statements were parsed
+    for (const ParsedFilterStatement& statement : *entry->second->Statements)
+    {
+        if (statement.IsIdentifier())
+            continue;
+
+        const DataTablePtr& table = statement.Tree->Table();
+
+        if (dataSet->Table(table->Name()) != table)
+        {
+            RemoveEntry(cacheState, entry->second);
+            cacheState.Statistics.Invalidations++;
+            cacheState.Statistics.Misses++;
+            return false;
+        }
+    }
+
+    cacheState.Entries.splice(cacheState.Entries.begin(), cacheState.Entries, entry->second);
+    cacheState.Statistics.Hits++;
+    statements = entry->second->Statements;
+
+    return true;
+}
+
+void FilterExpressionCache::AddStatements(const DataSetPtr& dataSet, const string& primaryTableName, const string& normalizedExpression, const ParsedFilterStatements& statements)
+{
+    FilterExpressionCacheState& cacheState = GetCacheState();
+    const SharedPtr<ParsedFilterStatements> cachedStatements = NewSharedPtr<ParsedFilterStatements>();
+
+    cachedStatements->reserve(statements.size());
+
+    for (const ParsedFilterStatement& statement : statements)
+    {
+        ParsedFilterStatement cachedStatement;
+
+        if (statement.IsIdentifier())
+        {
+            cachedStatement.IdentifierType = statement.IdentifierType;
+            cachedStatement.Identifier = statement.Identifier;
+        }
+        else
+        {
+            cachedStatement.Tree = statement.Tree->Clone();
+        }
+
+        cachedStatements->push_back(std::move(cachedStatement));
+    }
+
+    const string key = CreateCacheKey(dataSet, primaryTableName, normalizedExpression);
+
+    ScopeLock lock(cacheState.Lock);
+
+    if (cacheState.Capacity == 0)
+        return;
+
+    const auto entry = cacheState.EntryIndex.find(key);
+
+    if (entry != cacheState.EntryIndex.end())
+        RemoveEntry(cacheState, entry->second);
+
+    while (cacheState.Entries.size() >= cacheState.Capacity)
+    {
+        RemoveEntry(cacheState, prev(cacheState.Entries.end()));
+        cacheState.Statistics.Evictions++;
+    }
+
+    cacheState.Entries.push_front({ key, dataSet.get(), cachedStatements });
+    cacheState.EntryIndex.emplace(key, cacheState.Entries.begin());
+}
+
+void FilterExpressionCache::Invalidate(const DataSetPtr& dataSet)
+{
+    if (dataSet == nullptr)
+        return;
+
+    FilterExpressionCacheState& cacheState = GetCacheState();
+    ScopeLock lock(cacheState.Lock);
+
+    for (auto entry = cacheState.Entries.begin(); entry != cacheState.Entries.end();)
+    {
+        if (entry->DataSetInstance == dataSet.get())
+        {
+            RemoveEntry(cacheState, entry++);
+            cacheState.Statistics.Invalidations++;
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+}
+
+void FilterExpressionCache::Clear()
+{
+    FilterExpressionCacheState& cacheState = GetCacheState();
+    ScopeLock lock(cacheState.Lock);
+
+    cacheState.Entries.clear();
+    cacheState.EntryIndex.clear();
+    cacheState.Statistics = {};
+}
+
+size_t FilterExpressionCache::GetCapacity()
+{
+    FilterExpressionCacheState& cacheState = GetCacheState();
+    ScopeLock lock(cacheState.Lock);
+    return cacheState.Capacity;
+}
+
+void FilterExpressionCache::SetCapacity(const size_t capacity)
+{
+    FilterExpressionCacheState& cacheState = GetCacheState();
+    ScopeLock lock(cacheState.Lock);
+
+    cacheState.Capacity = capacity;
+
+    while (cacheState.Entries.size() > capacity)
+    {
+        RemoveEntry(cacheState, prev(cacheState.Entries.end()));
+        cacheState.Statistics.Evictions++;
+    }
+}
+
+FilterExpressionCacheStatistics FilterExpressionCache::GetStatistics()
+{
+    FilterExpressionCacheState& cacheState = GetCacheState();
+    ScopeLock lock(cacheState.Lock);
+
+    FilterExpressionCacheStatistics statistics = cacheState.Statistics;
+    statistics.Count = cacheState.Entries.size();
+    statistics.Capacity = cacheState.Capacity;
+
+    return statistics;
+}
+
+string FilterExpressionCache::NormalizeExpression(const vector<FilterExpressionToken>& tokens)
+{
+    string normalizedExpression;
+
+    // Hidden tokens, i.e., white space and comments, are not included in token list. Tokens containing
+    // spaces are delimited literals, so joining tokens with a single space keeps token boundaries.
+    for (const FilterExpressionToken& token : tokens)
+    {
+        if (token.Type == FilterExpressionTokenType::EndOfInput)
+            break;
+
+        if (!normalizedExpression.empty())
+            normalizedExpression.push_back(' ');
+
+        normalizedExpression.append(token.Type == FilterExpressionTokenType::Keyword ? ToUpper(token.Text) : token.Text);
+    }
+
+    return normalizedExpression;
+}
@@ -0,0 +1,91 @@
+//******************************************************************************************************
+//  FilterExpressionCache.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __FILTER_EXPRESSION_CACHE_H
+#define __FILTER_EXPRESSION_CACHE_H
+
+#include "ExpressionTree.h"
+#include "FilterExpressionLexer.h"
+#include "../Data/DataSet.h"
+
+namespace GSF {
+namespace FilterExpressions
+{
+    // Filter expression statement as parsed against a data set schema. Statement is either an identifier,
+    // i.e., a signal ID, measurement key or point tag, or an expression for a table. Expression roots are
+    // immutable once optimized so they are shared by all expression trees created from a cached statement.
+    struct ParsedFilterStatement
+    {
+        FilterExpressionTokenType IdentifierType = FilterExpressionTokenType::EndOfInput;
+        std::string Identifier;
+        ExpressionTreePtr Tree;
+
+        bool IsIdentifier() const;
+    };
+
+    typedef std::vector<ParsedFilterStatement> ParsedFilterStatements;
+    typedef GSF::SharedPtr<const ParsedFilterStatements> ParsedFilterStatementsPtr;
+
+    struct FilterExpressionCacheStatistics
+    {
+        uint64_t Hits = 0ULL;
+        uint64_t Misses = 0ULL;
+        uint64_t Evictions = 0ULL;
+        uint64_t Invalidations = 0ULL;
+        size_t Count = 0;
+        size_t Capacity = 0;
+    };
+
+    // Process-wide, least recently used cache of parsed filter expression statements. Entries are keyed by
+    // data set, primary table name and normalized expression text, see NormalizeExpression, and are only
+    // used while the tables they were bound to are still part of the data set. Entries hold a reference to
+    // their data set's tables, so data sets being replaced, e.g., by DataPublisher::DefineMetadata, should
+    // be invalidated. All functions are thread-safe.
+    class FilterExpressionCache
+    {
+    public:
+        static constexpr size_t DefaultCapacity = 256;
+
+        // Gets cached statements for expression, false when statements are not cached or are no longer valid for data set
+        static bool TryGetStatements(const GSF::Data::DataSetPtr& dataSet, const std::string& primaryTableName, const std::string& normalizedExpression, ParsedFilterStatementsPtr& statements);
+
+        // Adds copy of statements to cache, expression trees are cloned without their evaluation state
+        static void AddStatements(const GSF::Data::DataSetPtr& dataSet, const std::string& primaryTableName, const std::string& normalizedExpression, const ParsedFilterStatements& statements);
+
+        // Removes all entries for data set
+        static void Invalidate(const GSF::Data::DataSetPtr& dataSet);
+        static void Clear();
+
+        // Gets or sets maximum number of cached filter expressions, zero disables cache
+        static size_t GetCapacity();
+        static void SetCapacity(size_t capacity);
+
+        static FilterExpressionCacheStatistics GetStatistics();
+
+        // Normalizes filter expression tokens so that expressions only differing by white space, comments
+        // or keyword case have the same cache key
+        static std::string NormalizeExpression(const std::vector<FilterExpressionToken>& tokens);
+    };
+}}
+
+#endif
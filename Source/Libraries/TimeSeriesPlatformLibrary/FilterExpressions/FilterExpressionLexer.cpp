@@ -0,0 +1,429 @@
+//******************************************************************************************************
+//  FilterExpressionLexer.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "FilterExpressionLexer.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::FilterExpressions;
+
+// Implicit tokens of grammar, longer symbols are listed first
+static const char* Operators[] =
+{
+    "===", "!==",
+    "<=", ">=", "==", "!=", "<>", "&&", "||", "<<", ">>",
+    ";", ",", "(", ")", "-", "+", "~", "!", "<", ">", "=", "&", "|", "^", "*", "/", "%"
+};
+
+static const char* Keywords[] =
+{
+    "ABS", "AND", "ASC", "BINARY", "BY", "CEILING", "COALESCE", "CONVERT", "CONTAINS", "DATEADD", "DATEDIFF",
+    "DATEPART", "DESC", "ENDSWITH", "FILTER", "FLOOR", "IIF", "IN", "INDEXOF", "IS", "ISDATE", "ISINTEGER",
+    "ISGUID", "ISNULL", "ISNUMERIC", "LASTINDEXOF", "LEN", "LIKE", "LOWER", "MAXOF", "MINOF", "NOT", "NOW",
+    "NTHINDEXOF", "NULL", "OR", "ORDER", "POWER", "REGEXMATCH", "REGEXVAL", "REPLACE", "REVERSE", "ROUND",
+    "SQRT", "SPLIT", "STARTSWITH", "STRCOUNT", "STRCMP", "SUBSTR", "TOP", "TRIM", "TRIMLEFT", "TRIMRIGHT",
+    "UPPER", "UTCNOW", "WHERE", "XOR"
+};
+
+static bool IsDigit(const char value)
+{
+    return value >= '0' && value <= '9';
+}
+
+static bool IsHexDigit(const char value)
+{
+    return IsDigit(value) || (value >= 'a' && value <= 'f') || (value >= 'A' && value <= 'F');
+}
+
+static bool IsLetter(const char value)
+{
+    return (value >= 'a' && value <= 'z') || (value >= 'A' && value <= 'Z');
+}
+
+static bool IsAcronymDigit(const char value)
+{
+    return IsLetter(value) || IsDigit(value) || value == '-' || value == '!' || value == '_' || value == '.' || value == '@' || value == '#' || value == '$';
+}
+
+static bool IsSpace(const char value)
+{
+    return value == ' ' || value == '\v' || value == '\t' || value == '\r' || value == '\n';
+}
+
+// Gets length of case-insensitive match of text at position
+static size_t MatchText(const string& input, const size_t position, const char* text)
+{
+    size_t length = 0;
+
+    while (text[length] != '\0')
+    {
+        if (position + length >= input.size() || toupper(static_cast<uint8_t>(input[position + length])) != text[length])
+            return 0;
+
+        length++;
+    }
+
+    return length;
+}
+
+FilterExpressionToken::FilterExpressionToken(const FilterExpressionTokenType type, string text, const size_t position) :
+    Type(type),
+    Text(std::move(text)),
+    Position(position)
+{
+}
+
+FilterExpressionLexer::FilterExpressionLexer(const string& input) :
+    m_input(input),
+    m_position(0)
+{
+}
+
+char FilterExpressionLexer::CharAt(const size_t position) const
+{
+    return position < m_input.size() ? m_input[position] : '\0';
+}
+
+size_t FilterExpressionLexer::MatchOperator() const
+{
+    for (const char* symbol : Operators)
+    {
+        const size_t length = MatchText(m_input, m_position, symbol);
+
+        if (length > 0)
+            return length;
+    }
+
+    return 0;
+}
+
+size_t FilterExpressionLexer::MatchKeyword() const
+{
+    size_t length = 0;
+
+    for (const char* keyword : Keywords)
+        length = max(length, MatchText(m_input, m_position, keyword));
+
+    return length;
+}
+
+size_t FilterExpressionLexer::MatchBooleanLiteral() const
+{
+    return max(MatchText(m_input, m_position, "TRUE"), MatchText(m_input, m_position, "FALSE"));
+}
+
+size_t FilterExpressionLexer::MatchIdentifier() const
+{
+    const char first = CharAt(m_position);
+    size_t position = m_position + 1;
+
+    if (first == '`' || first == '[')
+    {
+        const char last = first == '`' ? '`' : ']';
+
+        while (position < m_input.size() && m_input[position] != last)
+            position++;
+
+        // Quoted identifier needs at least one character and a closing quote
+        if (position >= m_input.size() || position == m_position + 1)
+            return 0;
+
+        return position - m_position + 1;
+    }
+
+    if (!IsLetter(first) && first != '_')
+        return 0;
+
+    while (IsLetter(CharAt(position)) || IsDigit(CharAt(position)) || CharAt(position) == '_')
+        position++;
+
+    return position - m_position;
+}
+
+size_t FilterExpressionLexer::MatchIntegerLiteral() const
+{
+    size_t position = m_position;
+
+    if (CharAt(position) == '0' && toupper(static_cast<uint8_t>(CharAt(position + 1))) == 'X' && IsHexDigit(CharAt(position + 2)))
+    {
+        position += 2;
+
+        while (IsHexDigit(CharAt(position)))
+            position++;
+
+        return position - m_position;
+    }
+
+    while (IsDigit(CharAt(position)))
+        position++;
+
+    return position - m_position;
+}
+
+size_t FilterExpressionLexer::MatchNumericLiteral() const
+{
+    size_t position = m_position;
+
+    if (IsDigit(CharAt(position)))
+    {
+        while (IsDigit(CharAt(position)))
+            position++;
+
+        if (CharAt(position) == '.')
+        {
+            position++;
+
+            while (IsDigit(CharAt(position)))
+                position++;
+        }
+    }
+    else if (CharAt(position) == '.' && IsDigit(CharAt(position + 1)))
+    {
+        position++;
+
+        while (IsDigit(CharAt(position)))
+            position++;
+    }
+    else
+    {
+        return 0;
+    }
+
+    // Exponent is only included when complete
+    if (toupper(static_cast<uint8_t>(CharAt(position))) == 'E')
+    {
+        size_t exponent = position + 1;
+
+        if (CharAt(exponent) == '-' || CharAt(exponent) == '+')
+            exponent++;
+
+        if (IsDigit(CharAt(exponent)))
+        {
+            while (IsDigit(CharAt(exponent)))
+                exponent++;
+
+            position = exponent;
+        }
+    }
+
+    return position - m_position;
+}
+
+size_t FilterExpressionLexer::MatchGuidValue(size_t position) const
+{
+    static const size_t GroupLengths[] = { 8, 4, 4, 4, 12 };
+    const size_t start = position;
+
+    for (size_t i = 0; i < 5; i++)
+    {
+        if (i > 0 && CharAt(position) == '-')
+            position++;
+
+        for (size_t j = 0; j < GroupLengths[i]; j++)
+        {
+            if (!IsHexDigit(CharAt(position)))
+                return 0;
+
+            position++;
+        }
+    }
+
+    return position - start;
+}
+
+size_t FilterExpressionLexer::MatchGuidLiteral() const
+{
+    const char first = CharAt(m_position);
+
+    if (first == '\'' || first == '{')
+    {
+        const size_t length = MatchGuidValue(m_position + 1);
+
+        if (length > 0 && CharAt(m_position + length + 1) == (first == '{' ? '}' : '\''))
+            return length + 2;
+
+        return 0;
+    }
+
+    return MatchGuidValue(m_position);
+}
+
+size_t FilterExpressionLexer::MatchMeasurementKeyLiteral() const
+{
+    size_t position = m_position;
+
+    while (IsAcronymDigit(CharAt(position)))
+        position++;
+
+    if (position == m_position || CharAt(position) != ':' || !IsDigit(CharAt(position + 1)))
+        return 0;
+
+    position++;
+
+    while (IsDigit(CharAt(position)))
+        position++;
+
+    return position - m_position;
+}
+
+size_t FilterExpressionLexer::MatchPointTagLiteral() const
+{
+    if (CharAt(m_position) != '"')
+        return 0;
+
+    size_t position = m_position + 1;
+
+    while (IsAcronymDigit(CharAt(position)))
+        position++;
+
+    if (position == m_position + 1 || CharAt(position) != '"')
+        return 0;
+
+    return position - m_position + 1;
+}
+
+size_t FilterExpressionLexer::MatchStringLiteral() const
+{
+    if (CharAt(m_position) != '\'')
+        return 0;
+
+    size_t position = m_position + 1;
+    size_t length = 0;
+
+    // Each quote can end string, a doubled quote continues it
+    while (position < m_input.size())
+    {
+        if (m_input[position] != '\'')
+        {
+            position++;
+            continue;
+        }
+
+        length = position - m_position + 1;
+
+        if (CharAt(position + 1) != '\'')
+            break;
+
+        position += 2;
+    }
+
+    return length;
+}
+
+size_t FilterExpressionLexer::MatchDateTimeLiteral() const
+{
+    if (CharAt(m_position) != '#')
+        return 0;
+
+    const size_t position = m_input.find('#', m_position + 1);
+
+    if (position == string::npos || position == m_position + 1)
+        return 0;
+
+    return position - m_position + 1;
+}
+
+size_t FilterExpressionLexer::MatchComment() const
+{
+    if (CharAt(m_position) == '-' && CharAt(m_position + 1) == '-')
+    {
+        const size_t position = m_input.find_first_of("\r\n", m_position);
+        return (position == string::npos ? m_input.size() : position) - m_position;
+    }
+
+    if (CharAt(m_position) == '/' && CharAt(m_position + 1) == '*')
+    {
+        const size_t position = m_input.find("*/", m_position + 2);
+        return position == string::npos ? m_input.size() - m_position : position - m_position + 2;
+    }
+
+    return 0;
+}
+
+vector<FilterExpressionToken> FilterExpressionLexer::Tokenize()
+{
+    vector<FilterExpressionToken> tokens;
+
+    while (m_position < m_input.size())
+    {
+        size_t length = 0;
+        FilterExpressionTokenType type = FilterExpressionTokenType::UnexpectedChar;
+        bool hidden = false;
+
+        // Longest match wins, on a tie the rule defined first in grammar is kept
+        const auto match = [&](const size_t matchLength, const FilterExpressionTokenType matchType, const bool matchHidden)
+        {
+            if (matchLength > length)
+            {
+                length = matchLength;
+                type = matchType;
+                hidden = matchHidden;
+            }
+        };
+
+        match(MatchOperator(), FilterExpressionTokenType::Operator, false);
+        match(MatchKeyword(), FilterExpressionTokenType::Keyword, false);
+        match(MatchBooleanLiteral(), FilterExpressionTokenType::BooleanLiteral, false);
+        match(MatchIdentifier(), FilterExpressionTokenType::Identifier, false);
+        match(MatchIntegerLiteral(), FilterExpressionTokenType::IntegerLiteral, false);
+        match(MatchNumericLiteral(), FilterExpressionTokenType::NumericLiteral, false);
+        match(MatchGuidLiteral(), FilterExpressionTokenType::GuidLiteral, false);
+        match(MatchMeasurementKeyLiteral(), FilterExpressionTokenType::MeasurementKeyLiteral, false);
+        match(MatchPointTagLiteral(), FilterExpressionTokenType::PointTagLiteral, false);
+        match(MatchStringLiteral(), FilterExpressionTokenType::StringLiteral, false);
+        match(MatchDateTimeLiteral(), FilterExpressionTokenType::DateTimeLiteral, false);
+        match(MatchComment(), FilterExpressionTokenType::UnexpectedChar, true);
+
+        if (length == 0)
+        {
+            // Spaces are skipped and any other character is an unexpected character,
+            // multi-byte UTF-8 sequences are kept together as one character
+            length = 1;
+            hidden = IsSpace(m_input[m_position]);
+
+            if ((static_cast<uint8_t>(m_input[m_position]) & 0xC0) == 0xC0)
+            {
+                while ((static_cast<uint8_t>(CharAt(m_position + length)) & 0xC0) == 0x80)
+                    length++;
+            }
+        }
+
+        if (!hidden)
+            tokens.emplace_back(type, m_input.substr(m_position, length), m_position);
+
+        m_position += length;
+    }
+
+    tokens.emplace_back(FilterExpressionTokenType::EndOfInput, "<EOF>", m_input.size());
+    return tokens;
+}
+
+bool FilterExpressionLexer::IsKeyword(const FilterExpressionToken& token, const char* keyword)
+{
+    return token.Type == FilterExpressionTokenType::Keyword && MatchText(token.Text, 0, keyword) == token.Text.size();
+}
+
+bool FilterExpressionLexer::IsOperator(const FilterExpressionToken& token, const char* symbol)
+{
+    return token.Type == FilterExpressionTokenType::Operator && token.Text == symbol;
+}
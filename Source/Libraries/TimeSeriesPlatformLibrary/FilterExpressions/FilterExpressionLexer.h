@@ -0,0 +1,95 @@
+//******************************************************************************************************
+//  FilterExpressionLexer.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __FILTER_EXPRESSION_LEXER_H
+#define __FILTER_EXPRESSION_LEXER_H
+
+#include "../Common/CommonTypes.h"
+
+namespace GSF {
+namespace FilterExpressions
+{
+    // Token types of FilterExpressionSyntax.g4 grammar, keywords and operator symbols are
+    // distinguished by token text
+    enum class FilterExpressionTokenType
+    {
+        Operator,
+        Keyword,
+        BooleanLiteral,
+        Identifier,
+        IntegerLiteral,
+        NumericLiteral,
+        GuidLiteral,
+        MeasurementKeyLiteral,
+        PointTagLiteral,
+        StringLiteral,
+        DateTimeLiteral,
+        UnexpectedChar,
+        EndOfInput
+    };
+
+    struct FilterExpressionToken
+    {
+        FilterExpressionTokenType Type;
+        std::string Text;
+        size_t Position;
+
+        FilterExpressionToken(FilterExpressionTokenType type, std::string text, size_t position);
+    };
+
+    // Hand-written lexer for FilterExpressionSyntax.g4 grammar. Tokens are matched like an ANTLR lexer,
+    // i.e., longest match wins and ties go to the rule defined first in grammar. Comments and spaces are
+    // skipped and token list is always terminated with an end of input token.
+    class FilterExpressionLexer
+    {
+    private:
+        const std::string& m_input;
+        size_t m_position;
+
+        size_t MatchOperator() const;
+        size_t MatchKeyword() const;
+        size_t MatchBooleanLiteral() const;
+        size_t MatchIdentifier() const;
+        size_t MatchIntegerLiteral() const;
+        size_t MatchNumericLiteral() const;
+        size_t MatchGuidLiteral() const;
+        size_t MatchGuidValue(size_t position) const;
+        size_t MatchMeasurementKeyLiteral() const;
+        size_t MatchPointTagLiteral() const;
+        size_t MatchStringLiteral() const;
+        size_t MatchDateTimeLiteral() const;
+        size_t MatchComment() const;
+
+        char CharAt(size_t position) const;
+
+    public:
+        FilterExpressionLexer(const std::string& input);
+
+        std::vector<FilterExpressionToken> Tokenize();
+
+        static bool IsKeyword(const FilterExpressionToken& token, const char* keyword);
+        static bool IsOperator(const FilterExpressionToken& token, const char* symbol);
+    };
+}}
+
+#endif
@@ -22,15 +22,19 @@
 //******************************************************************************************************
 
 #include "FilterExpressionParser.h"
-#include "tree/ParseTreeWalker.h"
+#include "FilterExpressionReader.h"
+#include "BatchEvaluator.h"
+#include "QueryPlanner.h"
 #include "../Common/Nullable.h"
 
+#ifdef USE_ANTLR_FILTER_PARSER
+#include "FilterExpressionSyntaxWalker.h"
+#endif
+
 using namespace std;
 using namespace GSF;
 using namespace GSF::Data;
 using namespace GSF::FilterExpressions;
-using namespace antlr4;
-using namespace antlr4::tree;
 using namespace boost;
 
 static string ParseStringLiteral(string stringLiteral)
@@ -85,6 +89,102 @@ static string ParsePointTagLiteral(string pointTagLiteral)
     return pointTagLiteral;
 }
 
+// Runs tasks on up to maxThreads threads, tasks are assigned to threads round-robin. Tasks are expected
+// to handle their own exceptions.
+template<class TTask>
+static void RunTasks(const size_t taskCount, const int32_t maxThreads, const TTask& task)
+{
+    const size_t threadCount = min(taskCount, static_cast<size_t>(max(maxThreads, 1)));
+
+    if (threadCount < 2)
+    {
+        for (size_t i = 0; i < taskCount; i++)
+            task(i);
+
+        return;
+    }
+
+    vector<Thread> threads;
+
+    threads.reserve(threadCount);
+
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back([&, i]
+        {
+            for (size_t j = i; j < taskCount; j += threadCount)
+                task(j);
+        });
+    }
+
+    for (size_t i = 0; i < threadCount; i++)
+        threads[i].join();
+}
+
+// Determines if expression can be evaluated on multiple threads. Computed column values are evaluated with the
+// shared expression tree of their column and then stored, so are only evaluated on one thread. When the rows of
+// one evaluation are partitioned, current time must be the same for every row, so Now() and UtcNow() are also
+// only evaluated on one thread.
+static bool CanEvaluateConcurrently(const ExpressionPtr& expression, const bool partitioned)
+{
+    if (expression == nullptr)
+        return true;
+
+    const auto canEvaluateArguments = [partitioned](const ExpressionCollectionPtr& arguments)
+    {
+        for (const ExpressionPtr& argument : *arguments)
+        {
+            if (!CanEvaluateConcurrently(argument, partitioned))
+                return false;
+        }
+
+        return true;
+    };
+
+    switch (expression->Type)
+    {
+        case ExpressionType::Value:
+            return true;
+        case ExpressionType::Unary:
+            return CanEvaluateConcurrently(CastSharedPtr<UnaryExpression>(expression)->Value, partitioned);
+        case ExpressionType::Column:
+            return !CastSharedPtr<ColumnExpression>(expression)->DataColumn->Computed();
+        case ExpressionType::InList:
+        {
+            const InListExpressionPtr inListExpression = CastSharedPtr<InListExpression>(expression);
+            return CanEvaluateConcurrently(inListExpression->Value, partitioned) && canEvaluateArguments(inListExpression->Arguments);
+        }
+        case ExpressionType::Function:
+        {
+            const FunctionExpressionPtr functionExpression = CastSharedPtr<FunctionExpression>(expression);
+
+            if (partitioned && (functionExpression->FunctionType == ExpressionFunctionType::Now || functionExpression->FunctionType == ExpressionFunctionType::UtcNow))
+                return false;
+
+            return canEvaluateArguments(functionExpression->Arguments);
+        }
+        case ExpressionType::Operator:
+        {
+            const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
+            return CanEvaluateConcurrently(operatorExpression->LeftValue, partitioned) && CanEvaluateConcurrently(operatorExpression->RightValue, partitioned);
+        }
+        default:
+            return false;
+    }
+}
+
+// Determines if a statement can be evaluated on its own thread, order-by terms are then also read on that thread
+static bool CanEvaluateStatementConcurrently(const ExpressionTree& expressionTree)
+{
+    for (const auto& orderByTerm : expressionTree.OrderByTerms)
+    {
+        if (get<0>(orderByTerm)->Computed())
+            return false;
+    }
+
+    return CanEvaluateConcurrently(expressionTree.Root, false);
+}
+
 FilterExpressionParserException::FilterExpressionParserException(string message) noexcept :
     m_message(std::move(message))
 {
@@ -96,46 +196,77 @@ const char* FilterExpressionParserException::what() const noexcept
 }
 
 FilterExpressionParser::FilterExpressionParser(const string& filterExpression, const bool suppressConsoleErrorOutput) :
-    m_inputStream(filterExpression),
-    m_callbackErrorListener(nullptr),
+    m_filterExpression(filterExpression),
+    m_suppressConsoleErrorOutput(suppressConsoleErrorOutput),
     m_dataSet(nullptr),
     m_trackFilteredRows(true),
     m_trackFilteredSignalIDs(false),
-    m_filterExpressionStatementCount(0)
+    m_filterExpressionStatementCount(0),
+    m_syntaxErrorReported(false),
+    m_maxThreads(1),
+#ifdef USE_ANTLR_FILTER_PARSER
+    m_useAntlrParser(true)
+#else
+    m_useAntlrParser(false)
+#endif
 {
-    m_lexer = new FilterExpressionSyntaxLexer(&m_inputStream);
-    m_tokens = new CommonTokenStream(m_lexer);
-    m_parser = new FilterExpressionSyntaxParser(m_tokens);
-    
-    if (suppressConsoleErrorOutput)
-        m_parser->removeErrorListeners();
 }
 
-FilterExpressionParser::~FilterExpressionParser()
+void FilterExpressionParser::VisitParseTreeNodes()
 {
-    delete m_lexer;
-    delete m_tokens;
-    delete m_parser;
-    delete m_callbackErrorListener;
-}
+    vector<FilterExpressionToken> tokens = FilterExpressionLexer(m_filterExpression).Tokenize();
+    const string normalizedExpression = FilterExpressionCache::NormalizeExpression(tokens);
+    ParsedFilterStatementsPtr cachedStatements;
 
-FilterExpressionParser::CallbackErrorListener::CallbackErrorListener(FilterExpressionParserPtr filterExpressionParser, ParsingExceptionCallback parsingExceptionCallback) :
-    m_filterExpressionParser(std::move(filterExpressionParser)),
-    m_parsingExceptionCallback(std::move(parsingExceptionCallback))
-{        
-}
+    // Expression trees for an expression already parsed against data set schema are created from cached statements
+    if (m_dataSet != nullptr && FilterExpressionCache::TryGetStatements(m_dataSet, m_primaryTableName, normalizedExpression, cachedStatements))
+    {
+        ApplyParsedStatements(*cachedStatements);
+        return;
+    }
 
-void FilterExpressionParser::CallbackErrorListener::syntaxError(Recognizer* recognizer, Token* offendingSymbol, size_t line, size_t charPositionInLine, const string &msg, std::exception_ptr e)
-{
-    m_parsingExceptionCallback(m_filterExpressionParser, msg);
+    m_parsedStatements.clear();
+    m_syntaxErrorReported = false;
+
+#ifdef USE_ANTLR_FILTER_PARSER
+    // Create ANTLR parse tree and visit listener methods, unless hand-written parser is selected for comparison
+    if (m_useAntlrParser)
+        FilterExpressionSyntaxWalker(*this).Walk();
+    else
+        FilterExpressionReader(*this, std::move(tokens)).Parse();
+#else
+    // Parse filter expression statements with recursive-descent parser
+    FilterExpressionReader(*this, std::move(tokens)).Parse();
+#endif
+
+    // Simplify completed expression trees before they are evaluated
+    for (const ExpressionTreePtr& expressionTree : m_expressionTrees)
+        expressionTree->Optimize();
+
+    if (m_dataSet != nullptr && !m_syntaxErrorReported && !m_parsedStatements.empty())
+        FilterExpressionCache::AddStatements(m_dataSet, m_primaryTableName, normalizedExpression, m_parsedStatements);
+
+    m_parsedStatements.clear();
 }
 
-void FilterExpressionParser::VisitParseTreeNodes()
+void FilterExpressionParser::ApplyParsedStatements(const ParsedFilterStatements& statements)
 {
-    // Create parse tree and visit listener methods
-    ParseTreeWalker walker;
-    const auto parseTree = m_parser->parse();
-    walker.walk(this, parseTree);
+    for (const ParsedFilterStatement& statement : statements)
+    {
+        EnterFilterExpressionStatement();
+
+        // Identifiers are matched to current rows of primary table, as when parsed
+        if (statement.IsIdentifier())
+        {
+            ExitIdentifierStatement(statement.IdentifierType, statement.Identifier);
+            continue;
+        }
+
+        m_activeExpressionTree = statement.Tree->Clone();
+        m_expressionTrees.push_back(m_activeExpressionTree);
+    }
+
+    m_parsedStatements.clear();
 }
 
 void FilterExpressionParser::InitializeSetOperations()
@@ -211,37 +342,48 @@ void FilterExpressionParser::MapMatchedFieldRow(const DataTablePtr& primaryTable
     if (column == nullptr)
         return;
 
-    const int32_t columnIndex = column->Index();
+    const DataColumnHandle columnHandle = primaryTable->ColumnHandle(columnName);
 
-    for (int32_t i = 0; i < primaryTable->RowCount(); i++)
+    // Indexed string columns are searched through table
+    if (column->Type() == DataType::String && !column->Computed() && primaryTable->Index(columnHandle) != nullptr)
     {
-        const DataRowPtr& row = primaryTable->Row(i);
+        const DataRowPtr& row = primaryTable->FindRow<string>(columnHandle, matchValue);
 
         if (row)
+            AddMatchedRow(row, signalIDColumnIndex);
+
+        return;
+    }
+
+    // Other columns are searched through a lookup built on first use, so each value in a list does not scan table
+    auto fieldRowLookup = m_fieldRowLookups.find(columnName);
+
+    if (fieldRowLookup == m_fieldRowLookups.end())
+    {
+        const int32_t columnIndex = column->Index();
+        StringMap<DataRowPtr> fieldRows;
+
+        for (int32_t i = 0; i < primaryTable->RowCount(); i++)
         {
+            const DataRowPtr& row = primaryTable->Row(i);
+
+            if (row == nullptr)
+                continue;
+
             const Nullable<string> field = row->ValueAsString(columnIndex);
 
-            if (field.HasValue() && IsEqual(matchValue, field.GetValueOrDefault()))
-            {
-                AddMatchedRow(row, signalIDColumnIndex);
-                return;
-            }
+            // First row with value is kept, matching order of a table scan
+            if (field.HasValue())
+                fieldRows.emplace(field.GetValueOrDefault(), row);
         }
+
+        fieldRowLookup = m_fieldRowLookups.emplace(columnName, std::move(fieldRows)).first;
     }
-}
 
-bool FilterExpressionParser::TryGetExpr(const ParserRuleContext* context, ExpressionPtr& expression) const
-{
-    return TryGetValue<const ParserRuleContext*, ExpressionPtr>(m_expressions, context, expression, nullptr);
-}
+    const auto fieldRow = fieldRowLookup->second.find(matchValue);
 
-void FilterExpressionParser::AddExpr(const ParserRuleContext* context, const ExpressionPtr& expression)
-{
-    // Track expression in parser rule context map
-    m_expressions.insert(pair<const ParserRuleContext*, ExpressionPtr>(context, expression));
-
-    // Update active expression tree root
-    m_activeExpressionTree->Root = expression;
+    if (fieldRow != fieldRowLookup->second.end())
+        AddMatchedRow(fieldRow->second, signalIDColumnIndex);
 }
 
 const DataSetPtr& FilterExpressionParser::GetDataSet() const
@@ -280,17 +422,7 @@ void FilterExpressionParser::SetPrimaryTableName(const string& tableName)
 
 void FilterExpressionParser::RegisterParsingExceptionCallback(const ParsingExceptionCallback& parsingExceptionCallback)
 {
-    if (m_callbackErrorListener)
-    {
-        m_parser->removeErrorListener(m_callbackErrorListener);
-        delete m_callbackErrorListener;
-    }
-
-    if (parsingExceptionCallback == nullptr)
-        return;
-
-    m_callbackErrorListener = new CallbackErrorListener(shared_from_this(), parsingExceptionCallback);
-    m_parser->addErrorListener(m_callbackErrorListener);
+    m_parsingExceptionCallback = parsingExceptionCallback;
 }
 
 void FilterExpressionParser::Evaluate()
@@ -306,16 +438,50 @@ void FilterExpressionParser::Evaluate()
     m_filteredRowSet.clear();
     m_filteredSignalIDs.clear();
     m_filteredSignalIDSet.clear();
+    m_fieldRowLookups.clear();
+    m_signalIDRowLookup.clear();
     m_expressionTrees.clear();
-    m_expressions.clear();
 
     VisitParseTreeNodes();
 
+    const size_t statementCount = m_expressionTrees.size();
+    bool evaluateConcurrently = m_maxThreads > 1 && statementCount > 1;
+
+    for (size_t i = 0; i < statementCount && evaluateConcurrently; i++)
+        evaluateConcurrently = CanEvaluateStatementConcurrently(*m_expressionTrees[i]);
+
+    // Independent statements are selected on multiple threads, matched rows are then applied in statement
+    // order, along with any error, so results are the same as when statements are evaluated one at a time
+    vector<vector<DataRowPtr>> statementRows;
+    vector<std::exception_ptr> statementErrors;
+
+    if (evaluateConcurrently)
+    {
+        statementRows.resize(statementCount);
+        statementErrors.resize(statementCount);
+
+        RunTasks(statementCount, m_maxThreads, [&](const size_t i)
+        {
+            try
+            {
+                statementRows[i] = Select(m_expressionTrees[i]);
+            }
+            catch (...)
+            {
+                statementErrors[i] = std::current_exception();
+            }
+        });
+    }
+
     // Each filter expression statement will have its own expression tree, evaluate each
-    for (size_t i = 0; i < m_expressionTrees.size(); i++)
+    for (size_t i = 0; i < statementCount; i++)
     {
         const ExpressionTreePtr& expressionTree = m_expressionTrees[i];
-        const vector<DataRowPtr> matchedRows = Select(expressionTree);
+
+        if (evaluateConcurrently && statementErrors[i] != nullptr)
+            std::rethrow_exception(statementErrors[i]);
+
+        const vector<DataRowPtr> matchedRows = evaluateConcurrently ? std::move(statementRows[i]) : Select(expressionTree, m_maxThreads);
         int32_t signalIDColumnIndex = -1;
 
         if (m_trackFilteredSignalIDs)
@@ -339,6 +505,31 @@ void FilterExpressionParser::Evaluate()
     }
 }
 
+int32_t FilterExpressionParser::GetMaxThreads() const
+{
+    return m_maxThreads;
+}
+
+void FilterExpressionParser::SetMaxThreads(const int32_t maxThreads)
+{
+    m_maxThreads = max(maxThreads, 1);
+}
+
+bool FilterExpressionParser::GetUseAntlrParser() const
+{
+    return m_useAntlrParser;
+}
+
+void FilterExpressionParser::SetUseAntlrParser(const bool useAntlrParser)
+{
+#ifdef USE_ANTLR_FILTER_PARSER
+    m_useAntlrParser = useAntlrParser;
+#else
+    // Hand-written parser is the only parser available
+    m_useAntlrParser = false;
+#endif
+}
+
 bool FilterExpressionParser::GetTrackFilteredRows() const
 {
     return m_trackFilteredRows;
@@ -389,20 +580,13 @@ const vector<ExpressionTreePtr>& FilterExpressionParser::GetExpressionTrees()
     return m_expressionTrees;
 }
 
-/*
-    filterExpressionStatement
-     : identifierStatement
-     | filterStatement
-     | expression
-     ;
- */
-void FilterExpressionParser::enterFilterExpressionStatement(FilterExpressionSyntaxParser::FilterExpressionStatementContext*)
+void FilterExpressionParser::EnterFilterExpressionStatement()
 {
     // One filter expression can contain multiple filter statements separated by semi-colon,
     // so we track each as an independent expression tree
-    m_expressions.clear();
     m_activeExpressionTree = nullptr;
     m_filterExpressionStatementCount++;
+    m_parsedStatements.emplace_back();
 
     // Encountering second filter expression statement necessitates the use of set operations
     // to prevent possible result duplications
@@ -410,22 +594,8 @@ void FilterExpressionParser::enterFilterExpressionStatement(FilterExpressionSynt
         InitializeSetOperations();
 }
 
-/*
-    filterStatement
-     : K_FILTER ( K_TOP topLimit )? tableName K_WHERE expression ( K_ORDER K_BY orderingTerm ( ',' orderingTerm )* )?
-     ;
-
-    topLimit
-     : ( '-' | '+' )? INTEGER_LITERAL
-     ;
-
-    orderingTerm
-     : exactMatchModifier? columnName ( K_ASC | K_DESC )?
-     ;
- */
-void FilterExpressionParser::enterFilterStatement(FilterExpressionSyntaxParser::FilterStatementContext* context)
+void FilterExpressionParser::EnterFilterStatement(const string& tableName, const string& topLimit)
 {
-    const string& tableName = context->tableName()->getText();
     const DataTablePtr& table = m_dataSet->Table(tableName);
 
     if (table == nullptr)
@@ -433,44 +603,49 @@ void FilterExpressionParser::enterFilterStatement(FilterExpressionSyntaxParser::
 
     m_activeExpressionTree = NewSharedPtr<ExpressionTree>(table);
     m_expressionTrees.push_back(m_activeExpressionTree);
+    m_parsedStatements.back().Tree = m_activeExpressionTree;
 
-    if (context->K_TOP() != nullptr)
-        m_activeExpressionTree->TopLimit = stoi(context->topLimit()->getText());
+    if (!topLimit.empty())
+        m_activeExpressionTree->TopLimit = stoi(topLimit);
+}
 
-    if (context->K_ORDER() != nullptr && context->K_BY() != nullptr)
+void FilterExpressionParser::AddOrderByTerm(const string& columnName, const bool ascending, const bool exactMatchModifier)
+{
+    const DataTablePtr& table = m_activeExpressionTree->Table();
+    const DataColumnPtr& orderByColumn = table->Column(columnName);
+
+    if (orderByColumn == nullptr)
+        throw FilterExpressionParserException("Failed to find order by field \"" + columnName + "\" for table \"" + table->Name() + "\"");
+
+    m_activeExpressionTree->OrderByTerms.emplace_back(orderByColumn, ascending, !exactMatchModifier);
+}
+
+void FilterExpressionParser::EnterExpression()
+{
+    // Handle case of encountering a standalone expression, i.e., an expression not within a filter statement context
+    if (m_activeExpressionTree == nullptr)
     {
-        for (size_t i = 0; i < context->orderingTerm().size(); i++)
-        {
-            auto orderingTermContext = context->orderingTerm(i);
-            const string& orderByColumnName = orderingTermContext->orderByColumnName()->getText();
-            const DataColumnPtr& orderByColumn = table->Column(orderByColumnName);
-
-            if (orderByColumn == nullptr)
-                throw FilterExpressionParserException("Failed to find order by field \"" + orderByColumnName + "\" for table \"" + table->Name() + "\"");
-
-            m_activeExpressionTree->OrderByTerms.emplace_back(
-                orderByColumn,
-                orderingTermContext->K_DESC() == nullptr,
-                orderingTermContext->exactMatchModifier() == nullptr
-            );
-        }
+        const DataTablePtr& table = m_dataSet->Table(m_primaryTableName);
+
+        if (table == nullptr)
+            throw FilterExpressionParserException("Failed to find table \"" + m_primaryTableName + "\"");
+
+        m_activeExpressionTree = NewSharedPtr<ExpressionTree>(table);
+        m_expressionTrees.push_back(m_activeExpressionTree);
+        m_parsedStatements.back().Tree = m_activeExpressionTree;
     }
 }
 
-/*
-    identifierStatement
-     : GUID_LITERAL
-     | MEASUREMENT_KEY_LITERAL
-     | POINT_TAG_LITERAL
-     ;
- */
-void FilterExpressionParser::exitIdentifierStatement(FilterExpressionSyntaxParser::IdentifierStatementContext* context)
+void FilterExpressionParser::ExitIdentifierStatement(const FilterExpressionTokenType identifierType, const string& identifier)
 {
     GSF::Guid signalID = Empty::Guid;
 
-    if (context->GUID_LITERAL())
+    m_parsedStatements.back().IdentifierType = identifierType;
+    m_parsedStatements.back().Identifier = identifier;
+
+    if (identifierType == FilterExpressionTokenType::GuidLiteral)
     {
-        signalID = ParseGuidLiteral(context->GUID_LITERAL()->getText());
+        signalID = ParseGuidLiteral(identifier);
 
         if (!m_trackFilteredRows && !m_trackFilteredSignalIDs)
         {
@@ -478,7 +653,7 @@ void FilterExpressionParser::exitIdentifierStatement(FilterExpressionSyntaxParse
             // In this scenario the filter expression parser would only be used to generate expression trees
             // for general expression parsing, e.g., for a DataColumn expression, so here the Guid should be
             // treated as a literal expression value instead of an identifier to track:
-            enterExpression(nullptr);
+            EnterExpression();
             m_activeExpressionTree->Root = CastSharedPtr<Expression>(NewSharedPtr<ValueExpression>(ExpressionValueType::Guid, signalID));
             return;
         }
@@ -520,467 +695,72 @@ void FilterExpressionParser::exitIdentifierStatement(FilterExpressionSyntaxParse
     if (m_trackFilteredRows && signalID != Empty::Guid)
     {
         // Map matching row for manually specified Guid
-        for (int32_t i = 0; i < primaryTable->RowCount(); i++)
-        {
-            const DataRowPtr& row = primaryTable->Row(i);
-
-            if (row)
-            {
-                const Nullable<GSF::Guid> signalIDField = row->ValueAsGuid(signalIDColumnIndex);
+        DataRowPtr matchedRow = nullptr;
 
-                if (signalIDField.HasValue() && signalIDField.GetValueOrDefault() == signalID)
-                {
-                    if (m_filterExpressionStatementCount > 1)
-                    {
-                        if (m_filteredRowSet.insert(row).second)
-                            m_filteredRows.push_back(row);
-                    }
-                    else
-                    {
-                        m_filteredRows.push_back(row);
-                    }
-
-                    return;
-                }
-            }
-        }
+        const DataColumnHandle signalIDColumnHandle = primaryTable->ColumnHandle(signalIDColumn->Name());
 
-        return;
-    }
-
-    if (context->MEASUREMENT_KEY_LITERAL())
-    {
-        MapMatchedFieldRow(primaryTable, primaryTableIDFields->MeasurementKeyFieldName, context->MEASUREMENT_KEY_LITERAL()->getText(), signalIDColumnIndex);
-        return;
-    }
-
-    if (context->POINT_TAG_LITERAL())
-        MapMatchedFieldRow(primaryTable, primaryTableIDFields->PointTagFieldName, ParsePointTagLiteral(context->POINT_TAG_LITERAL()->getText()), signalIDColumnIndex);
-}
-
-/*
-    expression
-     : notOperator expression
-     | expression logicalOperator expression
-     | predicateExpression
-     ;
- */
-void FilterExpressionParser::enterExpression(FilterExpressionSyntaxParser::ExpressionContext*)
-{
-    // Handle case of encountering a standalone expression, i.e., an expression not within a filter statement context
-    if (m_activeExpressionTree == nullptr)
-    {
-        const DataTablePtr& table = m_dataSet->Table(m_primaryTableName);
-
-        if (table == nullptr)
-            throw FilterExpressionParserException("Failed to find table \"" + m_primaryTableName + "\"");
-
-        m_activeExpressionTree = NewSharedPtr<ExpressionTree>(table);
-        m_expressionTrees.push_back(m_activeExpressionTree);
-    }
-}
-
-/*
-    expression
-     : notOperator expression
-     | expression logicalOperator expression
-     | predicateExpression
-     ;
- */
-void FilterExpressionParser::exitExpression(FilterExpressionSyntaxParser::ExpressionContext* context)
-{
-    ExpressionPtr value;
-
-    // Check for predicate expressions (see explicit visit function)
-    const auto predicateExpressionContext = context->predicateExpression();
-
-    if (predicateExpressionContext != nullptr)
-    {
-        if (TryGetExpr(predicateExpressionContext, value))
+        if (signalIDColumn->Type() == DataType::Guid && !signalIDColumn->Computed() && primaryTable->Index(signalIDColumnHandle) != nullptr)
         {
-            AddExpr(context, value);
-            return;
+            matchedRow = primaryTable->FindRow<GSF::Guid>(signalIDColumnHandle, signalID);
         }
-
-        throw FilterExpressionParserException("Failed to find predicate expression \"" + predicateExpressionContext->getText() + "\"");
-    }
-
-    // Check for not operator expressions
-    const auto notOperatorContext = context->notOperator();
-
-    if (notOperatorContext != nullptr)
-    {
-        if (context->expression().size() != 1)
-            throw FilterExpressionParserException("Not operator expression is malformed: \"" + context->getText() + "\"");
-
-        if (!TryGetExpr(context->expression(0), value))
-            throw FilterExpressionParserException("Failed to find not operator expression \"" + context->getText() + "\"");
-        
-        AddExpr(context, NewSharedPtr<UnaryExpression>(ExpressionUnaryType::Not, value));
-        return;
-    }
-
-    // Check for logical operator expressions
-    const auto logicalOperatorContext = context->logicalOperator();
-
-    if (logicalOperatorContext != nullptr)
-    {
-        ExpressionPtr leftValue, rightValue;
-        ExpressionOperatorType operatorType;
-
-        if (context->expression().size() != 2)
-            throw FilterExpressionParserException("Operator expression, in logical operator expression context, is malformed: \"" + context->getText() + "\"");
-
-        if (!TryGetExpr(context->expression(0), leftValue))
-            throw FilterExpressionParserException("Failed to find left operator expression \"" + context->expression(0)->getText() + "\"");
-
-        if (!TryGetExpr(context->expression(1), rightValue))
-            throw FilterExpressionParserException("Failed to find right operator expression \"" + context->expression(1)->getText() + "\"");
-
-        const string& operatorSymbol = logicalOperatorContext->getText();
-
-        // Check for boolean operations
-        if (logicalOperatorContext->K_AND() != nullptr || IsEqual(operatorSymbol, "&&", false))
-            operatorType = ExpressionOperatorType::And;
-        else if (logicalOperatorContext->K_OR() != nullptr  || IsEqual(operatorSymbol, "||", false))
-            operatorType = ExpressionOperatorType::Or;
         else
-            throw FilterExpressionParserException("Unexpected logical operator \"" + operatorSymbol + "\"");
-
-        AddExpr(context, NewSharedPtr<OperatorExpression>(operatorType, leftValue, rightValue));
-        return;
-    }
-
-    throw FilterExpressionParserException("Unexpected expression \"" + context->getText() + "\"");
-}
-
-/*
-    predicateExpression
-     : predicateExpression notOperator? K_IN exactMatchModifier? '(' expressionList ')'
-     | predicateExpression K_IS notOperator? K_NULL
-     | predicateExpression comparisonOperator predicateExpression
-     | predicateExpression notOperator? K_LIKE exactMatchModifier? predicateExpression
-     | valueExpression
-     ;
- */
-void FilterExpressionParser::exitPredicateExpression(FilterExpressionSyntaxParser::PredicateExpressionContext* context)
-{
-    ExpressionPtr value;
-
-    // Check for value expressions (see explicit visit function)
-    const auto valueExpressionContext = context->valueExpression();
-
-    if (valueExpressionContext != nullptr)
-    {
-        if (TryGetExpr(valueExpressionContext, value))
-        {
-            AddExpr(context, value);
-            return;
-        }
-
-        throw FilterExpressionParserException("Failed to find value expression \"" + valueExpressionContext->getText() + "\"");
-    }
-
-    // Check for IN expressions
-    const auto inKeywordContext = context->K_IN();
-    const auto notOperatorContext = context->notOperator();
-    const auto exactMatchModifierContext = context->exactMatchModifier();
-
-    if (inKeywordContext != nullptr)
-    {
-        // IN expression expects one predicate
-        if (context->predicateExpression().size() != 1)
-            throw FilterExpressionParserException("\"IN\" expression is malformed: \"" + context->getText() + "\"");
-
-        if (!TryGetExpr(context->predicateExpression(0), value))
-            throw FilterExpressionParserException("Failed to find \"IN\" predicate expression \"" + context->predicateExpression(0)->getText() + "\"");
-
-        ExpressionCollectionPtr arguments = NewSharedPtr<ExpressionCollection>();
-        const auto expressionList = context->expressionList();
-        const size_t argumentCount = expressionList->expression().size();
-
-        if (argumentCount < 1)
-            throw FilterExpressionParserException("Not enough expressions found for \"IN\" operation");
-
-        for (size_t i = 0; i < argumentCount; i++)
-        {
-            ExpressionPtr argument;
-
-            if (TryGetExpr(expressionList->expression(i), argument))
-                arguments->push_back(argument);
-            else
-                throw FilterExpressionParserException("Failed to find argument expression " + ToString(i) + " \"" + expressionList->expression(i)->getText() + "\" for \"IN\" operation");
-        }
-
-        AddExpr(context, NewSharedPtr<InListExpression>(value, arguments, notOperatorContext != nullptr, exactMatchModifierContext != nullptr));
-        return;
-    }
-
-    // Check for IS NULL expressions
-    const auto isKeywordContext = context->K_IS();
-    const auto nullKeywordContext = context->K_NULL();
-
-    if (isKeywordContext != nullptr && nullKeywordContext != nullptr)
-    {
-        const ExpressionOperatorType operatorType = notOperatorContext == nullptr ? ExpressionOperatorType::IsNull : ExpressionOperatorType::IsNotNull;
-
-        // IS NULL expression expects one predicate
-        if (context->predicateExpression().size() != 1)
-            throw FilterExpressionParserException("\"IS NULL\" expression is malformed: \"" + context->getText() + "\"");
-
-        if (TryGetExpr(context->predicateExpression(0), value))
         {
-            AddExpr(context, NewSharedPtr<OperatorExpression>(operatorType, value, nullptr));
-            return;
-        }
-
-        throw FilterExpressionParserException("Failed to find \"IS NULL\" predicate expression \"" + context->predicateExpression(0)->getText() + "\"");
-    }
-
-    // Remaining operators require two predicate expressions
-    if (context->predicateExpression().size() != 2)
-        throw FilterExpressionParserException("Operator expression, in predicate expression context, is malformed: \"" + context->getText() + "\"");
-
-    ExpressionPtr leftValue, rightValue;
-    ExpressionOperatorType operatorType;
-
-    if (!TryGetExpr(context->predicateExpression(0), leftValue))
-        throw FilterExpressionParserException("Failed to find left operator predicate expression \"" + context->predicateExpression(0)->getText() + "\"");
-
-    if (!TryGetExpr(context->predicateExpression(1), rightValue))
-        throw FilterExpressionParserException("Failed to find right operator predicate expression \"" + context->predicateExpression(1)->getText() + "\"");
-
-    // Check for comparison operator expressions
-    const auto comparisonOperatorContext = context->comparisonOperator();
-
-    if (comparisonOperatorContext != nullptr)
-    {
-        const string& operatorSymbol = comparisonOperatorContext->getText();
-
-        // Check for comparison operations
-        if (IsEqual(operatorSymbol, "<", false))
-            operatorType = ExpressionOperatorType::LessThan;
-        else if (IsEqual(operatorSymbol, "<=", false))
-            operatorType = ExpressionOperatorType::LessThanOrEqual;
-        else if (IsEqual(operatorSymbol, ">", false))
-            operatorType = ExpressionOperatorType::GreaterThan;
-        else if (IsEqual(operatorSymbol, ">=", false))
-            operatorType = ExpressionOperatorType::GreaterThanOrEqual;
-        else if (IsEqual(operatorSymbol, "=", false) || IsEqual(operatorSymbol, "==", false))
-            operatorType = ExpressionOperatorType::Equal;
-        else if (IsEqual(operatorSymbol, "===", false))
-            operatorType = ExpressionOperatorType::EqualExactMatch;
-        else if (IsEqual(operatorSymbol, "<>", false) || IsEqual(operatorSymbol, "!=", false))
-            operatorType = ExpressionOperatorType::NotEqual;
-        else if (IsEqual(operatorSymbol, "!==", false))
-            operatorType = ExpressionOperatorType::NotEqualExactMatch;
-        else
-            throw FilterExpressionParserException("Unexpected comparison operator \"" + operatorSymbol + "\"");
-
-        AddExpr(context, NewSharedPtr<OperatorExpression>(operatorType, leftValue, rightValue));
-        return;
-    }
-
-    // Check for LIKE expressions
-    const auto likeKeywordContext = context->K_LIKE();
-
-    if (likeKeywordContext != nullptr)
-    {
-        if (exactMatchModifierContext == nullptr)
-            operatorType = notOperatorContext == nullptr ? ExpressionOperatorType::Like : ExpressionOperatorType::NotLike;
-        else
-            operatorType = notOperatorContext == nullptr ? ExpressionOperatorType::LikeExactMatch : ExpressionOperatorType::NotLikeExactMatch;
-
-        AddExpr(context, NewSharedPtr<OperatorExpression>(operatorType, leftValue, rightValue));
-        return;
-    }
-
-    throw FilterExpressionParserException("Unexpected predicate expression \"" + context->getText() + "\"");
-}
+            // Lookup is built on first use so each signal ID in a list does not scan table
+            if (m_signalIDRowLookup.empty())
+            {
+                for (int32_t i = 0; i < primaryTable->RowCount(); i++)
+                {
+                    const DataRowPtr& row = primaryTable->Row(i);
 
-/*
-    valueExpression
-     : literalValue
-     | columnName
-     | functionExpression
-     | unaryOperator valueExpression
-     | '(' expression ')'
-     | valueExpression mathOperator valueExpression
-     | valueExpression bitwiseOperator valueExpression
-; */
-void FilterExpressionParser::exitValueExpression(FilterExpressionSyntaxParser::ValueExpressionContext* context)
-{
-    ExpressionPtr value;
+                    if (row == nullptr)
+                        continue;
 
-    // Check for literal values (see explicit visit function)
-    const auto literalValueContext = context->literalValue();
+                    const Nullable<GSF::Guid> signalIDField = row->ValueAsGuid(signalIDColumnIndex);
 
-    if (literalValueContext != nullptr)
-    {
-        if (TryGetExpr(literalValueContext, value))
-        {
-            AddExpr(context, value);
-            return;
-        }
-
-        throw FilterExpressionParserException("Failed to find literal value \"" + literalValueContext->getText() + "\"");
-    }
+                    if (signalIDField.HasValue())
+                        m_signalIDRowLookup.emplace(signalIDField.GetValueOrDefault(), row);
+                }
+            }
 
-    // Check for column names (see explicit visit function)
-    const auto columnNameContext = context->columnName();
+            const auto signalIDRow = m_signalIDRowLookup.find(signalID);
 
-    if (columnNameContext != nullptr)
-    {
-        if (TryGetExpr(columnNameContext, value))
-        {
-            AddExpr(context, value);
-            return;
+            if (signalIDRow != m_signalIDRowLookup.end())
+                matchedRow = signalIDRow->second;
         }
 
-        throw FilterExpressionParserException("Failed to find column name \"" + columnNameContext->getText() + "\"");
-    }
-
-    // Check for function expressions (see explicit visit function)
-    const auto functionExpressionContext = context->functionExpression();
-
-    if (functionExpressionContext != nullptr)
-    {
-        if (TryGetExpr(functionExpressionContext, value))
-        {
-            AddExpr(context, value);
+        if (matchedRow == nullptr)
             return;
-        }
-
-        throw FilterExpressionParserException("Failed to find function expression \"" + functionExpressionContext->getText() + "\"");
-    }
-
-    // Check for unary operators
-    const auto unaryOperatorContext = context->unaryOperator();
 
-    if (unaryOperatorContext != nullptr)
-    {
-        if (context->valueExpression().size() != 1)
-            throw FilterExpressionParserException("Unary operator value expression is undefined");
-
-        if (TryGetExpr(context->valueExpression(0), value))
+        if (m_filterExpressionStatementCount > 1)
         {
-            ExpressionUnaryType unaryType;
-            const string unaryOperator = unaryOperatorContext->getText();
-
-            if (IsEqual(unaryOperator, "+", false))
-                unaryType = ExpressionUnaryType::Plus;
-            else if (IsEqual(unaryOperator, "-", false))
-                unaryType = ExpressionUnaryType::Minus;
-            else if (IsEqual(unaryOperator, "~", false) || IsEqual(unaryOperator, "!", false) || unaryOperatorContext->K_NOT() != nullptr)
-                unaryType = ExpressionUnaryType::Not;
-            else
-                throw FilterExpressionParserException("Unexpected unary operator type \"" + unaryOperator + "\"");
-
-            AddExpr(context, NewSharedPtr<UnaryExpression>(unaryType, value));
-            return;
+            if (m_filteredRowSet.insert(matchedRow).second)
+                m_filteredRows.push_back(matchedRow);
         }
-
-        throw FilterExpressionParserException("Failed to find unary operator value expression \"" + context->getText() + "\"");
-    }
-
-    // Check for sub-expressions, i.e., "(" expression ")"
-    const auto expressionContext = context->expression();
-
-    if (expressionContext != nullptr)
-    {
-        if (TryGetExpr(expressionContext, value))
+        else
         {
-            AddExpr(context, value);
-            return;
+            m_filteredRows.push_back(matchedRow);
         }
 
-        throw FilterExpressionParserException("Failed to find sub-expression \"" + expressionContext->getText() + "\"");
-    }
-
-    // Remaining operators require two value expressions
-    if (context->valueExpression().size() != 2)
-        throw FilterExpressionParserException("Operator expression, in value expression context, is malformed: \"" + context->getText() + "\"");
-
-    ExpressionPtr leftValue, rightValue;
-    ExpressionOperatorType operatorType;
-
-    if (!TryGetExpr(context->valueExpression(0), leftValue))
-        throw FilterExpressionParserException("Failed to find left operator value expression \"" + context->valueExpression(0)->getText() + "\"");
-
-    if (!TryGetExpr(context->valueExpression(1), rightValue))
-        throw FilterExpressionParserException("Failed to find right operator value expression \"" + context->valueExpression(1)->getText() + "\"");
-
-    // Check for math operator expressions
-    const auto mathOperatorContext = context->mathOperator();
-
-    if (mathOperatorContext != nullptr)
-    {
-        const string& operatorSymbol = mathOperatorContext->getText();
-
-        // Check for arithmetic operations
-        if (IsEqual(operatorSymbol, "*", false))
-            operatorType = ExpressionOperatorType::Multiply;
-        else if (IsEqual(operatorSymbol, "/", false))
-            operatorType = ExpressionOperatorType::Divide;
-        else if (IsEqual(operatorSymbol, "%", false))
-            operatorType = ExpressionOperatorType::Modulus;
-        else if (IsEqual(operatorSymbol, "+", false))
-            operatorType = ExpressionOperatorType::Add;
-        else if (IsEqual(operatorSymbol, "-", false))
-            operatorType = ExpressionOperatorType::Subtract;
-        else
-            throw FilterExpressionParserException("Unexpected math operator \"" + operatorSymbol + "\"");
-
-        AddExpr(context, NewSharedPtr<OperatorExpression>(operatorType, leftValue, rightValue));
         return;
     }
 
-    // Check for bitwise operator expressions
-    const auto bitwiseOperatorContext = context->bitwiseOperator();
-
-    if (bitwiseOperatorContext != nullptr)
+    if (identifierType == FilterExpressionTokenType::MeasurementKeyLiteral)
     {
-        const string& operatorSymbol = bitwiseOperatorContext->getText();
-
-        // Check for bitwise operations
-        if (IsEqual(operatorSymbol, "<<", false))
-            operatorType = ExpressionOperatorType::BitShiftLeft;
-        else if (IsEqual(operatorSymbol, ">>", false))
-            operatorType = ExpressionOperatorType::BitShiftRight;
-        else if (IsEqual(operatorSymbol, "&", false))
-            operatorType = ExpressionOperatorType::BitwiseAnd;
-        else if (IsEqual(operatorSymbol, "|", false))
-            operatorType = ExpressionOperatorType::BitwiseOr;
-        else if (IsEqual(operatorSymbol, "^", false) || bitwiseOperatorContext->K_XOR() != nullptr)
-            operatorType = ExpressionOperatorType::BitwiseXor;
-        else
-            throw FilterExpressionParserException("Unexpected bitwise operator \"" + operatorSymbol + "\"");
-
-        AddExpr(context, NewSharedPtr<OperatorExpression>(operatorType, leftValue, rightValue));
+        MapMatchedFieldRow(primaryTable, primaryTableIDFields->MeasurementKeyFieldName, identifier, signalIDColumnIndex);
         return;
     }
 
-    throw FilterExpressionParserException("Unexpected value expression \"" + context->getText() + "\"");
+    if (identifierType == FilterExpressionTokenType::PointTagLiteral)
+        MapMatchedFieldRow(primaryTable, primaryTableIDFields->PointTagFieldName, ParsePointTagLiteral(identifier), signalIDColumnIndex);
 }
 
-/*
-    literalValue
-     : INTEGER_LITERAL
-     | NUMERIC_LITERAL
-     | STRING_LITERAL
-     | DATETIME_LITERAL
-     | GUID_LITERAL
-     | BOOLEAN_LITERAL
-     | K_NULL
-     ;
- */
-void FilterExpressionParser::exitLiteralValue(FilterExpressionSyntaxParser::LiteralValueContext* context)
+ValueExpressionPtr FilterExpressionParser::ParseLiteralValue(const FilterExpressionTokenType literalType, const string& literal) const
 {
     ValueExpressionPtr result = nullptr;
 
-    if (context->INTEGER_LITERAL())
+    if (literalType == FilterExpressionTokenType::IntegerLiteral)
     {
-        const double_t value = stod(context->INTEGER_LITERAL()->getText());
+        const double_t value = stod(literal);
 
         if (value > Int64::MaxValue)
             result = NewSharedPtr<ValueExpression>(ExpressionValueType::Double, value);
@@ -989,10 +769,8 @@ void FilterExpressionParser::exitLiteralValue(FilterExpressionSyntaxParser::Lite
         else
             result = NewSharedPtr<ValueExpression>(ExpressionValueType::Int32, static_cast<int32_t>(value));
     }
-    else if (context->NUMERIC_LITERAL())
+    else if (literalType == FilterExpressionTokenType::NumericLiteral)
     {
-        const string& literal = context->NUMERIC_LITERAL()->getText();
-        
         if (Contains(literal, "E"))
         {
             // Real literals using scientific notation are parsed as double
@@ -1012,161 +790,52 @@ void FilterExpressionParser::exitLiteralValue(FilterExpressionSyntaxParser::Lite
             }
         }
     }
-    else if (context->STRING_LITERAL())
+    else if (literalType == FilterExpressionTokenType::StringLiteral)
     {
-        result = NewSharedPtr<ValueExpression>(ExpressionValueType::String, ParseStringLiteral(context->STRING_LITERAL()->getText()));
+        result = NewSharedPtr<ValueExpression>(ExpressionValueType::String, ParseStringLiteral(literal));
     }
-    else if (context->DATETIME_LITERAL())
+    else if (literalType == FilterExpressionTokenType::DateTimeLiteral)
     {
-        result = NewSharedPtr<ValueExpression>(ExpressionValueType::DateTime, ParseDateTimeLiteral(context->DATETIME_LITERAL()->getText()));
+        result = NewSharedPtr<ValueExpression>(ExpressionValueType::DateTime, ParseDateTimeLiteral(literal));
     }
-    else if (context->GUID_LITERAL())
+    else if (literalType == FilterExpressionTokenType::GuidLiteral)
     {
-        result = NewSharedPtr<ValueExpression>(ExpressionValueType::Guid, ParseGuidLiteral(context->GUID_LITERAL()->getText()));
+        result = NewSharedPtr<ValueExpression>(ExpressionValueType::Guid, ParseGuidLiteral(literal));
     }
-    else if (context->BOOLEAN_LITERAL())
+    else if (literalType == FilterExpressionTokenType::BooleanLiteral)
     {
-        result = IsEqual(context->BOOLEAN_LITERAL()->getText(), "true") ? ExpressionTree::True : ExpressionTree::False;
+        result = IsEqual(literal, "true") ? ExpressionTree::True : ExpressionTree::False;
     }
-    else if (context->K_NULL())
+    else if (literalType == FilterExpressionTokenType::Keyword && IsEqual(literal, "NULL"))
     {
         result = ExpressionTree::NullValue(ExpressionValueType::Undefined);
     }
 
-    if (result)
-        AddExpr(context, CastSharedPtr<Expression>(result));
+    if (result == nullptr)
+        throw FilterExpressionParserException("Unexpected literal value \"" + literal + "\"");
+
+    return result;
 }
 
-/*
-    columnName
-     : IDENTIFIER
-     ;
- */
-void FilterExpressionParser::exitColumnName(FilterExpressionSyntaxParser::ColumnNameContext* context)
+ExpressionPtr FilterExpressionParser::ParseColumnName(const string& columnName) const
 {
-    const string& columnName = context->IDENTIFIER()->getText();
     const DataColumnPtr& dataColumn = m_activeExpressionTree->Table()->Column(columnName);
 
     if (dataColumn == nullptr)
         throw FilterExpressionParserException("Failed to find column \"" + columnName + "\" in table \"" + m_activeExpressionTree->Table()->Name() + "\"");
 
-    AddExpr(context, NewSharedPtr<ColumnExpression>(dataColumn));
+    return NewSharedPtr<ColumnExpression>(dataColumn);
 }
 
-/*
-    functionExpression
-     : functionName '(' expressionList? ')'
-     ;
- */
-void FilterExpressionParser::exitFunctionExpression(FilterExpressionSyntaxParser::FunctionExpressionContext* context)
+void FilterExpressionParser::ReportSyntaxError(const size_t line, const size_t column, const string& message)
 {
-    ExpressionFunctionType functionType;
-    auto functionNameContext = context->functionName();
-
-    if (functionNameContext->K_ABS() != nullptr)
-        functionType = ExpressionFunctionType::Abs;
-    else if (functionNameContext->K_CEILING() != nullptr)
-        functionType = ExpressionFunctionType::Ceiling;
-    else if (functionNameContext->K_COALESCE() != nullptr)
-        functionType = ExpressionFunctionType::Coalesce;
-    else if (functionNameContext->K_CONVERT() != nullptr)
-        functionType = ExpressionFunctionType::Convert;
-    else if (functionNameContext->K_CONTAINS() != nullptr)
-        functionType = ExpressionFunctionType::Contains;
-    else if (functionNameContext->K_DATEADD() != nullptr)
-        functionType = ExpressionFunctionType::DateAdd;
-    else if (functionNameContext->K_DATEDIFF() != nullptr)
-        functionType = ExpressionFunctionType::DateDiff;
-    else if (functionNameContext->K_DATEPART() != nullptr)
-        functionType = ExpressionFunctionType::DatePart;
-    else if (functionNameContext->K_ENDSWITH() != nullptr)
-        functionType = ExpressionFunctionType::EndsWith;
-    else if (functionNameContext->K_FLOOR() != nullptr)
-        functionType = ExpressionFunctionType::Floor;
-    else if (functionNameContext->K_IIF() != nullptr)
-        functionType = ExpressionFunctionType::IIf;
-    else if (functionNameContext->K_INDEXOF() != nullptr)
-        functionType = ExpressionFunctionType::IndexOf;
-    else if (functionNameContext->K_ISDATE() != nullptr)
-        functionType = ExpressionFunctionType::IsDate;
-    else if (functionNameContext->K_ISINTEGER() != nullptr)
-        functionType = ExpressionFunctionType::IsInteger;
-    else if (functionNameContext->K_ISGUID() != nullptr)
-        functionType = ExpressionFunctionType::IsGuid;
-    else if (functionNameContext->K_ISNULL() != nullptr)
-        functionType = ExpressionFunctionType::IsNull;
-    else if (functionNameContext->K_ISNUMERIC() != nullptr)
-        functionType = ExpressionFunctionType::IsNumeric;
-    else if (functionNameContext->K_LASTINDEXOF() != nullptr)
-        functionType = ExpressionFunctionType::LastIndexOf;
-    else if (functionNameContext->K_LEN() != nullptr)
-        functionType = ExpressionFunctionType::Len;
-    else if (functionNameContext->K_LOWER() != nullptr)
-        functionType = ExpressionFunctionType::Lower;
-    else if (functionNameContext->K_MAXOF() != nullptr)
-        functionType = ExpressionFunctionType::MaxOf;
-    else if (functionNameContext->K_MINOF() != nullptr)
-        functionType = ExpressionFunctionType::MinOf;
-    else if (functionNameContext->K_NOW() != nullptr)
-        functionType = ExpressionFunctionType::Now;
-    else if (functionNameContext->K_NTHINDEXOF() != nullptr)
-        functionType = ExpressionFunctionType::NthIndexOf;
-    else if (functionNameContext->K_POWER() != nullptr)
-        functionType = ExpressionFunctionType::Power;
-    else if (functionNameContext->K_REGEXMATCH() != nullptr)
-        functionType = ExpressionFunctionType::RegExMatch;
-    else if (functionNameContext->K_REGEXVAL() != nullptr)
-        functionType = ExpressionFunctionType::RegExVal;
-    else if (functionNameContext->K_REPLACE() != nullptr)
-        functionType = ExpressionFunctionType::Replace;
-    else if (functionNameContext->K_REVERSE() != nullptr)
-        functionType = ExpressionFunctionType::Reverse;
-    else if (functionNameContext->K_ROUND() != nullptr)
-        functionType = ExpressionFunctionType::Round;
-    else if (functionNameContext->K_SPLIT() != nullptr)
-        functionType = ExpressionFunctionType::Split;
-    else if (functionNameContext->K_SQRT() != nullptr)
-        functionType = ExpressionFunctionType::Sqrt;
-    else if (functionNameContext->K_STARTSWITH() != nullptr)
-        functionType = ExpressionFunctionType::StartsWith;
-    else if (functionNameContext->K_STRCOUNT() != nullptr)
-        functionType = ExpressionFunctionType::StrCount;
-    else if (functionNameContext->K_STRCMP() != nullptr)
-        functionType = ExpressionFunctionType::StrCmp;
-    else if (functionNameContext->K_SUBSTR() != nullptr)
-        functionType = ExpressionFunctionType::SubStr;
-    else if (functionNameContext->K_TRIM() != nullptr)
-        functionType = ExpressionFunctionType::Trim;
-    else if (functionNameContext->K_TRIMLEFT() != nullptr)
-        functionType = ExpressionFunctionType::TrimLeft;
-    else if (functionNameContext->K_TRIMRIGHT() != nullptr)
-        functionType = ExpressionFunctionType::TrimRight;
-    else if (functionNameContext->K_UPPER() != nullptr)
-        functionType = ExpressionFunctionType::Upper;
-    else if (functionNameContext->K_UTCNOW() != nullptr)
-        functionType = ExpressionFunctionType::UtcNow;
-    else
-        throw FilterExpressionParserException("Unexpected function type \"" + functionNameContext->getText() + "\"");
+    m_syntaxErrorReported = true;
 
-    ExpressionCollectionPtr arguments = NewSharedPtr<ExpressionCollection>();
-    const auto expressionList = context->expressionList();
-
-    if (expressionList != nullptr)
-    {
-        const int32_t argumentCount = expressionList->expression().size();
-
-        for (int32_t i = 0; i < argumentCount; i++)
-        {
-            ExpressionPtr argument;
-
-            if (TryGetExpr(expressionList->expression(i), argument))
-                arguments->push_back(argument);
-            else
-                throw FilterExpressionParserException("Failed to find argument expression " + ToString(i) + " \"" + expressionList->expression(i)->getText() + "\" for function \"" + functionNameContext->getText() + "\"");
-        }
-    }
+    if (!m_suppressConsoleErrorOutput)
+        cerr << "line " << line << ":" << column << " " << message << endl;
 
-    AddExpr(context, NewSharedPtr<FunctionExpression>(functionType, arguments));
+    if (m_parsingExceptionCallback != nullptr)
+        m_parsingExceptionCallback(shared_from_this(), message);
 }
 
 vector<ExpressionTreePtr> FilterExpressionParser::GenerateExpressionTrees(const DataSetPtr& dataSet, const string& primaryTableName, const string& filterExpression, const bool suppressConsoleErrorOutput)
@@ -1222,122 +891,286 @@ vector<DataRowPtr> FilterExpressionParser::Select(const DataTablePtr& dataTable,
     return Select(dataTable->Parent(), filterExpression, dataTable->Name(), tableIDFields, suppressConsoleErrorOutput);
 }
 
-vector<DataRowPtr> FilterExpressionParser::Select(const ExpressionTreePtr& expressionTree)
+typedef pair<DataRowPtr, int32_t> MatchedRow;
+
+// Evaluates WHERE expression for row, if final result is Null, i.e., has no value due to Null propagation, result is False
+static bool IsMatch(const ExpressionTreePtr& expressionTree, const DataRowPtr& row)
+{
+    ExpressionValueType resultValueType;
+    const bool result = expressionTree->EvaluatePredicate(row, resultValueType);
+
+    // Final expression should have a boolean data type (it's part of a WHERE clause)
+    if (resultValueType != ExpressionValueType::Boolean)
+        throw FilterExpressionParserException("Final expression tree evaluation did not result in a boolean value, result data type is \"" + string(EnumName(resultValueType)) + "\"");
+
+    return result;
+}
+
+// Compares rows by order-by term, result is negative when left row sorts first
+static int32_t CompareOrderByTerm(const std::tuple<DataColumnPtr, bool, bool>& orderByTerm, const DataRowPtr& leftMatchedRow, const DataRowPtr& rightMatchedRow)
+{
+    const DataColumnPtr& orderByColumn = get<0>(orderByTerm);
+    const int32_t columnIndex = orderByColumn->Index();
+    const bool ascending = get<1>(orderByTerm);
+    const bool exactMatch = get<2>(orderByTerm);
+    const DataRowPtr& leftRow = ascending ? leftMatchedRow : rightMatchedRow;
+    const DataRowPtr& rightRow = ascending ? rightMatchedRow : leftMatchedRow;
+    int32_t result;
+
+    switch (orderByColumn->Type())
+    {
+        case DataType::String:
+        {
+            auto leftNullable = leftRow->ValueAsString(columnIndex);
+            auto rightNullable = rightRow->ValueAsString(columnIndex);
+
+            if (leftNullable.HasValue() && rightNullable.HasValue())
+                result = Compare(leftNullable.GetValueOrDefault(), rightNullable.GetValueOrDefault(), !exactMatch);
+            else if (!leftNullable.HasValue() && !rightNullable.HasValue())
+                result = 0;
+            else
+                result = leftNullable.HasValue() ? 1 : -1;
+
+            break;
+        }
+        case DataType::Boolean:
+            result = CompareValues(leftRow->ValueAsBoolean(columnIndex), rightRow->ValueAsBoolean(columnIndex));
+            break;
+        case DataType::DateTime:
+            result = CompareValues(leftRow->ValueAsDateTime(columnIndex), rightRow->ValueAsDateTime(columnIndex));
+            break;
+        case DataType::Single:
+            result = CompareValues(leftRow->ValueAsSingle(columnIndex), rightRow->ValueAsSingle(columnIndex));
+            break;
+        case DataType::Double:
+            result = CompareValues(leftRow->ValueAsDouble(columnIndex), rightRow->ValueAsDouble(columnIndex));
+            break;
+        case DataType::Decimal:
+            result = CompareValues(leftRow->ValueAsDecimal(columnIndex), rightRow->ValueAsDecimal(columnIndex));
+            break;
+        case DataType::Guid:
+            result = CompareValues(leftRow->ValueAsGuid(columnIndex), rightRow->ValueAsGuid(columnIndex));
+            break;
+        case DataType::Int8:
+            result = CompareValues(leftRow->ValueAsInt8(columnIndex), rightRow->ValueAsInt8(columnIndex));
+            break;
+        case DataType::Int16:
+            result = CompareValues(leftRow->ValueAsInt16(columnIndex), rightRow->ValueAsInt16(columnIndex));
+            break;
+        case DataType::Int32:
+            result = CompareValues(leftRow->ValueAsInt32(columnIndex), rightRow->ValueAsInt32(columnIndex));
+            break;
+        case DataType::Int64:
+            result = CompareValues(leftRow->ValueAsInt64(columnIndex), rightRow->ValueAsInt64(columnIndex));
+            break;
+        case DataType::UInt8:
+            result = CompareValues(leftRow->ValueAsUInt8(columnIndex), rightRow->ValueAsUInt8(columnIndex));
+            break;
+        case DataType::UInt16:
+            result = CompareValues(leftRow->ValueAsUInt16(columnIndex), rightRow->ValueAsUInt16(columnIndex));
+            break;
+        case DataType::UInt32:
+            result = CompareValues(leftRow->ValueAsUInt32(columnIndex), rightRow->ValueAsUInt32(columnIndex));
+            break;
+        case DataType::UInt64:
+            result = CompareValues(leftRow->ValueAsUInt64(columnIndex), rightRow->ValueAsUInt64(columnIndex));
+            break;
+        default:
+            throw FilterExpressionParserException("Unexpected column data type encountered");
+    }
+
+    return result;
+}
+
+vector<DataRowPtr> FilterExpressionParser::Select(const ExpressionTreePtr& expressionTree, const int32_t maxThreads)
 {
     const DataTablePtr& table = expressionTree->Table();
+    const vector<std::tuple<DataColumnPtr, bool, bool>>& orderByTerms = expressionTree->OrderByTerms;
+    const int32_t topLimit = expressionTree->TopLimit;
     vector<DataRowPtr> matchedRows;
+    vector<DataRowPtr> candidateRows;
+
+    if (topLimit == 0)
+        return matchedRows;
+
+    // When expression has indexable predicates, only rows found through column indexes are evaluated
+    const bool hasCandidateRows = QueryPlanner(table).TryGetCandidateRows(expressionTree->Root, candidateRows);
+    bool hasOrderedRows = false;
 
-    for (int32_t i = 0; i < table->RowCount(); i++)
+    // Otherwise, an ordered index on first order-by column lists rows in sort order. Ordered
+    // string indexes are case-insensitive so are only used for terms that ignore case.
+    if (!hasCandidateRows && !orderByTerms.empty())
     {
-        if (expressionTree->TopLimit > -1 && static_cast<int32_t>(matchedRows.size()) >= expressionTree->TopLimit)
-            break;
+        const DataColumnPtr& orderByColumn = get<0>(orderByTerms[0]);
 
-        const DataRowPtr& row = table->Row(i);
+        if (orderByColumn->Type() != DataType::String || !get<2>(orderByTerms[0]))
+            hasOrderedRows = table->TryGetOrderedRows(table->ColumnHandle(orderByColumn->Name()), get<1>(orderByTerms[0]), candidateRows);
+    }
 
-        if (row == nullptr)
-            continue;
+    bool useCandidateRows = hasCandidateRows || hasOrderedRows;
+    bool rowsMatched = false;
+
+    expressionTree->BeginEvaluation();
 
-        const ValueExpressionPtr& resultExpression = expressionTree->Evaluate(row);
+    // Full scans that do not stop early at TOP limit evaluate expression a column at a time,
+    // candidate rows are then the matched rows in row order
+    if (!useCandidateRows && (topLimit < 0 || !orderByTerms.empty()))
+    {
+        vector<int32_t> positions;
 
-        // Final expression should have a boolean data type (it's part of a WHERE clause)
-        if (resultExpression->ValueType != ExpressionValueType::Boolean)
-            throw FilterExpressionParserException("Final expression tree evaluation did not result in a boolean value, result data type is \"" + string(EnumName(resultExpression->ValueType)) + "\"");
+        if (BatchEvaluator(*expressionTree).TryGetMatchingPositions(positions))
+        {
+            candidateRows.reserve(positions.size());
 
-        // If final result is Null, i.e., has no value due to Null propagation, treat result as False
-        if (resultExpression->ValueAsBoolean())
-            matchedRows.push_back(row);
+            for (const int32_t position : positions)
+                candidateRows.push_back(table->Row(position));
+
+            useCandidateRows = true;
+            rowsMatched = true;
+        }
     }
 
-    if (!matchedRows.empty() && !expressionTree->OrderByTerms.empty())
+    const int32_t scanCount = useCandidateRows ? ConvertInt32(candidateRows.size()) : table->RowCount();
+    const int32_t partitionCount = min(maxThreads, scanCount / MinimumPartitionRowCount);
+
+    // Otherwise, large scans that do not stop early at TOP limit are partitioned across threads. Each partition
+    // is evaluated with its own clone of the expression tree, matched rows are then candidate rows in scan order.
+    if (!rowsMatched && partitionCount > 1 && (topLimit < 0 || (!orderByTerms.empty() && !hasOrderedRows)) && CanEvaluateConcurrently(expressionTree->Root, true))
     {
-        sort(matchedRows.begin(), matchedRows.end(), [expressionTree](const DataRowPtr& leftMatchedRow, const DataRowPtr& rightMatchedRow)
+        vector<uint8_t> rowMatches(scanCount);
+        vector<std::exception_ptr> partitionErrors(partitionCount);
+
+        RunTasks(partitionCount, partitionCount, [&](const size_t partition)
         {
-            for (size_t i = 0; i < expressionTree->OrderByTerms.size(); i++)
+            const int32_t start = ConvertInt32(scanCount * partition / partitionCount);
+            const int32_t end = ConvertInt32(scanCount * (partition + 1) / partitionCount);
+
+            try
             {
-                const auto orderByTerm = expressionTree->OrderByTerms[i];
-                const DataColumnPtr& orderByColumn = get<0>(orderByTerm);
-                const int32_t columnIndex = orderByColumn->Index();
-                const bool ascending = get<1>(orderByTerm);
-                const bool exactMatch = get<2>(orderByTerm);
-                const DataRowPtr& leftRow = ascending ? leftMatchedRow : rightMatchedRow;
-                const DataRowPtr& rightRow = ascending ? rightMatchedRow : leftMatchedRow;
-                int32_t result;
-
-                switch (orderByColumn->Type())
+                const ExpressionTreePtr partitionTree = expressionTree->Clone();
+
+                partitionTree->BeginEvaluation();
+
+                for (int32_t i = start; i < end; i++)
                 {
-                    case DataType::String:
-                    {
-                        auto leftNullable = leftRow->ValueAsString(columnIndex);
-                        auto rightNullable = rightRow->ValueAsString(columnIndex);
-
-                        if (leftNullable.HasValue() && rightNullable.HasValue())
-                            result = Compare(leftNullable.GetValueOrDefault(), rightNullable.GetValueOrDefault(), !exactMatch);
-                        else if (!leftNullable.HasValue() && !rightNullable.HasValue())
-                            result = 0;
-                        else
-                            result = leftNullable.HasValue() ? 1 : -1;
-
-                        break;
-                    }
-                    case DataType::Boolean:
-                        result = CompareValues(leftRow->ValueAsBoolean(columnIndex), rightRow->ValueAsBoolean(columnIndex));
-                        break;
-                    case DataType::DateTime:
-                        result = CompareValues(leftRow->ValueAsDateTime(columnIndex), rightRow->ValueAsDateTime(columnIndex));
-                        break;
-                    case DataType::Single:
-                        result = CompareValues(leftRow->ValueAsSingle(columnIndex), rightRow->ValueAsSingle(columnIndex));
-                        break;
-                    case DataType::Double:
-                        result = CompareValues(leftRow->ValueAsDouble(columnIndex), rightRow->ValueAsDouble(columnIndex));
-                        break;
-                    case DataType::Decimal:
-                        result = CompareValues(leftRow->ValueAsDecimal(columnIndex), rightRow->ValueAsDecimal(columnIndex));
-                        break;
-                    case DataType::Guid:
-                        result = CompareValues(leftRow->ValueAsGuid(columnIndex), rightRow->ValueAsGuid(columnIndex));
-                        break;
-                    case DataType::Int8:
-                        result = CompareValues(leftRow->ValueAsInt8(columnIndex), rightRow->ValueAsInt8(columnIndex));
-                        break;
-                    case DataType::Int16:
-                        result = CompareValues(leftRow->ValueAsInt16(columnIndex), rightRow->ValueAsInt16(columnIndex));
-                        break;
-                    case DataType::Int32:
-                        result = CompareValues(leftRow->ValueAsInt32(columnIndex), rightRow->ValueAsInt32(columnIndex));
-                        break;
-                    case DataType::Int64:
-                        result = CompareValues(leftRow->ValueAsInt64(columnIndex), rightRow->ValueAsInt64(columnIndex));
-                        break;
-                    case DataType::UInt8:
-                        result = CompareValues(leftRow->ValueAsUInt8(columnIndex), rightRow->ValueAsUInt8(columnIndex));
-                        break;
-                    case DataType::UInt16:
-                        result = CompareValues(leftRow->ValueAsUInt16(columnIndex), rightRow->ValueAsUInt16(columnIndex));
-                        break;
-                    case DataType::UInt32:
-                        result = CompareValues(leftRow->ValueAsUInt32(columnIndex), rightRow->ValueAsUInt32(columnIndex));
-                        break;
-                    case DataType::UInt64:
-                        result = CompareValues(leftRow->ValueAsUInt64(columnIndex), rightRow->ValueAsUInt64(columnIndex));
-                        break;
-                    default:
-                        throw FilterExpressionParserException("Unexpected column data type encountered");
+                    const DataRowPtr& row = useCandidateRows ? candidateRows[i] : table->Row(i);
+                    rowMatches[i] = row != nullptr && IsMatch(partitionTree, row);
                 }
+            }
+            catch (...)
+            {
+                partitionErrors[partition] = std::current_exception();
+            }
+        });
 
-                if (result < 0)
-                    return true;
+        // Error of first partition in scan order is the error evaluation on a single thread reports
+        for (const std::exception_ptr& partitionError : partitionErrors)
+        {
+            if (partitionError != nullptr)
+                std::rethrow_exception(partitionError);
+        }
 
-                if (result > 0)
-                    return false;
+        vector<DataRowPtr> matchedCandidateRows;
 
-                // Last compare result was equal, continue sort based on next order-by term
-            }
+        for (int32_t i = 0; i < scanCount; i++)
+        {
+            if (rowMatches[i])
+                matchedCandidateRows.push_back(useCandidateRows ? candidateRows[i] : table->Row(i));
+        }
 
-            return false;
-        });
+        candidateRows = std::move(matchedCandidateRows);
+        useCandidateRows = true;
+        rowsMatched = true;
+    }
+
+    const int32_t rowCount = useCandidateRows ? ConvertInt32(candidateRows.size()) : table->RowCount();
+
+    if (orderByTerms.empty())
+    {
+        for (int32_t i = 0; i < rowCount; i++)
+        {
+            if (topLimit > -1 && ConvertInt32(matchedRows.size()) >= topLimit)
+                break;
+
+            const DataRowPtr& row = useCandidateRows ? candidateRows[i] : table->Row(i);
+
+            if (row != nullptr && (rowsMatched || IsMatch(expressionTree, row)))
+                matchedRows.push_back(row);
+        }
+
+        return matchedRows;
     }
 
+    // Rows with equal order-by values keep their scan order
+    const auto sortsBefore = [&orderByTerms](const MatchedRow& leftMatchedRow, const MatchedRow& rightMatchedRow)
+    {
+        for (const auto& orderByTerm : orderByTerms)
+        {
+            const int32_t result = CompareOrderByTerm(orderByTerm, leftMatchedRow.first, rightMatchedRow.first);
+
+            if (result != 0)
+                return result < 0;
+        }
+
+        return leftMatchedRow.second < rightMatchedRow.second;
+    };
+
+    vector<MatchedRow> matches;
+
+    for (int32_t i = 0; i < rowCount; i++)
+    {
+        const DataRowPtr& row = useCandidateRows ? candidateRows[i] : table->Row(i);
+
+        if (row == nullptr)
+            continue;
+
+        if (hasOrderedRows)
+        {
+            // Once TOP limit is reached, scan continues only while rows tie with last match on first order-by term
+            if (topLimit > -1 && ConvertInt32(matches.size()) >= topLimit && CompareOrderByTerm(orderByTerms[0], matches.back().first, row) != 0)
+                break;
+
+            if (rowsMatched || IsMatch(expressionTree, row))
+                matches.emplace_back(row, i);
+
+            continue;
+        }
+
+        if (!rowsMatched && !IsMatch(expressionTree, row))
+            continue;
+
+        if (topLimit < 0)
+        {
+            matches.emplace_back(row, i);
+        }
+        else if (ConvertInt32(matches.size()) < topLimit)
+        {
+            matches.emplace_back(row, i);
+            push_heap(matches.begin(), matches.end(), sortsBefore);
+        }
+        else if (sortsBefore(MatchedRow(row, i), matches.front()))
+        {
+            // Heap front is the last of the rows within TOP limit, replace it with row that sorts before it
+            pop_heap(matches.begin(), matches.end(), sortsBefore);
+            matches.back() = MatchedRow(row, i);
+            push_heap(matches.begin(), matches.end(), sortsBefore);
+        }
+    }
+
+    // Ordered rows only need sorting when ties on first order-by term are ordered by other terms
+    if (!hasOrderedRows && topLimit > -1)
+        sort_heap(matches.begin(), matches.end(), sortsBefore);
+    else if (!hasOrderedRows || orderByTerms.size() > 1)
+        sort(matches.begin(), matches.end(), sortsBefore);
+
+    if (topLimit > -1 && ConvertInt32(matches.size()) > topLimit)
+        matches.erase(matches.begin() + topLimit, matches.end());
+
+    matchedRows.reserve(matches.size());
+
+    for (MatchedRow& match : matches)
+        matchedRows.push_back(std::move(match.first));
+
     return matchedRows;
 }
 
@@ -25,10 +25,11 @@
 #define __FILTER_EXPRESSION_PARSER_H
 
 #include "FilterExpressions.h"
-#include "FilterExpressionSyntaxLexer.h"
-#include "../../Common/CommonTypes.h"
-#include "../../Data/DataSet.h"
+#include "../Common/CommonTypes.h"
+#include "../Data/DataSet.h"
 #include "ExpressionTree.h"
+#include "FilterExpressionCache.h"
+#include <unordered_set>
 
 #ifdef _DEBUG
 #define SUPPRESS_CONSOLE_ERROR_OUTPUT false
@@ -65,26 +66,17 @@ namespace FilterExpressions
     typedef std::function<void(FilterExpressionParserPtr, const std::string&)> ParsingExceptionCallback;
 
     class FilterExpressionParser : // NOLINT
-        public FilterExpressionSyntaxBaseListener,
         public GSF::EnableSharedThisPtr<FilterExpressionParser>
     {
     private:
-        class CallbackErrorListener : public antlr4::BaseErrorListener
-        {
-        private:
-            const FilterExpressionParserPtr m_filterExpressionParser;
-            const ParsingExceptionCallback m_parsingExceptionCallback;
-
-        public:
-            CallbackErrorListener(FilterExpressionParserPtr filterExpressionParser, ParsingExceptionCallback parsingExceptionCallback);
-            void syntaxError(antlr4::Recognizer* recognizer, antlr4::Token* offendingSymbol, size_t line, size_t charPositionInLine, const std::string& msg, std::exception_ptr e) override;
-        };
-
-        antlr4::ANTLRInputStream m_inputStream;
-        FilterExpressionSyntaxLexer* m_lexer;
-        antlr4::CommonTokenStream* m_tokens;
-        FilterExpressionSyntaxParser* m_parser;
-        CallbackErrorListener* m_callbackErrorListener;
+        // Filter expression syntax is parsed by FilterExpressionReader, or by FilterExpressionSyntaxWalker when
+        // library is built with USE_ANTLR_FILTER_PARSER, both build expression trees with functions below
+        friend class FilterExpressionReader;
+        friend class FilterExpressionSyntaxWalker;
+
+        const std::string m_filterExpression;
+        const bool m_suppressConsoleErrorOutput;
+        ParsingExceptionCallback m_parsingExceptionCallback;
         GSF::Data::DataSetPtr m_dataSet;
         std::string m_primaryTableName;
         GSF::StringMap<TableIDFieldsPtr> m_tableIDFields;
@@ -99,19 +91,38 @@ namespace FilterExpressions
 
         int32_t m_filterExpressionStatementCount;
 
+        // Primary table rows by column value for direct signal ID, measurement key and point tag lists,
+        // used for columns without a table index
+        GSF::StringMap<GSF::StringMap<GSF::Data::DataRowPtr>> m_fieldRowLookups;
+        std::unordered_map<GSF::Guid, GSF::Data::DataRowPtr> m_signalIDRowLookup;
+
         ExpressionTreePtr m_activeExpressionTree;
         std::vector<ExpressionTreePtr> m_expressionTrees;
-        std::map<const antlr4::ParserRuleContext*, ExpressionPtr> m_expressions;
+
+        // Statements of parsed filter expression, added to FilterExpressionCache when parsed without error
+        std::vector<ParsedFilterStatement> m_parsedStatements;
+        bool m_syntaxErrorReported;
+        int32_t m_maxThreads;
+
+        // Declared in all builds so class layout does not depend on USE_ANTLR_FILTER_PARSER
+        bool m_useAntlrParser;
 
         void VisitParseTreeNodes();
+        void ApplyParsedStatements(const ParsedFilterStatements& statements);
         void InitializeSetOperations();
         inline void AddMatchedRow(const GSF::Data::DataRowPtr& row, int32_t signalIDColumnIndex);
         inline void MapMatchedFieldRow(const GSF::Data::DataTablePtr& primaryTable, const std::string& columnName, const std::string& matchValue, int32_t signalIDColumnIndex);
-        inline bool TryGetExpr(const antlr4::ParserRuleContext* context, ExpressionPtr& expression) const;
-        inline void AddExpr(const antlr4::ParserRuleContext* context, const ExpressionPtr& expression);
+
+        void EnterFilterExpressionStatement();
+        void EnterFilterStatement(const std::string& tableName, const std::string& topLimit);
+        void AddOrderByTerm(const std::string& columnName, bool ascending, bool exactMatchModifier);
+        void EnterExpression();
+        void ExitIdentifierStatement(FilterExpressionTokenType identifierType, const std::string& identifier);
+        ValueExpressionPtr ParseLiteralValue(FilterExpressionTokenType literalType, const std::string& literal) const;
+        ExpressionPtr ParseColumnName(const std::string& columnName) const;
+        void ReportSyntaxError(size_t line, size_t column, const std::string& message);
     public:
         FilterExpressionParser(const std::string& filterExpression, bool suppressConsoleErrorOutput = SUPPRESS_CONSOLE_ERROR_OUTPUT);
-        ~FilterExpressionParser();
 
         const GSF::Data::DataSetPtr& GetDataSet() const;
         void SetDataSet(const GSF::Data::DataSetPtr& dataSet);
@@ -128,6 +139,18 @@ namespace FilterExpressions
 
         void Evaluate();
 
+        // Gets or sets maximum number of threads used by Evaluate. When greater than one, multiple statements are
+        // evaluated concurrently, or for a single statement, large table scans are partitioned across threads.
+        // Filtered rows and signal IDs are in the same order as when evaluated on a single thread.
+        int32_t GetMaxThreads() const;
+        void SetMaxThreads(int32_t maxThreads);
+
+        // Gets or sets flag that determines if ANTLR generated parser is used, defaults to true when library is built
+        // with USE_ANTLR_FILTER_PARSER. Hand-written parser remains available so results of both parsers can be
+        // compared, see FilterExpressionParserFuzzTests. Without ANTLR parser, flag is always false.
+        bool GetUseAntlrParser() const;
+        void SetUseAntlrParser(bool useAntlrParser);
+
         bool GetTrackFilteredRows() const;
         void SetTrackFilteredRows(bool trackFilteredRows);
         const std::vector<GSF::Data::DataRowPtr>& FilteredRows() const;
@@ -140,17 +163,6 @@ namespace FilterExpressions
 
         const std::vector<ExpressionTreePtr>& GetExpressionTrees();
 
-        void enterFilterExpressionStatement(FilterExpressionSyntaxParser::FilterExpressionStatementContext*) override;
-        void enterFilterStatement(FilterExpressionSyntaxParser::FilterStatementContext*) override;
-        void exitIdentifierStatement(FilterExpressionSyntaxParser::IdentifierStatementContext*) override;
-        void enterExpression(FilterExpressionSyntaxParser::ExpressionContext*) override;
-        void exitExpression(FilterExpressionSyntaxParser::ExpressionContext*) override;
-        void exitPredicateExpression(FilterExpressionSyntaxParser::PredicateExpressionContext*) override;
-        void exitValueExpression(FilterExpressionSyntaxParser::ValueExpressionContext*) override;
-        void exitLiteralValue(FilterExpressionSyntaxParser::LiteralValueContext*) override;
-        void exitColumnName(FilterExpressionSyntaxParser::ColumnNameContext*) override;
-        void exitFunctionExpression(FilterExpressionSyntaxParser::FunctionExpressionContext*) override;
-
         static std::vector<ExpressionTreePtr> GenerateExpressionTrees(const GSF::Data::DataSetPtr& dataSet, const std::string& primaryTableName, const std::string& filterExpression, bool suppressConsoleErrorOutput = SUPPRESS_CONSOLE_ERROR_OUTPUT);
         static std::vector<ExpressionTreePtr> GenerateExpressionTrees(const GSF::Data::DataTablePtr& dataTable, const std::string& filterExpression, bool suppressConsoleErrorOutput = SUPPRESS_CONSOLE_ERROR_OUTPUT);
         static ExpressionTreePtr GenerateExpressionTree(const GSF::Data::DataTablePtr& dataTable, const std::string& filterExpression, bool suppressConsoleErrorOutput = SUPPRESS_CONSOLE_ERROR_OUTPUT);
@@ -159,7 +171,10 @@ namespace FilterExpressions
     
         static std::vector<GSF::Data::DataRowPtr> Select(const GSF::Data::DataSetPtr& dataSet, const std::string& filterExpression, const std::string& primaryTableName = {}, const TableIDFieldsPtr& tableIDFields = nullptr, bool suppressConsoleErrorOutput = SUPPRESS_CONSOLE_ERROR_OUTPUT);
         static std::vector<GSF::Data::DataRowPtr> Select(const GSF::Data::DataTablePtr& dataTable, const std::string& filterExpression, const TableIDFieldsPtr& tableIDFields = nullptr, bool suppressConsoleErrorOutput = SUPPRESS_CONSOLE_ERROR_OUTPUT);
-        static std::vector<GSF::Data::DataRowPtr> Select(const ExpressionTreePtr& expressionTree);
+        static std::vector<GSF::Data::DataRowPtr> Select(const ExpressionTreePtr& expressionTree, int32_t maxThreads = 1);
+
+        // Minimum number of rows in each partition of a table scan evaluated on multiple threads
+        static constexpr int32_t MinimumPartitionRowCount = 16384;
 
         static const TableIDFieldsPtr DefaultTableIDFields;
     };
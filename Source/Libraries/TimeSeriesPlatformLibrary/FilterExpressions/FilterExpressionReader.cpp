@@ -0,0 +1,672 @@
+//******************************************************************************************************
+//  FilterExpressionReader.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "FilterExpressionReader.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::FilterExpressions;
+
+// Precedence of grammar rule alternatives, higher values bind tighter
+static constexpr int32_t NotPrecedence = 3;
+static constexpr int32_t LogicalPrecedence = 2;
+static constexpr int32_t InPrecedence = 5;
+static constexpr int32_t IsNullPrecedence = 4;
+static constexpr int32_t ComparisonPrecedence = 3;
+static constexpr int32_t LikePrecedence = 2;
+static constexpr int32_t UnaryPrecedence = 4;
+static constexpr int32_t MathPrecedence = 2;
+static constexpr int32_t BitwisePrecedence = 1;
+
+// Function name keywords in ExpressionFunctionType order
+static const char* FunctionNames[] =
+{
+    "ABS", "CEILING", "COALESCE", "CONVERT", "CONTAINS", "DATEADD", "DATEDIFF", "DATEPART", "ENDSWITH", "FLOOR",
+    "IIF", "INDEXOF", "ISDATE", "ISINTEGER", "ISGUID", "ISNULL", "ISNUMERIC", "LASTINDEXOF", "LEN", "LOWER",
+    "MAXOF", "MINOF", "NOW", "NTHINDEXOF", "POWER", "REGEXMATCH", "REGEXVAL", "REPLACE", "REVERSE", "ROUND",
+    "SPLIT", "SQRT", "STARTSWITH", "STRCOUNT", "STRCMP", "SUBSTR", "TRIM", "TRIMLEFT", "TRIMRIGHT", "UPPER",
+    "UTCNOW"
+};
+
+static bool TryGetFunctionType(const FilterExpressionToken& token, ExpressionFunctionType& functionType)
+{
+    for (size_t i = 0; i < sizeof(FunctionNames) / sizeof(FunctionNames[0]); i++)
+    {
+        if (FilterExpressionLexer::IsKeyword(token, FunctionNames[i]))
+        {
+            functionType = static_cast<ExpressionFunctionType>(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool TryGetComparisonOperator(const FilterExpressionToken& token, ExpressionOperatorType& operatorType)
+{
+    if (token.Type != FilterExpressionTokenType::Operator)
+        return false;
+
+    const string& symbol = token.Text;
+
+    if (symbol == "<")
+        operatorType = ExpressionOperatorType::LessThan;
+    else if (symbol == "<=")
+        operatorType = ExpressionOperatorType::LessThanOrEqual;
+    else if (symbol == ">")
+        operatorType = ExpressionOperatorType::GreaterThan;
+    else if (symbol == ">=")
+        operatorType = ExpressionOperatorType::GreaterThanOrEqual;
+    else if (symbol == "=" || symbol == "==")
+        operatorType = ExpressionOperatorType::Equal;
+    else if (symbol == "===")
+        operatorType = ExpressionOperatorType::EqualExactMatch;
+    else if (symbol == "<>" || symbol == "!=")
+        operatorType = ExpressionOperatorType::NotEqual;
+    else if (symbol == "!==")
+        operatorType = ExpressionOperatorType::NotEqualExactMatch;
+    else
+        return false;
+
+    return true;
+}
+
+static bool TryGetMathOperator(const FilterExpressionToken& token, ExpressionOperatorType& operatorType)
+{
+    if (token.Type != FilterExpressionTokenType::Operator)
+        return false;
+
+    const string& symbol = token.Text;
+
+    if (symbol == "*")
+        operatorType = ExpressionOperatorType::Multiply;
+    else if (symbol == "/")
+        operatorType = ExpressionOperatorType::Divide;
+    else if (symbol == "%")
+        operatorType = ExpressionOperatorType::Modulus;
+    else if (symbol == "+")
+        operatorType = ExpressionOperatorType::Add;
+    else if (symbol == "-")
+        operatorType = ExpressionOperatorType::Subtract;
+    else
+        return false;
+
+    return true;
+}
+
+static bool TryGetBitwiseOperator(const FilterExpressionToken& token, ExpressionOperatorType& operatorType)
+{
+    const string& symbol = token.Text;
+
+    if (FilterExpressionLexer::IsKeyword(token, "XOR"))
+        operatorType = ExpressionOperatorType::BitwiseXor;
+    else if (token.Type != FilterExpressionTokenType::Operator)
+        return false;
+    else if (symbol == "<<")
+        operatorType = ExpressionOperatorType::BitShiftLeft;
+    else if (symbol == ">>")
+        operatorType = ExpressionOperatorType::BitShiftRight;
+    else if (symbol == "&")
+        operatorType = ExpressionOperatorType::BitwiseAnd;
+    else if (symbol == "|")
+        operatorType = ExpressionOperatorType::BitwiseOr;
+    else if (symbol == "^")
+        operatorType = ExpressionOperatorType::BitwiseXor;
+    else
+        return false;
+
+    return true;
+}
+
+FilterExpressionReader::FilterExpressionReader(FilterExpressionParser& filterExpressionParser, vector<FilterExpressionToken> tokens) :
+    m_filterExpressionParser(filterExpressionParser),
+    m_tokens(std::move(tokens)),
+    m_index(0)
+{
+}
+
+const FilterExpressionToken& FilterExpressionReader::Current() const
+{
+    return m_tokens[m_index];
+}
+
+const FilterExpressionToken& FilterExpressionReader::Consume()
+{
+    const FilterExpressionToken& token = m_tokens[m_index];
+
+    // Last token is always end of input
+    if (m_index < m_tokens.size() - 1)
+        m_index++;
+
+    return token;
+}
+
+bool FilterExpressionReader::IsKeyword(const char* keyword, const size_t offset) const
+{
+    return FilterExpressionLexer::IsKeyword(m_tokens[min(m_index + offset, m_tokens.size() - 1)], keyword);
+}
+
+bool FilterExpressionReader::IsOperator(const char* symbol, const size_t offset) const
+{
+    return FilterExpressionLexer::IsOperator(m_tokens[min(m_index + offset, m_tokens.size() - 1)], symbol);
+}
+
+bool FilterExpressionReader::IsNotOperator(const size_t offset) const
+{
+    return IsKeyword("NOT", offset) || IsOperator("!", offset);
+}
+
+bool FilterExpressionReader::IsExactMatchModifier() const
+{
+    return IsKeyword("BINARY") || IsOperator("===");
+}
+
+bool FilterExpressionReader::IsStatementEnd(const size_t offset) const
+{
+    const size_t index = min(m_index + offset, m_tokens.size() - 1);
+    return m_tokens[index].Type == FilterExpressionTokenType::EndOfInput || IsOperator(";", offset);
+}
+
+void FilterExpressionReader::Expect(const bool matched, const string& expected)
+{
+    if (!matched)
+        ReportSyntaxError("mismatched input '" + Current().Text + "' expecting " + expected);
+}
+
+void FilterExpressionReader::ReportSyntaxError(const string& message, const bool recoverable) const
+{
+    const string& filterExpression = m_filterExpressionParser.m_filterExpression;
+    const size_t position = Current().Position;
+    const size_t lineStart = position == 0 ? string::npos : filterExpression.rfind('\n', position - 1);
+    const size_t line = count(filterExpression.begin(), filterExpression.begin() + position, '\n') + 1;
+    const size_t column = lineStart == string::npos ? position : position - lineStart - 1;
+
+    m_filterExpressionParser.ReportSyntaxError(line, column, message);
+
+    if (!recoverable)
+        throw FilterExpressionParserException("Failed to parse filter expression at line " + ToString(line) + ":" + ToString(column) + ", " + message);
+}
+
+void FilterExpressionReader::Parse()
+{
+    // Matches "error" rule of grammar, filter expression cannot start with an unexpected character
+    if (Current().Type == FilterExpressionTokenType::UnexpectedChar)
+        throw FilterExpressionParserException("Unexpected character: " + Current().Text);
+
+    while (IsOperator(";"))
+        Consume();
+
+    // Filter expression without any statements produces no expression trees, error is reported
+    // but, consistent with prior parser error recovery, evaluation does not fail
+    if (Current().Type == FilterExpressionTokenType::EndOfInput)
+    {
+        ReportSyntaxError("mismatched input '<EOF>' expecting filter expression statement", true);
+        return;
+    }
+
+    while (true)
+    {
+        ParseFilterExpressionStatement();
+
+        if (!IsOperator(";"))
+            break;
+
+        while (IsOperator(";"))
+            Consume();
+
+        if (Current().Type == FilterExpressionTokenType::EndOfInput)
+            break;
+    }
+
+    if (Current().Type != FilterExpressionTokenType::EndOfInput)
+        ReportSyntaxError("extraneous input '" + Current().Text + "' expecting {<EOF>, ';'}");
+}
+
+/*
+    filterExpressionStatement
+     : identifierStatement
+     | filterStatement
+     | expression
+     ;
+
+    identifierStatement
+     : GUID_LITERAL
+     | MEASUREMENT_KEY_LITERAL
+     | POINT_TAG_LITERAL
+     ;
+ */
+void FilterExpressionReader::ParseFilterExpressionStatement()
+{
+    m_filterExpressionParser.EnterFilterExpressionStatement();
+
+    if (IsKeyword("FILTER"))
+    {
+        ParseFilterStatement();
+        return;
+    }
+
+    const FilterExpressionTokenType tokenType = Current().Type;
+
+    // A Guid is only an identifier statement when it is the whole statement, otherwise it starts an expression
+    if (tokenType == FilterExpressionTokenType::MeasurementKeyLiteral || tokenType == FilterExpressionTokenType::PointTagLiteral ||
+        (tokenType == FilterExpressionTokenType::GuidLiteral && IsStatementEnd(1)))
+    {
+        const FilterExpressionToken& identifier = Consume();
+        m_filterExpressionParser.ExitIdentifierStatement(identifier.Type, identifier.Text);
+        return;
+    }
+
+    m_filterExpressionParser.EnterExpression();
+    m_filterExpressionParser.m_activeExpressionTree->Root = ParseExpression(0);
+}
+
+/*
+    filterStatement
+     : K_FILTER ( K_TOP topLimit )? tableName K_WHERE expression ( K_ORDER K_BY orderingTerm ( ',' orderingTerm )* )?
+     ;
+
+    topLimit
+     : ( '-' | '+' )? INTEGER_LITERAL
+     ;
+
+    orderingTerm
+     : exactMatchModifier? orderByColumnName ( K_ASC | K_DESC )?
+     ;
+ */
+void FilterExpressionReader::ParseFilterStatement()
+{
+    string topLimit;
+
+    Consume();
+
+    if (IsKeyword("TOP"))
+    {
+        Consume();
+
+        if (IsOperator("-") || IsOperator("+"))
+            topLimit = Consume().Text;
+
+        Expect(Current().Type == FilterExpressionTokenType::IntegerLiteral, "INTEGER_LITERAL");
+        topLimit += Consume().Text;
+    }
+
+    Expect(Current().Type == FilterExpressionTokenType::Identifier, "IDENTIFIER");
+    m_filterExpressionParser.EnterFilterStatement(Consume().Text, topLimit);
+
+    Expect(IsKeyword("WHERE"), "WHERE");
+    Consume();
+
+    // Ordering terms are applied before the where expression is parsed so that order by
+    // field errors are reported ahead of any column errors found in the expression
+    const size_t whereIndex = m_index;
+    const size_t orderByIndex = FindOrderByClause();
+
+    if (orderByIndex == string::npos)
+    {
+        m_filterExpressionParser.m_activeExpressionTree->Root = ParseExpression(0);
+        return;
+    }
+
+    m_index = orderByIndex;
+    ParseOrderByClause();
+
+    const size_t statementEndIndex = m_index;
+    m_index = whereIndex;
+
+    m_filterExpressionParser.m_activeExpressionTree->Root = ParseExpression(0);
+
+    if (m_index != orderByIndex)
+        ReportSyntaxError("extraneous input '" + Current().Text + "' expecting ORDER");
+
+    m_index = statementEndIndex;
+}
+
+size_t FilterExpressionReader::FindOrderByClause() const
+{
+    int32_t depth = 0;
+
+    for (size_t offset = 0; !IsStatementEnd(offset); offset++)
+    {
+        if (IsOperator("(", offset))
+            depth++;
+        else if (IsOperator(")", offset))
+            depth--;
+        else if (depth == 0 && IsKeyword("ORDER", offset))
+            return m_index + offset;
+    }
+
+    return string::npos;
+}
+
+void FilterExpressionReader::ParseOrderByClause()
+{
+    Consume();
+    Expect(IsKeyword("BY"), "BY");
+
+    do
+    {
+        Consume();
+
+        const bool exactMatchModifier = IsExactMatchModifier();
+        bool ascending = true;
+
+        if (exactMatchModifier)
+            Consume();
+
+        Expect(Current().Type == FilterExpressionTokenType::Identifier, "IDENTIFIER");
+        const string& orderByColumnName = Consume().Text;
+
+        if (IsKeyword("ASC"))
+        {
+            Consume();
+        }
+        else if (IsKeyword("DESC"))
+        {
+            Consume();
+            ascending = false;
+        }
+
+        m_filterExpressionParser.AddOrderByTerm(orderByColumnName, ascending, exactMatchModifier);
+    }
+    while (IsOperator(","));
+}
+
+/*
+    expression
+     : notOperator expression
+     | expression logicalOperator expression
+     | predicateExpression
+     ;
+ */
+ExpressionPtr FilterExpressionReader::ParseExpression(const int32_t precedence)
+{
+    ExpressionPtr expression;
+
+    // Not operator of expression alternative takes precedence over unary not operator of a value expression,
+    // so it applies to the following predicate expression as a whole
+    if (IsNotOperator())
+    {
+        Consume();
+        expression = NewSharedPtr<UnaryExpression>(ExpressionUnaryType::Not, ParseExpression(NotPrecedence));
+    }
+    else
+    {
+        expression = ParsePredicateExpression(0);
+    }
+
+    // AND and OR operators have the same precedence and are evaluated from left to right
+    while (precedence <= LogicalPrecedence)
+    {
+        ExpressionOperatorType operatorType;
+
+        if (IsKeyword("AND") || IsOperator("&&"))
+            operatorType = ExpressionOperatorType::And;
+        else if (IsKeyword("OR") || IsOperator("||"))
+            operatorType = ExpressionOperatorType::Or;
+        else
+            break;
+
+        Consume();
+
+        const ExpressionPtr rightValue = ParseExpression(LogicalPrecedence + 1);
+        expression = NewSharedPtr<OperatorExpression>(operatorType, expression, rightValue);
+    }
+
+    return expression;
+}
+
+/*
+    predicateExpression
+     : predicateExpression notOperator? K_IN exactMatchModifier? '(' expressionList ')'
+     | predicateExpression K_IS notOperator? K_NULL
+     | predicateExpression comparisonOperator predicateExpression
+     | predicateExpression notOperator? K_LIKE exactMatchModifier? predicateExpression
+     | valueExpression
+     ;
+ */
+ExpressionPtr FilterExpressionReader::ParsePredicateExpression(const int32_t precedence)
+{
+    ExpressionPtr expression = ParseValueExpression(0);
+
+    while (true)
+    {
+        const bool hasNotOperator = IsNotOperator() && (IsKeyword("IN", 1) || IsKeyword("LIKE", 1));
+        ExpressionOperatorType operatorType;
+
+        if (precedence <= InPrecedence && IsKeyword("IN", hasNotOperator ? 1 : 0))
+        {
+            if (hasNotOperator)
+                Consume();
+
+            Consume();
+
+            const bool exactMatchModifier = IsExactMatchModifier();
+
+            if (exactMatchModifier)
+                Consume();
+
+            Expect(IsOperator("("), "'('");
+            Consume();
+
+            const ExpressionCollectionPtr arguments = ParseExpressionList();
+
+            Expect(IsOperator(")"), "')'");
+            Consume();
+
+            expression = NewSharedPtr<InListExpression>(expression, arguments, hasNotOperator, exactMatchModifier);
+        }
+        else if (precedence <= IsNullPrecedence && IsKeyword("IS"))
+        {
+            Consume();
+
+            const bool isNotNull = IsNotOperator();
+
+            if (isNotNull)
+                Consume();
+
+            Expect(IsKeyword("NULL"), "NULL");
+            Consume();
+
+            expression = NewSharedPtr<OperatorExpression>(isNotNull ? ExpressionOperatorType::IsNotNull : ExpressionOperatorType::IsNull, expression, nullptr);
+        }
+        else if (precedence <= ComparisonPrecedence && TryGetComparisonOperator(Current(), operatorType))
+        {
+            Consume();
+
+            const ExpressionPtr rightValue = ParsePredicateExpression(ComparisonPrecedence + 1);
+            expression = NewSharedPtr<OperatorExpression>(operatorType, expression, rightValue);
+        }
+        else if (precedence <= LikePrecedence && IsKeyword("LIKE", hasNotOperator ? 1 : 0))
+        {
+            if (hasNotOperator)
+                Consume();
+
+            Consume();
+
+            const bool exactMatchModifier = IsExactMatchModifier();
+
+            if (exactMatchModifier)
+                Consume();
+
+            if (exactMatchModifier)
+                operatorType = hasNotOperator ? ExpressionOperatorType::NotLikeExactMatch : ExpressionOperatorType::LikeExactMatch;
+            else
+                operatorType = hasNotOperator ? ExpressionOperatorType::NotLike : ExpressionOperatorType::Like;
+
+            const ExpressionPtr rightValue = ParsePredicateExpression(LikePrecedence + 1);
+            expression = NewSharedPtr<OperatorExpression>(operatorType, expression, rightValue);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return expression;
+}
+
+/*
+    valueExpression
+     : literalValue
+     | columnName
+     | functionExpression
+     | unaryOperator valueExpression
+     | '(' expression ')'
+     | valueExpression mathOperator valueExpression
+     | valueExpression bitwiseOperator valueExpression
+     ;
+ */
+ExpressionPtr FilterExpressionReader::ParseValueExpression(const int32_t precedence)
+{
+    ExpressionPtr expression;
+    ExpressionFunctionType functionType;
+    ExpressionOperatorType operatorType;
+
+    switch (Current().Type)
+    {
+        case FilterExpressionTokenType::IntegerLiteral:
+        case FilterExpressionTokenType::NumericLiteral:
+        case FilterExpressionTokenType::StringLiteral:
+        case FilterExpressionTokenType::DateTimeLiteral:
+        case FilterExpressionTokenType::GuidLiteral:
+        case FilterExpressionTokenType::BooleanLiteral:
+        {
+            const FilterExpressionToken& literal = Consume();
+            expression = m_filterExpressionParser.ParseLiteralValue(literal.Type, literal.Text);
+            break;
+        }
+        case FilterExpressionTokenType::Identifier:
+            expression = m_filterExpressionParser.ParseColumnName(Consume().Text);
+            break;
+        default:
+            if (IsKeyword("NULL"))
+            {
+                const FilterExpressionToken& literal = Consume();
+                expression = m_filterExpressionParser.ParseLiteralValue(literal.Type, literal.Text);
+            }
+            else if (TryGetFunctionType(Current(), functionType))
+            {
+                expression = ParseFunctionExpression();
+            }
+            else if (IsOperator("-") || IsOperator("+") || IsOperator("~") || IsNotOperator())
+            {
+                ExpressionUnaryType unaryType;
+
+                if (IsOperator("+"))
+                    unaryType = ExpressionUnaryType::Plus;
+                else if (IsOperator("-"))
+                    unaryType = ExpressionUnaryType::Minus;
+                else
+                    unaryType = ExpressionUnaryType::Not;
+
+                Consume();
+                expression = NewSharedPtr<UnaryExpression>(unaryType, ParseValueExpression(UnaryPrecedence));
+            }
+            else if (IsOperator("("))
+            {
+                Consume();
+                expression = ParseExpression(0);
+
+                Expect(IsOperator(")"), "')'");
+                Consume();
+            }
+            else
+            {
+                ReportSyntaxError("no viable alternative at input '" + Current().Text + "'");
+            }
+
+            break;
+    }
+
+    // Math operators bind tighter than bitwise operators, operators of each group have the same
+    // precedence and are evaluated from left to right
+    while (true)
+    {
+        ExpressionPtr rightValue;
+
+        if (precedence <= MathPrecedence && TryGetMathOperator(Current(), operatorType))
+        {
+            Consume();
+            rightValue = ParseValueExpression(MathPrecedence + 1);
+        }
+        else if (precedence <= BitwisePrecedence && TryGetBitwiseOperator(Current(), operatorType))
+        {
+            Consume();
+            rightValue = ParseValueExpression(BitwisePrecedence + 1);
+        }
+        else
+        {
+            break;
+        }
+
+        expression = NewSharedPtr<OperatorExpression>(operatorType, expression, rightValue);
+    }
+
+    return expression;
+}
+
+/*
+    functionExpression
+     : functionName '(' expressionList? ')'
+     ;
+ */
+ExpressionPtr FilterExpressionReader::ParseFunctionExpression()
+{
+    ExpressionFunctionType functionType;
+    ExpressionCollectionPtr arguments;
+
+    TryGetFunctionType(Consume(), functionType);
+
+    Expect(IsOperator("("), "'('");
+    Consume();
+
+    if (IsOperator(")"))
+        arguments = NewSharedPtr<ExpressionCollection>();
+    else
+        arguments = ParseExpressionList();
+
+    Expect(IsOperator(")"), "')'");
+    Consume();
+
+    return NewSharedPtr<FunctionExpression>(functionType, arguments);
+}
+
+/*
+    expressionList
+     : expression ( ',' expression )*
+     ;
+ */
+ExpressionCollectionPtr FilterExpressionReader::ParseExpressionList()
+{
+    ExpressionCollectionPtr expressions = NewSharedPtr<ExpressionCollection>();
+
+    expressions->push_back(ParseExpression(0));
+
+    while (IsOperator(","))
+    {
+        Consume();
+        expressions->push_back(ParseExpression(0));
+    }
+
+    return expressions;
+}
@@ -0,0 +1,70 @@
+//******************************************************************************************************
+//  FilterExpressionReader.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __FILTER_EXPRESSION_READER_H
+#define __FILTER_EXPRESSION_READER_H
+
+#include "FilterExpressionParser.h"
+
+namespace GSF {
+namespace FilterExpressions
+{
+    // Hand-written recursive-descent parser for FilterExpressionSyntax.g4 grammar that builds the expression trees
+    // of a filter expression parser. Operator precedence and associativity match the ANTLR generated parser, i.e.,
+    // each left-recursive grammar rule is parsed by precedence climbing where earlier rule alternatives bind tighter.
+    // Parsing stops with a FilterExpressionParserException at the first syntax error.
+    class FilterExpressionReader
+    {
+    private:
+        FilterExpressionParser& m_filterExpressionParser;
+        std::vector<FilterExpressionToken> m_tokens;
+        size_t m_index;
+
+        const FilterExpressionToken& Current() const;
+        const FilterExpressionToken& Consume();
+        bool IsKeyword(const char* keyword, size_t offset = 0) const;
+        bool IsOperator(const char* symbol, size_t offset = 0) const;
+        bool IsNotOperator(size_t offset = 0) const;
+        bool IsExactMatchModifier() const;
+        bool IsStatementEnd(size_t offset) const;
+        void Expect(bool matched, const std::string& expected);
+        void ReportSyntaxError(const std::string& message, bool recoverable = false) const;
+
+        void ParseFilterExpressionStatement();
+        void ParseFilterStatement();
+        size_t FindOrderByClause() const;
+        void ParseOrderByClause();
+        ExpressionPtr ParseExpression(int32_t precedence);
+        ExpressionPtr ParsePredicateExpression(int32_t precedence);
+        ExpressionPtr ParseValueExpression(int32_t precedence);
+        ExpressionPtr ParseFunctionExpression();
+        ExpressionCollectionPtr ParseExpressionList();
+
+    public:
+        FilterExpressionReader(FilterExpressionParser& filterExpressionParser, std::vector<FilterExpressionToken> tokens);
+
+        void Parse();
+    };
+}}
+
+#endif
@@ -0,0 +1,718 @@
+//******************************************************************************************************
+//  FilterExpressionSyntaxWalker.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+// ANTLR generated parser is only used when enabled, see USE_ANTLR_FILTER_PARSER option in CMakeLists.txt
+#ifdef USE_ANTLR_FILTER_PARSER
+
+#include "FilterExpressionSyntaxWalker.h"
+#include "tree/ParseTreeWalker.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::FilterExpressions;
+using namespace antlr4;
+using namespace antlr4::tree;
+
+FilterExpressionSyntaxWalker::SyntaxErrorListener::SyntaxErrorListener(FilterExpressionParser& filterExpressionParser) :
+    m_filterExpressionParser(filterExpressionParser)
+{        
+}
+
+void FilterExpressionSyntaxWalker::SyntaxErrorListener::syntaxError(Recognizer* recognizer, Token* offendingSymbol, size_t line, size_t charPositionInLine, const string &msg, std::exception_ptr e)
+{
+    // Parser continues with ANTLR error recovery after syntax error is reported
+    m_filterExpressionParser.ReportSyntaxError(line, charPositionInLine, msg);
+}
+
+FilterExpressionSyntaxWalker::FilterExpressionSyntaxWalker(FilterExpressionParser& filterExpressionParser) :
+    m_filterExpressionParser(filterExpressionParser)
+{
+}
+
+bool FilterExpressionSyntaxWalker::TryGetExpr(const ParserRuleContext* context, ExpressionPtr& expression) const
+{
+    return TryGetValue<const ParserRuleContext*, ExpressionPtr>(m_expressions, context, expression, nullptr);
+}
+
+void FilterExpressionSyntaxWalker::AddExpr(const ParserRuleContext* context, const ExpressionPtr& expression)
+{
+    // Track expression in parser rule context map
+    m_expressions.insert(pair<const ParserRuleContext*, ExpressionPtr>(context, expression));
+
+    // Update active expression tree root
+    m_filterExpressionParser.m_activeExpressionTree->Root = expression;
+}
+
+void FilterExpressionSyntaxWalker::Walk()
+{
+    ANTLRInputStream inputStream(m_filterExpressionParser.m_filterExpression);
+    FilterExpressionSyntaxLexer lexer(&inputStream);
+    CommonTokenStream tokens(&lexer);
+    FilterExpressionSyntaxParser parser(&tokens);
+    SyntaxErrorListener syntaxErrorListener(m_filterExpressionParser);
+
+    // Console error listener is replaced, filter expression parser writes errors to console unless suppressed
+    parser.removeErrorListeners();
+    parser.addErrorListener(&syntaxErrorListener);
+
+    // Create parse tree
+    tree::ParseTree* parseTree = parser.parse();
+
+    // After a syntax error, ANTLR error recovery can leave parse tree nodes that listener methods do not
+    // expect, so parsing fails instead, consistent with hand-written FilterExpressionReader
+    if (m_filterExpressionParser.m_syntaxErrorReported)
+    {
+        for (const Token* token : tokens.getTokens())
+        {
+            if (token->getChannel() == Token::DEFAULT_CHANNEL && token->getType() != static_cast<size_t>(EOF) && token->getText() != ";")
+                throw FilterExpressionParserException("Failed to parse filter expression, see reported syntax errors");
+        }
+
+        // Filter expression without any statements is reported but evaluation does not fail
+        return;
+    }
+
+    // Visit listener methods
+    ParseTreeWalker walker;
+    walker.walk(this, parseTree);
+}
+
+/*
+    filterExpressionStatement
+     : identifierStatement
+     | filterStatement
+     | expression
+     ;
+ */
+void FilterExpressionSyntaxWalker::enterFilterExpressionStatement(FilterExpressionSyntaxParser::FilterExpressionStatementContext*)
+{
+    m_expressions.clear();
+    m_filterExpressionParser.EnterFilterExpressionStatement();
+}
+
+/*
+    filterStatement
+     : K_FILTER ( K_TOP topLimit )? tableName K_WHERE expression ( K_ORDER K_BY orderingTerm ( ',' orderingTerm )* )?
+     ;
+
+    topLimit
+     : ( '-' | '+' )? INTEGER_LITERAL
+     ;
+
+    orderingTerm
+     : exactMatchModifier? columnName ( K_ASC | K_DESC )?
+     ;
+ */
+void FilterExpressionSyntaxWalker::enterFilterStatement(FilterExpressionSyntaxParser::FilterStatementContext* context)
+{
+    m_filterExpressionParser.EnterFilterStatement(context->tableName()->getText(), context->K_TOP() == nullptr ? string() : context->topLimit()->getText());
+
+    if (context->K_ORDER() != nullptr && context->K_BY() != nullptr)
+    {
+        for (size_t i = 0; i < context->orderingTerm().size(); i++)
+        {
+            auto orderingTermContext = context->orderingTerm(i);
+
+            m_filterExpressionParser.AddOrderByTerm(
+                orderingTermContext->orderByColumnName()->getText(),
+                orderingTermContext->K_DESC() == nullptr,
+                orderingTermContext->exactMatchModifier() != nullptr
+            );
+        }
+    }
+}
+
+/*
+    identifierStatement
+     : GUID_LITERAL
+     | MEASUREMENT_KEY_LITERAL
+     | POINT_TAG_LITERAL
+     ;
+ */
+void FilterExpressionSyntaxWalker::exitIdentifierStatement(FilterExpressionSyntaxParser::IdentifierStatementContext* context)
+{
+    if (context->GUID_LITERAL())
+        m_filterExpressionParser.ExitIdentifierStatement(FilterExpressionTokenType::GuidLiteral, context->GUID_LITERAL()->getText());
+    else if (context->MEASUREMENT_KEY_LITERAL())
+        m_filterExpressionParser.ExitIdentifierStatement(FilterExpressionTokenType::MeasurementKeyLiteral, context->MEASUREMENT_KEY_LITERAL()->getText());
+    else if (context->POINT_TAG_LITERAL())
+        m_filterExpressionParser.ExitIdentifierStatement(FilterExpressionTokenType::PointTagLiteral, context->POINT_TAG_LITERAL()->getText());
+}
+
+/*
+    expression
+     : notOperator expression
+     | expression logicalOperator expression
+     | predicateExpression
+     ;
+ */
+void FilterExpressionSyntaxWalker::enterExpression(FilterExpressionSyntaxParser::ExpressionContext*)
+{
+    m_filterExpressionParser.EnterExpression();
+}
+
+/*
+    expression
+     : notOperator expression
+     | expression logicalOperator expression
+     | predicateExpression
+     ;
+ */
+void FilterExpressionSyntaxWalker::exitExpression(FilterExpressionSyntaxParser::ExpressionContext* context)
+{
+    ExpressionPtr value;
+
+    // Check for predicate expressions (see explicit visit function)
+    const auto predicateExpressionContext = context->predicateExpression();
+
+    if (predicateExpressionContext != nullptr)
+    {
+        if (TryGetExpr(predicateExpressionContext, value))
+        {
+            AddExpr(context, value);
+            return;
+        }
+
+        throw FilterExpressionParserException("Failed to find predicate expression \"" + predicateExpressionContext->getText() + "\"");
+    }
+
+    // Check for not operator expressions
+    const auto notOperatorContext = context->notOperator();
+
+    if (notOperatorContext != nullptr)
+    {
+        if (context->expression().size() != 1)
+            throw FilterExpressionParserException("Not operator expression is malformed: \"" + context->getText() + "\"");
+
+        if (!TryGetExpr(context->expression(0), value))
+            throw FilterExpressionParserException("Failed to find not operator expression \"" + context->getText() + "\"");
+        
+        AddExpr(context, NewSharedPtr<UnaryExpression>(ExpressionUnaryType::Not, value));
+        return;
+    }
+
+    // Check for logical operator expressions
+    const auto logicalOperatorContext = context->logicalOperator();
+
+    if (logicalOperatorContext != nullptr)
+    {
+        ExpressionPtr leftValue, rightValue;
+        ExpressionOperatorType operatorType;
+
+        if (context->expression().size() != 2)
+            throw FilterExpressionParserException("Operator expression, in logical operator expression context, is malformed: \"" + context->getText() + "\"");
+
+        if (!TryGetExpr(context->expression(0), leftValue))
+            throw FilterExpressionParserException("Failed to find left operator expression \"" + context->expression(0)->getText() + "\"");
+
+        if (!TryGetExpr(context->expression(1), rightValue))
+            throw FilterExpressionParserException("Failed to find right operator expression \"" + context->expression(1)->getText() + "\"");
+
+        const string& operatorSymbol = logicalOperatorContext->getText();
+
+        // Check for boolean operations
+        if (logicalOperatorContext->K_AND() != nullptr || IsEqual(operatorSymbol, "&&", false))
+            operatorType = ExpressionOperatorType::And;
+        else if (logicalOperatorContext->K_OR() != nullptr  || IsEqual(operatorSymbol, "||", false))
+            operatorType = ExpressionOperatorType::Or;
+        else
+            throw FilterExpressionParserException("Unexpected logical operator \"" + operatorSymbol + "\"");
+
+        AddExpr(context, NewSharedPtr<OperatorExpression>(operatorType, leftValue, rightValue));
+        return;
+    }
+
+    throw FilterExpressionParserException("Unexpected expression \"" + context->getText() + "\"");
+}
+
+/*
+    predicateExpression
+     : predicateExpression notOperator? K_IN exactMatchModifier? '(' expressionList ')'
+     | predicateExpression K_IS notOperator? K_NULL
+     | predicateExpression comparisonOperator predicateExpression
+     | predicateExpression notOperator? K_LIKE exactMatchModifier? predicateExpression
+     | valueExpression
+     ;
+ */
+void FilterExpressionSyntaxWalker::exitPredicateExpression(FilterExpressionSyntaxParser::PredicateExpressionContext* context)
+{
+    ExpressionPtr value;
+
+    // Check for value expressions (see explicit visit function)
+    const auto valueExpressionContext = context->valueExpression();
+
+    if (valueExpressionContext != nullptr)
+    {
+        if (TryGetExpr(valueExpressionContext, value))
+        {
+            AddExpr(context, value);
+            return;
+        }
+
+        throw FilterExpressionParserException("Failed to find value expression \"" + valueExpressionContext->getText() + "\"");
+    }
+
+    // Check for IN expressions
+    const auto inKeywordContext = context->K_IN();
+    const auto notOperatorContext = context->notOperator();
+    const auto exactMatchModifierContext = context->exactMatchModifier();
+
+    if (inKeywordContext != nullptr)
+    {
+        // IN expression expects one predicate
+        if (context->predicateExpression().size() != 1)
+            throw FilterExpressionParserException("\"IN\" expression is malformed: \"" + context->getText() + "\"");
+
+        if (!TryGetExpr(context->predicateExpression(0), value))
+            throw FilterExpressionParserException("Failed to find \"IN\" predicate expression \"" + context->predicateExpression(0)->getText() + "\"");
+
+        ExpressionCollectionPtr arguments = NewSharedPtr<ExpressionCollection>();
+        const auto expressionList = context->expressionList();
+        const size_t argumentCount = expressionList->expression().size();
+
+        if (argumentCount < 1)
+            throw FilterExpressionParserException("Not enough expressions found for \"IN\" operation");
+
+        for (size_t i = 0; i < argumentCount; i++)
+        {
+            ExpressionPtr argument;
+
+            if (TryGetExpr(expressionList->expression(i), argument))
+                arguments->push_back(argument);
+            else
+                throw FilterExpressionParserException("Failed to find argument expression " + ToString(i) + " \"" + expressionList->expression(i)->getText() + "\" for \"IN\" operation");
+        }
+
+        AddExpr(context, NewSharedPtr<InListExpression>(value, arguments, notOperatorContext != nullptr, exactMatchModifierContext != nullptr));
+        return;
+    }
+
+    // Check for IS NULL expressions
+    const auto isKeywordContext = context->K_IS();
+    const auto nullKeywordContext = context->K_NULL();
+
+    if (isKeywordContext != nullptr && nullKeywordContext != nullptr)
+    {
+        const ExpressionOperatorType operatorType = notOperatorContext == nullptr ? ExpressionOperatorType::IsNull : ExpressionOperatorType::IsNotNull;
+
+        // IS NULL expression expects one predicate
+        if (context->predicateExpression().size() != 1)
+            throw FilterExpressionParserException("\"IS NULL\" expression is malformed: \"" + context->getText() + "\"");
+
+        if (TryGetExpr(context->predicateExpression(0), value))
+        {
+            AddExpr(context, NewSharedPtr<OperatorExpression>(operatorType, value, nullptr));
+            return;
+        }
+
+        throw FilterExpressionParserException("Failed to find \"IS NULL\" predicate expression \"" + context->predicateExpression(0)->getText() + "\"");
+    }
+
+    // Remaining operators require two predicate expressions
+    if (context->predicateExpression().size() != 2)
+        throw FilterExpressionParserException("Operator expression, in predicate expression context, is malformed: \"" + context->getText() + "\"");
+
+    ExpressionPtr leftValue, rightValue;
+    ExpressionOperatorType operatorType;
+
+    if (!TryGetExpr(context->predicateExpression(0), leftValue))
+        throw FilterExpressionParserException("Failed to find left operator predicate expression \"" + context->predicateExpression(0)->getText() + "\"");
+
+    if (!TryGetExpr(context->predicateExpression(1), rightValue))
+        throw FilterExpressionParserException("Failed to find right operator predicate expression \"" + context->predicateExpression(1)->getText() + "\"");
+
+    // Check for comparison operator expressions
+    const auto comparisonOperatorContext = context->comparisonOperator();
+
+    if (comparisonOperatorContext != nullptr)
+    {
+        const string& operatorSymbol = comparisonOperatorContext->getText();
+
+        // Check for comparison operations
+        if (IsEqual(operatorSymbol, "<", false))
+            operatorType = ExpressionOperatorType::LessThan;
+        else if (IsEqual(operatorSymbol, "<=", false))
+            operatorType = ExpressionOperatorType::LessThanOrEqual;
+        else if (IsEqual(operatorSymbol, ">", false))
+            operatorType = ExpressionOperatorType::GreaterThan;
+        else if (IsEqual(operatorSymbol, ">=", false))
+            operatorType = ExpressionOperatorType::GreaterThanOrEqual;
+        else if (IsEqual(operatorSymbol, "=", false) || IsEqual(operatorSymbol, "==", false))
+            operatorType = ExpressionOperatorType::Equal;
+        else if (IsEqual(operatorSymbol, "===", false))
+            operatorType = ExpressionOperatorType::EqualExactMatch;
+        else if (IsEqual(operatorSymbol, "<>", false) || IsEqual(operatorSymbol, "!=", false))
+            operatorType = ExpressionOperatorType::NotEqual;
+        else if (IsEqual(operatorSymbol, "!==", false))
+            operatorType = ExpressionOperatorType::NotEqualExactMatch;
+        else
+            throw FilterExpressionParserException("Unexpected comparison operator \"" + operatorSymbol + "\"");
+
+        AddExpr(context, NewSharedPtr<OperatorExpression>(operatorType, leftValue, rightValue));
+        return;
+    }
+
+    // Check for LIKE expressions
+    const auto likeKeywordContext = context->K_LIKE();
+
+    if (likeKeywordContext != nullptr)
+    {
+        if (exactMatchModifierContext == nullptr)
+            operatorType = notOperatorContext == nullptr ? ExpressionOperatorType::Like : ExpressionOperatorType::NotLike;
+        else
+            operatorType = notOperatorContext == nullptr ? ExpressionOperatorType::LikeExactMatch : ExpressionOperatorType::NotLikeExactMatch;
+
+        AddExpr(context, NewSharedPtr<OperatorExpression>(operatorType, leftValue, rightValue));
+        return;
+    }
+
+    throw FilterExpressionParserException("Unexpected predicate expression \"" + context->getText() + "\"");
+}
+
+/*
+    valueExpression
+     : literalValue
+     | columnName
+     | functionExpression
+     | unaryOperator valueExpression
+     | '(' expression ')'
+     | valueExpression mathOperator valueExpression
+     | valueExpression bitwiseOperator valueExpression
+; */
+void FilterExpressionSyntaxWalker::exitValueExpression(FilterExpressionSyntaxParser::ValueExpressionContext* context)
+{
+    ExpressionPtr value;
+
+    // Check for literal values (see explicit visit function)
+    const auto literalValueContext = context->literalValue();
+
+    if (literalValueContext != nullptr)
+    {
+        if (TryGetExpr(literalValueContext, value))
+        {
+            AddExpr(context, value);
+            return;
+        }
+
+        throw FilterExpressionParserException("Failed to find literal value \"" + literalValueContext->getText() + "\"");
+    }
+
+    // Check for column names (see explicit visit function)
+    const auto columnNameContext = context->columnName();
+
+    if (columnNameContext != nullptr)
+    {
+        if (TryGetExpr(columnNameContext, value))
+        {
+            AddExpr(context, value);
+            return;
+        }
+
+        throw FilterExpressionParserException("Failed to find column name \"" + columnNameContext->getText() + "\"");
+    }
+
+    // Check for function expressions (see explicit visit function)
+    const auto functionExpressionContext = context->functionExpression();
+
+    if (functionExpressionContext != nullptr)
+    {
+        if (TryGetExpr(functionExpressionContext, value))
+        {
+            AddExpr(context, value);
+            return;
+        }
+
+        throw FilterExpressionParserException("Failed to find function expression \"" + functionExpressionContext->getText() + "\"");
+    }
+
+    // Check for unary operators
+    const auto unaryOperatorContext = context->unaryOperator();
+
+    if (unaryOperatorContext != nullptr)
+    {
+        if (context->valueExpression().size() != 1)
+            throw FilterExpressionParserException("Unary operator value expression is undefined");
+
+        if (TryGetExpr(context->valueExpression(0), value))
+        {
+            ExpressionUnaryType unaryType;
+            const string unaryOperator = unaryOperatorContext->getText();
+
+            if (IsEqual(unaryOperator, "+", false))
+                unaryType = ExpressionUnaryType::Plus;
+            else if (IsEqual(unaryOperator, "-", false))
+                unaryType = ExpressionUnaryType::Minus;
+            else if (IsEqual(unaryOperator, "~", false) || IsEqual(unaryOperator, "!", false) || unaryOperatorContext->K_NOT() != nullptr)
+                unaryType = ExpressionUnaryType::Not;
+            else
+                throw FilterExpressionParserException("Unexpected unary operator type \"" + unaryOperator + "\"");
+
+            AddExpr(context, NewSharedPtr<UnaryExpression>(unaryType, value));
+            return;
+        }
+
+        throw FilterExpressionParserException("Failed to find unary operator value expression \"" + context->getText() + "\"");
+    }
+
+    // Check for sub-expressions, i.e., "(" expression ")"
+    const auto expressionContext = context->expression();
+
+    if (expressionContext != nullptr)
+    {
+        if (TryGetExpr(expressionContext, value))
+        {
+            AddExpr(context, value);
+            return;
+        }
+
+        throw FilterExpressionParserException("Failed to find sub-expression \"" + expressionContext->getText() + "\"");
+    }
+
+    // Remaining operators require two value expressions
+    if (context->valueExpression().size() != 2)
+        throw FilterExpressionParserException("Operator expression, in value expression context, is malformed: \"" + context->getText() + "\"");
+
+    ExpressionPtr leftValue, rightValue;
+    ExpressionOperatorType operatorType;
+
+    if (!TryGetExpr(context->valueExpression(0), leftValue))
+        throw FilterExpressionParserException("Failed to find left operator value expression \"" + context->valueExpression(0)->getText() + "\"");
+
+    if (!TryGetExpr(context->valueExpression(1), rightValue))
+        throw FilterExpressionParserException("Failed to find right operator value expression \"" + context->valueExpression(1)->getText() + "\"");
+
+    // Check for math operator expressions
+    const auto mathOperatorContext = context->mathOperator();
+
+    if (mathOperatorContext != nullptr)
+    {
+        const string& operatorSymbol = mathOperatorContext->getText();
+
+        // Check for arithmetic operations
+        if (IsEqual(operatorSymbol, "*", false))
+            operatorType = ExpressionOperatorType::Multiply;
+        else if (IsEqual(operatorSymbol, "/", false))
+            operatorType = ExpressionOperatorType::Divide;
+        else if (IsEqual(operatorSymbol, "%", false))
+            operatorType = ExpressionOperatorType::Modulus;
+        else if (IsEqual(operatorSymbol, "+", false))
+            operatorType = ExpressionOperatorType::Add;
+        else if (IsEqual(operatorSymbol, "-", false))
+            operatorType = ExpressionOperatorType::Subtract;
+        else
+            throw FilterExpressionParserException("Unexpected math operator \"" + operatorSymbol + "\"");
+
+        AddExpr(context, NewSharedPtr<OperatorExpression>(operatorType, leftValue, rightValue));
+        return;
+    }
+
+    // Check for bitwise operator expressions
+    const auto bitwiseOperatorContext = context->bitwiseOperator();
+
+    if (bitwiseOperatorContext != nullptr)
+    {
+        const string& operatorSymbol = bitwiseOperatorContext->getText();
+
+        // Check for bitwise operations
+        if (IsEqual(operatorSymbol, "<<", false))
+            operatorType = ExpressionOperatorType::BitShiftLeft;
+        else if (IsEqual(operatorSymbol, ">>", false))
+            operatorType = ExpressionOperatorType::BitShiftRight;
+        else if (IsEqual(operatorSymbol, "&", false))
+            operatorType = ExpressionOperatorType::BitwiseAnd;
+        else if (IsEqual(operatorSymbol, "|", false))
+            operatorType = ExpressionOperatorType::BitwiseOr;
+        else if (IsEqual(operatorSymbol, "^", false) || bitwiseOperatorContext->K_XOR() != nullptr)
+            operatorType = ExpressionOperatorType::BitwiseXor;
+        else
+            throw FilterExpressionParserException("Unexpected bitwise operator \"" + operatorSymbol + "\"");
+
+        AddExpr(context, NewSharedPtr<OperatorExpression>(operatorType, leftValue, rightValue));
+        return;
+    }
+
+    throw FilterExpressionParserException("Unexpected value expression \"" + context->getText() + "\"");
+}
+
+/*
+    literalValue
+     : INTEGER_LITERAL
+     | NUMERIC_LITERAL
+     | STRING_LITERAL
+     | DATETIME_LITERAL
+     | GUID_LITERAL
+     | BOOLEAN_LITERAL
+     | K_NULL
+     ;
+ */
+void FilterExpressionSyntaxWalker::exitLiteralValue(FilterExpressionSyntaxParser::LiteralValueContext* context)
+{
+    FilterExpressionTokenType literalType;
+
+    if (context->INTEGER_LITERAL())
+        literalType = FilterExpressionTokenType::IntegerLiteral;
+    else if (context->NUMERIC_LITERAL())
+        literalType = FilterExpressionTokenType::NumericLiteral;
+    else if (context->STRING_LITERAL())
+        literalType = FilterExpressionTokenType::StringLiteral;
+    else if (context->DATETIME_LITERAL())
+        literalType = FilterExpressionTokenType::DateTimeLiteral;
+    else if (context->GUID_LITERAL())
+        literalType = FilterExpressionTokenType::GuidLiteral;
+    else if (context->BOOLEAN_LITERAL())
+        literalType = FilterExpressionTokenType::BooleanLiteral;
+    else if (context->K_NULL())
+        literalType = FilterExpressionTokenType::Keyword;
+    else
+        return;
+
+    AddExpr(context, CastSharedPtr<Expression>(m_filterExpressionParser.ParseLiteralValue(literalType, context->getText())));
+}
+
+/*
+    columnName
+     : IDENTIFIER
+     ;
+ */
+void FilterExpressionSyntaxWalker::exitColumnName(FilterExpressionSyntaxParser::ColumnNameContext* context)
+{
+    AddExpr(context, m_filterExpressionParser.ParseColumnName(context->IDENTIFIER()->getText()));
+}
+
+/*
+    functionExpression
+     : functionName '(' expressionList? ')'
+     ;
+ */
+void FilterExpressionSyntaxWalker::exitFunctionExpression(FilterExpressionSyntaxParser::FunctionExpressionContext* context)
+{
+    ExpressionFunctionType functionType;
+    auto functionNameContext = context->functionName();
+
+    if (functionNameContext->K_ABS() != nullptr)
+        functionType = ExpressionFunctionType::Abs;
+    else if (functionNameContext->K_CEILING() != nullptr)
+        functionType = ExpressionFunctionType::Ceiling;
+    else if (functionNameContext->K_COALESCE() != nullptr)
+        functionType = ExpressionFunctionType::Coalesce;
+    else if (functionNameContext->K_CONVERT() != nullptr)
+        functionType = ExpressionFunctionType::Convert;
+    else if (functionNameContext->K_CONTAINS() != nullptr)
+        functionType = ExpressionFunctionType::Contains;
+    else if (functionNameContext->K_DATEADD() != nullptr)
+        functionType = ExpressionFunctionType::DateAdd;
+    else if (functionNameContext->K_DATEDIFF() != nullptr)
+        functionType = ExpressionFunctionType::DateDiff;
+    else if (functionNameContext->K_DATEPART() != nullptr)
+        functionType = ExpressionFunctionType::DatePart;
+    else if (functionNameContext->K_ENDSWITH() != nullptr)
+        functionType = ExpressionFunctionType::EndsWith;
+    else if (functionNameContext->K_FLOOR() != nullptr)
+        functionType = ExpressionFunctionType::Floor;
+    else if (functionNameContext->K_IIF() != nullptr)
+        functionType = ExpressionFunctionType::IIf;
+    else if (functionNameContext->K_INDEXOF() != nullptr)
+        functionType = ExpressionFunctionType::IndexOf;
+    else if (functionNameContext->K_ISDATE() != nullptr)
+        functionType = ExpressionFunctionType::IsDate;
+    else if (functionNameContext->K_ISINTEGER() != nullptr)
+        functionType = ExpressionFunctionType::IsInteger;
+    else if (functionNameContext->K_ISGUID() != nullptr)
+        functionType = ExpressionFunctionType::IsGuid;
+    else if (functionNameContext->K_ISNULL() != nullptr)
+        functionType = ExpressionFunctionType::IsNull;
+    else if (functionNameContext->K_ISNUMERIC() != nullptr)
+        functionType = ExpressionFunctionType::IsNumeric;
+    else if (functionNameContext->K_LASTINDEXOF() != nullptr)
+        functionType = ExpressionFunctionType::LastIndexOf;
+    else if (functionNameContext->K_LEN() != nullptr)
+        functionType = ExpressionFunctionType::Len;
+    else if (functionNameContext->K_LOWER() != nullptr)
+        functionType = ExpressionFunctionType::Lower;
+    else if (functionNameContext->K_MAXOF() != nullptr)
+        functionType = ExpressionFunctionType::MaxOf;
+    else if (functionNameContext->K_MINOF() != nullptr)
+        functionType = ExpressionFunctionType::MinOf;
+    else if (functionNameContext->K_NOW() != nullptr)
+        functionType = ExpressionFunctionType::Now;
+    else if (functionNameContext->K_NTHINDEXOF() != nullptr)
+        functionType = ExpressionFunctionType::NthIndexOf;
+    else if (functionNameContext->K_POWER() != nullptr)
+        functionType = ExpressionFunctionType::Power;
+    else if (functionNameContext->K_REGEXMATCH() != nullptr)
+        functionType = ExpressionFunctionType::RegExMatch;
+    else if (functionNameContext->K_REGEXVAL() != nullptr)
+        functionType = ExpressionFunctionType::RegExVal;
+    else if (functionNameContext->K_REPLACE() != nullptr)
+        functionType = ExpressionFunctionType::Replace;
+    else if (functionNameContext->K_REVERSE() != nullptr)
+        functionType = ExpressionFunctionType::Reverse;
+    else if (functionNameContext->K_ROUND() != nullptr)
+        functionType = ExpressionFunctionType::Round;
+    else if (functionNameContext->K_SPLIT() != nullptr)
+        functionType = ExpressionFunctionType::Split;
+    else if (functionNameContext->K_SQRT() != nullptr)
+        functionType = ExpressionFunctionType::Sqrt;
+    else if (functionNameContext->K_STARTSWITH() != nullptr)
+        functionType = ExpressionFunctionType::StartsWith;
+    else if (functionNameContext->K_STRCOUNT() != nullptr)
+        functionType = ExpressionFunctionType::StrCount;
+    else if (functionNameContext->K_STRCMP() != nullptr)
+        functionType = ExpressionFunctionType::StrCmp;
+    else if (functionNameContext->K_SUBSTR() != nullptr)
+        functionType = ExpressionFunctionType::SubStr;
+    else if (functionNameContext->K_TRIM() != nullptr)
+        functionType = ExpressionFunctionType::Trim;
+    else if (functionNameContext->K_TRIMLEFT() != nullptr)
+        functionType = ExpressionFunctionType::TrimLeft;
+    else if (functionNameContext->K_TRIMRIGHT() != nullptr)
+        functionType = ExpressionFunctionType::TrimRight;
+    else if (functionNameContext->K_UPPER() != nullptr)
+        functionType = ExpressionFunctionType::Upper;
+    else if (functionNameContext->K_UTCNOW() != nullptr)
+        functionType = ExpressionFunctionType::UtcNow;
+    else
+        throw FilterExpressionParserException("Unexpected function type \"" + functionNameContext->getText() + "\"");
+
+    ExpressionCollectionPtr arguments = NewSharedPtr<ExpressionCollection>();
+    const auto expressionList = context->expressionList();
+
+    if (expressionList != nullptr)
+    {
+        const int32_t argumentCount = expressionList->expression().size();
+
+        for (int32_t i = 0; i < argumentCount; i++)
+        {
+            ExpressionPtr argument;
+
+            if (TryGetExpr(expressionList->expression(i), argument))
+                arguments->push_back(argument);
+            else
+                throw FilterExpressionParserException("Failed to find argument expression " + ToString(i) + " \"" + expressionList->expression(i)->getText() + "\" for function \"" + functionNameContext->getText() + "\"");
+        }
+    }
+
+    AddExpr(context, NewSharedPtr<FunctionExpression>(functionType, arguments));
+}
+
+#endif
@@ -0,0 +1,74 @@
+//******************************************************************************************************
+//  FilterExpressionSyntaxWalker.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __FILTER_EXPRESSION_SYNTAX_WALKER_H
+#define __FILTER_EXPRESSION_SYNTAX_WALKER_H
+
+#include "FilterExpressions.h"
+#include "FilterExpressionSyntaxLexer.h"
+#include "FilterExpressionParser.h"
+
+namespace GSF {
+namespace FilterExpressions
+{
+    // Builds expression trees of a filter expression parser by walking the parse tree of the ANTLR generated
+    // parser, used instead of FilterExpressionReader when library is built with USE_ANTLR_FILTER_PARSER
+    class FilterExpressionSyntaxWalker : public FilterExpressionSyntaxBaseListener // NOLINT
+    {
+    private:
+        // Reports syntax errors through filter expression parser, i.e., to console and parsing exception callback
+        class SyntaxErrorListener : public antlr4::BaseErrorListener
+        {
+        private:
+            FilterExpressionParser& m_filterExpressionParser;
+
+        public:
+            SyntaxErrorListener(FilterExpressionParser& filterExpressionParser);
+            void syntaxError(antlr4::Recognizer* recognizer, antlr4::Token* offendingSymbol, size_t line, size_t charPositionInLine, const std::string& msg, std::exception_ptr e) override;
+        };
+
+        FilterExpressionParser& m_filterExpressionParser;
+        std::map<const antlr4::ParserRuleContext*, ExpressionPtr> m_expressions;
+
+        inline bool TryGetExpr(const antlr4::ParserRuleContext* context, ExpressionPtr& expression) const;
+        inline void AddExpr(const antlr4::ParserRuleContext* context, const ExpressionPtr& expression);
+
+    public:
+        FilterExpressionSyntaxWalker(FilterExpressionParser& filterExpressionParser);
+
+        void Walk();
+
+        void enterFilterExpressionStatement(FilterExpressionSyntaxParser::FilterExpressionStatementContext*) override;
+        void enterFilterStatement(FilterExpressionSyntaxParser::FilterStatementContext*) override;
+        void exitIdentifierStatement(FilterExpressionSyntaxParser::IdentifierStatementContext*) override;
+        void enterExpression(FilterExpressionSyntaxParser::ExpressionContext*) override;
+        void exitExpression(FilterExpressionSyntaxParser::ExpressionContext*) override;
+        void exitPredicateExpression(FilterExpressionSyntaxParser::PredicateExpressionContext*) override;
+        void exitValueExpression(FilterExpressionSyntaxParser::ValueExpressionContext*) override;
+        void exitLiteralValue(FilterExpressionSyntaxParser::LiteralValueContext*) override;
+        void exitColumnName(FilterExpressionSyntaxParser::ColumnNameContext*) override;
+        void exitFunctionExpression(FilterExpressionSyntaxParser::FunctionExpressionContext*) override;
+    };
+}}
+
+#endif
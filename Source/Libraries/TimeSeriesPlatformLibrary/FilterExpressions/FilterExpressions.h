@@ -24,8 +24,9 @@
 #ifndef __FILTER_EXPRESSIONS_H
 #define __FILTER_EXPRESSIONS_H
 
-// When using filter expressions this header file must be included first, before all others, otherwise
-// "antlr4-runtime/ATNSimulator.h" causes an "E0040 expected an identifier" error in Visual Studio here:
+// When using filter expressions with ANTLR generated parser, see USE_ANTLR_FILTER_PARSER option, this header file
+// must be included first, before all others, otherwise "antlr4-runtime/ATNSimulator.h" causes an "E0040 expected an
+// identifier" error in Visual Studio here:
 
 /*
   class ANTLR4CPP_PUBLIC ATNSimulator {
@@ -34,11 +35,13 @@
     static const Ref<dfa::DFAState> ERROR;
  */
 
+#ifdef USE_ANTLR_FILTER_PARSER
 #include "FilterExpressionSyntaxBaseListener.h"
 
 // For some reason this symbol gets undefined? So, we re-define it...
 #ifndef EOF
 #define EOF (-1)
 #endif
+#endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,156 @@
+//******************************************************************************************************
+//  PatternMatcher.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "PatternMatcher.h"
+#include "ExpressionTree.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::FilterExpressions;
+
+static char ToUpperAscii(const char value)
+{
+    return value >= 'a' && value <= 'z' ? static_cast<char>(value - ('a' - 'A')) : value;
+}
+
+static bool IsEqualIgnoreCase(const char* left, const char* right, const size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        if (ToUpperAscii(left[i]) != ToUpperAscii(right[i]))
+            return false;
+    }
+
+    return true;
+}
+
+bool GSF::FilterExpressions::IsEqualIgnoreCase(const string_view left, const string_view right)
+{
+    return left.size() == right.size() && ::IsEqualIgnoreCase(left.data(), right.data(), left.size());
+}
+
+bool GSF::FilterExpressions::StartsWithIgnoreCase(const string_view value, const string_view findValue)
+{
+    return value.size() >= findValue.size() && ::IsEqualIgnoreCase(value.data(), findValue.data(), findValue.size());
+}
+
+bool GSF::FilterExpressions::EndsWithIgnoreCase(const string_view value, const string_view findValue)
+{
+    return value.size() >= findValue.size() && ::IsEqualIgnoreCase(value.data() + value.size() - findValue.size(), findValue.data(), findValue.size());
+}
+
+bool GSF::FilterExpressions::ContainsIgnoreCase(const string_view value, const string_view findValue)
+{
+    if (findValue.empty())
+        return true;
+
+    if (value.size() < findValue.size())
+        return false;
+
+    const char first = ToUpperAscii(findValue[0]);
+    const size_t last = value.size() - findValue.size();
+
+    for (size_t i = 0; i <= last; i++)
+    {
+        if (ToUpperAscii(value[i]) == first && ::IsEqualIgnoreCase(value.data() + i + 1, findValue.data() + 1, findValue.size() - 1))
+            return true;
+    }
+
+    return false;
+}
+
+int32_t GSF::FilterExpressions::CompareIgnoreCase(const string_view left, const string_view right)
+{
+    const size_t length = min(left.size(), right.size());
+
+    // Characters are compared as char values, matching GSF::Compare
+    for (size_t i = 0; i < length; i++)
+    {
+        const char leftValue = ToUpperAscii(left[i]);
+        const char rightValue = ToUpperAscii(right[i]);
+
+        if (leftValue < rightValue)
+            return -1;
+
+        if (leftValue > rightValue)
+            return 1;
+    }
+
+    if (left.size() < right.size())
+        return -1;
+
+    if (left.size() > right.size())
+        return 1;
+
+    return 0;
+}
+
+size_t IgnoreCaseHash::operator()(const string_view value) const
+{
+    size_t seed = 0;
+
+    for (const char character : value)
+        boost::hash_combine(seed, ToUpperAscii(character));
+
+    return seed;
+}
+
+bool IgnoreCaseEqual::operator()(const string_view left, const string_view right) const
+{
+    return IsEqualIgnoreCase(left, right);
+}
+
+LikePattern::LikePattern(const string& pattern)
+{
+    m_testExpression = Replace(pattern, "%", "*", false);
+    m_startsWithWildcard = StartsWith(m_testExpression, "*", false);
+    m_endsWithWildcard = EndsWith(m_testExpression, "*", false);
+
+    if (m_startsWithWildcard)
+        m_testExpression = m_testExpression.substr(1);
+
+    if (m_endsWithWildcard && !m_testExpression.empty())
+        m_testExpression = m_testExpression.substr(0, m_testExpression.size() - 1);
+
+    // Wild cards in the middle of the string are not supported
+    if (Contains(m_testExpression, "*", false))
+        throw ExpressionTreeException("Right operand of \"LIKE\" expression \"" + pattern + "\" has an invalid pattern");
+}
+
+bool LikePattern::IsMatch(const string_view value, const bool ignoreCase) const
+{
+    // "*" or "**" expression means match everything
+    if (m_testExpression.empty())
+        return true;
+
+    if (m_startsWithWildcard && (ignoreCase ? EndsWithIgnoreCase(value, m_testExpression) : value.size() >= m_testExpression.size() && value.substr(value.size() - m_testExpression.size()) == m_testExpression))
+        return true;
+
+    if (m_endsWithWildcard && (ignoreCase ? StartsWithIgnoreCase(value, m_testExpression) : value.substr(0, m_testExpression.size()) == m_testExpression))
+        return true;
+
+    if (m_startsWithWildcard && m_endsWithWildcard)
+        return ignoreCase ? ContainsIgnoreCase(value, m_testExpression) : value.find(m_testExpression) != string_view::npos;
+
+    return false;
+}
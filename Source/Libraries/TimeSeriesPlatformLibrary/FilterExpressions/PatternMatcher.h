@@ -0,0 +1,117 @@
+//******************************************************************************************************
+//  PatternMatcher.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __PATTERN_MATCHER_H
+#define __PATTERN_MATCHER_H
+
+#include "../Common/CommonTypes.h"
+#include <list>
+#include <regex>
+#include <string_view>
+
+namespace GSF {
+namespace FilterExpressions
+{
+    // Case-insensitive string functions that fold ASCII letters while comparing, values are not copied
+    bool IsEqualIgnoreCase(std::string_view left, std::string_view right);
+    bool StartsWithIgnoreCase(std::string_view value, std::string_view findValue);
+    bool EndsWithIgnoreCase(std::string_view value, std::string_view findValue);
+    bool ContainsIgnoreCase(std::string_view value, std::string_view findValue);
+    int32_t CompareIgnoreCase(std::string_view left, std::string_view right);
+
+    // Hash and equality for unordered containers of string values that match with IsEqualIgnoreCase
+    struct IgnoreCaseHash
+    {
+        size_t operator()(std::string_view value) const;
+    };
+
+    struct IgnoreCaseEqual
+    {
+        bool operator()(std::string_view left, std::string_view right) const;
+    };
+
+    // Represents a parsed LIKE operator pattern, "%" or "*" wildcards are only supported at the start and
+    // end of a pattern. Pattern is matched as a prefix, suffix or contained value depending on wildcards.
+    class LikePattern // NOLINT
+    {
+    private:
+        std::string m_testExpression;
+        bool m_startsWithWildcard;
+        bool m_endsWithWildcard;
+
+    public:
+        // Throws ExpressionTreeException for a pattern with wildcards in the middle
+        explicit LikePattern(const std::string& pattern);
+
+        bool IsMatch(std::string_view value, bool ignoreCase) const;
+    };
+
+    typedef GSF::SharedPtr<std::regex> RegexPtr;
+
+    // Least recently used cache of parsed patterns, used for patterns only known at run-time
+    template<class T>
+    class PatternCache // NOLINT
+    {
+    private:
+        typedef std::list<std::pair<std::string, T>> EntryList;
+
+        EntryList m_entries;
+        std::unordered_map<std::string, typename EntryList::iterator> m_entryIndex;
+        const size_t m_capacity;
+
+    public:
+        explicit PatternCache(const size_t capacity = 16) :
+            m_capacity(capacity)
+        {
+        }
+
+        // Gets parsed pattern from cache, pattern is parsed by provided function when not cached
+        template<class ParseFunction>
+        const T& GetOrAdd(const std::string& pattern, ParseFunction parse)
+        {
+            const auto entry = m_entryIndex.find(pattern);
+
+            if (entry != m_entryIndex.end())
+            {
+                m_entries.splice(m_entries.begin(), m_entries, entry->second);
+                return entry->second->second;
+            }
+
+            // Pattern is parsed before cache is changed in case parse fails
+            T value = parse(pattern);
+
+            if (m_entries.size() >= m_capacity)
+            {
+                m_entryIndex.erase(m_entries.back().first);
+                m_entries.pop_back();
+            }
+
+            m_entries.emplace_front(pattern, std::move(value));
+            m_entryIndex.emplace(pattern, m_entries.begin());
+
+            return m_entries.front().second;
+        }
+    };
+}}
+
+#endif
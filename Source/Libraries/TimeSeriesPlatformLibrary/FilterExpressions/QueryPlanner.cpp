@@ -0,0 +1,315 @@
+//******************************************************************************************************
+//  QueryPlanner.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "QueryPlanner.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+using namespace GSF::FilterExpressions;
+
+// Converts integer literal to column key type, false when value is outside of type range
+template<class T>
+static bool TryConvertKey(const int64_t value, T& key)
+{
+    if (value < static_cast<int64_t>(numeric_limits<T>::min()))
+        return false;
+
+    if (sizeof(T) < sizeof(int64_t) && value > static_cast<int64_t>(numeric_limits<T>::max()))
+        return false;
+
+    key = static_cast<T>(value);
+    return true;
+}
+
+QueryPlanner::QueryPlanner(const DataTablePtr& table) :
+    m_table(table)
+{
+}
+
+bool QueryPlanner::TryGetCandidateRows(const ExpressionPtr& expression, vector<DataRowPtr>& rows) const
+{
+    vector<int32_t> positions;
+
+    if (expression == nullptr || !TryGetCandidates(expression, positions))
+        return false;
+
+    rows.reserve(rows.size() + positions.size());
+
+    for (const int32_t position : positions)
+        rows.push_back(m_table->Row(position));
+
+    return true;
+}
+
+bool QueryPlanner::TryGetCandidates(const ExpressionPtr& expression, vector<int32_t>& positions) const
+{
+    if (expression->Type == ExpressionType::InList)
+    {
+        const InListExpressionPtr inListExpression = CastSharedPtr<InListExpression>(expression);
+
+        if (inListExpression->HasNotKeyword)
+            return false;
+
+        const DataColumnPtr column = GetIndexedColumn(inListExpression->Value);
+
+        if (column == nullptr)
+            return false;
+
+        for (const ExpressionPtr& argument : *inListExpression->Arguments)
+        {
+            if (!TryGetEqualCandidates(column, argument, positions))
+                return false;
+        }
+
+        sort(positions.begin(), positions.end());
+        positions.erase(unique(positions.begin(), positions.end()), positions.end());
+        return true;
+    }
+
+    if (expression->Type != ExpressionType::Operator)
+        return false;
+
+    const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
+    const ExpressionPtr& leftValue = operatorExpression->LeftValue;
+    const ExpressionPtr& rightValue = operatorExpression->RightValue;
+
+    switch (operatorExpression->OperatorType)
+    {
+        case ExpressionOperatorType::And:
+        {
+            // Rows that match both operands are within the candidates of either operand
+            vector<int32_t> leftPositions, rightPositions;
+            const bool hasLeftCandidates = TryGetCandidates(leftValue, leftPositions);
+            const bool hasRightCandidates = TryGetCandidates(rightValue, rightPositions);
+
+            if (hasLeftCandidates && hasRightCandidates)
+                set_intersection(leftPositions.begin(), leftPositions.end(), rightPositions.begin(), rightPositions.end(), back_inserter(positions));
+            else if (hasLeftCandidates)
+                positions = std::move(leftPositions);
+            else if (hasRightCandidates)
+                positions = std::move(rightPositions);
+
+            return hasLeftCandidates || hasRightCandidates;
+        }
+        case ExpressionOperatorType::Or:
+        {
+            // Rows that match either operand need candidates from both operands
+            vector<int32_t> leftPositions, rightPositions;
+
+            if (!TryGetCandidates(leftValue, leftPositions) || !TryGetCandidates(rightValue, rightPositions))
+                return false;
+
+            set_union(leftPositions.begin(), leftPositions.end(), rightPositions.begin(), rightPositions.end(), back_inserter(positions));
+            return true;
+        }
+        case ExpressionOperatorType::Equal:
+        case ExpressionOperatorType::EqualExactMatch:
+        {
+            DataColumnPtr column = GetIndexedColumn(leftValue);
+
+            if (column != nullptr)
+                return TryGetEqualCandidates(column, rightValue, positions);
+
+            column = GetIndexedColumn(rightValue);
+
+            return column != nullptr && TryGetEqualCandidates(column, leftValue, positions);
+        }
+        case ExpressionOperatorType::Like:
+        case ExpressionOperatorType::LikeExactMatch:
+        {
+            const DataColumnPtr column = GetIndexedColumn(leftValue);
+            return column != nullptr && TryGetLikeCandidates(column, rightValue, positions);
+        }
+        default:
+            return false;
+    }
+}
+
+bool QueryPlanner::TryGetEqualCandidates(const DataColumnPtr& column, const ExpressionPtr& expression, vector<int32_t>& positions) const
+{
+    if (expression->Type != ExpressionType::Value)
+        return false;
+
+    const ValueExpressionPtr value = CastSharedPtr<ValueExpression>(expression);
+
+    // Null is never equal to a column value
+    if (value->IsNull())
+        return true;
+
+    const DataColumnHandle handle = m_table->ColumnHandle(column->Name());
+    const ExpressionValueType valueType = value->ValueType;
+
+    switch (column->Type())
+    {
+        case DataType::String:
+            if (valueType != ExpressionValueType::String)
+                return false;
+
+            AddPositions<string>(handle, value->ValueAsString(), positions);
+            return true;
+        case DataType::Guid:
+            if (valueType != ExpressionValueType::Guid)
+                return false;
+
+            AddPositions<GSF::Guid>(handle, value->ValueAsGuid(), positions);
+            return true;
+        case DataType::Boolean:
+            if (valueType != ExpressionValueType::Boolean)
+                return false;
+
+            AddPositions<bool>(handle, value->ValueAsBoolean(), positions);
+            return true;
+        default:
+            break;
+    }
+
+    if (valueType != ExpressionValueType::Int32 && valueType != ExpressionValueType::Int64)
+        return false;
+
+    // Integer columns compare as integers, values outside of column type range never match
+    const int64_t integerValue = valueType == ExpressionValueType::Int32 ? value->ValueAsInt32() : value->ValueAsInt64();
+
+    switch (column->Type())
+    {
+        case DataType::Int8:
+        {
+            int8_t key;
+
+            if (TryConvertKey(integerValue, key))
+                AddPositions<int8_t>(handle, key, positions);
+
+            return true;
+        }
+        case DataType::Int16:
+        {
+            int16_t key;
+
+            if (TryConvertKey(integerValue, key))
+                AddPositions<int16_t>(handle, key, positions);
+
+            return true;
+        }
+        case DataType::Int32:
+        {
+            int32_t key;
+
+            if (TryConvertKey(integerValue, key))
+                AddPositions<int32_t>(handle, key, positions);
+
+            return true;
+        }
+        case DataType::Int64:
+            AddPositions<int64_t>(handle, integerValue, positions);
+            return true;
+        case DataType::UInt8:
+        {
+            uint8_t key;
+
+            if (TryConvertKey(integerValue, key))
+                AddPositions<uint8_t>(handle, key, positions);
+
+            return true;
+        }
+        case DataType::UInt16:
+        {
+            uint16_t key;
+
+            if (TryConvertKey(integerValue, key))
+                AddPositions<uint16_t>(handle, key, positions);
+
+            return true;
+        }
+        case DataType::UInt32:
+        {
+            uint32_t key;
+
+            if (TryConvertKey(integerValue, key))
+                AddPositions<uint32_t>(handle, key, positions);
+
+            return true;
+        }
+        case DataType::UInt64:
+        {
+            uint64_t key;
+
+            if (TryConvertKey(integerValue, key))
+                AddPositions<uint64_t>(handle, key, positions);
+
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+bool QueryPlanner::TryGetLikeCandidates(const DataColumnPtr& column, const ExpressionPtr& expression, vector<int32_t>& positions) const
+{
+    if (column->Type() != DataType::String || expression->Type != ExpressionType::Value)
+        return false;
+
+    const ValueExpressionPtr value = CastSharedPtr<ValueExpression>(expression);
+
+    if (value->ValueType != ExpressionValueType::String || value->IsNull())
+        return false;
+
+    const DataColumnHandle handle = m_table->ColumnHandle(column->Name());
+    const DataColumnIndexPtr& index = m_table->Index(handle);
+
+    if (index == nullptr || index->Type() != DataColumnIndexType::Ordered)
+        return false;
+
+    // Only patterns without a leading wildcard match by prefix, invalid patterns are left to evaluation
+    string prefix = Replace(value->ValueAsString(), "%", "*", false);
+
+    if (!prefix.empty() && prefix.back() == '*')
+        prefix.pop_back();
+
+    if (prefix.empty() || prefix.find('*') != string::npos)
+        return false;
+
+    for (const DataRowPtr& row : m_table->FindRowsWithPrefix(handle, prefix))
+        positions.push_back(m_table->RowPosition(row));
+
+    return true;
+}
+
+template<class T>
+void QueryPlanner::AddPositions(const DataColumnHandle& column, const T& value, vector<int32_t>& positions) const
+{
+    for (const DataRowPtr& row : m_table->FindRows<T>(column, value))
+        positions.push_back(m_table->RowPosition(row));
+}
+
+DataColumnPtr QueryPlanner::GetIndexedColumn(const ExpressionPtr& expression) const
+{
+    if (expression->Type != ExpressionType::Column)
+        return nullptr;
+
+    const DataColumnPtr& column = CastSharedPtr<ColumnExpression>(expression)->DataColumn;
+
+    if (column == nullptr || column->Computed() || m_table->Index(m_table->ColumnHandle(column->Name())) == nullptr)
+        return nullptr;
+
+    return column;
+}
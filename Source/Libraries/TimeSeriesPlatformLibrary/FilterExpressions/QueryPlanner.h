@@ -0,0 +1,62 @@
+//******************************************************************************************************
+//  QueryPlanner.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __QUERY_PLANNER_H
+#define __QUERY_PLANNER_H
+
+#include "ExpressionTree.h"
+
+namespace GSF {
+namespace FilterExpressions
+{
+    // Finds rows that can satisfy a filter expression through table column indexes so that only candidate rows
+    // need to be evaluated, rather than all rows of table. Indexable predicates compare a stored column to literal
+    // values, i.e., "col = literal", "col IN (literal, ...)" and "col LIKE 'prefix%'", and can be combined with
+    // AND and OR. Equality and IN predicates need a column index, LIKE predicates need an ordered index. Candidate
+    // rows can include rows that do not match, e.g., lookups are case-insensitive, so expression is still evaluated
+    // for each candidate row.
+    class QueryPlanner
+    {
+    private:
+        const GSF::Data::DataTablePtr& m_table;
+
+        bool TryGetCandidates(const ExpressionPtr& expression, std::vector<int32_t>& positions) const;
+        bool TryGetEqualCandidates(const GSF::Data::DataColumnPtr& column, const ExpressionPtr& expression, std::vector<int32_t>& positions) const;
+        bool TryGetLikeCandidates(const GSF::Data::DataColumnPtr& column, const ExpressionPtr& expression, std::vector<int32_t>& positions) const;
+
+        template<class T>
+        void AddPositions(const GSF::Data::DataColumnHandle& column, const T& value, std::vector<int32_t>& positions) const;
+
+        // Gets stored column for a column expression, null when expression is not an indexable column
+        GSF::Data::DataColumnPtr GetIndexedColumn(const ExpressionPtr& expression) const;
+
+    public:
+        QueryPlanner(const GSF::Data::DataTablePtr& table);
+
+        // Gets candidate rows for expression in row order, returns false when expression has no
+        // indexable predicate so all rows need to be evaluated
+        bool TryGetCandidateRows(const ExpressionPtr& expression, std::vector<GSF::Data::DataRowPtr>& rows) const;
+    };
+}}
+
+#endif
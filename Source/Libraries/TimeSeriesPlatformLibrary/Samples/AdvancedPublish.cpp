@@ -44,7 +44,7 @@ unordered_map<GSF::Guid, TemporalSubscriberPtr> TemporalSubscriptions;
 Mutex TemporalSubscriptionsLock;
 const TemporalSubscriberPtr NullTemporalSubscription = nullptr;
 
-bool RunPublisher(uint16_t port, bool genHistory);
+bool RunPublisher(uint16_t port, bool genHistory, bool useArchive, bool useRingBuffer);
 
 void DisplayClientConnected(DataPublisher* source, const SubscriberConnectionPtr& connection);
 void DisplayClientDisconnected(DataPublisher* source, const SubscriberConnectionPtr& connection);
@@ -161,16 +161,18 @@ int main(int argc, char* argv[])
     if (argc < 2)
     {
         cout << "Usage:" << endl;
-        cout << "    AdvancedPublish PORT" << endl;
+        cout << "    AdvancedPublish PORT [GenHistory|Archive|RingBuffer]" << endl;
         return 0;
     }
 
     // Get hostname and port.
     stringstream(argv[1]) >> port;
     const bool genHistory = argc > 2 && IsEqual(argv[2], "GenHistory");
+    const bool useArchive = argc > 2 && IsEqual(argv[2], "Archive");
+    const bool useRingBuffer = argc > 2 && IsEqual(argv[2], "RingBuffer");
 
     // Run the publisher.
-    if (RunPublisher(port, genHistory))
+    if (RunPublisher(port, genHistory, useArchive, useRingBuffer))
     {
         // Wait until the user presses enter before quitting.
         string line;
@@ -188,7 +190,7 @@ int main(int argc, char* argv[])
     return 0;
 }
 
-bool RunPublisher(uint16_t port, bool genHistory)
+bool RunPublisher(uint16_t port, bool genHistory, bool useArchive, bool useRingBuffer)
 {
     static float64_t randMax = float64_t(RAND_MAX);
     string errorMessage;
@@ -221,12 +223,31 @@ bool RunPublisher(uint16_t port, bool genHistory)
         Publisher->RegisterClientDisconnectedCallback(&DisplayClientDisconnected);
         Publisher->RegisterStatusMessageCallback(&DisplayStatusMessage);
         Publisher->RegisterErrorMessageCallback(&DisplayErrorMessage);
-        Publisher->RegisterProcessingIntervalChangeRequestedCallback(&HandleProcessingIntervalChangeRequested);
-        Publisher->RegisterTemporalSubscriptionRequestedCallback(&HandleTemporalSubscriptionRequested);
-        Publisher->RegisterTemporalSubscriptionCanceledCallback(&HandleTemporalSubscriptionCanceled);
 
-        // Enable temporal subscription support - this allows historical data requests as well as real-time
-        Publisher->SetSupportsTemporalSubscriptions(true);
+        if (useArchive)
+        {
+            // Archive all published data - publisher will automatically replay archived
+            // data for temporal subscriptions, so no temporal callbacks are needed
+            Publisher->SetMeasurementArchive(NewSharedPtr<MeasurementArchive>("Archive"));
+        }
+        else if (useRingBuffer)
+        {
+            // Keep last five minutes of published data in memory - publisher will automatically
+            // replay buffered data for temporal subscriptions, then switch them to live data
+            Publisher->SetMeasurementRingBuffer(NewSharedPtr<MeasurementRingBuffer>());
+        }
+        else
+        {
+            Publisher->RegisterProcessingIntervalChangeRequestedCallback(&HandleProcessingIntervalChangeRequested);
+            Publisher->RegisterTemporalSubscriptionRequestedCallback(&HandleTemporalSubscriptionRequested);
+            Publisher->RegisterTemporalSubscriptionCanceledCallback(&HandleTemporalSubscriptionCanceled);
+
+            // Enable temporal subscription support - this allows historical data requests as well as real-time
+            Publisher->SetSupportsTemporalSubscriptions(true);
+        }
+
+        // Publish publisher statistics every ten seconds, subscribers can filter for these with "SignalType = 'STAT'"
+        Publisher->SetMetricsPublicationInterval(10000);
 
         // Load metadata to be used for publication
         LoadMetadataToPublish(DevicesToPublish, MeasurementsToPublish, PhasorsToPublish);
@@ -0,0 +1,222 @@
+//******************************************************************************************************
+//  CompressionBenchmark.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "../Common/CommonTypes.h"
+#include "../Common/Compression.h"
+#include "../Common/Convert.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+using namespace std;
+using namespace GSF;
+
+struct BenchmarkSettings
+{
+    int32_t DocumentMegabytes = 20;
+    int32_t Iterations = 3;
+};
+
+bool ParseSettings(int argc, char* argv[], BenchmarkSettings& settings);
+vector<uint8_t> GenerateMetadata(int32_t megabytes);
+void LegacyCompress(const vector<uint8_t>& buffer, vector<uint8_t>& output);
+void LegacyDecompress(const vector<uint8_t>& buffer, vector<uint8_t>& output);
+void ReportResult(const string& name, size_t uncompressedSize, size_t compressedSize, float64_t compressSeconds, float64_t decompressSeconds);
+
+template<class TCompress, class TDecompress>
+void RunBenchmark(const string& name, const vector<uint8_t>& document, int32_t iterations, TCompress compress, TDecompress decompress)
+{
+    vector<uint8_t> compressed, decompressed;
+    float64_t compressSeconds = 0.0, decompressSeconds = 0.0;
+
+    for (int32_t i = 0; i < iterations; i++)
+    {
+        compressed.clear();
+        decompressed.clear();
+
+        auto start = chrono::steady_clock::now();
+        compress(document, compressed);
+        auto middle = chrono::steady_clock::now();
+        decompress(compressed, decompressed);
+        auto end = chrono::steady_clock::now();
+
+        compressSeconds += chrono::duration<float64_t>(middle - start).count();
+        decompressSeconds += chrono::duration<float64_t>(end - middle).count();
+
+        if (decompressed != document)
+        {
+            cout << name << ": decompressed document does not match original" << endl;
+            return;
+        }
+    }
+
+    ReportResult(name, document.size(), compressed.size(), compressSeconds / iterations, decompressSeconds / iterations);
+}
+
+// Benchmark application to compare gzip compression of meta-data documents.
+//
+// This application generates a meta-data XML document of the requested size and measures the
+// throughput of compressing and decompressing it with the original per-byte stream copy and with
+// the block based gzip functions at several compression levels and thread counts.
+int main(int argc, char* argv[])
+{
+    BenchmarkSettings settings;
+
+    if (!ParseSettings(argc, argv, settings))
+    {
+        cout << "Usage:" << endl;
+        cout << "    CompressionBenchmark [options]" << endl << endl;
+        cout << "Options:" << endl;
+        cout << "    -size N          Size of generated meta-data document in megabytes, defaults to 20" << endl;
+        cout << "    -iterations N    Number of iterations averaged for each result, defaults to 3" << endl;
+        return 0;
+    }
+
+    const vector<uint8_t> document = GenerateMetadata(settings.DocumentMegabytes);
+    const int32_t hardwareThreads = max(1, static_cast<int32_t>(thread::hardware_concurrency()));
+
+    cout << "Meta-data document: " << document.size() << " bytes, " << settings.Iterations << " iterations" << endl << endl;
+    cout << left << setw(28) << "Method" << right << setw(12) << "Compressed" << setw(8) << "Ratio" << setw(16) << "Compress MB/s" << setw(18) << "Decompress MB/s" << endl;
+
+    RunBenchmark("Per-byte stream copy", document, settings.Iterations, LegacyCompress, LegacyDecompress);
+
+    for (int32_t level : { 1, DefaultCompressionLevel, 9 })
+    {
+        const string levelName = level == DefaultCompressionLevel ? "default" : ToString(level);
+
+        RunBenchmark("Block, level " + levelName, document, settings.Iterations,
+            [level](const vector<uint8_t>& buffer, vector<uint8_t>& output) { GZipCompress(buffer, output, level); },
+            [](const vector<uint8_t>& buffer, vector<uint8_t>& output) { GZipDecompress(buffer, output); });
+    }
+
+    for (int32_t threads = 2; threads <= max(4, hardwareThreads); threads *= 2)
+    {
+        RunBenchmark("Block, default, " + ToString(threads) + " threads", document, settings.Iterations,
+            [threads](const vector<uint8_t>& buffer, vector<uint8_t>& output) { GZipCompress(buffer, output, DefaultCompressionLevel, threads); },
+            [](const vector<uint8_t>& buffer, vector<uint8_t>& output) { GZipDecompress(buffer, output); });
+    }
+
+    return 0;
+}
+
+bool ParseSettings(int argc, char* argv[], BenchmarkSettings& settings)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const string option = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (option == "-size" && hasValue)
+            settings.DocumentMegabytes = max(1, stoi(argv[++i]));
+        else if (option == "-iterations" && hasValue)
+            settings.Iterations = max(1, stoi(argv[++i]));
+        else
+            return false;
+    }
+
+    return true;
+}
+
+// Generates meta-data XML with measurement records similar to those of a production publisher
+vector<uint8_t> GenerateMetadata(int32_t megabytes)
+{
+    const size_t targetSize = static_cast<size_t>(megabytes) * 1024 * 1024;
+    static const char* SignalAcronyms[] = { "FREQ", "DFDT", "VPHM", "VPHA", "IPHM", "IPHA", "ALOG", "DIGI", "STAT" };
+    stringstream stream;
+    int32_t device = 0, index = 0;
+
+    stream << "<?xml version=\"1.0\" standalone=\"yes\"?>\r\n<DataSet>\r\n";
+
+    while (static_cast<size_t>(stream.tellp()) < targetSize)
+    {
+        const string deviceAcronym = "DEVICE" + ToString(device);
+        const char* signalAcronym = SignalAcronyms[index % 9];
+
+        stream << "  <MeasurementDetail>\r\n";
+        stream << "    <DeviceAcronym>" << deviceAcronym << "</DeviceAcronym>\r\n";
+        stream << "    <ID>PPA:" << (device * 100 + index) << "</ID>\r\n";
+        stream << "    <SignalID>" << ToString(NewGuid()) << "</SignalID>\r\n";
+        stream << "    <PointTag>GPA_" << deviceAcronym << ":" << signalAcronym << index << "</PointTag>\r\n";
+        stream << "    <SignalReference>" << deviceAcronym << "-" << signalAcronym << index << "</SignalReference>\r\n";
+        stream << "    <SignalAcronym>" << signalAcronym << "</SignalAcronym>\r\n";
+        stream << "    <Description>" << deviceAcronym << " " << signalAcronym << " measurement " << index << "</Description>\r\n";
+        stream << "    <Internal>true</Internal>\r\n";
+        stream << "    <Enabled>true</Enabled>\r\n";
+        stream << "    <UpdatedOn>2026-10-18T03:01:12.793-05:00</UpdatedOn>\r\n";
+        stream << "  </MeasurementDetail>\r\n";
+
+        if (++index == 100)
+        {
+            index = 0;
+            device++;
+        }
+    }
+
+    stream << "</DataSet>\r\n";
+
+    const string xml = stream.str();
+    return vector<uint8_t>(xml.begin(), xml.end());
+}
+
+// Compression as originally implemented, copying output of stream one byte at a time
+void LegacyCompress(const vector<uint8_t>& buffer, vector<uint8_t>& output)
+{
+    const MemoryStream memoryStream(buffer);
+    StreamBuffer streamBuffer;
+
+    streamBuffer.push(GZipCompressor());
+    streamBuffer.push(memoryStream);
+
+    istreambuf_iterator<char> it{ &streamBuffer };
+    const istreambuf_iterator<char> eos{};
+
+    for (; it != eos; ++it)
+        output.push_back(static_cast<uint8_t>(*it));
+}
+
+void LegacyDecompress(const vector<uint8_t>& buffer, vector<uint8_t>& output)
+{
+    const MemoryStream memoryStream(buffer);
+    StreamBuffer streamBuffer;
+
+    streamBuffer.push(GZipDecompressor());
+    streamBuffer.push(memoryStream);
+
+    istreambuf_iterator<char> it{ &streamBuffer };
+    const istreambuf_iterator<char> eos{};
+
+    for (; it != eos; ++it)
+        output.push_back(static_cast<uint8_t>(*it));
+}
+
+void ReportResult(const string& name, size_t uncompressedSize, size_t compressedSize, float64_t compressSeconds, float64_t decompressSeconds)
+{
+    const float64_t megabytes = uncompressedSize / (1024.0 * 1024.0);
+
+    cout << left << setw(28) << name << right << setw(12) << compressedSize
+        << setw(8) << fixed << setprecision(2) << uncompressedSize / static_cast<float64_t>(compressedSize)
+        << setw(16) << setprecision(1) << megabytes / compressSeconds
+        << setw(18) << megabytes / decompressSeconds << endl;
+}
@@ -0,0 +1,212 @@
+//******************************************************************************************************
+//  FilterExpressionBenchmark.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "../Common/CommonTypes.h"
+#include "../Common/Convert.h"
+#include "../FilterExpressions/FilterExpressionParser.h"
+#include "../FilterExpressions/BatchEvaluator.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+using namespace GSF::FilterExpressions;
+
+struct BenchmarkSettings
+{
+    int32_t RowCount = 500000;
+    int32_t Iterations = 5;
+};
+
+bool ParseSettings(int argc, char* argv[], BenchmarkSettings& settings);
+DataTablePtr GenerateMeasurementDetail(int32_t rowCount);
+void RowEvaluate(const ExpressionTreePtr& expressionTree, vector<int32_t>& positions);
+void BatchEvaluate(const ExpressionTreePtr& expressionTree, vector<int32_t>& positions);
+void ReportResult(const string& predicate, size_t matchCount, float64_t rowSeconds, float64_t batchSeconds);
+
+template<class TEvaluate>
+float64_t TimeEvaluation(const ExpressionTreePtr& expressionTree, int32_t iterations, vector<int32_t>& positions, TEvaluate evaluate)
+{
+    float64_t seconds = 0.0;
+
+    for (int32_t i = 0; i < iterations; i++)
+    {
+        positions.clear();
+
+        auto start = chrono::steady_clock::now();
+        evaluate(expressionTree, positions);
+        auto end = chrono::steady_clock::now();
+
+        seconds += chrono::duration<float64_t>(end - start).count();
+    }
+
+    return seconds / iterations;
+}
+
+// Benchmark application to compare row and batch evaluation of filter expressions.
+//
+// This application generates a measurement meta-data table with the requested number of rows and
+// measures the time to find the rows matching a set of predicates, evaluating the expression one row
+// at a time and evaluating it a column at a time with the batch evaluator.
+int main(int argc, char* argv[])
+{
+    BenchmarkSettings settings;
+
+    if (!ParseSettings(argc, argv, settings))
+    {
+        cout << "Usage:" << endl;
+        cout << "    FilterExpressionBenchmark [options]" << endl << endl;
+        cout << "Options:" << endl;
+        cout << "    -rows N          Number of rows in generated meta-data table, defaults to 500000" << endl;
+        cout << "    -iterations N    Number of iterations averaged for each result, defaults to 5" << endl;
+        return 0;
+    }
+
+    static const char* Predicates[] =
+    {
+        "SignalAcronym = 'FREQ'",
+        "PhasorSourceIndex >= 2 AND PhasorSourceIndex < 4",
+        "SignalAcronym IN ('VPHM', 'VPHA') AND Enabled",
+        "NOT Internal OR PhasorSourceIndex IS NULL",
+        "UpdatedOn > #2026-01-01# AND SignalAcronym <> 'STAT' AND PhasorSourceIndex <> 1",
+        "PointTag LIKE 'GPA_DEVICE1%' AND PhasorSourceIndex = 1"
+    };
+
+    const DataTablePtr measurementDetail = GenerateMeasurementDetail(settings.RowCount);
+
+    cout << "Meta-data table: " << measurementDetail->RowCount() << " rows, " << settings.Iterations << " iterations" << endl << endl;
+    cout << left << setw(80) << "Predicate" << right << setw(10) << "Matches" << setw(12) << "Row ms" << setw(12) << "Batch ms" << setw(10) << "Speedup" << endl;
+
+    for (const char* predicate : Predicates)
+    {
+        const ExpressionTreePtr expressionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, predicate);
+        vector<int32_t> rowPositions, batchPositions;
+
+        const float64_t rowSeconds = TimeEvaluation(expressionTree, settings.Iterations, rowPositions, RowEvaluate);
+        const float64_t batchSeconds = TimeEvaluation(expressionTree, settings.Iterations, batchPositions, BatchEvaluate);
+
+        if (batchPositions != rowPositions)
+        {
+            cout << predicate << ": batch evaluation does not match row evaluation" << endl;
+            continue;
+        }
+
+        ReportResult(predicate, rowPositions.size(), rowSeconds, batchSeconds);
+    }
+
+    return 0;
+}
+
+bool ParseSettings(int argc, char* argv[], BenchmarkSettings& settings)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const string option = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (option == "-rows" && hasValue)
+            settings.RowCount = max(1, stoi(argv[++i]));
+        else if (option == "-iterations" && hasValue)
+            settings.Iterations = max(1, stoi(argv[++i]));
+        else
+            return false;
+    }
+
+    return true;
+}
+
+// Generates measurement records similar to those of a production publisher
+DataTablePtr GenerateMeasurementDetail(int32_t rowCount)
+{
+    static const char* SignalAcronyms[] = { "FREQ", "DFDT", "VPHM", "VPHA", "IPHM", "IPHA", "ALOG", "DIGI", "STAT" };
+    const DataSetPtr dataSet = NewSharedPtr<DataSet>();
+    const DataTablePtr table = dataSet->CreateTable("MeasurementDetail");
+
+    table->AddColumn(table->CreateColumn("DeviceAcronym", DataType::String));
+    table->AddColumn(table->CreateColumn("SignalID", DataType::Guid));
+    table->AddColumn(table->CreateColumn("PointTag", DataType::String));
+    table->AddColumn(table->CreateColumn("SignalAcronym", DataType::String));
+    table->AddColumn(table->CreateColumn("PhasorSourceIndex", DataType::Int32));
+    table->AddColumn(table->CreateColumn("Internal", DataType::Boolean));
+    table->AddColumn(table->CreateColumn("Enabled", DataType::Boolean));
+    table->AddColumn(table->CreateColumn("UpdatedOn", DataType::DateTime));
+    dataSet->AddOrUpdateTable(table);
+
+    const datetime_t updatedOn = ParseTimestamp("2026-10-18 03:01:12");
+
+    for (int32_t i = 0; i < rowCount; i++)
+    {
+        const int32_t device = i / 100, index = i % 100;
+        const string deviceAcronym = "DEVICE" + ToString(device);
+        const char* signalAcronym = SignalAcronyms[index % 9];
+        const DataRowPtr row = table->CreateRow();
+
+        row->SetStringValue(0, deviceAcronym);
+        row->SetGuidValue(1, NewGuid());
+        row->SetStringValue(2, "GPA_" + deviceAcronym + ":" + signalAcronym + ToString(index));
+        row->SetStringValue(3, string(signalAcronym));
+
+        // Only phasor measurements have a source index
+        if (index % 9 >= 2 && index % 9 <= 5)
+            row->SetInt32Value(4, index % 6 + 1);
+
+        row->SetBooleanValue(5, index % 9 != 8);
+        row->SetBooleanValue(6, device % 10 != 0);
+        row->SetDateTimeValue(7, updatedOn);
+        table->AddRow(row);
+    }
+
+    return table;
+}
+
+void RowEvaluate(const ExpressionTreePtr& expressionTree, vector<int32_t>& positions)
+{
+    const DataTablePtr& table = expressionTree->Table();
+    ExpressionValueType resultValueType;
+
+    expressionTree->BeginEvaluation();
+
+    for (int32_t i = 0; i < table->RowCount(); i++)
+    {
+        if (expressionTree->EvaluatePredicate(table->Row(i), resultValueType))
+            positions.push_back(i);
+    }
+}
+
+void BatchEvaluate(const ExpressionTreePtr& expressionTree, vector<int32_t>& positions)
+{
+    expressionTree->BeginEvaluation();
+
+    if (!BatchEvaluator(*expressionTree).TryGetMatchingPositions(positions))
+        RowEvaluate(expressionTree, positions);
+}
+
+void ReportResult(const string& predicate, size_t matchCount, float64_t rowSeconds, float64_t batchSeconds)
+{
+    cout << left << setw(80) << predicate << right << setw(10) << matchCount
+        << setw(12) << fixed << setprecision(1) << rowSeconds * 1000.0
+        << setw(12) << batchSeconds * 1000.0
+        << setw(9) << setprecision(1) << rowSeconds / batchSeconds << "x" << endl;
+}
@@ -0,0 +1,728 @@
+//******************************************************************************************************
+//  FilterExpressionParserFuzzTests.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "../Common/CommonTypes.h"
+#include "../Common/Convert.h"
+#include "../FilterExpressions/FilterExpressionParser.h"
+#include <iostream>
+#include <random>
+
+#ifndef USE_ANTLR_FILTER_PARSER
+#error FilterExpressionParserFuzzTests compares parsers of a library built with USE_ANTLR_FILTER_PARSER
+#endif
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+using namespace GSF::FilterExpressions;
+
+struct FuzzSettings
+{
+    uint32_t Seed = 20261018U;
+    int32_t ValidCount = 5000;
+    int32_t MutatedCount = 800;
+};
+
+// Outcome of parsing and evaluating a filter expression with one of the parsers
+struct ParseResult
+{
+    bool Failed = false;
+    bool UnexpectedException = false;
+    string Description;
+};
+
+// Generates random filter expressions that follow FilterExpressionSyntax.g4 for MeasurementDetail table
+class FilterExpressionGenerator
+{
+private:
+    mt19937 m_random;
+    vector<string> m_signalIDs;
+    vector<string> m_measurementKeys;
+    vector<string> m_pointTags;
+
+    int32_t Next(const int32_t count)
+    {
+        return uniform_int_distribution<int32_t>(0, count - 1)(m_random);
+    }
+
+    bool Chance(const int32_t percent)
+    {
+        return Next(100) < percent;
+    }
+
+    template<size_t N>
+    const char* Pick(const char* const (&values)[N])
+    {
+        return values[Next(static_cast<int32_t>(N))];
+    }
+
+    string Keyword(const string& keyword);
+    string Space();
+    string Operator(const string& operatorSymbol);
+    string Function(const string& functionName, const vector<string>& arguments);
+    string BooleanExpression(int32_t depth);
+    string NumericExpression(int32_t depth);
+    string StringExpression(int32_t depth);
+    string DateTimeExpression(int32_t depth);
+    string Statement();
+
+public:
+    FilterExpressionGenerator(uint32_t seed, const DataTablePtr& table);
+
+    string FilterExpression();
+    string Mutate(const string& filterExpression);
+};
+
+bool ParseSettings(int argc, char* argv[], FuzzSettings& settings);
+ParseResult Parse(const DataSetPtr& dataSet, const string& filterExpression, bool useAntlrParser);
+string DescribeTree(const ExpressionTree& expressionTree);
+string DescribeExpression(const ExpressionPtr& expression);
+
+// Differential test application for filter expression parsers.
+//
+// This application parses, and evaluates, generated filter expressions with both the hand-written
+// parser and the ANTLR generated parser of a library built with USE_ANTLR_FILTER_PARSER. Expression
+// trees, TOP limits, ORDER BY terms and filtered signal IDs must be identical for valid statements.
+// Mutated statements, which are mostly invalid, must produce identical results or fail with both
+// parsers. Parsing stops at the first syntax error so ANTLR error recovery is not compared.
+int main(int argc, char* argv[])
+{
+    FuzzSettings settings;
+
+    if (!ParseSettings(argc, argv, settings))
+    {
+        cout << "Usage:" << endl;
+        cout << "    FilterExpressionParserFuzzTests [options]" << endl << endl;
+        cout << "Options:" << endl;
+        cout << "    -seed N       Seed of random filter expression generator, defaults to 20261018" << endl;
+        cout << "    -valid N      Number of generated valid filter expressions, defaults to 5000" << endl;
+        cout << "    -mutated N    Number of mutated and random filter expressions, defaults to 800" << endl;
+        return 0;
+    }
+
+    const DataSetPtr dataSet = DataSet::FromXml(string("MetadataSample1.xml"));
+    FilterExpressionGenerator generator(settings.Seed, dataSet->Table("MeasurementDetail"));
+    int32_t mismatchCount = 0, validFailedCount = 0, mutatedFailedCount = 0, readerUnexpectedCount = 0, antlrUnexpectedCount = 0;
+
+    const auto compare = [&](const string& filterExpression, const bool valid)
+    {
+        const ParseResult readerResult = Parse(dataSet, filterExpression, false);
+        const ParseResult antlrResult = Parse(dataSet, filterExpression, true);
+
+        readerUnexpectedCount += readerResult.UnexpectedException ? 1 : 0;
+        antlrUnexpectedCount += antlrResult.UnexpectedException ? 1 : 0;
+
+        // Error messages of syntax errors differ between parsers, only errors of valid statements are compared
+        const bool matched = readerResult.Failed == antlrResult.Failed && (readerResult.Description == antlrResult.Description || (!valid && readerResult.Failed));
+
+        if (readerResult.Failed && antlrResult.Failed)
+        {
+            if (valid)
+                validFailedCount++;
+            else
+                mutatedFailedCount++;
+        }
+
+        if (matched)
+            return;
+
+        mismatchCount++;
+        cout << "Mismatch for " << (valid ? "valid" : "mutated") << " filter expression: " << filterExpression << endl;
+        cout << "    Hand-written parser: " << readerResult.Description << endl;
+        cout << "    ANTLR parser:        " << antlrResult.Description << endl << endl;
+    };
+
+    for (int32_t i = 0; i < settings.ValidCount; i++)
+        compare(generator.FilterExpression(), true);
+
+    for (int32_t i = 0; i < settings.MutatedCount; i++)
+        compare(generator.Mutate(generator.FilterExpression()), false);
+
+    cout << "Valid filter expressions: " << settings.ValidCount << ", failed with both parsers: " << validFailedCount << endl;
+    cout << "Mutated filter expressions: " << settings.MutatedCount << ", failed with both parsers: " << mutatedFailedCount << endl;
+    cout << "Unexpected exceptions, hand-written parser: " << readerUnexpectedCount << ", ANTLR parser: " << antlrUnexpectedCount << endl;
+    cout << "Mismatches: " << mismatchCount << endl;
+
+    return mismatchCount == 0 ? 0 : 1;
+}
+
+bool ParseSettings(int argc, char* argv[], FuzzSettings& settings)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const string option = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (option == "-seed" && hasValue)
+            settings.Seed = static_cast<uint32_t>(stoul(argv[++i]));
+        else if (option == "-valid" && hasValue)
+            settings.ValidCount = max(0, stoi(argv[++i]));
+        else if (option == "-mutated" && hasValue)
+            settings.MutatedCount = max(0, stoi(argv[++i]));
+        else
+            return false;
+    }
+
+    return true;
+}
+
+ParseResult Parse(const DataSetPtr& dataSet, const string& filterExpression, const bool useAntlrParser)
+{
+    ParseResult result;
+
+    // Statements cached for one parser would otherwise be used by the other
+    FilterExpressionCache::Clear();
+
+    try
+    {
+        const FilterExpressionParserPtr parser = NewSharedPtr<FilterExpressionParser>(filterExpression, true);
+
+        parser->SetDataSet(dataSet);
+        parser->SetPrimaryTableName("MeasurementDetail");
+        parser->SetTableIDFields("MeasurementDetail", FilterExpressionParser::DefaultTableIDFields);
+        parser->SetTrackFilteredSignalIDs(true);
+        parser->SetUseAntlrParser(useAntlrParser);
+        parser->Evaluate();
+
+        for (const ExpressionTreePtr& expressionTree : parser->GetExpressionTrees())
+            result.Description += DescribeTree(*expressionTree) + "; ";
+
+        result.Description += "SignalIDs:";
+
+        for (const GSF::Guid& signalID : parser->FilteredSignalIDs())
+            result.Description += " " + ToString(signalID);
+    }
+    catch (const FilterExpressionParserException& ex)
+    {
+        result.Failed = true;
+        result.Description = ex.what();
+    }
+    catch (const ExpressionTreeException& ex)
+    {
+        result.Failed = true;
+        result.Description = ex.what();
+    }
+    catch (const DataSetException& ex)
+    {
+        result.Failed = true;
+        result.Description = ex.what();
+    }
+    catch (const std::exception& ex)
+    {
+        result.Failed = true;
+        result.UnexpectedException = true;
+        result.Description = ex.what();
+    }
+    catch (...)
+    {
+        result.Failed = true;
+        result.UnexpectedException = true;
+        result.Description = boost::current_exception_diagnostic_information(true);
+    }
+
+    return result;
+}
+
+string DescribeTree(const ExpressionTree& expressionTree)
+{
+    string description = expressionTree.Table()->Name() + " TOP " + ToString(expressionTree.TopLimit) + " WHERE " + DescribeExpression(expressionTree.Root);
+
+    for (const auto& orderByTerm : expressionTree.OrderByTerms)
+        description += " ORDER " + get<0>(orderByTerm)->Name() + (get<1>(orderByTerm) ? " ASC" : " DESC") + (get<2>(orderByTerm) ? " BINARY" : "");
+
+    return description;
+}
+
+string DescribeExpression(const ExpressionPtr& expression)
+{
+    if (expression == nullptr)
+        return "nullptr";
+
+    const auto describeArguments = [](const ExpressionCollectionPtr& arguments)
+    {
+        string description;
+
+        for (const ExpressionPtr& argument : *arguments)
+            description += ", " + DescribeExpression(argument);
+
+        return description;
+    };
+
+    switch (expression->Type)
+    {
+        case ExpressionType::Value:
+        {
+            const ValueExpressionPtr value = CastSharedPtr<ValueExpression>(expression);
+            return string(EnumName(value->ValueType)) + "(" + (value->IsNull() ? "NULL" : value->ToString()) + ")";
+        }
+        case ExpressionType::Unary:
+        {
+            const UnaryExpressionPtr unary = CastSharedPtr<UnaryExpression>(expression);
+            return string(EnumName(unary->UnaryType)) + "(" + DescribeExpression(unary->Value) + ")";
+        }
+        case ExpressionType::Column:
+            return "[" + CastSharedPtr<ColumnExpression>(expression)->DataColumn->Name() + "]";
+        case ExpressionType::InList:
+        {
+            const InListExpressionPtr inList = CastSharedPtr<InListExpression>(expression);
+            return string(inList->HasNotKeyword ? "NotIn" : "In") + (inList->ExactMatch ? "Binary" : "") + "(" + DescribeExpression(inList->Value) + describeArguments(inList->Arguments) + ")";
+        }
+        case ExpressionType::Function:
+        {
+            const FunctionExpressionPtr function = CastSharedPtr<FunctionExpression>(expression);
+            return "Function" + ToString(static_cast<int32_t>(function->FunctionType)) + "(" + describeArguments(function->Arguments) + ")";
+        }
+        case ExpressionType::Operator:
+        {
+            const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
+            return string(EnumName(operatorExpression->OperatorType)) + "(" + DescribeExpression(operatorExpression->LeftValue) + ", " + DescribeExpression(operatorExpression->RightValue) + ")";
+        }
+        default:
+            return "Unknown";
+    }
+}
+
+FilterExpressionGenerator::FilterExpressionGenerator(const uint32_t seed, const DataTablePtr& table) :
+    m_random(seed)
+{
+    const int32_t signalIDColumn = table->Column("SignalID")->Index();
+    const int32_t idColumn = table->Column("ID")->Index();
+    const int32_t pointTagColumn = table->Column("PointTag")->Index();
+
+    for (int32_t i = 0; i < table->RowCount(); i++)
+    {
+        const DataRowPtr& row = table->Row(i);
+        const Nullable<GSF::Guid> signalID = row->ValueAsGuid(signalIDColumn);
+        const Nullable<string> id = row->ValueAsString(idColumn);
+        const Nullable<string> pointTag = row->ValueAsString(pointTagColumn);
+
+        if (signalID.HasValue())
+            m_signalIDs.push_back(ToString(signalID.GetValueOrDefault()));
+
+        if (id.HasValue())
+            m_measurementKeys.push_back(id.GetValueOrDefault());
+
+        // Point tag literals only allow acronym characters
+        if (pointTag.HasValue() && pointTag.GetValueOrDefault().find_first_not_of("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-!_.@#$") == string::npos)
+            m_pointTags.push_back(pointTag.GetValueOrDefault());
+    }
+
+    // Identifiers that do not match any rows
+    m_signalIDs.push_back(ToString(NewGuid()));
+    m_measurementKeys.emplace_back("PPA:999999");
+    m_pointTags.emplace_back("GPA_UNKNOWN-TAG.1");
+}
+
+string FilterExpressionGenerator::FilterExpression()
+{
+    string filterExpression = Statement();
+    const int32_t statementCount = Chance(75) ? 1 : 2 + Next(2);
+
+    for (int32_t i = 1; i < statementCount; i++)
+        filterExpression += ";" + Space() + Statement();
+
+    if (Chance(5))
+        filterExpression += ";";
+
+    return filterExpression;
+}
+
+string FilterExpressionGenerator::Mutate(const string& filterExpression)
+{
+    static const char* const Insertions[] =
+    {
+        "(", ")", "'", ",", ";", "#", "{", "}", "-", "+", "*", "/", "%", "<", ">", "=", "!", "~", "&", "|", "^",
+        ".", " ", "\"", ":", "0", "7", "x", "@", "$", "AND ", " OR ", "NOT ", " IN ", " LIKE ", " IS ", "NULL",
+        "FILTER ", " WHERE ", " ORDER BY ", " TOP ", "0x", "1e", "==", "!==", "--", "/*", "*/", "BINARY ", "Len("
+    };
+
+    // Some inputs are random token sequences rather than mutations of a statement
+    if (Chance(15))
+    {
+        string tokens;
+        const int32_t tokenCount = 1 + Next(12);
+
+        for (int32_t i = 0; i < tokenCount; i++)
+            tokens += Pick(Insertions);
+
+        return tokens;
+    }
+
+    string mutated = filterExpression;
+    const int32_t mutationCount = 1 + Next(3);
+
+    for (int32_t i = 0; i < mutationCount && !mutated.empty(); i++)
+    {
+        const int32_t position = Next(static_cast<int32_t>(mutated.size()));
+        const int32_t length = 1 + Next(min(5, static_cast<int32_t>(mutated.size()) - position));
+
+        switch (Next(5))
+        {
+            case 0:
+                mutated.erase(position, length);
+                break;
+            case 1:
+                mutated.insert(position, Pick(Insertions));
+                break;
+            case 2:
+                mutated.insert(position, mutated.substr(Next(static_cast<int32_t>(mutated.size())), length));
+                break;
+            case 3:
+                if (position + 1 < static_cast<int32_t>(mutated.size()))
+                    swap(mutated[position], mutated[position + 1]);
+                break;
+            default:
+                mutated.resize(position);
+                break;
+        }
+    }
+
+    return mutated;
+}
+
+string FilterExpressionGenerator::Keyword(const string& keyword)
+{
+    // Keywords are not case sensitive
+    string result = keyword;
+
+    switch (Next(4))
+    {
+        case 0:
+            return ToLower(result);
+        case 1:
+            for (char& c : result)
+            {
+                if (Chance(50))
+                    c = static_cast<char>(tolower(c));
+            }
+
+            return result;
+        default:
+            return result;
+    }
+}
+
+string FilterExpressionGenerator::Space()
+{
+    static const char* const Spaces[] = { "  ", "\t", "\n", " /* comment */ ", " -- comment\n", "\r\n " };
+    return Chance(90) ? " " : Pick(Spaces);
+}
+
+string FilterExpressionGenerator::Operator(const string& operatorSymbol)
+{
+    // Operators are always separated by white space so that adjacent symbols cannot form a comment or another operator
+    return Space() + operatorSymbol + Space();
+}
+
+string FilterExpressionGenerator::Function(const string& functionName, const vector<string>& arguments)
+{
+    string function = Keyword(functionName) + "(";
+
+    for (size_t i = 0; i < arguments.size(); i++)
+        function += (i > 0 ? "," + Space() : "") + arguments[i];
+
+    return function + ")";
+}
+
+string FilterExpressionGenerator::Statement()
+{
+    static const char* const OrderByColumns[] = { "PointTag", "SignalAcronym", "PhasorSourceIndex", "DeviceAcronym", "UpdatedOn", "Enabled" };
+    const int32_t statementType = Next(100);
+
+    if (statementType < 55)
+    {
+        string statement = Keyword("FILTER") + Space();
+
+        if (Chance(30))
+            statement += Keyword("TOP") + Space() + (Chance(10) ? "-1" : Chance(10) ? "+" + ToString(Next(20)) : ToString(Next(50))) + Space();
+
+        statement += "MeasurementDetail" + Space() + Keyword("WHERE") + Space() + BooleanExpression(4);
+
+        if (Chance(35))
+        {
+            const int32_t termCount = 1 + Next(3);
+            statement += Space() + Keyword("ORDER") + Space() + Keyword("BY") + Space();
+
+            for (int32_t i = 0; i < termCount; i++)
+            {
+                if (i > 0)
+                    statement += "," + Space();
+
+                if (Chance(15))
+                    statement += Chance(50) ? Keyword("BINARY") + Space() : "===" + Space();
+
+                statement += OrderByColumns[Next(6)];
+
+                if (Chance(60))
+                    statement += Space() + Keyword(Chance(50) ? "ASC" : "DESC");
+            }
+        }
+
+        return statement;
+    }
+
+    // Filter expressions without a statement filter rows of primary table
+    if (statementType < 75)
+        return BooleanExpression(4);
+
+    if (statementType < 87)
+    {
+        const string& signalID = m_signalIDs[Next(static_cast<int32_t>(m_signalIDs.size()))];
+
+        switch (Next(3))
+        {
+            case 0:
+                return "'" + signalID + "'";
+            case 1:
+                return "{" + signalID + "}";
+            default:
+                return signalID;
+        }
+    }
+
+    if (statementType < 94)
+        return m_measurementKeys[Next(static_cast<int32_t>(m_measurementKeys.size()))];
+
+    return "\"" + m_pointTags[Next(static_cast<int32_t>(m_pointTags.size()))] + "\"";
+}
+
+string FilterExpressionGenerator::BooleanExpression(const int32_t depth)
+{
+    static const char* const BooleanColumns[] = { "Internal", "Enabled" };
+    static const char* const ComparisonOperators[] = { "<", "<=", ">", ">=", "=", "==", "===", "!=", "!==", "<>" };
+    static const char* const EqualityOperators[] = { "=", "==", "===", "!=", "!==", "<>" };
+    static const char* const LikePatterns[] = { "'TVA%'", "'%FQ'", "'%SHELBY%'", "'STAT'", "'tva_%'", "'*:FQ'" };
+
+    if (depth <= 0 || Chance(20))
+    {
+        switch (Next(3))
+        {
+            case 0:
+                return Keyword(Chance(50) ? "TRUE" : "FALSE");
+            default:
+                return BooleanColumns[Next(2)];
+        }
+    }
+
+    switch (Next(14))
+    {
+        case 0:
+            return NumericExpression(depth - 1) + Operator(Pick(ComparisonOperators)) + NumericExpression(depth - 1);
+        case 1:
+            return StringExpression(depth - 1) + Operator(Pick(ComparisonOperators)) + StringExpression(depth - 1);
+        case 2:
+            return DateTimeExpression(depth - 1) + Operator(Pick(ComparisonOperators)) + DateTimeExpression(depth - 1);
+        case 3:
+        {
+            string like = StringExpression(depth - 1) + Space();
+
+            if (Chance(30))
+                like += Keyword("NOT") + Space();
+
+            like += Keyword("LIKE") + Space();
+
+            if (Chance(20))
+                like += Chance(50) ? Keyword("BINARY") + Space() : "===" + Space();
+
+            return like + Pick(LikePatterns);
+        }
+        case 4:
+        {
+            const string values[] = { NumericExpression(depth - 1), StringExpression(depth - 1), DateTimeExpression(depth - 1), "SignalID" };
+            return values[Next(4)] + Space() + Keyword("IS") + Space() + (Chance(50) ? Keyword("NOT") + Space() : "") + Keyword("NULL");
+        }
+        case 5:
+        {
+            const bool numeric = Chance(50);
+            const int32_t valueCount = 1 + Next(4);
+            string inList = numeric ? NumericExpression(depth - 1) : StringExpression(depth - 1);
+
+            inList += Space() + (Chance(25) ? (Chance(50) ? Keyword("NOT") : "!") + Space() : "") + Keyword("IN") + Space();
+
+            if (Chance(20))
+                inList += Chance(50) ? Keyword("BINARY") + Space() : "===";
+
+            inList += "(";
+
+            for (int32_t i = 0; i < valueCount; i++)
+                inList += (i > 0 ? "," + Space() : "") + (numeric ? NumericExpression(depth - 2) : StringExpression(depth - 2));
+
+            return inList + ")";
+        }
+        case 6:
+            // Space follows "!" since an operand starting with "#" would otherwise lex as a measurement key
+            return (Chance(50) ? Keyword("NOT") : "!") + " " + BooleanExpression(depth - 1);
+        case 7:
+        case 8:
+        {
+            static const char* const LogicalOperators[] = { "AND", "&&", "OR", "||" };
+            const string logicalOperator = Pick(LogicalOperators);
+            return BooleanExpression(depth - 1) + Operator(isalpha(logicalOperator[0]) ? Keyword(logicalOperator) : logicalOperator) + BooleanExpression(depth - 1);
+        }
+        case 9:
+            return "(" + Space() + BooleanExpression(depth - 1) + Space() + ")";
+        case 10:
+            return "(" + BooleanExpression(depth - 1) + ")" + Operator(Pick(EqualityOperators)) + Keyword(Chance(50) ? "TRUE" : "FALSE");
+        case 11:
+            return Function("IIf", { BooleanExpression(depth - 1), BooleanExpression(depth - 1), BooleanExpression(depth - 1) });
+        case 12:
+        {
+            static const char* const StringTests[] = { "StartsWith", "EndsWith", "Contains" };
+            return Function(Pick(StringTests), { StringExpression(depth - 1), Chance(50) ? "'TVA'" : "'fq'", Keyword(Chance(50) ? "TRUE" : "FALSE") });
+        }
+        default:
+        {
+            switch (Next(6))
+            {
+                case 0:
+                    return Function("RegExMatch", { "'^[A-Z]+_'", StringExpression(depth - 1) });
+                case 1:
+                    return Function("IsDate", { Chance(50) ? StringExpression(depth - 1) : "UpdatedOn" });
+                case 2:
+                    return Function("IsInteger", { StringExpression(depth - 1) });
+                case 3:
+                    return Function("IsNumeric", { NumericExpression(depth - 1) });
+                case 4:
+                    return Function("IsGuid", { Chance(50) ? "SignalID" : "'" + m_signalIDs[0] + "'" });
+                default:
+                    return Function("IsNull", { BooleanColumns[Next(2)], Keyword(Chance(50) ? "TRUE" : "FALSE") });
+            }
+        }
+    }
+}
+
+string FilterExpressionGenerator::NumericExpression(const int32_t depth)
+{
+    if (depth <= 0 || Chance(35))
+    {
+        static const char* const NumericLiterals[] = { "1.5", ".25", "2e3", "1E-2", "0.0", "3.14159" };
+        static const char* const HexDigits[] = { "0x1", "0xF", "0x1f", "0X2A", "0xff" };
+
+        switch (Next(5))
+        {
+            case 0:
+                return ToString(Next(100));
+            case 1:
+                return Pick(NumericLiterals);
+            case 2:
+                return Pick(HexDigits);
+            default:
+                return "PhasorSourceIndex";
+        }
+    }
+
+    switch (Next(9))
+    {
+        case 0:
+        case 1:
+        {
+            static const char* const Operators[] = { "*", "+", "-", "<<", ">>", "&", "|", "^", "XOR" };
+            const string arithmeticOperator = Pick(Operators);
+            return NumericExpression(depth - 1) + Operator(arithmeticOperator == "XOR" ? Keyword(arithmeticOperator) : arithmeticOperator) + NumericExpression(depth - 1);
+        }
+        case 2:
+            // Divisors are non-zero literals, integer division by zero is not evaluated
+            return NumericExpression(depth - 1) + Operator(Chance(50) ? "/" : "%") + ToString(1 + Next(9));
+        case 3:
+        {
+            static const char* const UnaryOperators[] = { "-", "+", "~" };
+            return string(Pick(UnaryOperators)) + (Chance(50) ? "PhasorSourceIndex" : "(" + NumericExpression(depth - 1) + ")");
+        }
+        case 4:
+            return "(" + NumericExpression(depth - 1) + ")";
+        case 5:
+        {
+            static const char* const Functions[] = { "Abs", "Ceiling", "Floor", "Round" };
+            return Function(Pick(Functions), { NumericExpression(depth - 1) });
+        }
+        case 6:
+        {
+            static const char* const Functions[] = { "Coalesce", "IsNull", "MaxOf", "MinOf" };
+            return Function(Pick(Functions), { "PhasorSourceIndex", NumericExpression(depth - 1) });
+        }
+        case 7:
+        {
+            switch (Next(4))
+            {
+                case 0:
+                    return Function("Len", { StringExpression(depth - 1) });
+                case 1:
+                    return Function("IndexOf", { StringExpression(depth - 1), "'A'" });
+                case 2:
+                    return Function("StrCmp", { StringExpression(depth - 1), StringExpression(depth - 1) });
+                default:
+                    return Function("Power", { NumericExpression(depth - 1), ToString(Next(3)) });
+            }
+        }
+        default:
+        {
+            static const char* const DateParts[] = { "'Year'", "'month'", "'Day'", "'Hour'", "'Minute'", "'Second'" };
+            return Chance(50) ? Function("DatePart", { DateTimeExpression(depth - 1), Pick(DateParts) }) : Function("IIf", { BooleanExpression(depth - 1), NumericExpression(depth - 1), NumericExpression(depth - 1) });
+        }
+    }
+}
+
+string FilterExpressionGenerator::StringExpression(const int32_t depth)
+{
+    static const char* const StringColumns[] = { "DeviceAcronym", "ID", "PointTag", "SignalReference", "SignalAcronym", "Description" };
+
+    if (depth <= 0 || Chance(40))
+    {
+        static const char* const StringLiterals[] = { "'FREQ'", "'TVA_SHELBY'", "''", "'It''s'", "'stat'", "'SHELBY-FQ'", "'1024'" };
+        return Chance(70) ? Pick(StringColumns) : Pick(StringLiterals);
+    }
+
+    switch (Next(8))
+    {
+        case 0:
+            return StringExpression(depth - 1) + Operator("+") + StringExpression(depth - 1);
+        case 1:
+        {
+            static const char* const Functions[] = { "Upper", "Lower", "Trim", "TrimLeft", "TrimRight", "Reverse" };
+            return Function(Pick(Functions), { StringExpression(depth - 1) });
+        }
+        case 2:
+            return Chance(50) ? Function("SubStr", { StringExpression(depth - 1), ToString(Next(4)) }) : Function("SubStr", { StringExpression(depth - 1), ToString(Next(4)), ToString(Next(6)) });
+        case 3:
+            return Function("Replace", { StringExpression(depth - 1), "'_'", "'-'" });
+        case 4:
+            return Function("Coalesce", { Pick(StringColumns), StringExpression(depth - 1) });
+        case 5:
+            return Function("RegExVal", { "'[A-Z]+'", StringExpression(depth - 1) });
+        case 6:
+            return Function("Convert", { NumericExpression(depth - 1), "'System.String'" });
+        default:
+            return "(" + StringExpression(depth - 1) + ")";
+    }
+}
+
+string FilterExpressionGenerator::DateTimeExpression(const int32_t depth)
+{
+    static const char* const DateTimeLiterals[] = { "#2019-02-04 03:00:52.73-05:00#", "#2/4/2019#", "#2019-01-31#", "#2010-01-01T00:00:00#", "'2019-02-04'" };
+
+    if (depth <= 0 || Chance(50))
+        return Chance(50) ? "UpdatedOn" : Pick(DateTimeLiterals);
+
+    static const char* const Intervals[] = { "'Year'", "'Month'", "'Day'", "'Hour'", "'minute'", "'Second'" };
+    return Function("DateAdd", { DateTimeExpression(depth - 1), ToString(Next(30)), Pick(Intervals) });
+}
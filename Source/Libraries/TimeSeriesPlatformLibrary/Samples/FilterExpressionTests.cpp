@@ -27,6 +27,7 @@
 #include <iterator>
 #include <boost/filesystem.hpp>
 #include "../FilterExpressions/FilterExpressionParser.h"
+#include "../FilterExpressions/BatchEvaluator.h"
 #include "../Data/DataSet.h"
 
 using namespace std;
@@ -57,6 +58,43 @@ void Evaluate(const FilterExpressionParserPtr& parser)
     }
 }
 
+// Evaluates filter expression for row, compiled evaluation result, or error, is validated against expression tree evaluation
+ValueExpressionPtr Evaluate(const DataRowPtr& dataRow, const string& filterExpression, const bool suppressConsoleErrorOutput = SUPPRESS_CONSOLE_ERROR_OUTPUT)
+{
+    const ExpressionTreePtr expressionTree = FilterExpressionParser::GenerateExpressionTree(dataRow->Parent(), filterExpression, suppressConsoleErrorOutput);
+    ValueExpressionPtr result, referenceResult;
+    exception_ptr error, referenceError;
+
+    try
+    {
+        result = expressionTree->Evaluate(dataRow);
+    }
+    catch (...)
+    {
+        error = current_exception();
+    }
+
+    try
+    {
+        referenceResult = expressionTree->EvaluateReference(dataRow);
+    }
+    catch (...)
+    {
+        referenceError = current_exception();
+    }
+
+    assert((error == nullptr) == (referenceError == nullptr));
+
+    if (error != nullptr)
+        rethrow_exception(error);
+
+    assert(result->ValueType == referenceResult->ValueType);
+    assert(result->IsNull() == referenceResult->IsNull());
+    assert(result->IsNull() || result->ToString() == referenceResult->ToString());
+
+    return result;
+}
+
 // Sample application to test the filter expression parser.
 int main(int argc, char* argv[])
 {
@@ -1510,6 +1548,855 @@ int main(int argc, char* argv[])
     assert(timetag > DateAdd(UtcNow(), -5, TimeInterval::Second));
     cout << "Test " << ++test << " succeeded..." << endl;
 
+    // Test 160 - test materialized computed column is re-evaluated when a source column changes
+    dataRow->Parent()->MaterializeColumn("ComputedCol");
+    assert(dataRow->ValueAsInt32("ComputedCol").GetValueOrDefault() == 32);
+
+    const Nullable<int32_t> accessID = dataRow->ValueAsInt32("AccessID");
+    dataRow->SetInt32Value("AccessID", accessID.GetValueOrDefault() + 10);
+    valueExpression = FilterExpressionParser::Evaluate(dataRow, "aBs(-AccessiD xOR 2+ framespersecond^4 -6)");
+
+    assert(valueExpression->ValueAsInt32() != 32);
+    assert(dataRow->ValueAsInt32("ComputedCol").GetValueOrDefault() == valueExpression->ValueAsInt32());
+
+    dataRow->SetInt32Value("AccessID", accessID);
+    assert(dataRow->ValueAsInt32("ComputedCol").GetValueOrDefault() == 32);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 161 - compiled predicate evaluation matches expression tree evaluation for all rows
+    const DataTablePtr measurementDetail = dataSet->Table("MeasurementDetail");
+
+    const vector<string> predicates =
+    {
+        "SignalAcronym = 'STAT'",
+        "SignalAcronym IN ('FREQ', 'DFDT', 'IPHM') OR Internal",
+        "PointTag LIKE '%-FQ' AND Enabled",
+        "!Internal AND PhasorSourceIndex > 1",
+        "PhasorSourceIndex * 2 + 1 >= 3 OR PhasorSourceIndex IS NULL",
+        "PhasorSourceIndex IN (1, 2, 3)",
+        "PhasorSourceIndex IN (1, 2) AND Enabled",
+        "UpdatedOn > '2000-01-01' AND Description <> '' AND SignalID IS NOT NULL",
+        "Len(SignalReference) > 20 AND -PhasorSourceIndex % 3 = -1",
+        "IIf(Internal, SignalAcronym, DeviceAcronym) LIKE 'S%'",
+        "Coalesce(PhasorSourceIndex, 0) = 0 AND SignalAcronym + '-' + DeviceAcronym <> ''"
+    };
+
+    for (const string& predicate : predicates)
+    {
+        const ExpressionTreePtr expressionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, predicate);
+
+        for (int32_t i = 0; i < measurementDetail->RowCount(); i++)
+        {
+            const DataRowPtr& row = measurementDetail->Row(i);
+            ExpressionValueType resultValueType;
+            bool result = false, error = false, referenceError = false;
+            ValueExpressionPtr referenceResult;
+
+            try
+            {
+                result = expressionTree->EvaluatePredicate(row, resultValueType);
+            }
+            catch (const ExpressionTreeException&)
+            {
+                error = true;
+            }
+
+            try
+            {
+                referenceResult = expressionTree->EvaluateReference(row);
+            }
+            catch (const ExpressionTreeException&)
+            {
+                referenceError = true;
+            }
+
+            assert(error == referenceError);
+
+            if (error)
+                continue;
+
+            assert(resultValueType == referenceResult->ValueType);
+            assert(result == (referenceResult->ValueType == ExpressionValueType::Boolean && referenceResult->ValueAsBoolean()));
+        }
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 162 - test row independent sub-expressions are folded to literal values
+    ExpressionTreePtr expressionTree = FilterExpressionParser::GenerateExpressionTree(dataRow->Parent(), "Len('abc') > 2");
+    assert(expressionTree->Root->Type == ExpressionType::Value);
+    assert(CastSharedPtr<ValueExpression>(expressionTree->Root)->ValueAsBoolean());
+
+    expressionTree = FilterExpressionParser::GenerateExpressionTree(dataRow->Parent(), "-(2 * 3) * AccessID");
+    assert(expressionTree->Root->Type == ExpressionType::Operator);
+    assert(CastSharedPtr<OperatorExpression>(expressionTree->Root)->LeftValue->Type == ExpressionType::Value);
+
+    valueExpression = Evaluate(dataRow, "AccessID * 2 IN (-(-1), Len('abcde') * 4 + 6 * 2, AccessID + AccessID)");
+    assert(valueExpression->ValueType == ExpressionValueType::Boolean);
+    assert(valueExpression->ValueAsBoolean());
+
+    // Sub-expression that fails to evaluate is not folded, error is reported on evaluation
+    try
+    {
+        Evaluate(dataRow, "Convert('x', 'System.Int32') + AccessID", true);
+        assert(false);
+    }
+    catch (const std::exception&)
+    {
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 163 - test AND and OR operations with constant operands are short-circuited
+    expressionTree = FilterExpressionParser::GenerateExpressionTree(dataRow->Parent(), "1 = 0 AND AccessID IS NOT NULL");
+    assert(expressionTree->Root == ExpressionTree::False);
+
+    expressionTree = FilterExpressionParser::GenerateExpressionTree(dataRow->Parent(), "AccessID IS NULL OR Len('a') = 1");
+    assert(expressionTree->Root == ExpressionTree::True);
+
+    // Operands that can be Null are not short-circuited since a Null operand makes result Null
+    expressionTree = FilterExpressionParser::GenerateExpressionTree(dataRow->Parent(), "1 = 0 AND AccessID > 0");
+    assert(expressionTree->Root->Type == ExpressionType::Operator);
+    assert(CastSharedPtr<OperatorExpression>(expressionTree->Root)->OperatorType == ExpressionOperatorType::And);
+
+    expressionTree = FilterExpressionParser::GenerateExpressionTree(dataRow->Parent(), "AccessID > 0 OR Len('a') = 1");
+    assert(expressionTree->Root->Type == ExpressionType::Operator);
+    assert(CastSharedPtr<OperatorExpression>(expressionTree->Root)->OperatorType == ExpressionOperatorType::Or);
+
+    expressionTree = FilterExpressionParser::GenerateExpressionTree(dataRow->Parent(), "1 = 1 AND AccessID > 0");
+    assert(expressionTree->Root->Type == ExpressionType::Operator);
+    assert(CastSharedPtr<OperatorExpression>(expressionTree->Root)->OperatorType == ExpressionOperatorType::GreaterThan);
+
+    // Operand errors are reported since operand is not short-circuited
+    try
+    {
+        Evaluate(dataRow, "True OR Convert('x', 'System.Int32') > 1", true);
+        assert(false);
+    }
+    catch (...)
+    {
+    }
+
+    valueExpression = Evaluate(dataRow, "NULL AND AccessID > 0");
+    assert(valueExpression->ValueType == ExpressionValueType::Boolean);
+    assert(valueExpression->IsNull());
+
+    // Operand type errors are still reported
+    try
+    {
+        Evaluate(dataRow, "False AND AccessID", true);
+        assert(false);
+    }
+    catch (const ExpressionTreeException&)
+    {
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 164 - test IIf with a constant test is replaced by selected result expression
+    expressionTree = FilterExpressionParser::GenerateExpressionTree(dataRow->Parent(), "IIf(Len('ab') = 2, AccessID, 1 / 0)");
+    assert(expressionTree->Root->Type == ExpressionType::Column);
+
+    valueExpression = Evaluate(dataRow, "IIf(NULL, 1 / 0, AccessID * 2)");
+    assert(valueExpression->ValueAsInt32() == dataRow->ValueAsInt32("AccessID").GetValueOrDefault() * 2);
+
+    valueExpression = Evaluate(dataRow, "IIf(1 = 1, NULL, AccessID)");
+    assert(valueExpression->ValueType == ExpressionValueType::Boolean);
+    assert(valueExpression->IsNull());
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 165 - test current time sub-expressions are evaluated for each evaluation pass
+    dataRows = FilterExpressionParser::Select(measurementDetail, "DateAdd(Now(), -1, 'Day') < UtcNow() AND DateDiff(UpdatedOn, Now(), 'Hour') > 1");
+    assert(dataRows.size() == static_cast<size_t>(measurementDetail->RowCount()));
+
+    expressionTree = FilterExpressionParser::GenerateExpressionTree(dataRow->Parent(), "DateAdd(Now(), 1, 'Day')");
+    const datetime_t dateTime = expressionTree->Evaluate(dataRow)->ValueAsDateTime();
+    assert(expressionTree->Evaluate(dataRow)->ValueAsDateTime() >= dateTime);
+    assert(dateTime > GSF::Now());
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 166 - test literal and run-time regular expression and LIKE patterns
+    valueExpression = Evaluate(dataRow, "RegExVal('[a-z]+', Name) + RegExVal('^SH', Acronym)");
+    assert(valueExpression->ValueAsString() == "helbySH");
+
+    valueExpression = Evaluate(dataRow, "Name LIKE Lower(Acronym) + '%' AND Acronym LIKE === '%' + Upper(SubStr(Name, 2, 3)) + '%' AND NOT RegExMatch(Lower(Acronym), Name)");
+    assert(valueExpression->ValueAsBoolean());
+
+    try
+    {
+        Evaluate(dataRow, "RegExMatch('(', Name)", true);
+        assert(false);
+    }
+    catch (const std::exception&)
+    {
+    }
+
+    assert(IsEqualIgnoreCase("Shelby", "SHELBY") && StartsWithIgnoreCase("Shelby", "sH") && EndsWithIgnoreCase("Shelby", "BY") && ContainsIgnoreCase("Shelby", "ELB"));
+    assert(CompareIgnoreCase("a_", "A") > 0 && CompareIgnoreCase("_", "a") > 0 && CompareIgnoreCase("Shelby", "SHELBY") == 0);
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 167 - test statements using column indexes select same rows, in same order, as a table scan
+    const string indexedFilterExpressions[] =
+    {
+        "FILTER MeasurementDetail WHERE SignalAcronym = 'stat'",
+        "FILTER MeasurementDetail WHERE SignalAcronym IN ('FREQ', 'DFDT', 'VPHM') AND PhasorSourceIndex IS NULL",
+        "FILTER MeasurementDetail WHERE PointTag LIKE 'gpa_teststream%' OR SignalAcronym = 'IPHA'",
+        "FILTER TOP 3 MeasurementDetail WHERE PhasorSourceIndex IN (1, 2) ORDER BY PointTag DESC",
+        "FILTER MeasurementDetail WHERE PhasorSourceIndex = 1 AND SignalAcronym === 'VPHM'",
+        "STAT:31; {c571fab4-3eb3-459c-8e41-00f660c6d631}; FILTER MeasurementDetail WHERE ID = 'STAT:63'"
+    };
+
+    vector<vector<DataRowPtr>> scannedRows;
+
+    for (const string& filterExpression : indexedFilterExpressions)
+        scannedRows.push_back(FilterExpressionParser::Select(dataSet, filterExpression, "MeasurementDetail"));
+
+    assert(scannedRows[2].size() > 3 && scannedRows[5].size() == 3);
+
+    measurementDetail->CreateIndex("SignalAcronym");
+    measurementDetail->CreateIndex("PhasorSourceIndex");
+    measurementDetail->CreateIndex("PointTag", DataColumnIndexType::Ordered);
+    measurementDetail->CreateIndex("ID", DataColumnIndexType::UniqueHash);
+
+    for (size_t i = 0; i < scannedRows.size(); i++)
+        assert(FilterExpressionParser::Select(dataSet, indexedFilterExpressions[i], "MeasurementDetail") == scannedRows[i]);
+
+    for (const char* columnName : { "SignalAcronym", "PhasorSourceIndex", "PointTag", "ID" })
+        measurementDetail->RemoveIndex(columnName);
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 168 - test operator precedence, syntax error reporting and filter expressions without statements
+    valueExpression = Evaluate(dataRow, "NOT 1 < 2 OR -(2 - 3) * 4 = 4 /* comment */ AND 0x0F & 3 << 2 = 12");
+    assert(valueExpression->ValueAsBoolean());
+
+    string parsingException;
+
+    parser = NewSharedPtr<FilterExpressionParser>("FILTER MeasurementDetail WHERE SignalAcronym IN ('FREQ' 'STAT')", true);
+    parser->SetDataSet(dataSet);
+    parser->RegisterParsingExceptionCallback([&parsingException](FilterExpressionParserPtr, const string& exception) { parsingException = exception; });
+
+    try
+    {
+        parser->Evaluate();
+        result = false;
+    }
+    catch (const FilterExpressionParserException&)
+    {
+        result = true;
+    }
+
+    // Error wording differs between hand-written and ANTLR parsers, both report offending token
+    assert(result && parsingException.find("input ''STAT''") != string::npos);
+
+    parsingException.clear();
+    parser = NewSharedPtr<FilterExpressionParser>(" ; -- no statements", true);
+    parser->SetDataSet(dataSet);
+    parser->SetPrimaryTableName("MeasurementDetail");
+    parser->RegisterParsingExceptionCallback([&parsingException](FilterExpressionParserPtr, const string& exception) { parsingException = exception; });
+    parser->Evaluate();
+
+    assert(!parsingException.empty() && parser->FilteredRows().empty());
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 169 - test parsed filter expressions are cached by data set and normalized expression text
+    FilterExpressionCache::Clear();
+
+    dataRows = FilterExpressionParser::Select(dataSet, "FILTER MeasurementDetail WHERE SignalAcronym = 'STAT' ORDER BY PointTag", "MeasurementDetail");
+    assert(FilterExpressionParser::Select(dataSet, "filter MeasurementDetail /* cached */ where SignalAcronym = 'STAT'  order by PointTag", "MeasurementDetail") == dataRows);
+    assert(FilterExpressionParser::Select(dataSet, "FILTER MeasurementDetail WHERE SignalAcronym = 'stat' ORDER BY PointTag", "MeasurementDetail") == dataRows);
+
+    FilterExpressionCacheStatistics statistics = FilterExpressionCache::GetStatistics();
+    assert(statistics.Hits == 1 && statistics.Misses == 2 && statistics.Count == 2);
+
+    FilterExpressionCache::Invalidate(dataSet);
+    assert(FilterExpressionCache::GetStatistics().Count == 0);
+
+    FilterExpressionCache::SetCapacity(0);
+    FilterExpressionParser::Select(dataSet, "FILTER MeasurementDetail WHERE SignalAcronym = 'STAT'", "MeasurementDetail");
+    assert(FilterExpressionCache::GetStatistics().Count == 0);
+    FilterExpressionCache::SetCapacity(FilterExpressionCache::DefaultCapacity);
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 170 - test TOP with ORDER BY selects first rows of full sort, with and without ordered column indexes
+    const string orderedFilterExpressions[] =
+    {
+        "MeasurementDetail WHERE SignalAcronym <> 'STAT' ORDER BY PointTag DESC",
+        "MeasurementDetail WHERE SignalID IS NOT NULL ORDER BY PhasorSourceIndex DESC, PointTag",
+        "MeasurementDetail WHERE SignalID IS NOT NULL ORDER BY === SignalAcronym, PhasorSourceIndex DESC",
+        "MeasurementDetail WHERE Internal ORDER BY === PointTag DESC",
+        "MeasurementDetail WHERE SignalAcronym IN ('STAT', 'IPHM') ORDER BY === PointTag"
+    };
+
+    vector<vector<DataRowPtr>> sortedRows;
+
+    for (const string& filterExpression : orderedFilterExpressions)
+    {
+        sortedRows.push_back(FilterExpressionParser::Select(dataSet, "FILTER " + filterExpression, "MeasurementDetail"));
+        assert(sortedRows.back().size() > 5);
+    }
+
+    for (int32_t indexed = 0; indexed < 2; indexed++)
+    {
+        if (indexed)
+        {
+            measurementDetail->CreateIndex("PointTag", DataColumnIndexType::Ordered);
+            measurementDetail->CreateIndex("PhasorSourceIndex", DataColumnIndexType::Ordered);
+            measurementDetail->CreateIndex("SignalAcronym", DataColumnIndexType::Ordered);
+        }
+
+        for (size_t i = 0; i < sortedRows.size(); i++)
+        {
+            const vector<DataRowPtr> topRows(sortedRows[i].begin(), sortedRows[i].begin() + 5);
+            assert(FilterExpressionParser::Select(dataSet, "FILTER TOP 5 " + orderedFilterExpressions[i], "MeasurementDetail") == topRows);
+            assert(FilterExpressionParser::Select(dataSet, "FILTER " + orderedFilterExpressions[i], "MeasurementDetail") == sortedRows[i]);
+        }
+    }
+
+    for (const char* columnName : { "PointTag", "PhasorSourceIndex", "SignalAcronym" })
+        measurementDetail->RemoveIndex(columnName);
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 171 - test IN lists of literals with mixed types, Null values and exact matching
+    valueExpression = Evaluate(dataRow, "AccessID IN (1, 1.5, 2.0, 3) AND FramesPerSecond NOT IN (29, 31, 60.0) AND Acronym IN ('bus', 'shelby', 2) AND NOT Acronym IN === ('bus', 'shelby')");
+    assert(valueExpression->ValueAsBoolean());
+
+    valueExpression = Evaluate(dataRow, "UniqueID IN ('{b9650400-d17c-41df-b974-83a6662afab6}', '00000000-0000-0000-0000-000000000000') AND UpdatedOn IN (#2000-01-01#, UpdatedOn)");
+    assert(valueExpression->ValueAsBoolean());
+
+    string pointTagList, signalIDList;
+
+    for (int32_t i = 0; i < measurementDetail->RowCount(); i++)
+    {
+        pointTagList += (i > 0 ? ", '" : "'") + ToLower(measurementDetail->Row(i)->ValueAsString("PointTag").GetValueOrDefault()) + "'";
+        signalIDList += (i > 0 ? ", " : "") + ToString(measurementDetail->Row(i)->ValueAsGuid("SignalID").GetValueOrDefault());
+    }
+
+    assert(FilterExpressionParser::Select(dataSet, "FILTER MeasurementDetail WHERE PointTag IN (NULL, " + pointTagList + ")", "MeasurementDetail").size() == static_cast<size_t>(measurementDetail->RowCount()));
+    assert(FilterExpressionParser::Select(dataSet, "FILTER MeasurementDetail WHERE PointTag IN === (" + pointTagList + ")", "MeasurementDetail").empty());
+    assert(FilterExpressionParser::Select(dataSet, "FILTER MeasurementDetail WHERE SignalID NOT IN (" + signalIDList + ")", "MeasurementDetail").empty());
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 172 - test batch evaluation selects the same rows as row evaluation
+    const string batchPredicates[] =
+    {
+        "PhasorSourceIndex > 2",
+        "2 >= PhasorSourceIndex AND PhasorSourceIndex <> 1",
+        "PhasorSourceIndex < 2.5 OR PhasorSourceIndex = 3.0",
+        "PhasorSourceIndex IS NULL OR NOT Internal",
+        "NOT (PhasorSourceIndex = 1) AND Enabled",
+        "SignalAcronym = 'stat' AND PointTag > 'M'",
+        "SignalAcronym === 'stat' OR SignalAcronym !== 'FREQ'",
+        "UpdatedOn >= #2000-01-01# AND SignalID <> '00000000-0000-0000-0000-000000000000'",
+        "Internal = 'true' OR PhasorSourceIndex IS NOT NULL",
+        "PointTag LIKE '%-FQ' AND PhasorSourceIndex >= 1",
+        "Len(SignalReference) > 20 OR NOT (Description <> '')"
+    };
+
+    for (const string& predicate : batchPredicates)
+    {
+        const ExpressionTreePtr expressionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, predicate);
+        vector<int32_t> positions, referencePositions;
+
+        expressionTree->BeginEvaluation();
+
+        for (int32_t i = 0; i < measurementDetail->RowCount(); i++)
+        {
+            ExpressionValueType resultValueType;
+
+            if (expressionTree->EvaluatePredicate(measurementDetail->Row(i), resultValueType))
+                referencePositions.push_back(i);
+        }
+
+        expressionTree->BeginEvaluation();
+        assert(BatchEvaluator(*expressionTree).TryGetMatchingPositions(positions));
+        assert(positions == referencePositions);
+    }
+
+    // Expressions that are not boolean are left to row evaluation
+    vector<int32_t> positions;
+    assert(!BatchEvaluator(*FilterExpressionParser::GenerateExpressionTree(measurementDetail, "PhasorSourceIndex + 1")).TryGetMatchingPositions(positions));
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 173 - test statements and large table scans evaluated on multiple threads match single thread evaluation
+    const DataSetPtr scanDataSet = NewSharedPtr<DataSet>();
+    const DataTablePtr scanTable = scanDataSet->CreateTable("Scan");
+
+    scanTable->AddColumn(scanTable->CreateColumn("SignalID", DataType::Guid));
+    scanTable->AddColumn(scanTable->CreateColumn("Name", DataType::String));
+    scanTable->AddColumn(scanTable->CreateColumn("Value", DataType::Double));
+    scanDataSet->AddOrUpdateTable(scanTable);
+
+    for (int32_t i = 0; i < FilterExpressionParser::MinimumPartitionRowCount * 4; i++)
+    {
+        const DataRowPtr row = scanTable->CreateRow();
+
+        row->SetGuidValue(0, NewGuid());
+
+        // Names that are not time intervals start in second partition
+        row->SetStringValue(1, i % 20000 == 19999 ? "X" + ToString(i) : ToString(i % 997));
+
+        if (i % 7 != 0)
+            row->SetDoubleValue(2, i % 13 / 2.0);
+
+        scanTable->AddRow(row);
+    }
+
+    const auto selectRows = [&](const string& filterExpression, const int32_t maxThreads)
+    {
+        string result;
+
+        try
+        {
+            const ExpressionTreePtr expressionTree = FilterExpressionParser::GenerateExpressionTrees(scanDataSet, "Scan", filterExpression)[0];
+
+            for (const DataRowPtr& row : FilterExpressionParser::Select(expressionTree, maxThreads))
+                result += ToString(scanTable->RowPosition(row)) + ",";
+        }
+        catch (const ExpressionTreeException& ex)
+        {
+            result = ex.what();
+        }
+
+        return result;
+    };
+
+    const string scanExpressions[] =
+    {
+        "FILTER Scan WHERE Len(Name) > 2",
+        "FILTER Scan WHERE Name LIKE '1%' ORDER BY Value DESC, Name",
+        "FILTER TOP 100 Scan WHERE Name LIKE '%5' ORDER BY Value, Name DESC",
+        "FILTER Scan WHERE Value > 2 AND Name LIKE '2%'",
+        "FILTER Scan WHERE IIf(Name LIKE 'X%', DateAdd(#2020-01-01#, 1, Name), #2020-01-01#) > #2020-01-01#"
+    };
+
+    for (const string& scanExpression : scanExpressions)
+    {
+        const string result = selectRows(scanExpression, 1);
+        assert(!result.empty() && result == selectRows(scanExpression, 4));
+    }
+
+    // First error in scan order is reported
+    assert(selectRows(scanExpressions[4], 4) == "Time interval \"X19999\" is not recognized");
+
+    vector<DataRowPtr> filteredRows;
+    vector<GSF::Guid> filteredSignalIDs;
+
+    for (const int32_t maxThreads : { 1, 4 })
+    {
+        parser = NewSharedPtr<FilterExpressionParser>("FILTER Scan WHERE Name LIKE '1%'; FILTER TOP 10 Scan WHERE Len(Name) = 1 ORDER BY Value DESC; FILTER Scan WHERE Value > 5");
+        parser->SetDataSet(scanDataSet);
+        parser->SetTableIDFields("Scan", FilterExpressionParser::DefaultTableIDFields);
+        parser->SetPrimaryTableName("Scan");
+        parser->SetTrackFilteredSignalIDs(true);
+        parser->SetMaxThreads(maxThreads);
+        Evaluate(parser);
+
+        if (maxThreads == 1)
+        {
+            filteredRows = parser->FilteredRows();
+            filteredSignalIDs = parser->FilteredSignalIDs();
+        }
+    }
+
+    assert(!filteredRows.empty() && parser->FilteredRows() == filteredRows);
+    assert(parser->FilteredSignalIDs() == filteredSignalIDs);
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 174 - test storage of rows that are never added to table is reused by new rows
+    DataSetPtr slotDataSet = NewSharedPtr<DataSet>();
+    DataTablePtr slotTable = slotDataSet->CreateTable("Slots");
+    slotTable->AddColumn(slotTable->CreateColumn("Value", DataType::Int32));
+    slotTable->AddColumn(slotTable->CreateColumn("Name", DataType::String));
+    slotDataSet->AddOrUpdateTable(slotTable);
+
+    for (int32_t i = 0; i < 2; i++)
+    {
+        DataRowPtr slotRow = slotTable->CreateRow();
+        slotRow->SetInt32Value(0, i);
+        slotRow->SetStringValue(1, "Row" + ToString(i));
+        slotTable->AddRow(slotRow);
+    }
+
+    const TypedDataColumnStorage<int32_t>* slotStorage = static_cast<const TypedDataColumnStorage<int32_t>*>(slotTable->ColumnStorage(slotTable->ColumnHandle("Value")));
+
+    for (int32_t i = 0; i < 100; i++)
+    {
+        DataRowPtr discardedRow = slotTable->CreateRow();
+        discardedRow->SetInt32Value(0, 100 + i);
+        discardedRow->SetStringValue(1, string("Discarded"));
+    }
+
+    assert(slotStorage->Count() == 3);
+
+    DataRowPtr reusedRow = slotTable->CreateRow();
+    assert(slotStorage->Count() == 3);
+    assert(!reusedRow->ValueAsInt32(0).HasValue() && !reusedRow->ValueAsString(1).HasValue());
+    assert(slotTable->RowPosition(reusedRow) == -1);
+
+    reusedRow->SetInt32Value(0, 2);
+    slotTable->AddRow(reusedRow);
+
+    vector<int32_t> rowSlots;
+    slotTable->GetRowSlots(rowSlots);
+    assert(slotTable->RowCount() == 3 && rowSlots.size() == 3);
+
+    for (int32_t i = 0; i < slotTable->RowCount(); i++)
+        assert(slotTable->Row(i)->ValueAsInt32(0).GetValueOrDefault() == i && slotStorage->GetValue(rowSlots[i]) == i);
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 175 - test computed columns, materialized or not, evaluated on multiple threads match single thread evaluation
+    const DataSetPtr computedDataSet = NewSharedPtr<DataSet>();
+    const DataTablePtr computedTable = computedDataSet->CreateTable("Computed");
+
+    computedTable->AddColumn(computedTable->CreateColumn("Value", DataType::Int32));
+    computedTable->AddColumn(computedTable->CreateColumn("Name", DataType::String));
+    computedTable->AddColumn(computedTable->CreateColumn("Doubled", DataType::Int32, "Value * 2"));
+    computedTable->AddColumn(computedTable->CreateColumn("Label", DataType::String, "Name + '-' + Doubled"));
+    computedDataSet->AddOrUpdateTable(computedTable);
+
+    // Values of rows added after column is materialized are computed on first read, i.e., by scan threads
+    computedTable->MaterializeColumn("Label");
+
+    for (int32_t i = 0; i < FilterExpressionParser::MinimumPartitionRowCount * 4; i++)
+    {
+        const DataRowPtr row = computedTable->CreateRow();
+        row->SetInt32Value(0, i);
+        row->SetStringValue(1, ToString(i % 97));
+        computedTable->AddRow(row);
+    }
+
+    const auto selectComputedRows = [&](const string& filterExpression, const int32_t maxThreads)
+    {
+        string result;
+
+        for (const DataRowPtr& row : FilterExpressionParser::Select(FilterExpressionParser::GenerateExpressionTrees(computedDataSet, "Computed", filterExpression)[0], maxThreads))
+            result += ToString(computedTable->RowPosition(row)) + ",";
+
+        return result;
+    };
+
+    const string computedExpressions[] =
+    {
+        "FILTER Computed WHERE Doubled % 3 = 0",
+        "FILTER Computed WHERE Label LIKE '1%' ORDER BY Label",
+        "FILTER Computed WHERE Len(Label) > 6 AND Doubled > 1000"
+    };
+
+    for (const string& computedExpression : computedExpressions)
+    {
+        const string result = selectComputedRows(computedExpression, 4);
+        assert(!result.empty() && result == selectComputedRows(computedExpression, 1));
+    }
+
+    for (int32_t i = 0; i < computedTable->RowCount(); i++)
+    {
+        const DataRowPtr& row = computedTable->Row(i);
+        assert(row->ValueAsInt32("Doubled").GetValueOrDefault() == i * 2);
+        assert(row->ValueAsString("Label").GetValueOrDefault() == ToString(i % 97) + "-" + ToString(i * 2));
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 176 - test optimized AND and OR operations with constant operands match unoptimized evaluation for rows with Null values
+    const DataRowPtr nullRow = dataRow->Parent()->CreateRow();
+
+    const string logicalOperands[] =
+    {
+        "AccessID > 0",
+        "AccessID IS NULL",
+        "AccessID IS NOT NULL",
+        "NOT (AccessID IS NULL)",
+        "AccessID IS NULL AND Acronym IS NOT NULL",
+        "AccessID IS NULL OR AccessID > 0",
+        "Acronym LIKE 'B%'",
+        "ComputedCol IS NULL",
+        "IsNull(AccessID, 0) = 0",
+        "Convert('x', 'System.Int32') > 1",
+        "Convert('x', 'System.Int32') IS NULL",
+        "Convert(AccessID, 'System.Guid') IS NULL"
+    };
+
+    const ValueExpressionPtr logicalConstants[] = { ExpressionTree::True, ExpressionTree::False, ExpressionTree::NullValue(ExpressionValueType::Boolean), ExpressionTree::NullValue(ExpressionValueType::Undefined) };
+
+    const auto evaluateTree = [](const ExpressionTreePtr& tree, const DataRowPtr& row)
+    {
+        string result;
+
+        try
+        {
+            const ValueExpressionPtr value = tree->EvaluateReference(row);
+            result = string(EnumName(value->ValueType)) + ":" + (value->IsNull() ? "Null" : value->ToString());
+
+            const ValueExpressionPtr compiledValue = tree->Evaluate(row);
+            assert(compiledValue->ValueType == value->ValueType && compiledValue->IsNull() == value->IsNull());
+            assert(value->IsNull() || compiledValue->ToString() == value->ToString());
+        }
+        catch (const ExpressionTreeException& ex)
+        {
+            result = ex.what();
+        }
+        catch (const std::exception& ex)
+        {
+            // Failed conversions, e.g., Convert('x', 'System.Int32'), raise standard exceptions
+            result = ex.what();
+        }
+
+        return result;
+    };
+
+    for (const string& logicalOperand : logicalOperands)
+    {
+        const ExpressionPtr operand = FilterExpressionParser::GenerateExpressionTree(dataRow->Parent(), logicalOperand)->Root;
+
+        for (const ValueExpressionPtr& logicalConstant : logicalConstants)
+        {
+            for (const ExpressionOperatorType operatorType : { ExpressionOperatorType::And, ExpressionOperatorType::Or })
+            {
+                for (const bool constantOnLeft : { true, false })
+                {
+                    const ExpressionTreePtr unoptimizedTree = NewSharedPtr<ExpressionTree>(dataRow->Parent());
+
+                    if (constantOnLeft)
+                        unoptimizedTree->Root = NewSharedPtr<OperatorExpression>(operatorType, logicalConstant, operand);
+                    else
+                        unoptimizedTree->Root = NewSharedPtr<OperatorExpression>(operatorType, operand, logicalConstant);
+
+                    const ExpressionTreePtr optimizedTree = unoptimizedTree->Clone();
+                    optimizedTree->Optimize();
+
+                    for (const DataRowPtr& row : { nullRow, dataRow })
+                        assert(evaluateTree(optimizedTree, row) == evaluateTree(unoptimizedTree, row));
+                }
+            }
+        }
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 177 - test compiled evaluation of Evaluate test case expressions matches expression tree evaluation, for all rows
+    const string evaluateExpressions[] =
+    {
+        "AccessID % 2 = 0 AND FramesPerSecond % 4 <> 2 OR AccessID % 1 = 0",
+        "AccessID % 2 = 0 AND (FramesPerSecond % 4 <> 2 OR -AccessID % 1 = 0)",
+        "AccessID % 2 = 0 AND (FramesPerSecond % 4 <> 2 AND AccessID % 1 = 0)",
+        "AccessID % 2 >= 0 || (FramesPerSecond % 4 <> 2 AND AccessID % 1 = 0)",
+        "AccessID % 2 = 0 OR FramesPerSecond % 4 != 2 && AccessID % 1 == 0",
+        "!AccessID % 2 = 0 || FramesPerSecond % 4 = 0x2 && AccessID % 1 == 0",
+        "NOT AccessID % 2 = 0 OR FramesPerSecond % 4 >> 0x1 = 1 && AccessID % 1 == 0x0",
+        "!AccessID % 2 = 0 OR FramesPerSecond % 4 >> 1 = 1 && AccessID % 3 << 1 & 4 >= 4",
+        "OriginalSource IS NULL",
+        "ParentAcronym IS NOT NULL",
+        "NOT ParentAcronym IS NULL && Len(parentAcronym) == 0",
+        "-FramesPerSecond",
+        "~FramesPerSecond",
+        "~FramesPerSecond * -1 - 1 << -2",
+        "NOT True",
+        "!True",
+        "~True",
+        "Len(IsNull(OriginalSource, 'A')) = 1",
+        "RegExMatch('SH', Acronym)",
+        "RegExMatch('SH', Name)",
+        "RegExMatch('S[hH]', Name) && RegExMatch('S[hH]', Acronym)",
+        "RegExVal('Sh\\w+', Name)",
+        "SubStr(RegExVal('Sh\\w+', Name), 2) == 'ElbY'",
+        "SubStr(RegExVal('Sh\\w+', Name), 3, 2) == 'lB'",
+        "RegExVal('Sh\\w+', Name) IN ('NT', Acronym, 'NT')",
+        "RegExVal('Sh\\w+', Name) IN ===('NT', Acronym, 'NT')",
+        "RegExVal('Sh\\w+', Name) IN BINARY ('NT', Acronym, 3.05)",
+        "Name IN===(0x9F, Acronym, 'Shelby')",
+        "Acronym LIKE === 'Sh*'",
+        "name LiKe binaRY 'SH%'",
+        "Name === 'Shelby' && Name== 'SHelBy' && Name !=='SHelBy'",
+        "#2019-02-04T03:00:52.73-05:00#",
+        "#2019-2-4T3:00:52.73-05:00#",
+        "DatePart(#02/04/2019T03:00:52.73-05:00#, 'Year')",
+        "DatePart(#02/04/2019 03:00:52.73-05:00#, 'Month')",
+        "DatePart(#2019-02-04 03:00:52.73-05:00#, 'Day')",
+        "DatePart(#2019-02-04 3:00#, 'Hour')",
+        "DatePart(#2019-02-04 3:00:52.73-05:00#, 'Hour')",
+        "DatePart(#2/4/2019 3:21:55#, 'Minute')",
+        "DatePart(#02/04/2019 03:21:55.33#, 'Second')",
+        "DatePart(#02/04/2019 3:21:5.033#, 'Millisecond')",
+        "DatePart(DateAdd('2019-02-04 03:00:52.73-05:00', 1, 'Year'), 'year')",
+        "DateAdd('2019-02-04', 2, 'Month')",
+        "DateAdd(#1/31/2019#, 1, 'Day')",
+        "DateAdd(#2019-01-31#, 2, 'Week')",
+        "DateAdd(#2019-01-31#, 25, 'Hour')",
+        "DateAdd(#2018-12-31 23:58#, 3, 'Minute')",
+        "DateAdd('2019-01-1 00:59', 61, 'Second')",
+        "DateAdd('2019-01-1 00:00:59.999', 2, 'Millisecond')",
+        "DateAdd(#1/1/2019 0:0:1.029#, -FramesPerSecond, 'Millisecond')",
+        "DateDiff(#2006-01-01 00:00:00#, #2008-12-31 00:00:00#, 'Year')",
+        "DateDiff(#2006-01-01 00:00:00#, #2008-12-31 00:00:00#, 'month')",
+        "DateDiff(#2006-01-01 00:00:00#, #2008-12-31 00:00:00#, 'DAY')",
+        "DateDiff(#2006-01-01 00:00:00#, #2008-12-31 00:00:00#, 'Week')",
+        "DateDiff(#2006-01-01 00:00:00#, #2008-12-31 00:00:00#, 'WeekDay')",
+        "DateDiff(#2006-01-01 00:00:00#, #2008-12-31 00:00:00#, 'Hour')",
+        "DateDiff(#2006-01-01 00:00:00#, #2008-12-31 00:00:00#, 'Minute')",
+        "DateDiff(#2006-01-01 00:00:00#, #2008-12-31 00:00:00#, 'Second')",
+        "DateDiff(#2008-12-30 00:02:50.546#, '2008-12-31', 'Millisecond')",
+        "DatePart(#2019-02-04 03:00:52.73-05:00#, 'DayOfyear')",
+        "DatePart(#2019-02-04 03:00:52.73-05:00#, 'Week')",
+        "DatePart(#2019-02-04 03:00:52.73-05:00#, 'WeekDay')",
+        "IsDate(#2019-02-04 03:00:52.73-05:00#) AND IsDate('2/4/2019') ANd isdate(updatedon) && !ISDATE(2.5) && !IsDate('ImNotADate')",
+        "IsInteger(32768) AND IsInteger('1024') and ISinTegeR(FaLsE) And isinteger(accessid) && !ISINTEGER(2.5) && !IsInteger('ImNotAnInteger')",
+        "IsGuid({9448a8b5-35c1-4dc7-8c42-8712153ac08a}) AND IsGuid('9448a8b5-35c1-4dc7-8c42-8712153ac08a') anD isGuid(9448a8b5-35c1-4dc7-8c42-8712153ac08a) AND IsGuid(Convert(9448a8b5-35c1-4dc7-8c42-8712153ac08a, 'string')) aND isguid(nodeid) && !ISGUID(2.5) && !IsGuid('ImNotAGuid')",
+        "IsNumeric(32768) && isNumeric(123.456e-67) AND IsNumeric(3.14159265) and ISnumeric(true) AND IsNumeric('1024' ) and IsNumeric(2.5) aNd isnumeric(longitude) && !ISNUMERIC(9448a8b5-35c1-4dc7-8c42-8712153ac08a) && !IsNumeric('ImNotNumeric')",
+        "Convert(123, 'unknown')",
+        "AccessID ^ 2 + FramesPerSecond XOR 4",
+        "ComputedCol",
+        "aBs(-AccessiD xOR 2+ framespersecond^4 -6)"
+    };
+
+    const DataTablePtr& deviceDetail = dataRow->Parent();
+    vector<DataRowPtr> evaluateRows = { nullRow };
+
+    for (int32_t i = 0; i < deviceDetail->RowCount(); i++)
+        evaluateRows.push_back(deviceDetail->Row(i));
+
+    // Evaluate validates compiled evaluation result, or error, against expression tree evaluation
+    for (const string& evaluateExpression : evaluateExpressions)
+    {
+        for (const DataRowPtr& row : evaluateRows)
+        {
+            try
+            {
+                Evaluate(row, evaluateExpression, true);
+            }
+            catch (...)
+            {
+            }
+        }
+    }
+
+    Evaluate(dataSet->Table("SchemaVersion")->Row(0), "VersionNumber > 0");
+    Evaluate(dataRow, ToString(freqID));
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 178 - test string views remain valid while values of other rows in the column are assigned or computed
+    const DataSetPtr viewDataSet = NewSharedPtr<DataSet>();
+    const DataTablePtr viewTable = viewDataSet->CreateTable("Views");
+
+    viewTable->AddColumn(viewTable->CreateColumn("Name", DataType::String));
+    viewTable->AddColumn(viewTable->CreateColumn("Label", DataType::String, "Name + '-label'"));
+    viewDataSet->AddOrUpdateTable(viewTable);
+    viewTable->MaterializeColumn("Label");
+
+    for (int32_t i = 0; i < 1000; i++)
+    {
+        const DataRowPtr row = viewTable->CreateRow();
+        row->SetStringValue(0, "Name" + ToString(i));
+        viewTable->AddRow(row);
+    }
+
+    const DataColumnHandle nameHandle = viewTable->ColumnHandle("Name");
+    const DataColumnHandle labelHandle = viewTable->ColumnHandle("Label");
+    const string_view nameView = viewTable->Row(0)->GetStringValue(nameHandle);
+    const string_view labelView = viewTable->Row(0)->GetStringValue(labelHandle);
+    assert(nameView == "Name0" && labelView == "Name0-label");
+
+    // Replaced values and values larger than a storage chunk do not move characters of other rows
+    for (int32_t i = 1; i < viewTable->RowCount(); i++)
+        viewTable->Row(i)->SetStringValue(0, string(i % 10 == 0 ? 100000 : 100, 'x'));
+
+    vector<Thread> viewThreads;
+
+    for (int32_t i = 0; i < 4; i++)
+    {
+        viewThreads.emplace_back([&viewTable, &labelHandle, i]
+        {
+            for (int32_t j = 1 + i; j < viewTable->RowCount(); j += 4)
+                viewTable->Row(j)->GetStringValue(labelHandle);
+        });
+    }
+
+    for (Thread& viewThread : viewThreads)
+        viewThread.join();
+
+    assert(nameView == "Name0" && labelView == "Name0-label");
+    assert(viewTable->Row(10)->GetStringValue(labelHandle).size() == 100000 + 6);
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 179 - test range lookups with equal bounds, scanned and indexed, only match values when both bounds are inclusive
+    const DataSetPtr rangeDataSet = NewSharedPtr<DataSet>();
+    const DataTablePtr rangeTable = rangeDataSet->CreateTable("Ranges");
+
+    rangeTable->AddColumn(rangeTable->CreateColumn("Value", DataType::Int32));
+    rangeDataSet->AddOrUpdateTable(rangeTable);
+
+    for (const int32_t value : { 1, 2, 2, 3 })
+    {
+        const DataRowPtr row = rangeTable->CreateRow();
+        row->SetInt32Value(0, value);
+        rangeTable->AddRow(row);
+    }
+
+    const DataColumnHandle rangeHandle = rangeTable->ColumnHandle("Value");
+    const int32_t one = 1, two = 2, otherTwo = 2, three = 3;
+
+    for (int32_t i = 0; i < 3; i++)
+    {
+        if (i == 1)
+            rangeTable->CreateIndex("Value", DataColumnIndexType::Hash);
+        else if (i == 2)
+            rangeTable->CreateIndex("Value", DataColumnIndexType::Ordered);
+
+        assert(rangeTable->FindRowsInRange<int32_t>(rangeHandle, &two, false, &two, false).empty());
+        assert(rangeTable->FindRowsInRange<int32_t>(rangeHandle, &two, true, &two, false).empty());
+        assert(rangeTable->FindRowsInRange<int32_t>(rangeHandle, &two, false, &otherTwo, false).empty());
+        assert(rangeTable->FindRowsInRange<int32_t>(rangeHandle, &two, false, &otherTwo, true).empty());
+        assert(rangeTable->FindRowsInRange<int32_t>(rangeHandle, &three, true, &one, true).empty());
+        assert(rangeTable->FindRowsInRange<int32_t>(rangeHandle, &two, true, &two, true).size() == 2);
+        assert(rangeTable->FindRowsInRange<int32_t>(rangeHandle, &two, true, &otherTwo, true).size() == 2);
+        assert(rangeTable->FindRowsInRange<int32_t>(rangeHandle, &one, false, &three, false).size() == 2);
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 180 - test rows can only be added once to the table that created them, rows of other tables are added as clones
+    const DataTablePtr otherRangeTable = rangeDataSet->CreateTable("OtherRanges");
+    otherRangeTable->AddColumn(otherRangeTable->CreateColumn("Value", DataType::Int32));
+    rangeDataSet->AddOrUpdateTable(otherRangeTable);
+
+    const auto addRowFails = [](const DataTablePtr& table, const DataRowPtr& row)
+    {
+        try
+        {
+            table->AddRow(row);
+        }
+        catch (const DataSetException&)
+        {
+            return true;
+        }
+
+        return false;
+    };
+
+    assert(addRowFails(otherRangeTable, nullptr));
+    assert(addRowFails(otherRangeTable, rangeTable->Row(0)));
+    assert(addRowFails(rangeTable, rangeTable->Row(0)));
+    assert(otherRangeTable->RowCount() == 0 && rangeTable->RowCount() == 4);
+
+    const DataRowPtr clonedRow = otherRangeTable->CloneRow(rangeTable->Row(3));
+    otherRangeTable->AddRow(clonedRow);
+
+    assert(otherRangeTable->RowCount() == 1 && otherRangeTable->RowPosition(clonedRow) == 0);
+    assert(otherRangeTable->Row(0)->ValueAsInt32(0).GetValueOrDefault() == 3);
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
     // Wait until the user presses enter before quitting.
     cout << endl << "Tests complete. Press enter to exit." << endl;
     string line;
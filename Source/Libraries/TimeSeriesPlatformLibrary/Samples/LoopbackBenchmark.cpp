@@ -0,0 +1,447 @@
+//******************************************************************************************************
+//  LoopbackBenchmark.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "../Common/CommonTypes.h"
+#include "../Common/Convert.h"
+#include "../Transport/DataPublisher.h"
+#include "../Transport/DataSubscriber.h"
+#include "../Transport/SubscriberInstance.h"
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <fstream>
+#endif
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// Published values carry send time, in microseconds, modulo a period that
+// fits within the 24-bit mantissa of the 32-bit values sent on the wire
+static const int64_t LatencyPeriod = 10000000LL;
+static const int32_t WarmupSeconds = 2;
+static const chrono::steady_clock::time_point StartTime = chrono::steady_clock::now();
+
+struct BenchmarkSettings
+{
+    int32_t Subscribers = 4;
+    int32_t Signals = 1000;
+    int32_t FramesPerSecond = 30;
+    int32_t Seconds = 10;
+    uint16_t Port = 7165;
+    bool UdpDataChannel = false;
+    bool PayloadCompression = false;
+    bool Throttled = false;
+};
+
+struct BenchmarkSubscriber
+{
+    DataSubscriberPtr Subscriber;
+    atomic<uint64_t> MeasurementsReceived { 0ULL };
+    atomic<bool> Recording { false };
+    vector<int64_t> Latencies;
+};
+
+typedef SharedPtr<BenchmarkSubscriber> BenchmarkSubscriberPtr;
+
+// CPU time, in seconds, consumed by each thread of the process keyed by thread ID
+typedef map<string, float64_t> ThreadTimes;
+
+bool ParseSettings(int argc, char* argv[], BenchmarkSettings& settings, bool& runAll);
+void RunBenchmark(const BenchmarkSettings& settings);
+void ProcessMeasurements(DataSubscriber* source, const vector<MeasurementPtr>& measurements);
+void DisplayErrorMessage(DataSubscriber* source, const string& message);
+int64_t GetElapsedMicroseconds();
+ThreadTimes GetThreadTimes();
+int64_t GetPeakResidentSetSize();
+
+// Benchmark application to measure sustained throughput and latency of the publisher.
+//
+// This application starts a DataPublisher and a number of DataSubscriber instances in the same
+// process, connected over the loopback interface. A synthetic load of signals is published at a
+// fixed frame rate, each value carrying its send time so that subscribers can measure end-to-end
+// latency. After a warm-up period, the application reports received measurements per second,
+// latency percentiles, CPU time of each busy thread and peak resident memory of the process.
+int main(int argc, char* argv[])
+{
+    BenchmarkSettings settings;
+    bool runAll;
+
+    if (!ParseSettings(argc, argv, settings, runAll))
+    {
+        cout << "Usage:" << endl;
+        cout << "    LoopbackBenchmark [options]" << endl << endl;
+        cout << "Options:" << endl;
+        cout << "    -subscribers N   Number of subscribers, defaults to 4" << endl;
+        cout << "    -signals N       Number of published signals, defaults to 1000" << endl;
+        cout << "    -rate N          Published frames per second, defaults to 30" << endl;
+        cout << "    -seconds N       Measured duration after warm-up, defaults to 10" << endl;
+        cout << "    -port N          First publisher port, defaults to 7165" << endl;
+        cout << "    -udp             Use UDP data channel" << endl;
+        cout << "    -tssc            Use TSSC payload compression instead of compact format" << endl;
+        cout << "    -throttled       Use throttled subscriptions with a 0.1 second publish interval" << endl;
+        cout << "    -all             Run all data channel, compression and throttling combinations" << endl;
+        return 0;
+    }
+
+    if (runAll)
+    {
+        // Each run uses its own ports since publishers keep listening for the life of the process
+        for (int32_t i = 0; i < 8; i++)
+        {
+            BenchmarkSettings runSettings = settings;
+
+            runSettings.UdpDataChannel = (i & 1) != 0;
+            runSettings.PayloadCompression = (i & 2) != 0;
+            runSettings.Throttled = (i & 4) != 0;
+            runSettings.Port = static_cast<uint16_t>(settings.Port + i * (settings.Subscribers + 1));
+
+            RunBenchmark(runSettings);
+        }
+    }
+    else
+    {
+        RunBenchmark(settings);
+    }
+
+    return 0;
+}
+
+bool ParseSettings(int argc, char* argv[], BenchmarkSettings& settings, bool& runAll)
+{
+    runAll = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const string option = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (option == "-subscribers" && hasValue)
+            settings.Subscribers = max(1, stoi(argv[++i]));
+        else if (option == "-signals" && hasValue)
+            settings.Signals = max(1, stoi(argv[++i]));
+        else if (option == "-rate" && hasValue)
+            settings.FramesPerSecond = max(1, stoi(argv[++i]));
+        else if (option == "-seconds" && hasValue)
+            settings.Seconds = max(1, stoi(argv[++i]));
+        else if (option == "-port" && hasValue)
+            settings.Port = static_cast<uint16_t>(stoi(argv[++i]));
+        else if (option == "-udp")
+            settings.UdpDataChannel = true;
+        else if (option == "-tssc")
+            settings.PayloadCompression = true;
+        else if (option == "-throttled")
+            settings.Throttled = true;
+        else if (option == "-all")
+            runAll = true;
+        else
+            return false;
+    }
+
+    return true;
+}
+
+void RunBenchmark(const BenchmarkSettings& settings)
+{
+    cout << "Benchmark: " << settings.Subscribers << " subscribers, " << settings.Signals << " signals at " << settings.FramesPerSecond << " frames per second, ";
+    cout << (settings.UdpDataChannel ? "UDP" : "TCP") << ", " << (settings.PayloadCompression ? "TSSC" : "compact") << ", " << (settings.Throttled ? "throttled" : "unthrottled") << endl;
+
+    // Define publisher metadata for synthetic signals
+    DataPublisherPtr publisher = NewSharedPtr<DataPublisher>(settings.Port);
+    vector<DeviceMetadataPtr> deviceMetadata;
+    vector<MeasurementMetadataPtr> measurementMetadata;
+    vector<PhasorMetadataPtr> phasorMetadata;
+    vector<MeasurementRecord> measurements(settings.Signals);
+    const datetime_t updatedOn = UtcNow();
+
+    for (int32_t i = 0; i < settings.Signals; i++)
+    {
+        MeasurementMetadataPtr metadata = NewSharedPtr<MeasurementMetadata>();
+
+        metadata->DeviceAcronym = "BENCHMARK";
+        metadata->ID = "BENCH:" + ToString(i + 1);
+        metadata->SignalID = NewGuid();
+        metadata->PointTag = "BENCHMARK:VALUE" + ToString(i + 1);
+        metadata->Reference = SignalReference("BENCHMARK-AV" + ToString(i + 1));
+        metadata->PhasorSourceIndex = 0;
+        metadata->UpdatedOn = updatedOn;
+
+        measurementMetadata.push_back(metadata);
+        measurements[i].SignalHandle = publisher->GetSignalHandle(metadata->SignalID);
+    }
+
+    publisher->DefineMetadata(deviceMetadata, measurementMetadata, phasorMetadata);
+
+    // Connect and subscribe all subscribers
+    vector<BenchmarkSubscriberPtr> subscribers;
+
+    for (int32_t i = 0; i < settings.Subscribers; i++)
+    {
+        BenchmarkSubscriberPtr subscriber = NewSharedPtr<BenchmarkSubscriber>();
+        SubscriptionInfo info;
+
+        subscriber->Subscriber = NewSharedPtr<DataSubscriber>();
+        subscriber->Subscriber->SetUserData(subscriber.get());
+        subscriber->Subscriber->SetPayloadDataCompressed(settings.PayloadCompression);
+        subscriber->Subscriber->RegisterNewMeasurementsCallback(&ProcessMeasurements);
+        subscriber->Subscriber->RegisterErrorMessageCallback(&DisplayErrorMessage);
+
+        info.FilterExpression = SubscriberInstance::SubscribeAllNoStatsExpression;
+        info.Throttled = settings.Throttled;
+        info.PublishInterval = 0.1;
+        info.UdpDataChannel = settings.UdpDataChannel;
+        info.DataChannelLocalPort = static_cast<uint16_t>(settings.Port + 1 + i);
+
+        try
+        {
+            subscriber->Subscriber->Connect("localhost", settings.Port);
+            subscriber->Subscriber->Subscribe(info);
+        }
+        catch (...)
+        {
+            cerr << "    Failed to connect subscriber " << i + 1 << ": " << boost::current_exception_diagnostic_information(true) << endl;
+            continue;
+        }
+
+        subscribers.push_back(subscriber);
+    }
+
+    // Drive synthetic load on a dedicated thread
+    atomic<bool> publishing { true };
+    atomic<uint64_t> measurementsPublished { 0ULL };
+    atomic<uint64_t> framesMissed { 0ULL };
+
+    Thread publishThread([&]
+    {
+        const chrono::microseconds frameInterval(1000000 / settings.FramesPerSecond);
+        chrono::steady_clock::time_point nextFrameTime = chrono::steady_clock::now();
+
+        while (publishing)
+        {
+            const int64_t timestamp = ToTicks(UtcNow());
+            const float64_t value = static_cast<float64_t>(GetElapsedMicroseconds() % LatencyPeriod);
+
+            for (auto& measurement : measurements)
+            {
+                measurement.Timestamp = timestamp;
+                measurement.Value = value;
+            }
+
+            publisher->PublishMeasurements(measurements);
+            measurementsPublished += measurements.size();
+
+            nextFrameTime += frameInterval;
+            const chrono::steady_clock::time_point now = chrono::steady_clock::now();
+
+            // When publisher cannot keep up, skip frames rather than publishing a burst
+            if (now > nextFrameTime + frameInterval)
+            {
+                framesMissed += (now - nextFrameTime) / frameInterval;
+                nextFrameTime = now;
+            }
+            else
+            {
+                this_thread::sleep_until(nextFrameTime);
+            }
+        }
+    });
+
+    this_thread::sleep_for(chrono::seconds(WarmupSeconds));
+
+    // Start measurement window
+    const ThreadTimes startThreadTimes = GetThreadTimes();
+    const uint64_t startPublished = measurementsPublished;
+    const uint64_t startMissed = framesMissed;
+
+    for (auto& subscriber : subscribers)
+    {
+        subscriber->MeasurementsReceived = 0ULL;
+        subscriber->Recording = true;
+    }
+
+    const chrono::steady_clock::time_point windowStartTime = chrono::steady_clock::now();
+    this_thread::sleep_for(chrono::seconds(settings.Seconds));
+
+    for (auto& subscriber : subscribers)
+        subscriber->Recording = false;
+
+    const float64_t windowSeconds = chrono::duration<float64_t>(chrono::steady_clock::now() - windowStartTime).count();
+    const ThreadTimes stopThreadTimes = GetThreadTimes();
+    const uint64_t published = measurementsPublished - startPublished;
+    const uint64_t missed = framesMissed - startMissed;
+
+    publishing = false;
+    publishThread.join();
+
+    // Disconnect before reading latencies so callbacks no longer update them
+    uint64_t received = 0ULL;
+    vector<int64_t> latencies;
+
+    for (auto& subscriber : subscribers)
+    {
+        subscriber->Subscriber->Disconnect();
+        received += subscriber->MeasurementsReceived;
+        latencies.insert(latencies.end(), subscriber->Latencies.begin(), subscriber->Latencies.end());
+    }
+
+    sort(latencies.begin(), latencies.end());
+
+    const auto percentile = [&latencies](const float64_t value) -> float64_t
+    {
+        if (latencies.empty())
+            return 0.0;
+
+        const size_t index = min(latencies.size() - 1, static_cast<size_t>(value * static_cast<float64_t>(latencies.size())));
+        return static_cast<float64_t>(latencies[index]) / 1000.0;
+    };
+
+    cout << fixed << setprecision(2);
+    cout << "    Published:         " << published / windowSeconds << " measurements/s (" << missed << " frames missed)" << endl;
+    cout << "    Received:          " << received / windowSeconds << " measurements/s total, " << received / windowSeconds / max<size_t>(subscribers.size(), 1) << " per subscriber" << endl;
+    cout << "    Latency (ms):      p50 " << percentile(0.50) << ", p90 " << percentile(0.90) << ", p99 " << percentile(0.99) << ", max " << percentile(1.0) << " (" << latencies.size() << " packets)" << endl;
+    cout << "    Thread CPU (s):   ";
+
+    // Only report threads that were busy during measurement window
+    vector<pair<float64_t, string>> busyThreads;
+
+    for (const auto& stopThreadTime : stopThreadTimes)
+    {
+        float64_t startTime = 0.0;
+        TryGetValue(startThreadTimes, stopThreadTime.first, startTime, 0.0);
+
+        const float64_t cpuTime = stopThreadTime.second - startTime;
+
+        if (cpuTime >= 0.01)
+            busyThreads.emplace_back(cpuTime, stopThreadTime.first);
+    }
+
+    sort(busyThreads.rbegin(), busyThreads.rend());
+
+    if (busyThreads.empty())
+        cout << " not available";
+
+    for (const auto& busyThread : busyThreads)
+        cout << " " << busyThread.second << "=" << busyThread.first;
+
+    cout << endl;
+    cout << "    Peak RSS:          " << GetPeakResidentSetSize() / 1024 << " MB" << endl << endl;
+    cout.unsetf(ios::fixed);
+}
+
+void ProcessMeasurements(DataSubscriber* source, const vector<MeasurementPtr>& measurements)
+{
+    BenchmarkSubscriber& subscriber = *static_cast<BenchmarkSubscriber*>(source->GetUserData());
+
+    if (!subscriber.Recording || measurements.empty())
+        return;
+
+    // All measurements in a frame share a send time, so latency is sampled once per received packet
+    const int64_t sendTime = static_cast<int64_t>(measurements[0]->Value);
+    const int64_t latency = (GetElapsedMicroseconds() % LatencyPeriod - sendTime + LatencyPeriod) % LatencyPeriod;
+
+    subscriber.MeasurementsReceived += measurements.size();
+    subscriber.Latencies.push_back(latency);
+}
+
+void DisplayErrorMessage(DataSubscriber* source, const string& message)
+{
+    cerr << "    " << message << endl;
+}
+
+int64_t GetElapsedMicroseconds()
+{
+    return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - StartTime).count();
+}
+
+ThreadTimes GetThreadTimes()
+{
+    ThreadTimes threadTimes;
+
+#ifndef _WIN32
+    // User and system time of each thread is available from the process task list
+    const float64_t ticksPerSecond = static_cast<float64_t>(sysconf(_SC_CLK_TCK));
+    DIR* taskDirectory = opendir("/proc/self/task");
+
+    if (taskDirectory == nullptr)
+        return threadTimes;
+
+    while (const dirent* entry = readdir(taskDirectory))
+    {
+        const string threadID = entry->d_name;
+
+        if (threadID == "." || threadID == "..")
+            continue;
+
+        ifstream statStream("/proc/self/task/" + threadID + "/stat");
+        string stat;
+
+        if (!getline(statStream, stat))
+            continue;
+
+        // Fields following the parenthesized command name start with state, utime and stime are fields 14 and 15
+        const size_t fieldsStart = stat.rfind(')');
+
+        if (fieldsStart == string::npos)
+            continue;
+
+        stringstream fields(stat.substr(fieldsStart + 2));
+        string field;
+        uint64_t userTime = 0ULL, systemTime = 0ULL;
+
+        for (int32_t i = 3; i <= 15 && fields >> field; i++)
+        {
+            if (i == 14)
+                userTime = stoull(field);
+            else if (i == 15)
+                systemTime = stoull(field);
+        }
+
+        threadTimes[threadID] = static_cast<float64_t>(userTime + systemTime) / ticksPerSecond;
+    }
+
+    closedir(taskDirectory);
+#endif
+
+    return threadTimes;
+}
+
+int64_t GetPeakResidentSetSize()
+{
+#ifndef _WIN32
+    rusage usage {};
+
+    // Maximum resident set size is reported in kilobytes
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return usage.ru_maxrss;
+#endif
+
+    return 0LL;
+}
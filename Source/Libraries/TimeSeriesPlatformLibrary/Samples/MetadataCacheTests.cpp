@@ -0,0 +1,282 @@
+//******************************************************************************************************
+//  MetadataCacheTests.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <iterator>
+#include <boost/filesystem.hpp>
+#include "../Transport/SubscriberInstance.h"
+#include "../Transport/MetadataDelta.h"
+#include "../Data/DataSet.h"
+
+using namespace std;
+using namespace boost::filesystem;
+using namespace GSF;
+using namespace GSF::Data;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// Subscriber instance that exposes meta-data cache operations without connecting to a publisher
+class CacheSubscriber : public SubscriberInstance // NOLINT
+{
+public:
+    int32_t ErrorCount = 0;
+
+    CacheSubscriber(const string& hostname, const uint16_t port, const string& cachePath)
+    {
+        Initialize(hostname, port);
+        SetMetadataCachePath(cachePath);
+        SetMetadataCompressed(false);
+    }
+
+    // Simulates receipt of full versioned meta-data from publisher, which saves cache
+    void ReceiveMetadata(const vector<uint8_t>& payload)
+    {
+        ReceivedMetadata(payload);
+    }
+
+    bool LoadCache()
+    {
+        // Cache load is expected to report failures but never throw
+        try
+        {
+            return LoadMetadataCache();
+        }
+        catch (...)
+        {
+            cerr << "Unexpected exception: " << boost::current_exception_diagnostic_information(true) << endl;
+            assert(false);
+            return false;
+        }
+    }
+
+    int32_t MeasurementCount()
+    {
+        int32_t count = 0;
+        IterateMeasurementMetadata([&count](const MeasurementMetadataPtr&, void*) { count++; }, nullptr);
+        return count;
+    }
+
+protected:
+    void StatusMessage(const string&) override
+    {
+    }
+
+    void ErrorMessage(const string& message) override
+    {
+        cout << "    Expected error: " << message << endl;
+        ErrorCount++;
+    }
+};
+
+static vector<uint8_t> ReadFile(const string& fileName)
+{
+    std::ifstream stream(fileName, ios::binary);
+    return vector<uint8_t>((istreambuf_iterator<char>(stream)), istreambuf_iterator<char>());
+}
+
+static void WriteFile(const string& fileName, const vector<uint8_t>& buffer)
+{
+    std::ofstream stream(fileName, ios::binary | ios::trunc);
+    stream.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+}
+
+// Sample application to test the subscriber meta-data cache.
+int main(int argc, char* argv[])
+{
+    cout << "Current path: " << current_path() << endl << endl;
+
+    const string cachePath = (temp_directory_path() / unique_path("MetadataCache-%%%%-%%%%.bin")).string();
+    const string testPath = cachePath + ".test";
+    const DataSetPtr metadata = DataSet::FromXml(string("MetadataSample1.xml"));
+    const int32_t expectedCount = metadata->Table("MeasurementDetail")->RowCount();
+    int32_t test = 0;
+
+    VersionedMetadata versionedMetadata;
+    versionedMetadata.HistoryID = NewGuid();
+    versionedMetadata.Version = 3U;
+    versionedMetadata.Metadata = metadata;
+
+    vector<uint8_t> payload;
+    versionedMetadata.Write(payload);
+
+    // Test 1: receiving full meta-data saves cache for publisher
+    {
+        CacheSubscriber subscriber("localhost", 7165, cachePath);
+        subscriber.ReceiveMetadata(payload);
+
+        assert(subscriber.ErrorCount == 0);
+        assert(exists(cachePath));
+        assert(!exists(cachePath + ".tmp"));
+        assert(subscriber.MeasurementCount() == expectedCount);
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 2: cache round-trips for same publisher
+    {
+        CacheSubscriber subscriber("localhost", 7165, cachePath);
+
+        assert(subscriber.LoadCache());
+        assert(subscriber.ErrorCount == 0);
+        assert(subscriber.MeasurementCount() == expectedCount);
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 3: host name comparison is not case sensitive
+    {
+        CacheSubscriber subscriber("LOCALHOST", 7165, cachePath);
+
+        assert(subscriber.LoadCache());
+        assert(subscriber.MeasurementCount() == expectedCount);
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 4: cache from another host is not used
+    {
+        CacheSubscriber subscriber("otherhost", 7165, cachePath);
+
+        assert(!subscriber.LoadCache());
+        assert(subscriber.ErrorCount == 0);
+        assert(subscriber.MeasurementCount() == 0);
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 5: cache from another port is not used
+    {
+        CacheSubscriber subscriber("localhost", 7166, cachePath);
+
+        assert(!subscriber.LoadCache());
+        assert(subscriber.ErrorCount == 0);
+        assert(subscriber.MeasurementCount() == 0);
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 6: missing cache is not an error
+    {
+        CacheSubscriber subscriber("localhost", 7165, testPath);
+
+        assert(!subscriber.LoadCache());
+        assert(subscriber.ErrorCount == 0);
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    const vector<uint8_t> cache = ReadFile(cachePath);
+
+    // Test 7: unsupported cache format version is rejected
+    {
+        vector<uint8_t> buffer = cache;
+        buffer[4]++;
+        WriteFile(testPath, buffer);
+
+        CacheSubscriber subscriber("localhost", 7165, testPath);
+
+        assert(!subscriber.LoadCache());
+        assert(subscriber.ErrorCount == 1);
+        assert(subscriber.MeasurementCount() == 0);
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 8: invalid cache signature is rejected
+    {
+        vector<uint8_t> buffer = cache;
+        buffer[0] = 'X';
+        WriteFile(testPath, buffer);
+
+        CacheSubscriber subscriber("localhost", 7165, testPath);
+
+        assert(!subscriber.LoadCache());
+        assert(subscriber.ErrorCount == 1);
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 9: truncated caches, including an empty file, are rejected without loading any meta-data
+    {
+        const size_t step = max(cache.size() / 500, static_cast<size_t>(1));
+
+        for (size_t length = 0; length < cache.size(); length += (length < 64 ? 1 : step))
+        {
+            WriteFile(testPath, vector<uint8_t>(cache.begin(), cache.begin() + length));
+
+            CacheSubscriber subscriber("localhost", 7165, testPath);
+
+            assert(!subscriber.LoadCache());
+            assert(subscriber.ErrorCount == 1);
+            assert(subscriber.MeasurementCount() == 0);
+        }
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 10: corrupt versioned meta-data never throws, it is either rejected or loads when corruption only changes values
+    {
+        const size_t headerLength = 4 + 1 + 2 + string("localhost").size() + 2;
+        const size_t step = max((cache.size() - headerLength) / 500, static_cast<size_t>(1));
+
+        for (size_t offset = headerLength; offset < cache.size(); offset += step)
+        {
+            vector<uint8_t> buffer = cache;
+            buffer[offset] ^= 0xFF;
+            WriteFile(testPath, buffer);
+
+            CacheSubscriber subscriber("localhost", 7165, testPath);
+
+            if (!subscriber.LoadCache())
+                assert(subscriber.ErrorCount == 1 && subscriber.MeasurementCount() == 0);
+        }
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 11: cache that cannot be loaded leaves subscriber to request full meta-data, which then replaces cache
+    {
+        WriteFile(cachePath, vector<uint8_t>(cache.begin(), cache.begin() + cache.size() / 2));
+
+        CacheSubscriber subscriber("localhost", 7165, cachePath);
+
+        assert(!subscriber.LoadCache());
+        subscriber.ReceiveMetadata(payload);
+        assert(subscriber.MeasurementCount() == expectedCount);
+        assert(ReadFile(cachePath) == cache);
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    remove(cachePath);
+    remove(testPath);
+
+    // Wait until the user presses enter before quitting.
+    cout << endl << "Tests complete. Press enter to exit." << endl;
+    string line;
+    getline(cin, line);
+
+    return 0;
+}
@@ -34,6 +34,7 @@ using namespace GSF::FilterExpressions;
 DataPublisherPtr Publisher;
 TimerPtr PublishTimer;
 vector<MeasurementMetadataPtr> MeasurementsToPublish;
+vector<MeasurementRecord> Measurements;
 
 bool RunPublisher(uint16_t port);
 void DisplayClientConnected(DataPublisher* source, const SubscriberConnectionPtr& connection);
@@ -122,32 +123,27 @@ bool RunPublisher(uint16_t port)
 
         cout << "Loaded " << MeasurementsToPublish.size() << " measurement metadata records for publication." << endl << endl;
 
+        // Define reusable measurement records, identified by publisher assigned signal handles
+        Measurements.resize(MeasurementsToPublish.size());
+
+        for (size_t i = 0; i < MeasurementsToPublish.size(); i++)
+            Measurements[i].SignalHandle = Publisher->GetSignalHandle(MeasurementsToPublish[i]->SignalID);
+
         // Setup data publication timer - for this simple publishing sample we just
         // send random values every 33 milliseconds
         PublishTimer = NewSharedPtr<Timer>(33, [](Timer*, void*)
         {
-            // If metadata can change, the following integer should not be static:
-            static uint32_t count = ConvertUInt32(MeasurementsToPublish.size());
             const int64_t timestamp = ToTicks(UtcNow());
-            vector<MeasurementPtr> measurements;
-
-            measurements.reserve(count);
 
-            // Create new measurement values for publication
-            for (size_t i = 0; i < count; i++)
+            // Update measurement values for publication in place
+            for (auto& measurement : Measurements)
             {
-                const MeasurementMetadataPtr metadata = MeasurementsToPublish[i];
-                MeasurementPtr measurement = NewSharedPtr<Measurement>();
-
-                measurement->SignalID = metadata->SignalID;
-                measurement->Timestamp = timestamp;
-                measurement->Value = float64_t(rand());
-
-                measurements.push_back(measurement);
+                measurement.Timestamp = timestamp;
+                measurement.Value = float64_t(rand());
             }
 
             // Publish measurements
-            Publisher->PublishMeasurements(measurements);
+            Publisher->PublishMeasurements(Measurements);
         },
         true);
 
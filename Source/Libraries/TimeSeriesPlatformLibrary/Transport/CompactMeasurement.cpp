@@ -213,9 +213,15 @@ bool CompactMeasurement::TryParseMeasurement(uint8_t* data, uint32_t& offset, ui
 }
 
 uint32_t CompactMeasurement::SerializeMeasurement(const Measurement& measurement, vector<uint8_t>& buffer, const uint16_t runtimeID) const
+{
+    // Encode adjusted value (accounts for adder and multiplier)
+    return SerializeMeasurement(measurement.Timestamp, static_cast<float32_t>(measurement.AdjustedValue()), static_cast<uint32_t>(measurement.Flags), buffer, runtimeID);
+}
+
+uint32_t CompactMeasurement::SerializeMeasurement(const int64_t timestamp, const float32_t adjustedValue, const uint32_t flags, vector<uint8_t>& buffer, const uint16_t runtimeID) const
 {
     // Define the compact state flags
-    uint8_t compactFlags = MapToCompactFlags(static_cast<uint32_t>(measurement.Flags));
+    uint8_t compactFlags = MapToCompactFlags(flags);
 
     int64_t difference = 0L;
     bool usingBaseTimeOffset = false;
@@ -224,7 +230,7 @@ uint32_t CompactMeasurement::SerializeMeasurement(const Measurement& measurement
     {
         // See if timestamp will fit within space allowed for active base offset. We cache result so that post call
         // to binary length, result will speed other subsequent parsing operations by not having to reevaluate.
-        difference = measurement.Timestamp - m_baseTimeOffsets[m_timeIndex];
+        difference = timestamp - m_baseTimeOffsets[m_timeIndex];
         
         usingBaseTimeOffset = difference > 0 ? 
             (m_useMillisecondResolution ? difference / Ticks::PerMillisecond < UInt16::MaxValue : difference < UInt16::MaxValue) : false;
@@ -244,8 +250,8 @@ uint32_t CompactMeasurement::SerializeMeasurement(const Measurement& measurement
     // Encode runtime ID
     EndianConverter::WriteBigEndianBytes(buffer, runtimeID);
 
-    // Encode adjusted value (accounts for adder and multiplier)
-    EndianConverter::WriteBigEndianBytes(buffer, static_cast<float32_t>(measurement.AdjustedValue()));
+    // Encode adjusted value
+    EndianConverter::WriteBigEndianBytes(buffer, adjustedValue);
 
     if (!m_includeTime)
         return length;
@@ -266,7 +272,7 @@ uint32_t CompactMeasurement::SerializeMeasurement(const Measurement& measurement
     else
     {
         // Encode 8-byte full fidelity timestamp
-        EndianConverter::WriteBigEndianBytes(buffer, measurement.Timestamp);
+        EndianConverter::WriteBigEndianBytes(buffer, timestamp);
     }
 
     return length;
@@ -57,6 +57,9 @@ namespace Transport
 
         // Serializes a measurement into a buffer
         uint32_t SerializeMeasurement(const Measurement& measurement, std::vector<uint8_t>& buffer, uint16_t runtimeID) const;
+
+        // Serializes a measurement, specified by its component values, into a buffer
+        uint32_t SerializeMeasurement(int64_t timestamp, float32_t adjustedValue, uint32_t flags, std::vector<uint8_t>& buffer, uint16_t runtimeID) const;
     };
 }}}
 
@@ -246,6 +246,10 @@ namespace Transport
         static const uint32_t CompressionModeMask = 0x000000E0;
         // Mask to get character encoding used when exchanging messages between publisher and subscriber.
         static const uint32_t EncodingMask = 0x00000300;
+        // Mask to get implementation specific extension flags. Other implementations ignore these bits.
+        static const uint32_t ImplementationSpecificExtensionMask = 0x00FF0000;
+        // Determines whether metadata is exchanged using the binary data set format. Bit set = binary format, bit clear = XML format. Since this is an implementation specific extension, publishers that do not support it will still respond with XML.
+        static const uint32_t UseBinaryMetadataFormat = 0x00010000;
         // Determines type of serialization to use when exchanging signal index cache and metadata. Bit set = common serialization format, bit clear is deprecated.
         static const uint32_t UseCommonSerializationFormat = 0x01000000;
         // Determines whether external measurements are exchanged during metadata synchronization. Bit set = external measurements are exchanged, bit clear = no external measurements are exchanged.
@@ -24,9 +24,11 @@
 // ReSharper disable once CppUnusedIncludeDirective
 #include "../FilterExpressions/FilterExpressions.h"
 #include "DataPublisher.h"
+#include "../Common/Compression.h"
 #include "MetadataSchema.h"
 #include "ActiveMeasurementsSchema.h"
 #include "../FilterExpressions/FilterExpressionParser.h"
+#include <boost/uuid/name_generator_sha1.hpp>
 
 using namespace std;
 using namespace boost::asio::ip;
@@ -36,6 +38,12 @@ using namespace GSF::FilterExpressions;
 using namespace GSF::TimeSeries;
 using namespace GSF::TimeSeries::Transport;
 
+// Cache keys include client provided filter expressions, so number of cached responses is limited
+static const size_t MaxMetadataResponseCacheSize = 64;
+
+// Number of meta-data versions for which subscribers can receive deltas instead of full meta-data
+static const size_t MaxMetadataDeltaHistory = 16;
+
 struct UserCommandData
 {
     SubscriberConnection* connection;
@@ -45,6 +53,9 @@ struct UserCommandData
 
 DataPublisher::DataPublisher(const TcpEndPoint& endpoint) :
     m_nodeID(NewGuid()),
+    m_metadataVersion(0U),
+    m_metadataHistoryID(NewGuid()),
+    m_routingTables(m_metrics),
     m_securityMode(SecurityMode::None),
     m_maximumAllowedConnections(-1),
     m_isMetadataRefreshAllowed(true),
@@ -53,10 +64,35 @@ DataPublisher::DataPublisher(const TcpEndPoint& endpoint) :
     m_supportsTemporalSubscriptions(false),
     m_useBaseTimeOffsets(true),
     m_cipherKeyRotationPeriod(60000),
+    m_compressionLevel(DefaultCompressionLevel),
+    m_maxCompressionThreads(1),
     m_userData(nullptr),
     m_disposing(false),
-    m_clientAcceptor(m_commandChannelService, endpoint)
-{
+    m_totalMeasurementsPublished(m_metrics.GetCounter("MeasurementsPublished")),
+    m_totalConnectionsAccepted(m_metrics.GetCounter("ConnectionsAccepted")),
+    m_totalConnectionsRejected(m_metrics.GetCounter("ConnectionsRejected")),
+    m_metadataResponseCacheHits(m_metrics.GetCounter("MetadataResponseCacheHits")),
+    m_metadataResponseCacheMisses(m_metrics.GetCounter("MetadataResponseCacheMisses")),
+    m_metricsPublicationInterval(0),
+    m_metricsPublicationTimer(nullptr),
+    m_measurementArchive(nullptr),
+    m_measurementRingBuffer(nullptr),
+    m_archivePublishedMeasurements(false),
+    m_clientAcceptor(m_commandChannelService, endpoint),
+    m_commandWorkerGuard(make_work_guard(m_commandWorkerService)),
+    m_pendingCommandWork(m_metrics.GetGauge("PendingCommandWork"))
+{
+    m_metrics.RegisterGauge("ConnectedClients", [this]
+    {
+        ReaderLock readLock(m_subscriberConnectionsLock);
+        return static_cast<int64_t>(m_subscriberConnections.size());
+    });
+
+    m_metrics.RegisterGauge("CallbackQueueDepth", [this] { return static_cast<int64_t>(m_callbackQueue.Size()); });
+    m_metrics.RegisterGauge("CommandChannelBytesSent", [this] { return static_cast<int64_t>(GetTotalCommandChannelBytesSent()); });
+    m_metrics.RegisterGauge("DataChannelBytesSent", [this] { return static_cast<int64_t>(GetTotalDataChannelBytesSent()); });
+    m_metrics.RegisterGauge("MeasurementsSent", [this] { return static_cast<int64_t>(GetTotalMeasurementsSent()); });
+
     // Run call-back thread
     Thread([&,this]
     {
@@ -78,6 +114,18 @@ DataPublisher::DataPublisher(const TcpEndPoint& endpoint) :
         StartAccept();
         m_commandChannelService.run();
     });
+
+    // Run command worker threads, bounded so that many simultaneous metadata
+    // requests cannot starve publication of processor resources
+    const uint32_t commandWorkerCount = max(2U, min(4U, Thread::hardware_concurrency()));
+
+    for (uint32_t i = 0; i < commandWorkerCount; i++)
+    {
+        m_commandWorkerThreads.emplace_back([&,this]
+        {
+            m_commandWorkerService.run();
+        });
+    }
 }
 
 DataPublisher::DataPublisher(uint16_t port, bool ipV6) :
@@ -93,6 +141,29 @@ DataPublisher::DataPublisher(const string& networkInterface, uint16_t port) :
 DataPublisher::~DataPublisher()
 {
     m_disposing = true;
+
+    m_commandWorkerGuard.reset();
+    m_commandWorkerService.stop();
+
+    // Wait for running commands to complete before members they use are destroyed, publisher
+    // can be released by a command worker itself, which cannot wait for its own completion
+    for (Thread& commandWorkerThread : m_commandWorkerThreads)
+    {
+        if (commandWorkerThread.get_id() == boost::this_thread::get_id())
+            commandWorkerThread.detach();
+        else
+            commandWorkerThread.join();
+    }
+
+    if (m_metricsPublicationTimer != nullptr)
+        m_metricsPublicationTimer->Stop();
+
+    ScopeLock lock(m_temporalReplaysLock);
+
+    for (const auto& temporalReplay : m_temporalReplays)
+        temporalReplay.second->Stop();
+
+    m_temporalReplays.clear();
 }
 
 DataPublisher::CallbackDispatcher::CallbackDispatcher() :
@@ -121,10 +192,12 @@ void DataPublisher::AcceptConnection(const SubscriberConnectionPtr& connection,
 
         if (connectionAccepted)
         {
+            m_totalConnectionsAccepted->Add();
             DispatchClientConnected(connection.get());
         }
         else
         {
+            m_totalConnectionsRejected->Add();
             DispatchErrorMessage("Subscriber connection refused: connection would exceed " + ToString(m_maximumAllowedConnections) + " maximum allowed connections.");
             
             Thread([connection]
@@ -147,12 +220,153 @@ void DataPublisher::ConnectionTerminated(const SubscriberConnectionPtr& connecti
 
 void DataPublisher::RemoveConnection(const SubscriberConnectionPtr& connection)
 {
+    StopTemporalReplay(connection);
     m_routingTables.RemoveRoutes(connection);
 
     WriterLock writeLock(m_subscriberConnectionsLock);
     m_subscriberConnections.erase(connection);
 }
 
+DataPublisher::MetadataResponsePtr DataPublisher::GetMetadataResponse(const string& key, const MetadataResponseFactory& factory)
+{
+    promise<MetadataResponsePtr> responsePromise;
+    shared_future<MetadataResponsePtr> response;
+    string cacheKey;
+    bool cached = false;
+
+    {
+        ScopeLock lock(m_metadataResponseCacheLock);
+        cacheKey = ToString(m_metadataVersion) + ";" + key;
+
+        const auto iterator = m_metadataResponseCache.find(cacheKey);
+
+        if (iterator == m_metadataResponseCache.end())
+        {
+            if (m_metadataResponseCache.size() >= MaxMetadataResponseCacheSize)
+                m_metadataResponseCache.clear();
+
+            response = responsePromise.get_future().share();
+            m_metadataResponseCache.emplace(cacheKey, response);
+        }
+        else
+        {
+            response = iterator->second;
+            cached = true;
+        }
+    }
+
+    // Cached response may still be in preparation by another command worker, in which case get waits for it
+    if (cached)
+    {
+        m_metadataResponseCacheHits->Add();
+        return response.get();
+    }
+
+    m_metadataResponseCacheMisses->Add();
+
+    try
+    {
+        responsePromise.set_value(factory());
+    }
+    catch (...)
+    {
+        responsePromise.set_exception(current_exception());
+
+        // Failed responses are not cached so that a following request can retry
+        ScopeLock lock(m_metadataResponseCacheLock);
+        m_metadataResponseCache.erase(cacheKey);
+    }
+
+    return response.get();
+}
+
+VersionedMetadata DataPublisher::GetVersionedMetadata(const GSF::Guid& historyID, const uint32_t version)
+{
+    VersionedMetadata versionedMetadata;
+    ScopeLock lock(m_metadataResponseCacheLock);
+
+    versionedMetadata.HistoryID = m_metadataHistoryID;
+    versionedMetadata.Version = m_metadataVersion;
+
+    // Subscriber versions within retained history receive deltas, otherwise full meta-data is sent
+    if (historyID == m_metadataHistoryID && version <= m_metadataVersion && m_metadataVersion - version <= m_metadataDeltas.size())
+    {
+        versionedMetadata.BaseVersion = version;
+        versionedMetadata.Deltas.assign(m_metadataDeltas.end() - (m_metadataVersion - version), m_metadataDeltas.end());
+    }
+    else
+    {
+        versionedMetadata.Metadata = m_metadata;
+    }
+
+    return versionedMetadata;
+}
+
+void DataPublisher::QueueCommandWork(const function<void()>& work)
+{
+    m_pendingCommandWork->Add(1);
+
+    post(m_commandWorkerService, [this, work]
+    {
+        m_pendingCommandWork->Add(-1);
+        work();
+    });
+}
+
+void DataPublisher::StartTemporalReplay(const SubscriberConnectionPtr& connection)
+{
+    TemporalDataSourcePtr dataSource = m_measurementArchive;
+
+    // Ring buffer is preferred when it covers the requested start time or when there is no archive
+    if (m_measurementRingBuffer != nullptr)
+    {
+        int64_t startTime, stopTime;
+
+        if (dataSource == nullptr || (m_measurementRingBuffer->TryGetTimeRange(startTime, stopTime) && startTime <= ToTicks(connection->GetStartTimeConstraint())))
+            dataSource = m_measurementRingBuffer;
+    }
+
+    const TemporalReplayPtr temporalReplay = NewSharedPtr<TemporalReplay>(dataSource, connection);
+
+    // Stop any existing replay for connection, e.g., for a resubscribe
+    StopTemporalReplay(connection);
+
+    ScopeLock lock(m_temporalReplaysLock);
+    m_temporalReplays.insert_or_assign(connection, temporalReplay);
+    temporalReplay->Start();
+}
+
+uint64_t DataPublisher::BeginLiveDataHandoff(const SubscriberConnectionPtr& connection, const TemporalDataSourcePtr& dataSource)
+{
+    // Publications in progress finish first, so records before returned position were routed
+    // while live data was dropped and records added after it are buffered for connection
+    WriterLock writeLock(m_publicationLock);
+
+    connection->BeginLiveDataHandoff();
+
+    return dataSource->GetPosition();
+}
+
+void DataPublisher::StopTemporalReplay(const SubscriberConnectionPtr& connection)
+{
+    TemporalReplayPtr temporalReplay = nullptr;
+
+    m_temporalReplaysLock.lock();
+    const auto iterator = m_temporalReplays.find(connection);
+
+    if (iterator != m_temporalReplays.end())
+    {
+        temporalReplay = iterator->second;
+        m_temporalReplays.erase(iterator);
+    }
+
+    m_temporalReplaysLock.unlock();
+
+    // Replay thread is joined outside of lock
+    if (temporalReplay != nullptr)
+        temporalReplay->Stop();
+}
+
 void DataPublisher::Dispatch(const DispatcherFunction& function)
 {
     Dispatch(function, nullptr, 0, 0);
@@ -299,6 +513,9 @@ void DataPublisher::TemporalSubscriptionRequestedDispatcher(DataPublisher* sourc
 
     if (source != nullptr)
     {
+        if (source->m_measurementArchive != nullptr || source->m_measurementRingBuffer != nullptr)
+            source->StartTemporalReplay(connection->GetReference());
+
         const SubscriberConnectionCallback temporalSubscriptionRequestedCallback = source->m_temporalSubscriptionRequestedCallback;
 
         if (temporalSubscriptionRequestedCallback != nullptr)
@@ -312,6 +529,8 @@ void DataPublisher::TemporalSubscriptionCanceledDispatcher(DataPublisher* source
 
     if (source != nullptr)
     {
+        source->StopTemporalReplay(connection->GetReference());
+
         const SubscriberConnectionCallback temporalSubscriptionCanceledCallback = source->m_temporalSubscriptionCanceledCallback;
 
         if (temporalSubscriptionCanceledCallback != nullptr)
@@ -344,6 +563,16 @@ int32_t DataPublisher::GetColumnIndex(const GSF::Data::DataTablePtr& table, cons
         return column->Index();
 }
 
+DataColumnHandle DataPublisher::GetColumnHandle(const DataTablePtr& table, const string& columnName)
+{
+    const DataColumnHandle column = table->ColumnHandle(columnName);
+
+    if (!column.IsValid())
+        throw PublisherException("Column name \"" + columnName + "\" was not found in table \"" + table->Name() + "\"");
+
+    return column;
+}
+
 void DataPublisher::DefineMetadata(const vector<DeviceMetadataPtr>& deviceMetadata, const vector<MeasurementMetadataPtr>& measurementMetadata, const vector<PhasorMetadataPtr>& phasorMetadata, const int32_t versionNumber)
 {
     typedef unordered_map<uint16_t, char> PhasorTypeMap;
@@ -499,8 +728,10 @@ void DataPublisher::DefineMetadata(const vector<DeviceMetadataPtr>& deviceMetada
     DefineMetadata(metadata);
 }
 
-void DataPublisher::DefineMetadata(const DataSetPtr& metadata)
+void DataPublisher::DefineMetadata(const DataSetPtr& definedMetadata)
 {
+    const DataSetPtr previousMetadata = m_metadata;
+    const DataSetPtr metadata = m_metricsPublicationInterval > 0 ? DefineStatisticsMetadata(definedMetadata) : definedMetadata;
     m_metadata = metadata;
 
     // Create device data map used to build a flatter meta-data view used for easier client filtering
@@ -523,12 +754,12 @@ void DataPublisher::DefineMetadata(const DataSetPtr& metadata)
 
     if (deviceDetail != nullptr)
     {
-        const int32_t acronym = GetColumnIndex(deviceDetail, "Acronym");
-        const int32_t protocolName = GetColumnIndex(deviceDetail, "ProtocolName");
-        const int32_t framesPerSecond = GetColumnIndex(deviceDetail, "FramesPerSecond");
-        const int32_t companyAcronym = GetColumnIndex(deviceDetail, "CompanyAcronym");
-        const int32_t longitude = GetColumnIndex(deviceDetail, "Longitude");
-        const int32_t latitude = GetColumnIndex(deviceDetail, "Latitude");
+        const DataColumnHandle acronym = GetColumnHandle(deviceDetail, "Acronym");
+        const DataColumnHandle protocolName = GetColumnHandle(deviceDetail, "ProtocolName");
+        const DataColumnHandle framesPerSecond = GetColumnHandle(deviceDetail, "FramesPerSecond");
+        const DataColumnHandle companyAcronym = GetColumnHandle(deviceDetail, "CompanyAcronym");
+        const DataColumnHandle longitude = GetColumnHandle(deviceDetail, "Longitude");
+        const DataColumnHandle latitude = GetColumnHandle(deviceDetail, "Latitude");
 
         for (int32_t i = 0; i < deviceDetail->RowCount(); i++)
         {
@@ -536,14 +767,14 @@ void DataPublisher::DefineMetadata(const DataSetPtr& metadata)
             const DeviceDataPtr device = NewSharedPtr<DeviceData>();
 
             device->DeviceID = i;
-            device->FramesPerSecond = row->ValueAsInt32(framesPerSecond).GetValueOrDefault();
-            device->Company = row->ValueAsString(companyAcronym).GetValueOrDefault();
-            device->Protocol = row->ValueAsString(protocolName).GetValueOrDefault();
+            device->FramesPerSecond = row->GetInt32Value(framesPerSecond);
+            device->Company = row->GetStringValue(companyAcronym);
+            device->Protocol = row->GetStringValue(protocolName);
             device->ProtocolType = GetProtocolType(device->Protocol);
-            device->Longitude = row->ValueAsDecimal(longitude).GetValueOrDefault();
-            device->Latitude = row->ValueAsDecimal(latitude).GetValueOrDefault();
+            device->Longitude = row->GetDecimalValue(longitude);
+            device->Latitude = row->GetDecimalValue(latitude);
 
-            string deviceAcronymRef = row->ValueAsString(acronym).GetValueOrDefault();
+            string deviceAcronymRef(row->GetStringValue(acronym));
 
             if (!deviceAcronymRef.empty())
                 deviceData[deviceAcronymRef] = device;
@@ -570,17 +801,17 @@ void DataPublisher::DefineMetadata(const DataSetPtr& metadata)
 
     if (phasorDetail != nullptr)
     {
-        const int32_t id = GetColumnIndex(phasorDetail, "ID");
-        const int32_t deviceAcronym = GetColumnIndex(phasorDetail, "DeviceAcronym");
-        const int32_t type = GetColumnIndex(phasorDetail, "Type");
-        const int32_t phase = GetColumnIndex(phasorDetail, "Phase");
-        const int32_t sourceIndex = GetColumnIndex(phasorDetail, "SourceIndex");
+        const DataColumnHandle id = GetColumnHandle(phasorDetail, "ID");
+        const DataColumnHandle deviceAcronym = GetColumnHandle(phasorDetail, "DeviceAcronym");
+        const DataColumnHandle type = GetColumnHandle(phasorDetail, "Type");
+        const DataColumnHandle phase = GetColumnHandle(phasorDetail, "Phase");
+        const DataColumnHandle sourceIndex = GetColumnHandle(phasorDetail, "SourceIndex");
         
         for (int32_t i = 0; i < phasorDetail->RowCount(); i++)
         {
             const DataRowPtr& row = phasorDetail->Row(i);
             
-            string deviceAcronymRef = row->ValueAsString(deviceAcronym).GetValueOrDefault();
+            string deviceAcronymRef(row->GetStringValue(deviceAcronym));
 
             if (deviceAcronymRef.empty())
                 continue;
@@ -588,9 +819,9 @@ void DataPublisher::DefineMetadata(const DataSetPtr& metadata)
             PhasorDataMapPtr phasorMap;
             const PhasorDataPtr phasor = NewSharedPtr<PhasorData>();
 
-            phasor->PhasorID = row->ValueAsInt32(id).GetValueOrDefault();
-            phasor->PhasorType = row->ValueAsString(type).GetValueOrDefault();
-            phasor->Phase = row->ValueAsString(phase).GetValueOrDefault();
+            phasor->PhasorID = row->GetInt32Value(id);
+            phasor->PhasorType = row->GetStringValue(type);
+            phasor->Phase = row->GetStringValue(phase);
 
             if (!TryGetValue(phasorData, deviceAcronymRef, phasorMap, nullPhasorDataMap))
             {
@@ -598,7 +829,7 @@ void DataPublisher::DefineMetadata(const DataSetPtr& metadata)
                 phasorData[deviceAcronymRef] = phasorMap;
             }
 
-            phasorMap->insert_or_assign(row->ValueAsInt32(sourceIndex).GetValueOrDefault(), phasor);
+            phasorMap->insert_or_assign(row->GetInt32Value(sourceIndex), phasor);
         }
     }
 
@@ -612,17 +843,17 @@ void DataPublisher::DefineMetadata(const DataSetPtr& metadata)
     if (measurementDetail != nullptr && activeMeasurements != nullptr)
     {
         // Lookup column indices for measurement detail table
-        const int32_t md_deviceAcronym = GetColumnIndex(measurementDetail, "DeviceAcronym");
-        const int32_t md_id = GetColumnIndex(measurementDetail, "ID");
-        const int32_t md_signalID = GetColumnIndex(measurementDetail, "SignalID");
-        const int32_t md_pointTag = GetColumnIndex(measurementDetail, "PointTag");
-        const int32_t md_signalReference = GetColumnIndex(measurementDetail, "SignalReference");
-        const int32_t md_signalAcronym = GetColumnIndex(measurementDetail, "SignalAcronym");
-        const int32_t md_phasorSourceIndex = GetColumnIndex(measurementDetail, "PhasorSourceIndex");
-        const int32_t md_description = GetColumnIndex(measurementDetail, "Description");
-        const int32_t md_internal = GetColumnIndex(measurementDetail, "Internal");
-        const int32_t md_enabled = GetColumnIndex(measurementDetail, "Enabled");
-        const int32_t md_updatedOn = GetColumnIndex(measurementDetail, "UpdatedOn");
+        const DataColumnHandle md_deviceAcronym = GetColumnHandle(measurementDetail, "DeviceAcronym");
+        const DataColumnHandle md_id = GetColumnHandle(measurementDetail, "ID");
+        const DataColumnHandle md_signalID = GetColumnHandle(measurementDetail, "SignalID");
+        const DataColumnHandle md_pointTag = GetColumnHandle(measurementDetail, "PointTag");
+        const DataColumnHandle md_signalReference = GetColumnHandle(measurementDetail, "SignalReference");
+        const DataColumnHandle md_signalAcronym = GetColumnHandle(measurementDetail, "SignalAcronym");
+        const DataColumnHandle md_phasorSourceIndex = GetColumnHandle(measurementDetail, "PhasorSourceIndex");
+        const DataColumnHandle md_description = GetColumnHandle(measurementDetail, "Description");
+        const DataColumnHandle md_internal = GetColumnHandle(measurementDetail, "Internal");
+        const DataColumnHandle md_enabled = GetColumnHandle(measurementDetail, "Enabled");
+        const DataColumnHandle md_updatedOn = GetColumnHandle(measurementDetail, "UpdatedOn");
 
         // Lookup column indices for active measurements table
         const int32_t am_sourceNodeID = GetColumnIndex(activeMeasurements, "SourceNodeID");
@@ -650,28 +881,34 @@ void DataPublisher::DefineMetadata(const DataSetPtr& metadata)
         const int32_t am_description = GetColumnIndex(activeMeasurements, "Description");
         const int32_t am_updatedOn = GetColumnIndex(activeMeasurements, "UpdatedOn");
 
+        // Index primary key fields used to map signal ID, measurement key and point tag filter expressions to rows,
+        // indexes are not unique so that duplicated user defined meta-data is still accepted
+        activeMeasurements->CreateIndex("SignalID");
+        activeMeasurements->CreateIndex("ID");
+        activeMeasurements->CreateIndex("PointTag");
+
         for (int32_t i = 0; i < measurementDetail->RowCount(); i++)
         {
             const DataRowPtr& md_row = measurementDetail->Row(i);
 
-            if (!md_row->ValueAsBoolean(md_enabled).GetValueOrDefault())
+            if (!md_row->GetBooleanValue(md_enabled))
                 continue;
             
             DataRowPtr am_row = activeMeasurements->CreateRow();
 
             am_row->SetGuidValue(am_sourceNodeID, m_nodeID);
-            am_row->SetStringValue(am_id, md_row->ValueAsString(md_id));
-            am_row->SetGuidValue(am_signalID, md_row->ValueAsGuid(md_signalID));
-            am_row->SetStringValue(am_pointTag, md_row->ValueAsString(md_pointTag));
-            am_row->SetStringValue(am_signalReference, md_row->ValueAsString(md_signalReference));
-            am_row->SetInt32Value(am_internal, md_row->ValueAsBoolean(md_internal).GetValueOrDefault() ? 1 : 0);
+            am_row->SetStringValue(am_id, md_row->ValueAsString(md_id.Index));
+            am_row->SetGuidValue(am_signalID, md_row->ValueAsGuid(md_signalID.Index));
+            am_row->SetStringValue(am_pointTag, md_row->ValueAsString(md_pointTag.Index));
+            am_row->SetStringValue(am_signalReference, md_row->ValueAsString(md_signalReference.Index));
+            am_row->SetInt32Value(am_internal, md_row->GetBooleanValue(md_internal) ? 1 : 0);
             am_row->SetInt32Value(am_subscribed, 0);
-            am_row->SetStringValue(am_description, md_row->ValueAsString(md_description));
+            am_row->SetStringValue(am_description, md_row->ValueAsString(md_description.Index));
             am_row->SetDoubleValue(am_adder, 0.0);
             am_row->SetDoubleValue(am_multiplier, 1.0);
-            am_row->SetDateTimeValue(am_updatedOn, md_row->ValueAsDateTime(md_updatedOn));
+            am_row->SetDateTimeValue(am_updatedOn, md_row->ValueAsDateTime(md_updatedOn.Index));
 
-            string signalType = md_row->ValueAsString(md_signalAcronym).GetValueOrDefault();
+            string signalType(md_row->GetStringValue(md_signalAcronym));
 
             if (signalType.empty())
                 signalType = "CALC";
@@ -679,7 +916,7 @@ void DataPublisher::DefineMetadata(const DataSetPtr& metadata)
             am_row->SetStringValue(am_signalType, signalType);
             am_row->SetStringValue(am_engineeringUnits, GetEngineeringUnits(signalType));
 
-            string deviceAcronymRef = md_row->ValueAsString(md_deviceAcronym).GetValueOrDefault();
+            string deviceAcronymRef(md_row->GetStringValue(md_deviceAcronym));
 
             if (deviceAcronymRef.empty())
             {
@@ -710,7 +947,7 @@ void DataPublisher::DefineMetadata(const DataSetPtr& metadata)
                 if (TryGetValue(phasorData, deviceAcronymRef, phasorMap, nullPhasorDataMap))
                 {
                     PhasorDataPtr phasor;
-                    int32_t sourceIndex = md_row->ValueAsInt32(md_phasorSourceIndex).GetValueOrDefault();
+                    int32_t sourceIndex = md_row->GetInt32Value(md_phasorSourceIndex);
 
                     if (TryGetValue(*phasorMap, sourceIndex, phasor, nullPhasorData))
                     {
@@ -727,6 +964,33 @@ void DataPublisher::DefineMetadata(const DataSetPtr& metadata)
 
     m_filteringMetadata.swap(filteringMetadata);
 
+    // Filter expressions parsed against prior meta-data schema are no longer valid, this also applies
+    // when the same data set is defined again since its tables may have been changed
+    FilterExpressionCache::Invalidate(previousMetadata);
+    FilterExpressionCache::Invalidate(filteringMetadata);
+
+    // Track row changes so subscribers with a recent metadata version can be sent a delta
+    const MetadataDeltaPtr metadataDelta = MetadataDelta::Create(previousMetadata, metadata);
+
+    // Invalidate cached metadata responses, responses being prepared for prior version are not cached
+    {
+        ScopeLock lock(m_metadataResponseCacheLock);
+        m_metadataVersion++;
+        m_metadataResponseCache.clear();
+
+        if (metadataDelta == nullptr)
+        {
+            m_metadataDeltas.clear();
+        }
+        else
+        {
+            m_metadataDeltas.push_back(metadataDelta);
+
+            if (m_metadataDeltas.size() > MaxMetadataDeltaHistory)
+                m_metadataDeltas.pop_front();
+        }
+    }
+
     // Notify all subscribers that the configuration metadata has changed
     ReaderLock readLock(m_subscriberConnectionsLock);
 
@@ -753,32 +1017,32 @@ vector<MeasurementMetadataPtr> DataPublisher::FilterMetadata(const string& filte
     vector<MeasurementMetadataPtr> measurementMetadata;
     const DataTablePtr& measurementDetail = m_metadata->Table("MeasurementDetail");
     
-    const int32_t deviceAcronym = GetColumnIndex(measurementDetail, "DeviceAcronym");
-    const int32_t id = GetColumnIndex(measurementDetail, "ID");
-    const int32_t signalID = GetColumnIndex(measurementDetail, "SignalID");
-    const int32_t pointTag = GetColumnIndex(measurementDetail, "PointTag");
-    const int32_t signalReference = GetColumnIndex(measurementDetail, "SignalReference");
-    const int32_t phasorSourceIndex = GetColumnIndex(measurementDetail, "PhasorSourceIndex");
-    const int32_t description = GetColumnIndex(measurementDetail, "Description");
-    const int32_t enabled = GetColumnIndex(measurementDetail, "Enabled");
-    const int32_t updatedOn = GetColumnIndex(measurementDetail, "UpdatedOn");
+    const DataColumnHandle deviceAcronym = GetColumnHandle(measurementDetail, "DeviceAcronym");
+    const DataColumnHandle id = GetColumnHandle(measurementDetail, "ID");
+    const DataColumnHandle signalID = GetColumnHandle(measurementDetail, "SignalID");
+    const DataColumnHandle pointTag = GetColumnHandle(measurementDetail, "PointTag");
+    const DataColumnHandle signalReference = GetColumnHandle(measurementDetail, "SignalReference");
+    const DataColumnHandle phasorSourceIndex = GetColumnHandle(measurementDetail, "PhasorSourceIndex");
+    const DataColumnHandle description = GetColumnHandle(measurementDetail, "Description");
+    const DataColumnHandle enabled = GetColumnHandle(measurementDetail, "Enabled");
+    const DataColumnHandle updatedOn = GetColumnHandle(measurementDetail, "UpdatedOn");
 
     for (size_t i = 0; i < rows.size(); i++)
     {
         DataRowPtr row = rows[i];
         MeasurementMetadataPtr metadata = NewSharedPtr<MeasurementMetadata>();
 
-        if (!row->ValueAsBoolean(enabled).GetValueOrDefault())
+        if (!row->GetBooleanValue(enabled))
             continue;
 
-        metadata->DeviceAcronym = row->ValueAsString(deviceAcronym).GetValueOrDefault();
-        metadata->ID = row->ValueAsString(id).GetValueOrDefault();
-        metadata->SignalID = row->ValueAsGuid(signalID).GetValueOrDefault();
-        metadata->PointTag = row->ValueAsString(pointTag).GetValueOrDefault();
-        metadata->Reference = SignalReference(row->ValueAsString(signalReference).GetValueOrDefault());
-        metadata->PhasorSourceIndex = uint16_t(row->ValueAsInt32(phasorSourceIndex).GetValueOrDefault());
-        metadata->Description = row->ValueAsString(description).GetValueOrDefault();
-        metadata->UpdatedOn = row->ValueAsDateTime(updatedOn).GetValueOrDefault();
+        metadata->DeviceAcronym = row->GetStringValue(deviceAcronym);
+        metadata->ID = row->GetStringValue(id);
+        metadata->SignalID = row->GetGuidValue(signalID);
+        metadata->PointTag = row->GetStringValue(pointTag);
+        metadata->Reference = SignalReference(string(row->GetStringValue(signalReference)));
+        metadata->PhasorSourceIndex = uint16_t(row->GetInt32Value(phasorSourceIndex));
+        metadata->Description = row->GetStringValue(description);
+        metadata->UpdatedOn = row->GetDateTimeValue(updatedOn);
 
         measurementMetadata.push_back(metadata);
     }
@@ -800,9 +1064,121 @@ void DataPublisher::PublishMeasurements(const vector<Measurement>& measurements)
 
 void DataPublisher::PublishMeasurements(const vector<MeasurementPtr>& measurements)
 {
+    m_totalMeasurementsPublished->Add(measurements.size());
+
+    ReaderLock readLock(m_publicationLock);
+    const MeasurementRingBufferPtr measurementRingBuffer = m_measurementRingBuffer;
+
+    if (measurementRingBuffer != nullptr)
+        measurementRingBuffer->Append(measurements);
+
+    if (m_archivePublishedMeasurements)
+    {
+        const MeasurementArchivePtr measurementArchive = m_measurementArchive;
+
+        if (measurementArchive != nullptr)
+            measurementArchive->Append(measurements);
+    }
+
     m_routingTables.PublishMeasurements(measurements);
 }
 
+void DataPublisher::PublishMeasurements(const MeasurementRecord* measurements, const size_t count)
+{
+    if (measurements == nullptr || count == 0)
+        return;
+
+    m_totalMeasurementsPublished->Add(count);
+
+    vector<RoutedMeasurementRecord> routedMeasurements(count);
+
+    // Resolve signal IDs, constrain read lock to this block
+    {
+        ReaderLock readLock(m_signalHandlesLock);
+        const uint32_t handleCount = static_cast<uint32_t>(m_signalHandleIDs.size());
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const MeasurementRecord& measurement = measurements[i];
+            RoutedMeasurementRecord& routedMeasurement = routedMeasurements[i];
+
+            if (measurement.SignalHandle == MeasurementRecord::InvalidSignalHandle)
+            {
+                routedMeasurement.SignalID = &measurement.SignalID;
+            }
+            else
+            {
+                if (measurement.SignalHandle >= handleCount)
+                    throw PublisherException("Cannot publish measurement record, signal handle " + ToString(measurement.SignalHandle) + " is not defined");
+
+                routedMeasurement.SignalID = &m_signalHandleIDs[measurement.SignalHandle];
+            }
+
+            routedMeasurement.Record = &measurement;
+        }
+    }
+
+    ReaderLock readLock(m_publicationLock);
+    const MeasurementRingBufferPtr measurementRingBuffer = m_measurementRingBuffer;
+
+    if (measurementRingBuffer != nullptr)
+        measurementRingBuffer->Append(routedMeasurements);
+
+    if (m_archivePublishedMeasurements)
+    {
+        const MeasurementArchivePtr measurementArchive = m_measurementArchive;
+
+        if (measurementArchive != nullptr)
+            measurementArchive->Append(routedMeasurements);
+    }
+
+    m_routingTables.PublishMeasurements(routedMeasurements);
+}
+
+void DataPublisher::PublishMeasurements(const vector<MeasurementRecord>& measurements)
+{
+    if (!measurements.empty())
+        PublishMeasurements(measurements.data(), measurements.size());
+}
+
+uint32_t DataPublisher::GetSignalHandle(const GSF::Guid& signalID)
+{
+    // Constrain read lock to this block
+    {
+        ReaderLock readLock(m_signalHandlesLock);
+        const auto iterator = m_signalHandles.find(signalID);
+
+        if (iterator != m_signalHandles.end())
+            return iterator->second;
+    }
+
+    WriterLock writeLock(m_signalHandlesLock);
+    const auto iterator = m_signalHandles.find(signalID);
+
+    if (iterator != m_signalHandles.end())
+        return iterator->second;
+
+    const uint32_t signalHandle = static_cast<uint32_t>(m_signalHandleIDs.size());
+
+    if (signalHandle == MeasurementRecord::InvalidSignalHandle)
+        throw PublisherException("Cannot assign signal handle, maximum number of signal handles has been reached");
+
+    m_signalHandleIDs.push_back(signalID);
+    m_signalHandles.emplace(signalID, signalHandle);
+
+    return signalHandle;
+}
+
+GSF::Guid DataPublisher::GetSignalID(const uint32_t signalHandle)
+{
+    ReaderLock readLock(m_signalHandlesLock);
+
+    if (signalHandle >= m_signalHandleIDs.size())
+        return Empty::Guid;
+
+    return m_signalHandleIDs[signalHandle];
+}
+
 const GSF::Guid& DataPublisher::GetNodeID() const
 {
     return m_nodeID;
@@ -873,6 +1249,35 @@ void DataPublisher::SetSupportsTemporalSubscriptions(bool value)
     m_supportsTemporalSubscriptions = value;
 }
 
+const MeasurementArchivePtr& DataPublisher::GetMeasurementArchive() const
+{
+    return m_measurementArchive;
+}
+
+void DataPublisher::SetMeasurementArchive(const MeasurementArchivePtr& value, bool archivePublishedMeasurements)
+{
+    m_measurementArchive = value;
+    m_archivePublishedMeasurements = archivePublishedMeasurements;
+
+    // An archive allows the publisher to serve temporal subscriptions
+    if (m_measurementArchive != nullptr)
+        m_supportsTemporalSubscriptions = true;
+}
+
+const MeasurementRingBufferPtr& DataPublisher::GetMeasurementRingBuffer() const
+{
+    return m_measurementRingBuffer;
+}
+
+void DataPublisher::SetMeasurementRingBuffer(const MeasurementRingBufferPtr& value)
+{
+    m_measurementRingBuffer = value;
+
+    // A ring buffer allows the publisher to serve temporal subscriptions
+    if (m_measurementRingBuffer != nullptr)
+        m_supportsTemporalSubscriptions = true;
+}
+
 uint32_t DataPublisher::GetCipherKeyRotationPeriod() const
 {
     return m_cipherKeyRotationPeriod;
@@ -883,6 +1288,26 @@ void DataPublisher::SetCipherKeyRotationPeriod(uint32_t value)
     m_cipherKeyRotationPeriod = value;
 }
 
+int32_t DataPublisher::GetCompressionLevel() const
+{
+    return m_compressionLevel;
+}
+
+void DataPublisher::SetCompressionLevel(int32_t value)
+{
+    m_compressionLevel = value;
+}
+
+int32_t DataPublisher::GetMaxCompressionThreads() const
+{
+    return m_maxCompressionThreads;
+}
+
+void DataPublisher::SetMaxCompressionThreads(int32_t value)
+{
+    m_maxCompressionThreads = value;
+}
+
 bool DataPublisher::GetUseBaseTimeOffsets() const
 {
     return m_useBaseTimeOffsets;
@@ -939,6 +1364,164 @@ uint64_t DataPublisher::GetTotalMeasurementsSent()
     return totalMeasurementsSent;
 }
 
+MetricsSnapshot DataPublisher::GetMetricsSnapshot() const
+{
+    return m_metrics.GetSnapshot();
+}
+
+int32_t DataPublisher::GetMetricsPublicationInterval() const
+{
+    return m_metricsPublicationInterval;
+}
+
+void DataPublisher::SetMetricsPublicationInterval(const int32_t value)
+{
+    if (m_metricsPublicationTimer != nullptr)
+    {
+        m_metricsPublicationTimer->Stop();
+        m_metricsPublicationTimer = nullptr;
+    }
+
+    m_metricsPublicationInterval = max(value, 0);
+
+    if (m_metricsPublicationInterval == 0)
+        return;
+
+    m_metricsPublicationTimer = NewSharedPtr<Timer>(m_metricsPublicationInterval, [this](Timer*, void*)
+    {
+        PublishMetrics();
+    },
+    true);
+
+    m_metricsPublicationTimer->Start();
+}
+
+DataSetPtr DataPublisher::DefineStatisticsMetadata(const DataSetPtr& metadata)
+{
+    const DataTablePtr& sourceDetail = metadata->Table("MeasurementDetail");
+
+    if (sourceDetail == nullptr)
+        return metadata;
+
+    // Statistics are added to a copy of measurement detail so that defined data set is not changed,
+    // other tables are shared with defined data set
+    const DataSetPtr statisticsMetadata = NewSharedPtr<DataSet>();
+
+    for (const DataTablePtr& table : metadata->Tables())
+        statisticsMetadata->AddOrUpdateTable(table);
+
+    const DataTablePtr measurementDetail = statisticsMetadata->CreateTable(sourceDetail->Name());
+
+    for (int32_t i = 0; i < sourceDetail->ColumnCount(); i++)
+        measurementDetail->AddColumn(measurementDetail->CloneColumn(sourceDetail->Column(i)));
+
+    const DataColumnHandle deviceAcronym = GetColumnHandle(measurementDetail, "DeviceAcronym");
+    const DataColumnHandle id = GetColumnHandle(measurementDetail, "ID");
+    const DataColumnHandle signalID = GetColumnHandle(measurementDetail, "SignalID");
+    const DataColumnHandle pointTag = GetColumnHandle(measurementDetail, "PointTag");
+    const DataColumnHandle signalReference = GetColumnHandle(measurementDetail, "SignalReference");
+    const DataColumnHandle signalAcronym = GetColumnHandle(measurementDetail, "SignalAcronym");
+    const DataColumnHandle phasorSourceIndex = GetColumnHandle(measurementDetail, "PhasorSourceIndex");
+    const DataColumnHandle description = GetColumnHandle(measurementDetail, "Description");
+    const DataColumnHandle internal = GetColumnHandle(measurementDetail, "Internal");
+    const DataColumnHandle enabled = GetColumnHandle(measurementDetail, "Enabled");
+    const DataColumnHandle updatedOn = GetColumnHandle(measurementDetail, "UpdatedOn");
+
+    // Statistics may already be defined when metadata is redefined from a data set published by this publisher
+    unordered_set<GSF::Guid> definedSignalIDs;
+
+    for (int32_t i = 0; i < sourceDetail->RowCount(); i++)
+    {
+        const DataRowPtr& sourceRow = sourceDetail->Row(i);
+
+        if (sourceRow == nullptr)
+            continue;
+
+        const DataRowPtr row = measurementDetail->CloneRow(sourceRow);
+        definedSignalIDs.insert(row->GetGuidValue(signalID));
+        measurementDetail->AddRow(row);
+    }
+
+    const vector<pair<string, float64_t>> statistics = GetMetricsSnapshot().GetValues();
+    const datetime_t now = UtcNow();
+
+    for (const auto& statistic : statistics)
+    {
+        const string& name = statistic.first;
+        const GSF::Guid statisticSignalID = GetStatisticSignalID(name);
+
+        if (definedSignalIDs.find(statisticSignalID) != definedSignalIDs.end())
+            continue;
+
+        const string statisticID = ToString(GetStatisticID(name));
+        DataRowPtr row = measurementDetail->CreateRow();
+
+        // DataRow setters take column indexes, handles resolved above provide them
+        row->SetStringValue(deviceAcronym.Index, string());
+        row->SetStringValue(id.Index, "STAT:" + statisticID);
+        row->SetGuidValue(signalID.Index, statisticSignalID);
+        row->SetStringValue(pointTag.Index, "PUBLISHER!STAT:" + name);
+        row->SetStringValue(signalReference.Index, "PUBLISHER!STAT-ST" + statisticID);
+        row->SetStringValue(signalAcronym.Index, string("STAT"));
+        row->SetInt32Value(phasorSourceIndex.Index, 0);
+        row->SetStringValue(description.Index, "Data publisher statistic: " + name);
+        row->SetBooleanValue(internal.Index, true);
+        row->SetBooleanValue(enabled.Index, true);
+        row->SetDateTimeValue(updatedOn.Index, now);
+
+        measurementDetail->AddRow(row);
+    }
+
+    statisticsMetadata->AddOrUpdateTable(measurementDetail);
+
+    return statisticsMetadata;
+}
+
+uint32_t DataPublisher::GetStatisticID(const string& name)
+{
+    const auto iterator = m_statisticIDs.find(name);
+
+    if (iterator != m_statisticIDs.end())
+        return iterator->second;
+
+    // IDs are taken from statistic signal ID, rather than metric order, so they remain stable when metrics
+    // are added and between runs, an ID that collides with another statistic takes the next unused ID
+    const GSF::Guid signalID = GetStatisticSignalID(name);
+    uint32_t id = static_cast<uint32_t>(signalID.data[0]) << 24 | static_cast<uint32_t>(signalID.data[1]) << 16 | static_cast<uint32_t>(signalID.data[2]) << 8 | signalID.data[3];
+
+    while (id == 0 || !m_usedStatisticIDs.insert(id).second)
+        id++;
+
+    m_statisticIDs.emplace(name, id);
+
+    return id;
+}
+
+GSF::Guid DataPublisher::GetStatisticSignalID(const string& name) const
+{
+    // Statistic signal IDs are derived from node ID so they remain stable for a given publisher
+    const boost::uuids::name_generator_sha1 generator(m_nodeID);
+    return generator("STAT:" + name);
+}
+
+void DataPublisher::PublishMetrics()
+{
+    const MetricsSnapshot snapshot = GetMetricsSnapshot();
+    const vector<pair<string, float64_t>> statistics = snapshot.GetValues();
+    vector<MeasurementRecord> measurements(statistics.size());
+
+    for (size_t i = 0; i < statistics.size(); i++)
+    {
+        MeasurementRecord& measurement = measurements[i];
+
+        measurement.SignalID = GetStatisticSignalID(statistics[i].first);
+        measurement.Timestamp = snapshot.Timestamp;
+        measurement.Value = statistics[i].second;
+    }
+
+    PublishMeasurements(measurements);
+}
+
 void DataPublisher::RegisterStatusMessageCallback(const MessageCallback& statusMessageCallback)
 {
     m_statusMessageCallback = statusMessageCallback;
@@ -26,11 +26,19 @@
 
 #include "../Common/CommonTypes.h"
 #include "../Common/ThreadSafeQueue.h"
+#include "../Common/Metrics.h"
+#include "../Common/Timer.h"
 #include "../Data/DataSet.h"
 #include "SubscriberConnection.h"
 #include "RoutingTables.h"
+#include "MeasurementArchive.h"
+#include "MeasurementRingBuffer.h"
+#include "TemporalReplay.h"
+#include "MetadataDelta.h"
 #include "TransportTypes.h"
 #include "Constants.h"
+#include <deque>
+#include <future>
 
 namespace GSF {
 namespace FilterExpressions
@@ -67,9 +75,31 @@ namespace Transport
         GSF::Guid m_nodeID;
         GSF::Data::DataSetPtr m_metadata;
         GSF::Data::DataSetPtr m_filteringMetadata;
+
+        // Serialized metadata responses are cached by metadata version, serialization options and
+        // normalized filter expressions so subscribers requesting the same metadata share one response
+        struct MetadataResponse
+        {
+            std::vector<uint8_t> Buffer;
+            uint64_t RowCount;
+            size_t TableCount;
+        };
+
+        typedef SharedPtr<const MetadataResponse> MetadataResponsePtr;
+        typedef std::function<MetadataResponsePtr()> MetadataResponseFactory;
+
+        uint32_t m_metadataVersion;
+        GSF::Guid m_metadataHistoryID;
+        std::deque<MetadataDeltaPtr> m_metadataDeltas; // Deltas leading up to current version, oldest first
+        std::unordered_map<std::string, std::shared_future<MetadataResponsePtr>> m_metadataResponseCache;
+        GSF::Mutex m_metadataResponseCacheLock;
+        GSF::MetricsRegistry m_metrics;
         RoutingTables m_routingTables;
         std::unordered_set<SubscriberConnectionPtr> m_subscriberConnections;
         GSF::SharedMutex m_subscriberConnectionsLock;
+        std::unordered_map<GSF::Guid, uint32_t> m_signalHandles;
+        std::deque<GSF::Guid> m_signalHandleIDs; // Deque keeps references stable while routing
+        GSF::SharedMutex m_signalHandlesLock;
         SecurityMode m_securityMode;
         int32_t m_maximumAllowedConnections;
         bool m_isMetadataRefreshAllowed;
@@ -78,9 +108,33 @@ namespace Transport
         bool m_supportsTemporalSubscriptions;
         bool m_useBaseTimeOffsets;
         uint32_t m_cipherKeyRotationPeriod;
+        int32_t m_compressionLevel;
+        int32_t m_maxCompressionThreads;
         void* m_userData;
         bool m_disposing;
 
+        // Statistics
+        GSF::MetricCounterPtr m_totalMeasurementsPublished;
+        GSF::MetricCounterPtr m_totalConnectionsAccepted;
+        GSF::MetricCounterPtr m_totalConnectionsRejected;
+        GSF::MetricCounterPtr m_metadataResponseCacheHits;
+        GSF::MetricCounterPtr m_metadataResponseCacheMisses;
+        int32_t m_metricsPublicationInterval;
+        TimerPtr m_metricsPublicationTimer;
+        std::unordered_map<std::string, uint32_t> m_statisticIDs; // Kept so IDs are unchanged when metadata is redefined
+        std::unordered_set<uint32_t> m_usedStatisticIDs;
+
+        // Temporal subscription replay
+        MeasurementArchivePtr m_measurementArchive;
+        MeasurementRingBufferPtr m_measurementRingBuffer;
+        bool m_archivePublishedMeasurements;
+        std::unordered_map<SubscriberConnectionPtr, TemporalReplayPtr> m_temporalReplays;
+        GSF::Mutex m_temporalReplaysLock;
+
+        // Publication adds measurements to temporal data sources and routes them while shared lock is
+        // held, live data handoff takes exclusive lock so the two steps are seen as one
+        GSF::SharedMutex m_publicationLock;
+
         // Callback queue
         ThreadSafeQueue<CallbackDispatcher> m_callbackQueue;
 
@@ -88,11 +142,32 @@ namespace Transport
         GSF::IOContext m_commandChannelService;
         GSF::TcpAcceptor m_clientAcceptor;
 
+        // Command workers handle long running client commands, e.g., metadata refresh,
+        // so command channel thread remains responsive for all other connections
+        GSF::IOContext m_commandWorkerService;
+        boost::asio::executor_work_guard<GSF::IOContext::executor_type> m_commandWorkerGuard;
+        std::vector<Thread> m_commandWorkerThreads;
+        GSF::MetricGaugePtr m_pendingCommandWork;
+
         // Command channel handlers
         void StartAccept();
         void AcceptConnection(const SubscriberConnectionPtr& connection, const ErrorCode& error);
         void ConnectionTerminated(const SubscriberConnectionPtr& connection);
         void RemoveConnection(const SubscriberConnectionPtr& connection);
+        void QueueCommandWork(const std::function<void()>& work);
+        MetadataResponsePtr GetMetadataResponse(const std::string& key, const MetadataResponseFactory& factory);
+        VersionedMetadata GetVersionedMetadata(const GSF::Guid& historyID, uint32_t version);
+
+        // Statistics handlers
+        GSF::Data::DataSetPtr DefineStatisticsMetadata(const GSF::Data::DataSetPtr& metadata);
+        uint32_t GetStatisticID(const std::string& name);
+        GSF::Guid GetStatisticSignalID(const std::string& name) const;
+        void PublishMetrics();
+
+        // Temporal replay handlers
+        void StartTemporalReplay(const SubscriberConnectionPtr& connection);
+        void StopTemporalReplay(const SubscriberConnectionPtr& connection);
+        uint64_t BeginLiveDataHandoff(const SubscriberConnectionPtr& connection, const TemporalDataSourcePtr& dataSource);
 
         // Callbacks
         MessageCallback m_statusMessageCallback;
@@ -125,6 +200,7 @@ namespace Transport
         static void TemporalSubscriptionCanceledDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer);
         static void UserCommandDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer);
         static int32_t GetColumnIndex(const GSF::Data::DataTablePtr& table, const std::string& columnName);
+        static GSF::Data::DataColumnHandle GetColumnHandle(const GSF::Data::DataTablePtr& table, const std::string& columnName);
     public:
         // Creates a new instance of the data publisher.
         DataPublisher(const GSF::TcpEndPoint& endpoint);
@@ -159,6 +235,18 @@ namespace Transport
         void PublishMeasurements(const std::vector<Measurement>& measurements);
         void PublishMeasurements(const std::vector<MeasurementPtr>& measurements);
 
+        // Publishes a contiguous block of measurement records. Records are routed and serialized directly
+        // from the provided memory, so no measurement instances are allocated for unthrottled connections.
+        void PublishMeasurements(const MeasurementRecord* measurements, size_t count);
+        void PublishMeasurements(const std::vector<MeasurementRecord>& measurements);
+
+        // Gets a compact handle, assigned on first request, that can identify the specified signal
+        // in published measurement records in place of its signal ID. Handles are never reassigned.
+        uint32_t GetSignalHandle(const GSF::Guid& signalID);
+
+        // Gets the signal ID for a handle assigned by GetSignalHandle
+        GSF::Guid GetSignalID(uint32_t signalHandle);
+
         // Node ID defines a unique identification for the DataPublisher
         // instance that gets included in published metadata so that clients
         // can easily distinguish the source of the measurements
@@ -187,9 +275,33 @@ namespace Transport
         bool GetSupportsTemporalSubscriptions() const;
         void SetSupportsTemporalSubscriptions(bool value);
 
+        // Gets or sets the archive used to automatically serve temporal subscriptions. When defined, temporal
+        // subscriptions are replayed from the archive by the publisher and the temporal subscription callbacks
+        // become notifications only. Published measurements are also written to the archive unless disabled.
+        const MeasurementArchivePtr& GetMeasurementArchive() const;
+        void SetMeasurementArchive(const MeasurementArchivePtr& value, bool archivePublishedMeasurements = true);
+
+        // Gets or sets an in-memory ring buffer of recently published measurements used to automatically serve
+        // temporal subscriptions, e.g., "last 5 minutes" requests. Requests starting within the buffered window
+        // are served from the ring buffer, older requests fall back to the measurement archive when defined.
+        // Subscriptions without a stop time switch to live data once buffered history has been replayed.
+        const MeasurementRingBufferPtr& GetMeasurementRingBuffer() const;
+        void SetMeasurementRingBuffer(const MeasurementRingBufferPtr& value);
+
         uint32_t GetCipherKeyRotationPeriod() const;
         void SetCipherKeyRotationPeriod(uint32_t period);
 
+        // Gets or sets the gzip compression level used for metadata and signal index cache responses,
+        // from 1 (fastest) to 9 (smallest), defaults to zlib default level
+        int32_t GetCompressionLevel() const;
+        void SetCompressionLevel(int32_t value);
+
+        // Gets or sets the maximum number of threads used to compress large metadata responses, defaults to 1.
+        // Responses compressed on multiple threads consist of multiple gzip members, so only enable when all
+        // subscribers can decompress multi-member gzip data, as this library can.
+        int32_t GetMaxCompressionThreads() const;
+        void SetMaxCompressionThreads(int32_t value);
+
         // Gets or sets flag that determines if base time offsets should be used in compact format
         bool GetUseBaseTimeOffsets() const;
         void SetUseBaseTimeOffsets(bool value);
@@ -203,6 +315,16 @@ namespace Transport
         uint64_t GetTotalDataChannelBytesSent();
         uint64_t GetTotalMeasurementsSent();
 
+        // Gets a snapshot of publisher metrics, e.g., measurements published, connected clients, callback
+        // queue depth, pending route updates, route update time and totals across all connections
+        GSF::MetricsSnapshot GetMetricsSnapshot() const;
+
+        // Gets or sets the interval, in milliseconds, at which publisher metrics are published as STAT
+        // measurements; zero, the default, disables publication. Statistic measurements are added to a
+        // copy of the defined MeasurementDetail metadata, so interval should be set before metadata is defined.
+        int32_t GetMetricsPublicationInterval() const;
+        void SetMetricsPublicationInterval(int32_t value);
+
         // Callback registration
         //
         // Callback functions are defined with the following signatures:
@@ -229,6 +351,7 @@ namespace Transport
         void IterateSubscriberConnections(const SubscriberConnectionIteratorHandlerFunction& iteratorHandler, void* userData);
 
         friend class SubscriberConnection;
+        friend class TemporalReplay;
     };
 
     typedef SharedPtr<DataPublisher> DataPublisherPtr;
@@ -29,6 +29,7 @@
 #include "CompactMeasurement.h"
 #include "../Common/Convert.h"
 #include "../Common/EndianConverter.h"
+#include "../Common/Compression.h"
 #include <sstream>
 #include <boost/bind.hpp>
 
@@ -228,12 +229,16 @@ DataSubscriber::DataSubscriber() :
     m_subscriberID(Empty::Guid),
     m_compressPayloadData(true),
     m_compressMetadata(true),
+    m_binaryMetadataFormat(false),
     m_compressSignalIndexCache(true),
     m_disconnecting(false),
     m_userData(nullptr),
-    m_totalCommandChannelBytesReceived(0UL),
-    m_totalDataChannelBytesReceived(0UL),
-    m_totalMeasurementsReceived(0UL),
+    m_totalCommandChannelBytesReceived(m_metrics.GetCounter("CommandChannelBytesReceived")),
+    m_totalDataChannelBytesReceived(m_metrics.GetCounter("DataChannelBytesReceived")),
+    m_totalMeasurementsReceived(m_metrics.GetCounter("MeasurementsReceived")),
+    m_totalPacketsReceived(m_metrics.GetCounter("PacketsReceived")),
+    m_totalPacketsDropped(m_metrics.GetCounter("PacketsDropped")),
+    m_decodeTime(m_metrics.GetHistogram("DecodeTime")),
     m_connected(false),
     m_subscribed(false),
     m_signalIndexCache(nullptr),
@@ -246,6 +251,7 @@ DataSubscriber::DataSubscriber() :
     m_writeBuffer(Common::MaxPacketSize),
     m_dataChannelSocket(m_dataChannelService)
 {
+    m_metrics.RegisterGauge("CallbackQueueDepth", [this] { return static_cast<int64_t>(m_callbackQueue.Size()); });
 }
 
 // Destructor calls disconnect to clean up after itself.
@@ -311,7 +317,7 @@ void DataSubscriber::ReadPayloadHeader(const ErrorCode& error, size_t bytesTrans
     }
 
     // Gather statistics
-    m_totalCommandChannelBytesReceived += Common::PayloadHeaderSize;
+    m_totalCommandChannelBytesReceived->Add(Common::PayloadHeaderSize);
 
     const uint32_t packetSize = EndianConverter::ToLittleEndian<uint32_t>(m_readBuffer.data(), PacketSizeOffset);
 
@@ -349,7 +355,7 @@ void DataSubscriber::ReadPacket(const ErrorCode& error, size_t bytesTransferred)
     }
 
     // Gather statistics
-    m_totalCommandChannelBytesReceived += bytesTransferred;
+    m_totalCommandChannelBytesReceived->Add(bytesTransferred);
 
     // Process response
     ProcessServerResponse(&m_readBuffer[0], 0, ConvertUInt32(bytesTransferred));
@@ -385,7 +391,7 @@ void DataSubscriber::RunDataChannelResponseThread()
         }
 
         // Gather statistics
-        m_totalDataChannelBytesReceived += length;
+        m_totalDataChannelBytesReceived->Add(length);
 
         ProcessServerResponse(&buffer[0], 0, length);
     }
@@ -402,6 +408,8 @@ void DataSubscriber::ProcessServerResponse(uint8_t* buffer, uint32_t offset, uin
     const uint8_t responseCode = buffer[0];
     const uint8_t commandCode = buffer[1];
 
+    m_totalPacketsReceived->Add();
+
     switch (responseCode)
     {
         case ServerResponse::Succeeded:
@@ -550,15 +558,8 @@ void DataSubscriber::HandleUpdateSignalIndexCache(uint8_t* data, uint32_t offset
 
     if (m_compressSignalIndexCache)
     {
-        const MemoryStream memoryStream(data, offset, length);
-
         // Perform zlib decompression on buffer
-        StreamBuffer streamBuffer;
-
-        streamBuffer.push(GZipDecompressor());
-        streamBuffer.push(memoryStream);
-
-        CopyStream(&streamBuffer, uncompressedBuffer);
+        GZipDecompress(data + offset, length, uncompressedBuffer);
     }
     else
     {
@@ -619,10 +620,11 @@ void DataSubscriber::HandleDataPacket(uint8_t* data, uint32_t offset, uint32_t l
 
         // Read measurement count and gather statistics
         const uint32_t count = EndianConverter::ToBigEndian<uint32_t>(data, offset);
-        m_totalMeasurementsReceived += count;
+        m_totalMeasurementsReceived->Add(count);
         offset += 4; //-V112
 
         vector<MeasurementPtr> measurements;
+        MetricTimer decodeTimer(*m_decodeTime);
 
         if (dataPacketFlags & DataPacketFlags::Compressed)
             ParseTSSCMeasurements(data, offset, length, measurements);
@@ -680,6 +682,7 @@ void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint3
         }
 
         // Ignore packets until the reset has occurred.
+        m_totalPacketsDropped->Add();
         return;
     }
 
@@ -723,6 +726,8 @@ void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint3
 
     if (errorMessage.length() > 0)
     {
+        m_totalPacketsDropped->Add();
+
         stringstream errorMessageStream;
         errorMessageStream << "Decompression failure: ";
         errorMessageStream << errorMessage;
@@ -755,6 +760,7 @@ void DataSubscriber::ParseCompactMeasurements(uint8_t* data, uint32_t offset, ui
             if (errorMessageCallback != nullptr)
                 errorMessageCallback(this, "Error parsing measurement");
 
+            m_totalPacketsDropped->Add();
             break;
         }
 
@@ -984,6 +990,21 @@ void DataSubscriber::SetMetadataCompressed(bool compressed)
         SendOperationalModes();
 }
 
+// Returns true if metadata exchange requests binary data set format.
+bool DataSubscriber::IsMetadataBinaryFormat() const
+{
+    return m_binaryMetadataFormat;
+}
+
+// Set the value which determines whether metadata exchange requests binary data set format.
+void DataSubscriber::SetMetadataBinaryFormat(bool binaryFormat)
+{
+    m_binaryMetadataFormat = binaryFormat;
+
+    if (m_commandChannelSocket.is_open())
+        SendOperationalModes();
+}
+
 // Returns true if signal index cache exchange is compressed (GZip only).
 bool DataSubscriber::IsSignalIndexCacheCompressed() const
 {
@@ -1036,9 +1057,9 @@ void DataSubscriber::Connect(const string& hostname, const uint16_t port)
     DnsResolver::iterator hostEndpoint;
     ErrorCode error;
 
-    m_totalCommandChannelBytesReceived = 0UL;
-    m_totalDataChannelBytesReceived = 0UL;
-    m_totalMeasurementsReceived = 0UL;
+    m_totalCommandChannelBytesReceived->Reset();
+    m_totalDataChannelBytesReceived->Reset();
+    m_totalMeasurementsReceived->Reset();
 
     if (m_connected)
         throw SubscriberException("Subscriber is already connected; disconnect first");
@@ -1144,17 +1165,17 @@ void DataSubscriber::Subscribe()
     if (m_subscribed)
         Unsubscribe();
 
-    m_totalMeasurementsReceived = 0UL;
+    m_totalMeasurementsReceived->Reset();
 
     connectionStream << "trackLatestMeasurements=" << m_subscriptionInfo.Throttled << ";";
-    connectionStream << "publishInterval" << m_subscriptionInfo.PublishInterval << ";";
+    connectionStream << "publishInterval=" << m_subscriptionInfo.PublishInterval << ";";
     connectionStream << "includeTime=" << m_subscriptionInfo.IncludeTime << ";";
     connectionStream << "lagTime=" << m_subscriptionInfo.LagTime << ";";
     connectionStream << "leadTime=" << m_subscriptionInfo.LeadTime << ";";
     connectionStream << "useLocalClockAsRealTime=" << m_subscriptionInfo.UseLocalClockAsRealTime << ";";
     connectionStream << "processingInterval=" << m_subscriptionInfo.ProcessingInterval << ";";
     connectionStream << "useMillisecondResolution=" << m_subscriptionInfo.UseMillisecondResolution << ";";
-    connectionStream << "requestNaNValueFilter" << m_subscriptionInfo.RequestNaNValueFilter << ";";
+    connectionStream << "requestNaNValueFilter=" << m_subscriptionInfo.RequestNaNValueFilter << ";";
     connectionStream << "assemblyInfo={source=TimeSeriesPlatformLibrary; version=" GSFTS_VERSION "; buildDate=" GSFTS_BUILD_DATE "};";
 
     if (!m_subscriptionInfo.FilterExpression.empty())
@@ -1339,6 +1360,9 @@ void DataSubscriber::SendOperationalModes()
     if (m_compressMetadata)
         operationalModes |= OperationalModes::CompressMetadata;
 
+    if (m_binaryMetadataFormat)
+        operationalModes |= OperationalModes::UseBinaryMetadataFormat;
+
     if (m_compressSignalIndexCache)
         operationalModes |= OperationalModes::CompressSignalIndexCache;
 
@@ -1349,22 +1373,28 @@ void DataSubscriber::SendOperationalModes()
 // Gets the total number of bytes received via the command channel since last connection.
 uint64_t DataSubscriber::GetTotalCommandChannelBytesReceived() const
 {
-    return m_totalCommandChannelBytesReceived;
+    return m_totalCommandChannelBytesReceived->GetValue();
 }
 
 // Gets the total number of bytes received via the data channel since last connection.
 uint64_t DataSubscriber::GetTotalDataChannelBytesReceived() const
 {
     if (m_subscriptionInfo.UdpDataChannel)
-        return m_totalDataChannelBytesReceived;
+        return m_totalDataChannelBytesReceived->GetValue();
 
-    return m_totalCommandChannelBytesReceived;
+    return m_totalCommandChannelBytesReceived->GetValue();
 }
 
 // Gets the total number of measurements received since last subscription.
 uint64_t DataSubscriber::GetTotalMeasurementsReceived() const
 {
-    return m_totalMeasurementsReceived;
+    return m_totalMeasurementsReceived->GetValue();
+}
+
+// Gets a snapshot of subscriber metrics.
+MetricsSnapshot DataSubscriber::GetMetricsSnapshot() const
+{
+    return m_metrics.GetSnapshot();
 }
 
 // Indicates whether the subscriber is connected.
@@ -30,6 +30,7 @@
 #include "SignalIndexCache.h"
 #include "TSSCDecoder.h"
 #include "../Common/ThreadSafeQueue.h"
+#include "../Common/Metrics.h"
 
 namespace GSF {
 namespace TimeSeries {
@@ -167,14 +168,19 @@ namespace Transport
         Guid m_subscriberID;
         bool m_compressPayloadData;
         bool m_compressMetadata;
+        bool m_binaryMetadataFormat;
         bool m_compressSignalIndexCache;
         volatile bool m_disconnecting;
         void* m_userData;
 
         // Statistics counters
-        uint64_t m_totalCommandChannelBytesReceived;
-        uint64_t m_totalDataChannelBytesReceived;
-        uint64_t m_totalMeasurementsReceived;
+        GSF::MetricsRegistry m_metrics;
+        GSF::MetricCounterPtr m_totalCommandChannelBytesReceived;
+        GSF::MetricCounterPtr m_totalDataChannelBytesReceived;
+        GSF::MetricCounterPtr m_totalMeasurementsReceived;
+        GSF::MetricCounterPtr m_totalPacketsReceived;
+        GSF::MetricCounterPtr m_totalPacketsDropped;
+        GSF::MetricHistogramPtr m_decodeTime;
         bool m_connected;
         bool m_subscribed;
 
@@ -302,6 +308,12 @@ namespace Transport
         bool IsMetadataCompressed() const;
         void SetMetadataCompressed(bool compressed);
 
+        // Gets or sets value that determines whether the binary data set format is requested for metadata
+        // transfer. Publishers that do not support the format respond with XML, so metadata handlers must
+        // check for DataSet binary signature, after decompression, to determine format of received metadata.
+        bool IsMetadataBinaryFormat() const;
+        void SetMetadataBinaryFormat(bool binaryFormat);
+
         // Gets or sets value that determines whether the
         // signal index cache is compressed using GZip.
         bool IsSignalIndexCacheCompressed() const;
@@ -361,6 +373,10 @@ namespace Transport
         uint64_t GetTotalCommandChannelBytesReceived() const;
         uint64_t GetTotalDataChannelBytesReceived() const;
         uint64_t GetTotalMeasurementsReceived() const;
+
+        // Gets a snapshot of subscriber metrics, e.g., packets, bytes and measurements received,
+        // callback queue depth, packets dropped due to decoding errors and packet decoding time
+        GSF::MetricsSnapshot GetMetricsSnapshot() const;
         bool IsConnected() const;
         bool IsSubscribed() const;
     };
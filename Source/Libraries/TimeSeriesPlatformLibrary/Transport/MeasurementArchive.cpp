@@ -0,0 +1,549 @@
+//******************************************************************************************************
+//  MeasurementArchive.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "MeasurementArchive.h"
+#include "../Common/Convert.h"
+#include <boost/filesystem.hpp>
+
+using namespace std;
+using namespace boost::filesystem;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// Segment files start with a small header so that they can be validated when an archive is reopened
+static constexpr const uint32_t SegmentSignature = 0x41465347U; // "GSFA"
+static constexpr const uint32_t SegmentVersion = 1U;
+static constexpr const uint64_t SegmentHeaderSize = 16ULL;
+static constexpr const uint64_t RecordSize = sizeof(ArchiveRecord);
+static constexpr const uint64_t GuidSize = 16ULL;
+static const string SignalsFileName = "signals.dat";
+static const string SegmentFileExtension = ".seg";
+
+ArchiveException::ArchiveException(string message) noexcept :
+    m_message(std::move(message))
+{
+}
+
+const char* ArchiveException::what() const noexcept
+{
+    return &m_message[0];
+}
+
+ArchiveSegment::ArchiveSegment() :
+    Position(0ULL),
+    RecordCount(0ULL),
+    MinTimestamp(Int64::MaxValue),
+    MaxTimestamp(Int64::MinValue)
+{
+}
+
+ArchiveReader::ArchiveReader(vector<ArchiveSegmentPtr> segments, vector<bool> signalFilter, const int64_t startTime, const int64_t stopTime, const uint64_t startPosition, const uint64_t stopPosition) :
+    m_segments(std::move(segments)),
+    m_signalFilter(std::move(signalFilter)),
+    m_startTime(startTime),
+    m_stopTime(stopTime),
+    m_startPosition(startPosition),
+    m_stopPosition(stopPosition),
+    m_records(nullptr),
+    m_segmentIndex(0),
+    m_recordIndex(0ULL),
+    m_recordCount(0ULL)
+{
+}
+
+ArchiveReader::~ArchiveReader()
+{
+    if (m_segmentFile.is_open())
+        m_segmentFile.close();
+}
+
+bool ArchiveReader::OpenNextSegment()
+{
+    if (m_segmentFile.is_open())
+        m_segmentFile.close();
+
+    m_records = nullptr;
+
+    if (m_segmentIndex >= m_segments.size())
+        return false;
+
+    const ArchiveSegmentPtr& segment = m_segments[m_segmentIndex++];
+
+    // Only map the portion of the file that was flushed when the reader was created
+    m_segmentFile.open(segment->FileName, static_cast<size_t>(SegmentHeaderSize + segment->RecordCount * RecordSize));
+
+    if (!m_segmentFile.is_open())
+        throw ArchiveException("Failed to map archive segment \"" + segment->FileName + "\"");
+
+    m_records = reinterpret_cast<const ArchiveRecord*>(m_segmentFile.data() + SegmentHeaderSize);
+
+    // Reader only includes segments that overlap its position range
+    m_recordIndex = m_startPosition > segment->Position ? m_startPosition - segment->Position : 0ULL;
+    m_recordCount = min(segment->RecordCount, m_stopPosition - segment->Position);
+
+    return true;
+}
+
+bool ArchiveReader::SeekNextBlock()
+{
+    const vector<ArchiveTimeBlock>& timeIndex = m_segments[m_segmentIndex - 1]->TimeIndex;
+    size_t blockIndex = static_cast<size_t>(m_recordIndex / MeasurementArchive::TimeIndexBlockSize);
+
+    // Skip any record blocks that do not overlap the requested time range
+    while (blockIndex < timeIndex.size())
+    {
+        const ArchiveTimeBlock& block = timeIndex[blockIndex];
+
+        if (block.MaxTimestamp >= m_startTime && block.MinTimestamp <= m_stopTime)
+        {
+            m_recordIndex = blockIndex * MeasurementArchive::TimeIndexBlockSize;
+            return true;
+        }
+
+        blockIndex++;
+    }
+
+    m_recordIndex = m_recordCount;
+    return false;
+}
+
+bool ArchiveReader::IsIncluded(const uint32_t signalHandle) const
+{
+    if (m_signalFilter.empty())
+        return true;
+
+    return signalHandle < m_signalFilter.size() && m_signalFilter[signalHandle];
+}
+
+bool ArchiveReader::ReadNext(ArchiveRecord& record)
+{
+    while (true)
+    {
+        if (m_records == nullptr || m_recordIndex >= m_recordCount)
+        {
+            if (!OpenNextSegment())
+                return false;
+
+            continue;
+        }
+
+        if (m_recordIndex % MeasurementArchive::TimeIndexBlockSize == 0ULL && !SeekNextBlock())
+            continue;
+
+        const ArchiveRecord& current = m_records[m_recordIndex++];
+
+        if (current.Timestamp >= m_startTime && current.Timestamp <= m_stopTime && IsIncluded(current.SignalHandle))
+        {
+            record = current;
+            return true;
+        }
+    }
+}
+
+MeasurementArchive::MeasurementArchive(string directory) :
+    m_directory(std::move(directory)),
+    m_activeSegment(nullptr),
+    m_maximumSegmentRecords(DefaultMaximumSegmentRecords),
+    m_flushed(true)
+{
+    try
+    {
+        create_directories(m_directory);
+    }
+    catch (filesystem_error& ex)
+    {
+        throw ArchiveException("Failed to create archive directory \"" + m_directory + "\": " + string(ex.what()));
+    }
+
+    LoadSignals();
+    LoadSegments();
+    OpenActiveSegment();
+}
+
+MeasurementArchive::~MeasurementArchive()
+{
+    try
+    {
+        Flush();
+        m_segmentStream.close();
+        m_signalStream.close();
+    }
+    catch (...)
+    {
+        // Nothing can be done about I/O failures during shutdown
+    }
+}
+
+const string& MeasurementArchive::GetDirectory() const
+{
+    return m_directory;
+}
+
+uint64_t MeasurementArchive::GetMaximumSegmentRecords() const
+{
+    return m_maximumSegmentRecords;
+}
+
+void MeasurementArchive::SetMaximumSegmentRecords(const uint64_t value)
+{
+    if (value < TimeIndexBlockSize)
+        throw ArchiveException("Maximum segment records cannot be less than " + ToString(TimeIndexBlockSize));
+
+    m_maximumSegmentRecords = value;
+}
+
+void MeasurementArchive::LoadSignals()
+{
+    const path signalsPath = path(m_directory) / SignalsFileName;
+
+    if (exists(signalsPath))
+    {
+        // Drop any partially written trailing signal ID, e.g., from an unclean shutdown
+        const uint64_t signalCount = file_size(signalsPath) / GuidSize;
+        resize_file(signalsPath, signalCount * GuidSize);
+
+        std::ifstream signalStream(signalsPath.string(), ios::binary);
+        uint8_t buffer[GuidSize];
+
+        for (uint64_t i = 0; i < signalCount; i++)
+        {
+            signalStream.read(reinterpret_cast<char*>(buffer), GuidSize);
+
+            if (!signalStream)
+                throw ArchiveException("Failed to read archive signals file \"" + signalsPath.string() + "\"");
+
+            const Guid signalID = ParseGuid(buffer);
+            m_signalHandles.emplace(signalID, static_cast<uint32_t>(m_signalIDs.size()));
+            m_signalIDs.push_back(signalID);
+        }
+    }
+
+    m_signalStream.open(signalsPath.string(), ios::binary | ios::app);
+
+    if (!m_signalStream)
+        throw ArchiveException("Failed to open archive signals file \"" + signalsPath.string() + "\"");
+}
+
+void MeasurementArchive::LoadSegments()
+{
+    vector<string> fileNames;
+
+    for (directory_iterator iterator(m_directory); iterator != directory_iterator(); ++iterator)
+    {
+        const path& filePath = iterator->path();
+
+        if (is_regular_file(filePath) && filePath.extension().string() == SegmentFileExtension)
+            fileNames.push_back(filePath.string());
+    }
+
+    // Segment file names are zero-padded sequence numbers, so name order is write order
+    sort(fileNames.begin(), fileNames.end());
+
+    uint64_t position = 0ULL;
+
+    for (const auto& fileName : fileNames)
+    {
+        const uint64_t fileSize = file_size(fileName);
+
+        if (fileSize < SegmentHeaderSize)
+            throw ArchiveException("Archive segment \"" + fileName + "\" is missing its header");
+
+        // Drop any partially written trailing record, e.g., from an unclean shutdown
+        const uint64_t recordCount = (fileSize - SegmentHeaderSize) / RecordSize;
+        resize_file(fileName, SegmentHeaderSize + recordCount * RecordSize);
+
+        ArchiveSegmentPtr segment = NewSharedPtr<ArchiveSegment>();
+        segment->FileName = fileName;
+        segment->Position = position;
+        segment->RecordCount = recordCount;
+
+        LoadSegmentIndex(segment);
+        m_segments.push_back(segment);
+        position += recordCount;
+    }
+}
+
+void MeasurementArchive::LoadSegmentIndex(const ArchiveSegmentPtr& segment)
+{
+    boost::iostreams::mapped_file_source segmentFile(segment->FileName, static_cast<size_t>(SegmentHeaderSize + segment->RecordCount * RecordSize));
+    const uint32_t* header = reinterpret_cast<const uint32_t*>(segmentFile.data());
+
+    if (header[0] != SegmentSignature || header[1] != SegmentVersion || header[2] != RecordSize)
+        throw ArchiveException("Archive segment \"" + segment->FileName + "\" has an unrecognized format");
+
+    const ArchiveRecord* records = reinterpret_cast<const ArchiveRecord*>(segmentFile.data() + SegmentHeaderSize);
+
+    for (uint64_t i = 0; i < segment->RecordCount; i++)
+        UpdateSegmentIndex(*segment, i, records[i].Timestamp);
+}
+
+void MeasurementArchive::UpdateSegmentIndex(ArchiveSegment& segment, const uint64_t recordIndex, const int64_t timestamp)
+{
+    const size_t blockIndex = static_cast<size_t>(recordIndex / TimeIndexBlockSize);
+
+    if (blockIndex >= segment.TimeIndex.size())
+        segment.TimeIndex.push_back({ timestamp, timestamp });
+
+    ArchiveTimeBlock& block = segment.TimeIndex[blockIndex];
+
+    if (timestamp < block.MinTimestamp)
+        block.MinTimestamp = timestamp;
+
+    if (timestamp > block.MaxTimestamp)
+        block.MaxTimestamp = timestamp;
+
+    if (timestamp < segment.MinTimestamp)
+        segment.MinTimestamp = timestamp;
+
+    if (timestamp > segment.MaxTimestamp)
+        segment.MaxTimestamp = timestamp;
+}
+
+string MeasurementArchive::GetSegmentFileName(const uint32_t segmentNumber) const
+{
+    char fileName[32];
+    snprintf(fileName, sizeof(fileName), "%08u", segmentNumber);
+    return (path(m_directory) / (string(fileName) + SegmentFileExtension)).string();
+}
+
+void MeasurementArchive::OpenActiveSegment()
+{
+    if (m_segmentStream.is_open())
+        m_segmentStream.close();
+
+    // Reopen last segment for append if it still has room
+    if (!m_segments.empty() && m_segments.back()->RecordCount < m_maximumSegmentRecords)
+    {
+        m_activeSegment = m_segments.back();
+        m_segmentStream.open(m_activeSegment->FileName, ios::binary | ios::app);
+    }
+    else
+    {
+        m_activeSegment = NewSharedPtr<ArchiveSegment>();
+        m_activeSegment->FileName = GetSegmentFileName(ConvertUInt32(m_segments.size() + 1));
+
+        if (!m_segments.empty())
+            m_activeSegment->Position = m_segments.back()->Position + m_segments.back()->RecordCount;
+
+        m_segments.push_back(m_activeSegment);
+
+        m_segmentStream.open(m_activeSegment->FileName, ios::binary | ios::trunc);
+
+        const uint32_t header[] = { SegmentSignature, SegmentVersion, static_cast<uint32_t>(RecordSize), 0U };
+        m_segmentStream.write(reinterpret_cast<const char*>(header), SegmentHeaderSize);
+    }
+
+    if (!m_segmentStream)
+        throw ArchiveException("Failed to open archive segment \"" + m_activeSegment->FileName + "\" for writing");
+}
+
+uint32_t MeasurementArchive::GetOrAddSignalHandle(const Guid& signalID)
+{
+    const auto iterator = m_signalHandles.find(signalID);
+
+    if (iterator != m_signalHandles.end())
+        return iterator->second;
+
+    const uint32_t signalHandle = ConvertUInt32(m_signalIDs.size());
+    m_signalHandles.emplace(signalID, signalHandle);
+    m_signalIDs.push_back(signalID);
+    m_signalStream.write(reinterpret_cast<const char*>(signalID.data), GuidSize);
+
+    return signalHandle;
+}
+
+void MeasurementArchive::AppendRecord(const ArchiveRecord& record)
+{
+    if (m_activeSegment->RecordCount >= m_maximumSegmentRecords)
+    {
+        m_segmentStream.flush();
+        OpenActiveSegment();
+    }
+
+    m_segmentStream.write(reinterpret_cast<const char*>(&record), RecordSize);
+
+    // Time index is only updated after write so readers never see unwritten records
+    UpdateSegmentIndex(*m_activeSegment, m_activeSegment->RecordCount, record.Timestamp);
+    m_activeSegment->RecordCount++;
+    m_flushed = false;
+}
+
+void MeasurementArchive::Append(const Measurement& measurement)
+{
+    ScopeLock lock(m_lock);
+    ArchiveRecord record;
+
+    record.Timestamp = measurement.Timestamp;
+    record.SignalHandle = GetOrAddSignalHandle(measurement.SignalID);
+    record.Flags = static_cast<uint32_t>(measurement.Flags);
+    record.Value = measurement.Value;
+
+    AppendRecord(record);
+}
+
+void MeasurementArchive::Append(const vector<MeasurementPtr>& measurements)
+{
+    ScopeLock lock(m_lock);
+    ArchiveRecord record;
+
+    for (const auto& measurement : measurements)
+    {
+        record.Timestamp = measurement->Timestamp;
+        record.SignalHandle = GetOrAddSignalHandle(measurement->SignalID);
+        record.Flags = static_cast<uint32_t>(measurement->Flags);
+        record.Value = measurement->Value;
+
+        AppendRecord(record);
+    }
+}
+
+void MeasurementArchive::Append(const vector<RoutedMeasurementRecord>& measurements)
+{
+    ScopeLock lock(m_lock);
+    ArchiveRecord record;
+
+    for (const auto& measurement : measurements)
+    {
+        record.Timestamp = measurement.Record->Timestamp;
+        record.SignalHandle = GetOrAddSignalHandle(*measurement.SignalID);
+        record.Flags = static_cast<uint32_t>(measurement.Record->Flags);
+        record.Value = measurement.Record->Value;
+
+        AppendRecord(record);
+    }
+}
+
+void MeasurementArchive::Flush()
+{
+    ScopeLock lock(m_lock);
+    FlushStreams();
+}
+
+void MeasurementArchive::FlushStreams()
+{
+    if (m_flushed)
+        return;
+
+    m_signalStream.flush();
+    m_segmentStream.flush();
+
+    if (!m_segmentStream || !m_signalStream)
+        throw ArchiveException("Failed to flush archive \"" + m_directory + "\"");
+
+    m_flushed = true;
+}
+
+bool MeasurementArchive::TryGetTimeRange(int64_t& startTime, int64_t& stopTime)
+{
+    ScopeLock lock(m_lock);
+
+    startTime = Int64::MaxValue;
+    stopTime = Int64::MinValue;
+
+    for (const auto& segment : m_segments)
+    {
+        if (segment->RecordCount == 0ULL)
+            continue;
+
+        if (segment->MinTimestamp < startTime)
+            startTime = segment->MinTimestamp;
+
+        if (segment->MaxTimestamp > stopTime)
+            stopTime = segment->MaxTimestamp;
+    }
+
+    return startTime <= stopTime;
+}
+
+bool MeasurementArchive::TryGetSignalHandle(const Guid& signalID, uint32_t& signalHandle)
+{
+    ScopeLock lock(m_lock);
+    const auto iterator = m_signalHandles.find(signalID);
+
+    if (iterator == m_signalHandles.end())
+        return false;
+
+    signalHandle = iterator->second;
+    return true;
+}
+
+Guid MeasurementArchive::GetSignalID(const uint32_t signalHandle)
+{
+    ScopeLock lock(m_lock);
+
+    if (signalHandle >= m_signalIDs.size())
+        return Empty::Guid;
+
+    return m_signalIDs[signalHandle];
+}
+
+uint64_t MeasurementArchive::GetPosition()
+{
+    ScopeLock lock(m_lock);
+    return m_activeSegment->Position + m_activeSegment->RecordCount;
+}
+
+TemporalDataReaderPtr MeasurementArchive::CreateReader(const int64_t startTime, const int64_t stopTime, const unordered_set<Guid>& signalIDs, const uint64_t startPosition, const uint64_t stopPosition)
+{
+    ScopeLock lock(m_lock);
+    vector<ArchiveSegmentPtr> segments;
+    vector<bool> signalFilter;
+
+    // Make sure all appended records are visible to memory-mapped readers
+    FlushStreams();
+
+    for (const auto& segment : m_segments)
+    {
+        if (segment->RecordCount == 0ULL || segment->MaxTimestamp < startTime || segment->MinTimestamp > stopTime)
+            continue;
+
+        if (segment->Position + segment->RecordCount <= startPosition || segment->Position >= stopPosition)
+            continue;
+
+        // Active segment continues to grow, so reader gets a snapshot of its current state
+        if (segment == m_activeSegment)
+            segments.push_back(NewSharedPtr<ArchiveSegment>(*segment));
+        else
+            segments.push_back(segment);
+    }
+
+    if (!signalIDs.empty())
+    {
+        signalFilter.resize(m_signalIDs.size(), false);
+
+        for (const auto& signalID : signalIDs)
+        {
+            const auto iterator = m_signalHandles.find(signalID);
+
+            if (iterator != m_signalHandles.end())
+                signalFilter[iterator->second] = true;
+        }
+
+        // No requested signals exist in archive
+        if (segments.empty() || find(signalFilter.begin(), signalFilter.end(), true) == signalFilter.end())
+            segments.clear();
+    }
+
+    return NewSharedPtr<ArchiveReader>(std::move(segments), std::move(signalFilter), startTime, stopTime, startPosition, stopPosition);
+}
@@ -0,0 +1,168 @@
+//******************************************************************************************************
+//  MeasurementArchive.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __MEASUREMENT_ARCHIVE_H
+#define __MEASUREMENT_ARCHIVE_H
+
+#include "../Common/CommonTypes.h"
+#include "TransportTypes.h"
+#include "TemporalDataSource.h"
+#include <fstream>
+#include <boost/iostreams/device/mapped_file.hpp>
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Simple exception type thrown by the measurement archive
+    class ArchiveException : public Exception
+    {
+    private:
+        std::string m_message;
+
+    public:
+        ArchiveException(std::string message) noexcept;
+        const char* what() const noexcept;
+    };
+
+    // Minimum and maximum timestamps for a block of consecutive records in a segment
+    struct ArchiveTimeBlock
+    {
+        int64_t MinTimestamp;
+        int64_t MaxTimestamp;
+    };
+
+    // Catalog entry for a single segment file
+    struct ArchiveSegment
+    {
+        std::string FileName;
+        uint64_t Position;
+        uint64_t RecordCount;
+        int64_t MinTimestamp;
+        int64_t MaxTimestamp;
+        std::vector<ArchiveTimeBlock> TimeIndex;
+
+        ArchiveSegment();
+    };
+
+    typedef SharedPtr<ArchiveSegment> ArchiveSegmentPtr;
+
+    class MeasurementArchive;
+    typedef SharedPtr<MeasurementArchive> MeasurementArchivePtr;
+
+    // Forward-only cursor over archived records for a time range and range of archive positions, reading
+    // directly from memory-mapped segment files. Records are returned in archive order.
+    class ArchiveReader : public TemporalDataReader // NOLINT
+    {
+    private:
+        std::vector<ArchiveSegmentPtr> m_segments;
+        std::vector<bool> m_signalFilter;
+        const int64_t m_startTime;
+        const int64_t m_stopTime;
+        const uint64_t m_startPosition;
+        const uint64_t m_stopPosition;
+        boost::iostreams::mapped_file_source m_segmentFile;
+        const ArchiveRecord* m_records;
+        size_t m_segmentIndex;
+        uint64_t m_recordIndex;
+        uint64_t m_recordCount;
+
+        bool OpenNextSegment();
+        bool SeekNextBlock();
+        bool IsIncluded(uint32_t signalHandle) const;
+
+    public:
+        ArchiveReader(std::vector<ArchiveSegmentPtr> segments, std::vector<bool> signalFilter, int64_t startTime, int64_t stopTime, uint64_t startPosition, uint64_t stopPosition);
+        ~ArchiveReader();
+
+        bool ReadNext(ArchiveRecord& record) override;
+    };
+
+    typedef SharedPtr<ArchiveReader> ArchiveReaderPtr;
+
+    // Append-only binary measurement archive. Measurements are written as fixed-size records, keyed
+    // by a signal handle and timestamp, into a directory of size-limited segment files. Each segment
+    // keeps a sparse time index of record blocks so that readers can skip data outside a requested
+    // time range without scanning it.
+    class MeasurementArchive : public TemporalDataSource // NOLINT
+    {
+    private:
+        const std::string m_directory;
+        std::unordered_map<GSF::Guid, uint32_t> m_signalHandles;
+        std::vector<GSF::Guid> m_signalIDs;
+        std::vector<ArchiveSegmentPtr> m_segments;
+        ArchiveSegmentPtr m_activeSegment;
+        std::ofstream m_segmentStream;
+        std::ofstream m_signalStream;
+        uint64_t m_maximumSegmentRecords;
+        bool m_flushed;
+        GSF::Mutex m_lock;
+
+        uint32_t GetOrAddSignalHandle(const GSF::Guid& signalID);
+        void AppendRecord(const ArchiveRecord& record);
+        void FlushStreams();
+        void OpenActiveSegment();
+        void LoadSignals();
+        void LoadSegments();
+        std::string GetSegmentFileName(uint32_t segmentNumber) const;
+
+        static void LoadSegmentIndex(const ArchiveSegmentPtr& segment);
+        static void UpdateSegmentIndex(ArchiveSegment& segment, uint64_t recordIndex, int64_t timestamp);
+
+    public:
+        // Opens or creates an archive in the specified directory
+        MeasurementArchive(std::string directory);
+        ~MeasurementArchive();
+
+        const std::string& GetDirectory() const;
+
+        // Gets or sets the maximum number of records written to a segment file before a new segment is started
+        uint64_t GetMaximumSegmentRecords() const;
+        void SetMaximumSegmentRecords(uint64_t value);
+
+        // Appends measurements to the archive
+        void Append(const Measurement& measurement);
+        void Append(const std::vector<MeasurementPtr>& measurements);
+        void Append(const std::vector<RoutedMeasurementRecord>& measurements);
+
+        // Flushes buffered records to disk, making them visible to readers
+        void Flush();
+
+        // Gets the signal handle for the specified signal ID, returns false if signal has never been archived
+        bool TryGetSignalHandle(const GSF::Guid& signalID, uint32_t& signalHandle);
+
+        // TemporalDataSource implementation
+        bool TryGetTimeRange(int64_t& startTime, int64_t& stopTime) override;
+        GSF::Guid GetSignalID(uint32_t signalHandle) override;
+        uint64_t GetPosition() override;
+        TemporalDataReaderPtr CreateReader(int64_t startTime, int64_t stopTime, const std::unordered_set<GSF::Guid>& signalIDs = {}, uint64_t startPosition = 0ULL, uint64_t stopPosition = UInt64::MaxValue) override;
+
+        // Number of records per time index block
+        static constexpr const uint64_t TimeIndexBlockSize = 4096ULL;
+
+        // Default maximum records per segment, i.e., ~96MB segment files
+        static constexpr const uint64_t DefaultMaximumSegmentRecords = 4194304ULL;
+    };
+}}}
+
+#endif
@@ -0,0 +1,403 @@
+//******************************************************************************************************
+//  MeasurementRingBuffer.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "MeasurementRingBuffer.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+static constexpr const size_t InitialSignalCapacity = 64;
+
+RingBufferReader::RingBufferReader(vector<ArchiveRecord> records) :
+    m_records(std::move(records)),
+    m_index(0)
+{
+}
+
+bool RingBufferReader::ReadNext(ArchiveRecord& record)
+{
+    if (m_index >= m_records.size())
+        return false;
+
+    record = m_records[m_index++];
+    return true;
+}
+
+MeasurementRingBuffer::SignalBuffer::SignalBuffer() :
+    Head(0),
+    Count(0),
+    Sorted(true)
+{
+}
+
+size_t MeasurementRingBuffer::SignalBuffer::Position(const size_t index) const
+{
+    return (Head + index) % Timestamps.size();
+}
+
+void MeasurementRingBuffer::SignalBuffer::Append(const int64_t timestamp, const float64_t value, const uint32_t flags, const uint64_t position)
+{
+    // Grow capacity when full, unrolling existing data so that it starts at position zero
+    if (Count == Timestamps.size())
+    {
+        const size_t capacity = Count == 0 ? InitialSignalCapacity : Count * 2;
+        vector<int64_t> timestamps(capacity);
+        vector<float64_t> values(capacity);
+        vector<uint32_t> flagValues(capacity);
+        vector<uint64_t> positions(capacity);
+
+        for (size_t i = 0; i < Count; i++)
+        {
+            const size_t index = Position(i);
+            timestamps[i] = Timestamps[index];
+            values[i] = Values[index];
+            flagValues[i] = Flags[index];
+            positions[i] = Positions[index];
+        }
+
+        Timestamps.swap(timestamps);
+        Values.swap(values);
+        Flags.swap(flagValues);
+        Positions.swap(positions);
+        Head = 0;
+    }
+
+    if (Count > 0 && timestamp < Timestamps[Position(Count - 1)])
+        Sorted = false;
+
+    const size_t index = Position(Count);
+
+    Timestamps[index] = timestamp;
+    Values[index] = value;
+    Flags[index] = flags;
+    Positions[index] = position;
+    Count++;
+}
+
+size_t MeasurementRingBuffer::SignalBuffer::EvictBefore(const int64_t timestamp)
+{
+    size_t evicted = 0;
+
+    while (Count > 0 && Timestamps[Head] < timestamp)
+    {
+        Head = (Head + 1) % Timestamps.size();
+        Count--;
+        evicted++;
+    }
+
+    if (Count == 0)
+        Sorted = true;
+
+    return evicted;
+}
+
+size_t MeasurementRingBuffer::SignalBuffer::LowerBound(const int64_t timestamp) const
+{
+    // Out of order data requires a full scan
+    if (!Sorted)
+        return 0;
+
+    size_t first = 0;
+    size_t count = Count;
+
+    while (count > 0)
+    {
+        const size_t step = count / 2;
+        const size_t index = first + step;
+
+        if (Timestamps[Position(index)] < timestamp)
+        {
+            first = index + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    return first;
+}
+
+size_t MeasurementRingBuffer::SignalBuffer::PositionLowerBound(const uint64_t position) const
+{
+    // Records are stored in the order they were added, so positions are always sorted
+    size_t first = 0;
+    size_t count = Count;
+
+    while (count > 0)
+    {
+        const size_t step = count / 2;
+        const size_t index = first + step;
+
+        if (Positions[Position(index)] < position)
+        {
+            first = index + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    return first;
+}
+
+MeasurementRingBuffer::MeasurementRingBuffer(const int64_t retentionPeriod, const uint64_t maximumBytes) :
+    m_retentionPeriod(retentionPeriod),
+    m_maximumBytes(maximumBytes),
+    m_recordCount(0ULL),
+    m_position(0ULL),
+    m_latestTimestamp(Int64::MinValue),
+    m_lastSweepTimestamp(Int64::MinValue)
+{
+}
+
+int64_t MeasurementRingBuffer::GetRetentionPeriod() const
+{
+    return m_retentionPeriod;
+}
+
+void MeasurementRingBuffer::SetRetentionPeriod(const int64_t value)
+{
+    ScopeLock lock(m_lock);
+    m_retentionPeriod = value;
+    m_lastSweepTimestamp = Int64::MinValue;
+    ApplyRetention();
+}
+
+uint64_t MeasurementRingBuffer::GetMaximumBytes() const
+{
+    return m_maximumBytes;
+}
+
+void MeasurementRingBuffer::SetMaximumBytes(const uint64_t value)
+{
+    ScopeLock lock(m_lock);
+    m_maximumBytes = value;
+    ApplyRetention();
+}
+
+uint64_t MeasurementRingBuffer::GetBytesUsed()
+{
+    ScopeLock lock(m_lock);
+    return m_recordCount * RecordBytes;
+}
+
+MeasurementRingBuffer::SignalBuffer& MeasurementRingBuffer::GetSignalBuffer(const Guid& signalID)
+{
+    const auto iterator = m_signalHandles.find(signalID);
+
+    if (iterator != m_signalHandles.end())
+        return m_buffers[iterator->second];
+
+    m_signalHandles.emplace(signalID, ConvertUInt32(m_signalIDs.size()));
+    m_signalIDs.push_back(signalID);
+    m_buffers.emplace_back();
+
+    return m_buffers.back();
+}
+
+void MeasurementRingBuffer::Append(SignalBuffer& buffer, const int64_t timestamp, const float64_t value, const uint32_t flags)
+{
+    buffer.Append(timestamp, value, flags, m_position++);
+    m_recordCount++;
+
+    if (timestamp > m_latestTimestamp)
+        m_latestTimestamp = timestamp;
+}
+
+void MeasurementRingBuffer::Append(const Measurement& measurement)
+{
+    ScopeLock lock(m_lock);
+    Append(GetSignalBuffer(measurement.SignalID), measurement.Timestamp, measurement.Value, static_cast<uint32_t>(measurement.Flags));
+    ApplyRetention();
+}
+
+void MeasurementRingBuffer::Append(const vector<MeasurementPtr>& measurements)
+{
+    ScopeLock lock(m_lock);
+
+    for (const auto& measurement : measurements)
+        Append(GetSignalBuffer(measurement->SignalID), measurement->Timestamp, measurement->Value, static_cast<uint32_t>(measurement->Flags));
+
+    ApplyRetention();
+}
+
+void MeasurementRingBuffer::Append(const vector<RoutedMeasurementRecord>& measurements)
+{
+    ScopeLock lock(m_lock);
+
+    for (const auto& measurement : measurements)
+        Append(GetSignalBuffer(*measurement.SignalID), measurement.Record->Timestamp, measurement.Record->Value, static_cast<uint32_t>(measurement.Record->Flags));
+
+    ApplyRetention();
+}
+
+void MeasurementRingBuffer::EvictBefore(const int64_t timestamp)
+{
+    for (auto& buffer : m_buffers)
+        m_recordCount -= buffer.EvictBefore(timestamp);
+}
+
+void MeasurementRingBuffer::ApplyRetention()
+{
+    if (m_recordCount == 0ULL)
+        return;
+
+    // Time based retention is applied to all signals at most once per second of data
+    const int64_t cutoff = m_latestTimestamp - m_retentionPeriod;
+
+    if (cutoff - m_lastSweepTimestamp >= Ticks::PerSecond)
+    {
+        EvictBefore(cutoff);
+        m_lastSweepTimestamp = cutoff;
+    }
+
+    // When over memory limit, evict oldest data, freeing an extra tenth of the limit to avoid evicting on every append
+    while (m_recordCount > 0ULL && m_recordCount * RecordBytes > m_maximumBytes)
+    {
+        int64_t oldestTimestamp = Int64::MaxValue;
+
+        for (const auto& buffer : m_buffers)
+        {
+            if (buffer.Count > 0 && buffer.Timestamps[buffer.Head] < oldestTimestamp)
+                oldestTimestamp = buffer.Timestamps[buffer.Head];
+        }
+
+        const uint64_t bytesUsed = m_recordCount * RecordBytes;
+        const float64_t evictionRatio = min(1.0, static_cast<float64_t>(bytesUsed - m_maximumBytes + m_maximumBytes / 10ULL) / static_cast<float64_t>(bytesUsed));
+        const int64_t span = m_latestTimestamp - oldestTimestamp;
+
+        EvictBefore(oldestTimestamp + max(static_cast<int64_t>(1), static_cast<int64_t>(span * evictionRatio)));
+    }
+}
+
+bool MeasurementRingBuffer::TryGetTimeRange(int64_t& startTime, int64_t& stopTime)
+{
+    ScopeLock lock(m_lock);
+
+    startTime = Int64::MaxValue;
+    stopTime = Int64::MinValue;
+
+    for (const auto& buffer : m_buffers)
+    {
+        if (buffer.Count == 0)
+            continue;
+
+        // Only first and last values need to be checked for sorted data
+        if (buffer.Sorted)
+        {
+            startTime = min(startTime, buffer.Timestamps[buffer.Head]);
+            stopTime = max(stopTime, buffer.Timestamps[buffer.Position(buffer.Count - 1)]);
+            continue;
+        }
+
+        for (size_t i = 0; i < buffer.Count; i++)
+        {
+            const int64_t timestamp = buffer.Timestamps[buffer.Position(i)];
+            startTime = min(startTime, timestamp);
+            stopTime = max(stopTime, timestamp);
+        }
+    }
+
+    return startTime <= stopTime;
+}
+
+Guid MeasurementRingBuffer::GetSignalID(const uint32_t signalHandle)
+{
+    ScopeLock lock(m_lock);
+
+    if (signalHandle >= m_signalIDs.size())
+        return Empty::Guid;
+
+    return m_signalIDs[signalHandle];
+}
+
+uint64_t MeasurementRingBuffer::GetPosition()
+{
+    ScopeLock lock(m_lock);
+    return m_position;
+}
+
+TemporalDataReaderPtr MeasurementRingBuffer::CreateReader(const int64_t startTime, const int64_t stopTime, const unordered_set<Guid>& signalIDs, const uint64_t startPosition, const uint64_t stopPosition)
+{
+    vector<uint32_t> signalHandles;
+    vector<ArchiveRecord> records;
+
+    // Readers work from a snapshot so that replay does not hold the lock that live publication needs
+    m_lock.lock();
+
+    if (signalIDs.empty())
+    {
+        for (uint32_t i = 0; i < ConvertUInt32(m_signalIDs.size()); i++)
+            signalHandles.push_back(i);
+    }
+    else
+    {
+        for (const auto& signalID : signalIDs)
+        {
+            const auto iterator = m_signalHandles.find(signalID);
+
+            if (iterator != m_signalHandles.end())
+                signalHandles.push_back(iterator->second);
+        }
+    }
+
+    for (const uint32_t signalHandle : signalHandles)
+    {
+        const SignalBuffer& buffer = m_buffers[signalHandle];
+
+        for (size_t i = max(buffer.LowerBound(startTime), buffer.PositionLowerBound(startPosition)); i < buffer.Count; i++)
+        {
+            const size_t position = buffer.Position(i);
+            const int64_t timestamp = buffer.Timestamps[position];
+
+            if (buffer.Positions[position] >= stopPosition)
+                break;
+
+            if (timestamp > stopTime)
+            {
+                if (buffer.Sorted)
+                    break;
+
+                continue;
+            }
+
+            if (timestamp >= startTime)
+                records.push_back({ timestamp, signalHandle, buffer.Flags[position], buffer.Values[position] });
+        }
+    }
+
+    m_lock.unlock();
+
+    stable_sort(records.begin(), records.end(), [](const ArchiveRecord& left, const ArchiveRecord& right)
+    {
+        return left.Timestamp < right.Timestamp;
+    });
+
+    return NewSharedPtr<RingBufferReader>(std::move(records));
+}
@@ -0,0 +1,128 @@
+//******************************************************************************************************
+//  MeasurementRingBuffer.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __MEASUREMENT_RING_BUFFER_H
+#define __MEASUREMENT_RING_BUFFER_H
+
+#include "../Common/CommonTypes.h"
+#include "TransportTypes.h"
+#include "TemporalDataSource.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Reader over a snapshot of ring buffer records, ordered by timestamp
+    class RingBufferReader : public TemporalDataReader // NOLINT
+    {
+    private:
+        std::vector<ArchiveRecord> m_records;
+        size_t m_index;
+
+    public:
+        RingBufferReader(std::vector<ArchiveRecord> records);
+
+        bool ReadNext(ArchiveRecord& record) override;
+    };
+
+    // In-memory short-window historian. Recent measurements are kept columnarly per signal, i.e., separate
+    // timestamp, value, flag and position arrays in a circular buffer for each signal handle. Data older than the
+    // retention period, or the oldest data when the memory limit is exceeded, is evicted as new data arrives.
+    class MeasurementRingBuffer : public TemporalDataSource // NOLINT
+    {
+    private:
+        // Columnar circular buffer for a single signal
+        struct SignalBuffer
+        {
+            std::vector<int64_t> Timestamps;
+            std::vector<float64_t> Values;
+            std::vector<uint32_t> Flags;
+            std::vector<uint64_t> Positions;
+            size_t Head;
+            size_t Count;
+            bool Sorted;
+
+            SignalBuffer();
+
+            size_t Position(size_t index) const;
+            void Append(int64_t timestamp, float64_t value, uint32_t flags, uint64_t position);
+            size_t EvictBefore(int64_t timestamp);
+            size_t LowerBound(int64_t timestamp) const;
+            size_t PositionLowerBound(uint64_t position) const;
+        };
+
+        std::unordered_map<GSF::Guid, uint32_t> m_signalHandles;
+        std::vector<GSF::Guid> m_signalIDs;
+        std::vector<SignalBuffer> m_buffers;
+        int64_t m_retentionPeriod;
+        uint64_t m_maximumBytes;
+        uint64_t m_recordCount;
+        uint64_t m_position;
+        int64_t m_latestTimestamp;
+        int64_t m_lastSweepTimestamp;
+        GSF::Mutex m_lock;
+
+        SignalBuffer& GetSignalBuffer(const GSF::Guid& signalID);
+        void Append(SignalBuffer& buffer, int64_t timestamp, float64_t value, uint32_t flags);
+        void ApplyRetention();
+        void EvictBefore(int64_t timestamp);
+
+    public:
+        MeasurementRingBuffer(int64_t retentionPeriod = DefaultRetentionPeriod, uint64_t maximumBytes = DefaultMaximumBytes);
+
+        // Gets or sets the period of time, in ticks, measurements are retained relative to latest received timestamp
+        int64_t GetRetentionPeriod() const;
+        void SetRetentionPeriod(int64_t value);
+
+        // Gets or sets the maximum number of bytes used to store measurement data
+        uint64_t GetMaximumBytes() const;
+        void SetMaximumBytes(uint64_t value);
+
+        // Gets number of bytes currently used to store measurement data
+        uint64_t GetBytesUsed();
+
+        // Appends measurements to the buffer
+        void Append(const Measurement& measurement);
+        void Append(const std::vector<MeasurementPtr>& measurements);
+        void Append(const std::vector<RoutedMeasurementRecord>& measurements);
+
+        // TemporalDataSource implementation
+        bool TryGetTimeRange(int64_t& startTime, int64_t& stopTime) override;
+        GSF::Guid GetSignalID(uint32_t signalHandle) override;
+        uint64_t GetPosition() override;
+        TemporalDataReaderPtr CreateReader(int64_t startTime, int64_t stopTime, const std::unordered_set<GSF::Guid>& signalIDs = {}, uint64_t startPosition = 0ULL, uint64_t stopPosition = UInt64::MaxValue) override;
+
+        // Storage size, in bytes, of one buffered measurement
+        static constexpr const uint64_t RecordBytes = sizeof(int64_t) + sizeof(float64_t) + sizeof(uint32_t) + sizeof(uint64_t);
+
+        // Default retention period of five minutes
+        static constexpr const int64_t DefaultRetentionPeriod = Ticks::PerMinute * 5LL;
+
+        // Default memory limit of 256MB
+        static constexpr const uint64_t DefaultMaximumBytes = 268435456ULL;
+    };
+
+    typedef SharedPtr<MeasurementRingBuffer> MeasurementRingBufferPtr;
+}}}
+
+#endif
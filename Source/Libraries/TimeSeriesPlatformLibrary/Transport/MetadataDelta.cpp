@@ -0,0 +1,527 @@
+//******************************************************************************************************
+//  MetadataDelta.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "MetadataDelta.h"
+#include "../Common/Convert.h"
+#include "../Common/EndianConverter.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+using namespace GSF::TimeSeries::Transport;
+
+static const uint8_t VersionedMetadataFormat = 1;
+static const datetime_t DateTimeEpoch(boost::gregorian::date(1970, 1, 1));
+
+// Primary key columns of known meta-data tables
+static const StringMap<vector<string>> MetadataKeyColumns =
+{
+    { "DeviceDetail", { "Acronym" } },
+    { "MeasurementDetail", { "SignalID" } },
+    { "PhasorDetail", { "DeviceAcronym", "SourceIndex" } }
+};
+
+// Appends value in a comparable form, null values are distinguished from empty values
+template<class T>
+static void AppendValue(string& text, const DataRowPtr& row, const int32_t columnIndex, Nullable<T> (DataRow::*getValue)(int32_t))
+{
+    const Nullable<T> value = ((*row).*getValue)(columnIndex);
+
+    if (!value.HasValue())
+    {
+        text.push_back('\0');
+        return;
+    }
+
+    text.push_back('\1');
+    text.append(reinterpret_cast<const char*>(&value.GetValueOrDefault()), sizeof(T));
+}
+
+static void AppendValue(string& text, const DataRowPtr& row, const int32_t columnIndex)
+{
+    const DataColumnPtr& column = row->Parent()->Column(columnIndex);
+
+    switch (column->Type())
+    {
+        case DataType::String:
+        {
+            const Nullable<string> value = row->ValueAsString(columnIndex);
+
+            if (value.HasValue())
+            {
+                const uint32_t size = ConvertUInt32(value.GetValueOrDefault().size());
+                text.push_back('\1');
+                text.append(reinterpret_cast<const char*>(&size), sizeof(uint32_t));
+                text.append(value.GetValueOrDefault());
+            }
+            else
+            {
+                text.push_back('\0');
+            }
+            break;
+        }
+        case DataType::Boolean:
+            AppendValue<bool>(text, row, columnIndex, &DataRow::ValueAsBoolean);
+            break;
+        case DataType::DateTime:
+        {
+            const Nullable<datetime_t> value = row->ValueAsDateTime(columnIndex);
+
+            if (value.HasValue())
+            {
+                const datetime_t& timestamp = value.GetValueOrDefault();
+                const int64_t microseconds = timestamp.is_special() ? Int64::MinValue : (timestamp - DateTimeEpoch).total_microseconds();
+                text.push_back('\1');
+                text.append(reinterpret_cast<const char*>(&microseconds), sizeof(int64_t));
+            }
+            else
+            {
+                text.push_back('\0');
+            }
+            break;
+        }
+        case DataType::Single:
+            AppendValue<float32_t>(text, row, columnIndex, &DataRow::ValueAsSingle);
+            break;
+        case DataType::Double:
+            AppendValue<float64_t>(text, row, columnIndex, &DataRow::ValueAsDouble);
+            break;
+        case DataType::Decimal:
+        {
+            const Nullable<decimal_t> value = row->ValueAsDecimal(columnIndex);
+
+            if (value.HasValue())
+            {
+                text.push_back('\1');
+                text.append(value.GetValueOrDefault().str());
+                text.push_back('\0');
+            }
+            else
+            {
+                text.push_back('\0');
+            }
+            break;
+        }
+        case DataType::Guid:
+            AppendValue<Guid>(text, row, columnIndex, &DataRow::ValueAsGuid);
+            break;
+        case DataType::Int8:
+            AppendValue<int8_t>(text, row, columnIndex, &DataRow::ValueAsInt8);
+            break;
+        case DataType::Int16:
+            AppendValue<int16_t>(text, row, columnIndex, &DataRow::ValueAsInt16);
+            break;
+        case DataType::Int32:
+            AppendValue<int32_t>(text, row, columnIndex, &DataRow::ValueAsInt32);
+            break;
+        case DataType::Int64:
+            AppendValue<int64_t>(text, row, columnIndex, &DataRow::ValueAsInt64);
+            break;
+        case DataType::UInt8:
+            AppendValue<uint8_t>(text, row, columnIndex, &DataRow::ValueAsUInt8);
+            break;
+        case DataType::UInt16:
+            AppendValue<uint16_t>(text, row, columnIndex, &DataRow::ValueAsUInt16);
+            break;
+        case DataType::UInt32:
+            AppendValue<uint32_t>(text, row, columnIndex, &DataRow::ValueAsUInt32);
+            break;
+        case DataType::UInt64:
+            AppendValue<uint64_t>(text, row, columnIndex, &DataRow::ValueAsUInt64);
+            break;
+        default:
+            throw DataSetException("Unexpected column data type encountered");
+    }
+}
+
+static bool SchemaEquals(const DataTablePtr& left, const DataTablePtr& right)
+{
+    if (left->ColumnCount() != right->ColumnCount())
+        return false;
+
+    for (int32_t i = 0; i < left->ColumnCount(); i++)
+    {
+        const DataColumnPtr& leftColumn = left->Column(i);
+        const DataColumnPtr& rightColumn = right->Column(i);
+
+        if (leftColumn->Name() != rightColumn->Name() || leftColumn->Type() != rightColumn->Type() || leftColumn->Expression() != rightColumn->Expression())
+            return false;
+    }
+
+    return true;
+}
+
+static DataTablePtr CloneSchema(const DataSetPtr& dataSet, const DataTablePtr& source)
+{
+    DataTablePtr table = dataSet->CreateTable(source->Name());
+
+    for (int32_t i = 0; i < source->ColumnCount(); i++)
+        table->AddColumn(table->CloneColumn(source->Column(i)));
+
+    return table;
+}
+
+static void WriteDataSet(vector<uint8_t>& buffer, const DataSetPtr& dataSet)
+{
+    vector<uint8_t> dataSetBuffer;
+    dataSet->WriteBinary(dataSetBuffer);
+
+    EndianConverter::WriteBigEndianBytes(buffer, ConvertUInt32(dataSetBuffer.size()));
+    buffer.insert(buffer.end(), dataSetBuffer.begin(), dataSetBuffer.end());
+}
+
+static DataSetPtr ReadDataSet(const uint8_t* buffer, const uint32_t length, uint32_t& offset)
+{
+    if (length < offset + 4)
+        throw DataSetException("Versioned meta-data is truncated");
+
+    const uint32_t size = EndianConverter::ToBigEndian<uint32_t>(buffer, offset);
+    offset += 4;
+
+    if (length - offset < size)
+        throw DataSetException("Versioned meta-data is truncated");
+
+    DataSetPtr dataSet = DataSet::FromBinary(buffer + offset, size);
+    offset += size;
+
+    return dataSet;
+}
+
+MetadataDelta::MetadataDelta(DataSetPtr upserts, DataSetPtr deletes) :
+    m_upserts(std::move(upserts)),
+    m_deletes(std::move(deletes))
+{
+}
+
+const DataSetPtr& MetadataDelta::GetUpserts() const
+{
+    return m_upserts;
+}
+
+const DataSetPtr& MetadataDelta::GetDeletes() const
+{
+    return m_deletes;
+}
+
+uint64_t MetadataDelta::GetRowCount() const
+{
+    uint64_t rowCount = 0;
+
+    for (const auto& table : m_upserts->Tables())
+        rowCount += table->RowCount();
+
+    for (const auto& table : m_deletes->Tables())
+        rowCount += table->RowCount();
+
+    return rowCount;
+}
+
+void MetadataDelta::Apply(const DataSetPtr& metadata) const
+{
+    vector<string> tableNames = m_upserts->TableNames();
+
+    for (const auto& tableName : m_deletes->TableNames())
+    {
+        if (m_upserts->Table(tableName) == nullptr)
+            tableNames.push_back(tableName);
+    }
+
+    for (const auto& tableName : tableNames)
+    {
+        const DataTablePtr& table = metadata->Table(tableName);
+        const DataTablePtr& upserts = m_upserts->Table(tableName);
+        const DataTablePtr& deletes = m_deletes->Table(tableName);
+
+        if (table == nullptr || (upserts != nullptr && !SchemaEquals(table, upserts)) || (deletes != nullptr && !SchemaEquals(table, deletes)))
+            throw DataSetException("Meta-data delta for table \"" + tableName + "\" does not match local meta-data schema");
+
+        const vector<int32_t> keyColumns = GetKeyColumns(table);
+        unordered_map<string, DataRowPtr> upsertedRows;
+        unordered_set<string> deletedKeys;
+        vector<DataRowPtr> insertedRows;
+
+        if (upserts != nullptr)
+        {
+            for (int32_t i = 0; i < upserts->RowCount(); i++)
+            {
+                const DataRowPtr& row = upserts->Row(i);
+                upsertedRows.emplace(GetRowKey(row, keyColumns), row);
+            }
+        }
+
+        if (deletes != nullptr)
+        {
+            for (int32_t i = 0; i < deletes->RowCount(); i++)
+                deletedKeys.insert(GetRowKey(deletes->Row(i), keyColumns));
+        }
+
+        // Updated rows keep their position, inserted rows are appended
+        const DataTablePtr updatedTable = CloneSchema(metadata, table);
+
+        for (int32_t i = 0; i < table->RowCount(); i++)
+        {
+            const DataRowPtr& row = table->Row(i);
+            const string key = GetRowKey(row, keyColumns);
+            const auto iterator = upsertedRows.find(key);
+
+            if (iterator != upsertedRows.end())
+            {
+                updatedTable->AddRow(updatedTable->CloneRow(iterator->second));
+                upsertedRows.erase(iterator);
+            }
+            else if (deletedKeys.find(key) == deletedKeys.end())
+            {
+                updatedTable->AddRow(updatedTable->CloneRow(row));
+            }
+        }
+
+        if (upserts != nullptr)
+        {
+            for (int32_t i = 0; i < upserts->RowCount() && !upsertedRows.empty(); i++)
+            {
+                const DataRowPtr& row = upserts->Row(i);
+
+                if (upsertedRows.erase(GetRowKey(row, keyColumns)) > 0)
+                    updatedTable->AddRow(updatedTable->CloneRow(row));
+            }
+        }
+
+        metadata->AddOrUpdateTable(updatedTable);
+    }
+}
+
+MetadataDeltaPtr MetadataDelta::Create(const DataSetPtr& previous, const DataSetPtr& current)
+{
+    // Meta-data updated in place cannot be compared to its prior version
+    if (previous == nullptr || current == nullptr || previous == current)
+        return nullptr;
+
+    if (previous->TableCount() != current->TableCount())
+        return nullptr;
+
+    const DataSetPtr upserts = NewSharedPtr<DataSet>();
+    const DataSetPtr deletes = NewSharedPtr<DataSet>();
+
+    for (const auto& table : current->Tables())
+    {
+        const DataTablePtr& previousTable = previous->Table(table->Name());
+
+        if (previousTable == nullptr || !SchemaEquals(previousTable, table))
+            return nullptr;
+
+        // Tables shared with prior version, e.g., by publisher statistics metadata, may also be updated in place
+        if (previousTable == table)
+            return nullptr;
+
+        const vector<int32_t> keyColumns = GetKeyColumns(table);
+        vector<int32_t> valueColumns;
+
+        for (int32_t i = 0; i < table->ColumnCount(); i++)
+        {
+            if (!table->Column(i)->Computed())
+                valueColumns.push_back(i);
+        }
+
+        // Map prior rows by key, duplicate keys cannot be represented as a delta
+        unordered_map<string, DataRowPtr> previousRows;
+
+        for (int32_t i = 0; i < previousTable->RowCount(); i++)
+        {
+            const DataRowPtr& row = previousTable->Row(i);
+
+            if (!previousRows.emplace(GetRowKey(row, keyColumns), row).second)
+                return nullptr;
+        }
+
+        DataTablePtr upsertTable;
+        DataTablePtr deleteTable;
+        unordered_set<string> currentKeys;
+
+        for (int32_t i = 0; i < table->RowCount(); i++)
+        {
+            const DataRowPtr& row = table->Row(i);
+            const string key = GetRowKey(row, keyColumns);
+
+            if (!currentKeys.insert(key).second)
+                return nullptr;
+
+            const auto iterator = previousRows.find(key);
+
+            if (iterator != previousRows.end() && GetRowKey(iterator->second, valueColumns) == GetRowKey(row, valueColumns))
+                continue;
+
+            if (upsertTable == nullptr)
+                upsertTable = CloneSchema(upserts, table);
+
+            upsertTable->AddRow(upsertTable->CloneRow(row));
+        }
+
+        for (int32_t i = 0; i < previousTable->RowCount(); i++)
+        {
+            const DataRowPtr& row = previousTable->Row(i);
+
+            if (currentKeys.find(GetRowKey(row, keyColumns)) != currentKeys.end())
+                continue;
+
+            if (deleteTable == nullptr)
+                deleteTable = CloneSchema(deletes, table);
+
+            deleteTable->AddRow(deleteTable->CloneRow(row));
+        }
+
+        if (upsertTable != nullptr)
+            upserts->AddOrUpdateTable(upsertTable);
+
+        if (deleteTable != nullptr)
+            deletes->AddOrUpdateTable(deleteTable);
+    }
+
+    return NewSharedPtr<MetadataDelta>(upserts, deletes);
+}
+
+string MetadataDelta::GetRowKey(const DataRowPtr& row, const vector<int32_t>& keyColumns)
+{
+    string key;
+
+    for (const int32_t columnIndex : keyColumns)
+        AppendValue(key, row, columnIndex);
+
+    return key;
+}
+
+vector<int32_t> MetadataDelta::GetKeyColumns(const DataTablePtr& table)
+{
+    vector<int32_t> keyColumns;
+    vector<string> keyColumnNames;
+
+    if (TryGetValue(MetadataKeyColumns, table->Name(), keyColumnNames, {}))
+    {
+        for (const auto& columnName : keyColumnNames)
+        {
+            const DataColumnPtr& column = table->Column(columnName);
+
+            if (column == nullptr)
+            {
+                keyColumns.clear();
+                break;
+            }
+
+            keyColumns.push_back(column->Index());
+        }
+    }
+
+    // Tables without a known primary key are keyed on all values
+    if (keyColumns.empty())
+    {
+        for (int32_t i = 0; i < table->ColumnCount(); i++)
+        {
+            if (!table->Column(i)->Computed())
+                keyColumns.push_back(i);
+        }
+    }
+
+    return keyColumns;
+}
+
+const uint8_t VersionedMetadata::Signature[4] = { 'G', 'S', 'F', 'D' };
+
+VersionedMetadata::VersionedMetadata() :
+    HistoryID(Empty::Guid),
+    BaseVersion(0U),
+    Version(0U)
+{
+}
+
+void VersionedMetadata::Write(vector<uint8_t>& buffer) const
+{
+    buffer.insert(buffer.end(), begin(Signature), end(Signature));
+    buffer.push_back(VersionedMetadataFormat);
+    buffer.insert(buffer.end(), HistoryID.begin(), HistoryID.end());
+    EndianConverter::WriteBigEndianBytes(buffer, BaseVersion);
+    EndianConverter::WriteBigEndianBytes(buffer, Version);
+
+    if (Metadata != nullptr)
+    {
+        buffer.push_back(1);
+        WriteDataSet(buffer, Metadata);
+        return;
+    }
+
+    buffer.push_back(0);
+    EndianConverter::WriteBigEndianBytes(buffer, ConvertUInt32(Deltas.size()));
+
+    for (const auto& delta : Deltas)
+    {
+        WriteDataSet(buffer, delta->GetUpserts());
+        WriteDataSet(buffer, delta->GetDeletes());
+    }
+}
+
+void VersionedMetadata::Read(const uint8_t* buffer, const uint32_t length)
+{
+    static const uint32_t HeaderSize = sizeof(Signature) + 1 + 16 + 4 + 4 + 1;
+
+    if (!IsVersionedMetadata(buffer, length) || length < HeaderSize)
+        throw DataSetException("Buffer does not contain versioned meta-data");
+
+    uint32_t offset = sizeof(Signature);
+
+    if (buffer[offset++] != VersionedMetadataFormat)
+        throw DataSetException("Unsupported versioned meta-data format version: " + ToString(static_cast<int32_t>(buffer[offset - 1])));
+
+    HistoryID = ParseGuid(buffer + offset);
+    offset += 16;
+
+    BaseVersion = EndianConverter::ToBigEndian<uint32_t>(buffer, offset);
+    offset += 4;
+
+    Version = EndianConverter::ToBigEndian<uint32_t>(buffer, offset);
+    offset += 4;
+
+    Metadata = nullptr;
+    Deltas.clear();
+
+    if (buffer[offset++] != 0)
+    {
+        Metadata = ReadDataSet(buffer, length, offset);
+        return;
+    }
+
+    if (length < offset + 4)
+        throw DataSetException("Versioned meta-data is truncated");
+
+    const uint32_t deltaCount = EndianConverter::ToBigEndian<uint32_t>(buffer, offset);
+    offset += 4;
+
+    for (uint32_t i = 0; i < deltaCount; i++)
+    {
+        DataSetPtr upserts = ReadDataSet(buffer, length, offset);
+        DataSetPtr deletes = ReadDataSet(buffer, length, offset);
+        Deltas.push_back(NewSharedPtr<MetadataDelta>(upserts, deletes));
+    }
+}
+
+bool VersionedMetadata::IsVersionedMetadata(const uint8_t* buffer, const uint32_t length)
+{
+    return length > sizeof(Signature) && memcmp(buffer, Signature, sizeof(Signature)) == 0;
+}
@@ -0,0 +1,99 @@
+//******************************************************************************************************
+//  MetadataDelta.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __METADATA_DELTA_H
+#define __METADATA_DELTA_H
+
+#include "../Common/CommonTypes.h"
+#include "../Data/DataSet.h"
+#include <unordered_set>
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    class MetadataDelta;
+    typedef SharedPtr<MetadataDelta> MetadataDeltaPtr;
+
+    // Represents row changes between two versions of a meta-data set. Rows are matched by primary key, i.e.,
+    // DeviceDetail by Acronym, MeasurementDetail by SignalID and PhasorDetail by DeviceAcronym and SourceIndex;
+    // rows of other tables are matched on all of their values. Upserts hold inserted and updated rows, deletes
+    // hold the prior version of removed rows. Both data sets only contain tables that have changes.
+    class MetadataDelta // NOLINT
+    {
+    private:
+        GSF::Data::DataSetPtr m_upserts;
+        GSF::Data::DataSetPtr m_deletes;
+
+    public:
+        MetadataDelta(GSF::Data::DataSetPtr upserts, GSF::Data::DataSetPtr deletes);
+
+        const GSF::Data::DataSetPtr& GetUpserts() const;
+        const GSF::Data::DataSetPtr& GetDeletes() const;
+
+        // Gets total number of upserted and deleted rows
+        uint64_t GetRowCount() const;
+
+        // Applies row changes to meta-data set, changed tables are replaced in the data set
+        void Apply(const GSF::Data::DataSetPtr& metadata) const;
+
+        // Creates delta between two meta-data versions, returns null when a delta cannot represent
+        // the change, e.g., when schema differs, so that full meta-data needs to be sent instead
+        static MetadataDeltaPtr Create(const GSF::Data::DataSetPtr& previous, const GSF::Data::DataSetPtr& current);
+
+        // Gets key, in comparable form, of a meta-data row
+        static std::string GetRowKey(const GSF::Data::DataRowPtr& row, const std::vector<int32_t>& keyColumns);
+
+        // Gets indexes of primary key columns for a meta-data table
+        static std::vector<int32_t> GetKeyColumns(const GSF::Data::DataTablePtr& table);
+    };
+
+    // Versioned meta-data response used for delta synchronization. Response holds either full meta-data, or the
+    // deltas that take a subscriber from its current version, the base version, to the latest version. History
+    // ID identifies a publisher's version history, versions from another history, e.g., before a publisher was
+    // restarted, are not comparable.
+    //
+    // Binary format, all values are big-endian:
+    //     signature "GSFD", format version (uint8), history ID (16 bytes), base version (uint32), version (uint32),
+    //     full meta-data flag (uint8), then either full meta-data as data set size (uint32) and binary data set, or
+    //     delta count (uint32) and, for each delta, sizes and binary data sets for upserts and deletes
+    struct VersionedMetadata
+    {
+        GSF::Guid HistoryID;
+        uint32_t BaseVersion;
+        uint32_t Version;
+        GSF::Data::DataSetPtr Metadata;
+        std::vector<MetadataDeltaPtr> Deltas;
+
+        VersionedMetadata();
+
+        void Write(std::vector<uint8_t>& buffer) const;
+        void Read(const uint8_t* buffer, uint32_t length);
+
+        static bool IsVersionedMetadata(const uint8_t* buffer, uint32_t length);
+
+        static const uint8_t Signature[4];
+    };
+}}}
+
+#endif
@@ -304,6 +304,11 @@ uint64_t PublisherInstance::GetTotalMeasurementsSent() const
     return m_publisher->GetTotalMeasurementsSent();
 }
 
+MetricsSnapshot PublisherInstance::GetMetricsSnapshot() const
+{
+    return m_publisher->GetMetricsSnapshot();
+}
+
 bool PublisherInstance::IsInitialized() const
 {
     return m_initialized;
@@ -128,6 +128,7 @@ namespace Transport
         uint64_t GetTotalCommandChannelBytesSent() const;
         uint64_t GetTotalDataChannelBytesSent() const;
         uint64_t GetTotalMeasurementsSent() const;
+        GSF::MetricsSnapshot GetMetricsSnapshot() const;
 
         bool IsInitialized() const;
 
@@ -28,16 +28,21 @@ using namespace GSF;
 using namespace GSF::TimeSeries;
 using namespace GSF::TimeSeries::Transport;
 
-RoutingTables::RoutingTables() :
+RoutingTables::RoutingTables(MetricsRegistry& metrics) :
     m_activeRoutes(NewSharedPtr<RoutingTable>()),
-    m_enabled(true)
+    m_enabled(true),
+    m_routeUpdateTime(metrics.GetHistogram("RouteUpdateTime")),
+    m_routeTime(metrics.GetHistogram("RouteTime"))
 {
+    metrics.RegisterGauge("PendingRouteUpdates", [this] { return static_cast<int64_t>(m_routingTableOperations.Size()); });
+
     Thread([&,this]()
     {
         while (m_enabled)
         {
             m_routingTableOperations.WaitForData();
             const auto operation = m_routingTableOperations.Dequeue();
+            MetricTimer routeUpdateTimer(*m_routeUpdateTime);
             operation.first(*this, operation.second);
         }
     });
@@ -127,6 +132,7 @@ void RoutingTables::PublishMeasurements(const vector<MeasurementPtr>& measuremen
 
     // Constrain read lock to this block
     {
+        MetricTimer routeTimer(*m_routeTime);
         ReaderLock readLock(m_activeRoutesLock);
         const RoutingTable& activeRoutes = *m_activeRoutes;
 
@@ -160,7 +166,48 @@ void RoutingTables::PublishMeasurements(const vector<MeasurementPtr>& measuremen
     {
         auto& destination = *pair.first;
 
-        if (destination.GetIsSubscribed() && !destination.GetIsTemporalSubscription())
-            destination.PublishMeasurements(*pair.second);
+        if (destination.GetIsSubscribed())
+            destination.PublishLiveMeasurements(*pair.second);
+    }
+}
+
+void RoutingTables::PublishMeasurements(const vector<RoutedMeasurementRecord>& measurements)
+{
+    // Routed records only reference caller owned memory, so destination lists are simple value vectors
+    unordered_map<SubscriberConnectionPtr, vector<RoutedMeasurementRecord>> routedMeasurementMap;
+    const size_t size = measurements.size();
+
+    // Constrain read lock to this block
+    {
+        MetricTimer routeTimer(*m_routeTime);
+        ReaderLock readLock(m_activeRoutesLock);
+        const RoutingTable& activeRoutes = *m_activeRoutes;
+
+        for (auto& measurement : measurements)
+        {
+            const auto iterator = activeRoutes.find(*measurement.SignalID);
+
+            if (iterator == activeRoutes.end())
+                continue;
+
+            for (auto& destination : *iterator->second)
+            {
+                vector<RoutedMeasurementRecord>& routedMeasurements = routedMeasurementMap[destination];
+
+                if (routedMeasurements.empty())
+                    routedMeasurements.reserve(size);
+
+                routedMeasurements.push_back(measurement);
+            }
+        }
+    }
+
+    // Publish routed measurements
+    for (auto& pair : routedMeasurementMap)
+    {
+        auto& destination = *pair.first;
+
+        if (destination.GetIsSubscribed())
+            destination.PublishLiveMeasurements(pair.second);
     }
 }
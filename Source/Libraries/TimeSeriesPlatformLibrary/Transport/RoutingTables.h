@@ -26,6 +26,7 @@
 
 #include "../Common/CommonTypes.h"
 #include "../Common/ThreadSafeQueue.h"
+#include "../Common/Metrics.h"
 #include "SubscriberConnection.h"
 
 namespace GSF {
@@ -47,6 +48,8 @@ namespace Transport
         RoutingTablePtr m_activeRoutes;
         GSF::SharedMutex m_activeRoutesLock;
         volatile bool m_enabled;
+        GSF::MetricHistogramPtr m_routeUpdateTime;
+        GSF::MetricHistogramPtr m_routeTime;
 
         RoutingTablePtr CloneActiveRoutes();
         void SetActiveRoutes(RoutingTablePtr activeRoutes);
@@ -54,12 +57,14 @@ namespace Transport
         static void RemoveRoutesOperation(RoutingTables& routingTables, const DestinationRoutes& destinationRoutes);
 
     public:
-        RoutingTables();
+        // Creates new routing tables that record route update and routing time metrics to the provided registry
+        RoutingTables(GSF::MetricsRegistry& metrics);
         ~RoutingTables();
 
         void UpdateRoutes(const SubscriberConnectionPtr& destination, const std::unordered_set<GSF::Guid>& routes);
         void RemoveRoutes(const SubscriberConnectionPtr& destination);
         void PublishMeasurements(const std::vector<MeasurementPtr>& measurements);
+        void PublishMeasurements(const std::vector<RoutedMeasurementRecord>& measurements);
     };
 }}}
 
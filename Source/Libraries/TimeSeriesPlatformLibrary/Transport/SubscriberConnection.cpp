@@ -28,8 +28,10 @@
 #include "CompactMeasurement.h"
 #include "ActiveMeasurementsSchema.h"
 #include "../Common/EndianConverter.h"
+#include "../Common/Compression.h"
 #include "../Data/DataSet.h"
 #include "../FilterExpressions/FilterExpressionParser.h"
+#include <boost/bind.hpp>
 
 using namespace std;
 using namespace boost::asio;
@@ -45,6 +47,30 @@ static const float64_t DefaultLagTime = 5.0;
 static const float64_t DefaultLeadTime = 5.0;
 static const float64_t DefaultPublishInterval = 1.0;
 
+// Common accessors allowing publication of both measurement instances and measurement records
+static const GSF::Guid& SignalIDOf(const MeasurementPtr& measurement) { return measurement->SignalID; }
+static const GSF::Guid& SignalIDOf(const RoutedMeasurementRecord& measurement) { return *measurement.SignalID; }
+static int64_t TimestampOf(const MeasurementPtr& measurement) { return measurement->Timestamp; }
+static int64_t TimestampOf(const RoutedMeasurementRecord& measurement) { return measurement.Record->Timestamp; }
+static float64_t ValueOf(const MeasurementPtr& measurement) { return measurement->Value; }
+static float64_t ValueOf(const RoutedMeasurementRecord& measurement) { return measurement.Record->Value; }
+static float32_t AdjustedValueOf(const MeasurementPtr& measurement) { return static_cast<float32_t>(measurement->AdjustedValue()); }
+static float32_t AdjustedValueOf(const RoutedMeasurementRecord& measurement) { return static_cast<float32_t>(measurement.Record->Value); }
+static uint32_t FlagsOf(const MeasurementPtr& measurement) { return static_cast<uint32_t>(measurement->Flags); }
+static uint32_t FlagsOf(const RoutedMeasurementRecord& measurement) { return static_cast<uint32_t>(measurement.Record->Flags); }
+
+static MeasurementPtr ToMeasurementPtr(const RoutedMeasurementRecord& measurement)
+{
+    MeasurementPtr measurementPtr = NewSharedPtr<Measurement>();
+
+    measurementPtr->SignalID = *measurement.SignalID;
+    measurementPtr->Timestamp = measurement.Record->Timestamp;
+    measurementPtr->Value = measurement.Record->Value;
+    measurementPtr->Flags = measurement.Record->Flags;
+
+    return measurementPtr;
+}
+
 SubscriberConnection::SubscriberConnection(DataPublisherPtr parent, IOContext& commandChannelService) : //NOLINT
     m_parent(std::move(parent)),
     m_commandChannelService(commandChannelService),
@@ -71,14 +97,20 @@ SubscriberConnection::SubscriberConnection(DataPublisherPtr parent, IOContext& c
     m_startTimeSent(false),
     m_dataChannelActive(false),
     m_stopped(true),
+    m_liveDataState(LiveDataState::Published),
     m_commandChannelSocket(m_commandChannelService),
     m_readBuffer(Common::MaxPacketSize),
     m_udpPort(0),
     m_dataChannelSocket(m_dataChannelService),
     m_udpWriteStrand(m_dataChannelService),
-    m_totalCommandChannelBytesSent(0LL),
-    m_totalDataChannelBytesSent(0LL),
-    m_totalMeasurementsSent(0LL),
+    m_totalCommandChannelBytesSent(m_metrics.GetCounter("CommandChannelBytesSent")),
+    m_totalDataChannelBytesSent(m_metrics.GetCounter("DataChannelBytesSent")),
+    m_totalMeasurementsSent(m_metrics.GetCounter("MeasurementsSent")),
+    m_totalPacketsSent(m_metrics.GetCounter("PacketsSent")),
+    m_totalPacketsDropped(m_metrics.GetCounter("PacketsDropped")),
+    m_totalMeasurementsFiltered(m_metrics.GetCounter("MeasurementsFiltered")),
+    m_writeQueueDepth(m_metrics.GetGauge("WriteQueueDepth")),
+    m_encodeTime(m_metrics.GetHistogram("EncodeTime")),
     m_baseTimeRotationTimer(nullptr),
     m_timeIndex(0),
     m_baseTimeOffsets{ 0LL, 0LL },
@@ -163,7 +195,8 @@ uint32_t SubscriberConnection::GetEncoding() const
 
 bool SubscriberConnection::GetIsTemporalSubscription() const
 {
-    return m_startTimeConstraint < DateTime::MaxValue;
+    // Subscription remains temporal until replay hands off to real-time data
+    return m_liveDataState != LiveDataState::Published;
 }
 
 const GSF::datetime_t& SubscriberConnection::GetStartTimeConstraint() const
@@ -173,7 +206,12 @@ const GSF::datetime_t& SubscriberConnection::GetStartTimeConstraint() const
 
 void SubscriberConnection::SetStartTimeConstraint(const GSF::datetime_t& value)
 {
+    ScopeLock lock(m_liveDataLock);
+
+    // Any live data buffered for a prior temporal subscription is discarded
     m_startTimeConstraint = value;
+    m_bufferedLiveMeasurements.clear();
+    m_liveDataState = value < DateTime::MaxValue ? LiveDataState::Dropped : LiveDataState::Published;
 }
 
 const GSF::datetime_t& SubscriberConnection::GetStopTimeConstraint() const
@@ -358,17 +396,22 @@ void SubscriberConnection::SetSignalIndexCache(SignalIndexCachePtr signalIndexCa
 
 uint64_t SubscriberConnection::GetTotalCommandChannelBytesSent() const
 {
-    return m_totalCommandChannelBytesSent;
+    return m_totalCommandChannelBytesSent->GetValue();
 }
 
 uint64_t SubscriberConnection::GetTotalDataChannelBytesSent() const
 {
-    return m_totalDataChannelBytesSent;
+    return m_totalDataChannelBytesSent->GetValue();
 }
 
 uint64_t SubscriberConnection::GetTotalMeasurementsSent() const
 {
-    return m_totalMeasurementsSent;
+    return m_totalMeasurementsSent->GetValue();
+}
+
+MetricsSnapshot SubscriberConnection::GetMetricsSnapshot() const
+{
+    return m_metrics.GetSnapshot();
 }
 
 bool SubscriberConnection::CipherKeysDefined() const
@@ -518,6 +561,112 @@ void SubscriberConnection::PublishMeasurements(const vector<MeasurementPtr>& mea
     }
 }
 
+void SubscriberConnection::PublishMeasurements(const vector<RoutedMeasurementRecord>& measurements)
+{
+    if (measurements.empty() || !m_isSubscribed)
+        return;
+
+    if (m_trackLatestMeasurements)
+    {
+        // Latest measurement tracking retains measurement instances beyond
+        // the publish call, so records are copied for throttled connections
+        vector<MeasurementPtr> measurementPtrs;
+        measurementPtrs.reserve(measurements.size());
+
+        for (const auto& measurement : measurements)
+            measurementPtrs.push_back(ToMeasurementPtr(measurement));
+
+        PublishMeasurements(measurementPtrs);
+        return;
+    }
+
+    if (!m_startTimeSent)
+        m_startTimeSent = SendDataStartTime(measurements[0].Record->Timestamp);
+
+    if (m_usingPayloadCompression)
+        PublishTSSCMeasurements(measurements);
+    else
+        PublishCompactMeasurements(measurements);
+}
+
+void SubscriberConnection::PublishLiveMeasurements(const vector<MeasurementPtr>& measurements)
+{
+    if (m_liveDataState == LiveDataState::Published)
+    {
+        PublishMeasurements(measurements);
+        return;
+    }
+
+    if (m_liveDataState == LiveDataState::Dropped)
+        return;
+
+    // State is checked again under lock since handoff may have completed
+    ScopeLock lock(m_liveDataLock);
+
+    if (m_liveDataState == LiveDataState::Buffered)
+        m_bufferedLiveMeasurements.insert(m_bufferedLiveMeasurements.end(), measurements.begin(), measurements.end());
+    else if (m_liveDataState == LiveDataState::Published)
+        PublishMeasurements(measurements);
+}
+
+void SubscriberConnection::PublishLiveMeasurements(const vector<RoutedMeasurementRecord>& measurements)
+{
+    if (m_liveDataState == LiveDataState::Published)
+    {
+        PublishMeasurements(measurements);
+        return;
+    }
+
+    if (m_liveDataState == LiveDataState::Dropped)
+        return;
+
+    // State is checked again under lock since handoff may have completed
+    ScopeLock lock(m_liveDataLock);
+
+    if (m_liveDataState == LiveDataState::Buffered)
+    {
+        // Routed records only reference caller owned memory, so buffered measurements are copies
+        for (const auto& measurement : measurements)
+            m_bufferedLiveMeasurements.push_back(ToMeasurementPtr(measurement));
+    }
+    else if (m_liveDataState == LiveDataState::Published)
+    {
+        PublishMeasurements(measurements);
+    }
+}
+
+void SubscriberConnection::BeginLiveDataHandoff()
+{
+    ScopeLock lock(m_liveDataLock);
+
+    if (m_liveDataState == LiveDataState::Dropped)
+        m_liveDataState = LiveDataState::Buffered;
+}
+
+void SubscriberConnection::CompleteLiveDataHandoff()
+{
+    ScopeLock lock(m_liveDataLock);
+
+    if (m_liveDataState != LiveDataState::Buffered)
+        return;
+
+    // Lock holds off new live data until buffered measurements have been published
+    PublishMeasurements(m_bufferedLiveMeasurements);
+    m_bufferedLiveMeasurements.clear();
+    m_bufferedLiveMeasurements.shrink_to_fit();
+    m_liveDataState = LiveDataState::Published;
+}
+
+void SubscriberConnection::CancelLiveDataHandoff()
+{
+    ScopeLock lock(m_liveDataLock);
+
+    if (m_liveDataState == LiveDataState::Buffered)
+        m_liveDataState = LiveDataState::Dropped;
+
+    m_bufferedLiveMeasurements.clear();
+}
+
 void SubscriberConnection::CancelTemporalSubscription()
 {
     if (GetIsTemporalSubscription() && !m_temporalSubscriptionCanceled)
@@ -634,9 +783,9 @@ void SubscriberConnection::HandleSubscribe(uint8_t* data, uint32_t length)
                     }
 
                     if (TryGetValue(settings, "startTimeConstraint", setting))
-                        m_startTimeConstraint = ParseRelativeTimestamp(setting.c_str());
+                        SetStartTimeConstraint(ParseRelativeTimestamp(setting.c_str()));
                     else
-                        m_startTimeConstraint = DateTime::MaxValue;
+                        SetStartTimeConstraint(DateTime::MaxValue);
 
                     if (TryGetValue(settings, "stopTimeConstraint", setting))
                         m_stopTimeConstraint = ParseRelativeTimestamp(setting.c_str());
@@ -908,39 +1057,37 @@ void SubscriberConnection::HandleMetadataRefresh(uint8_t* data, uint32_t length)
 
     m_parent->DispatchStatusMessage("Received meta-data refresh request from " + GetConnectionID() + ", preparing response...");
 
-    StringMap<ExpressionTreePtr> filterExpressions;
+    string metadataFilters;
+    bool versionRequested = false;
+    Guid historyID = Empty::Guid;
+    uint32_t version = 0U;
     const datetime_t startTime = UtcNow(); //-V821
 
     try
     {
         uint32_t index = 0;
 
-        // Note that these client provided meta-data filter expressions are applied only to the
-        // in-memory DataSet and therefore are not subject to SQL injection attacks
         if (length > 4)
         {
             const uint32_t responseLength = EndianConverter::ToBigEndian<uint32_t>(data, index);
             index += 4;
 
             if (length >= responseLength + 4)
+                metadataFilters = NormalizeMetadataFilters(DecodeString(data, index, responseLength));
+
+            index += responseLength;
+
+            // Subscribers supporting delta synchronization follow filters with their current meta-data history ID and version
+            if (length > index + 20)
             {
-                const string metadataFilters = DecodeString(data, index, responseLength);
-                const vector<ExpressionTreePtr> expressions = FilterExpressions::FilterExpressionParser::GenerateExpressionTrees(m_parent->m_metadata, "MeasurementDetail", metadataFilters);
+                historyID = ParseGuid(data + index);
+                index += 16;
 
-                // Go through each subscriber specified filter expressions and add it to dictionary
-                for (const auto& expression : expressions)
-                    filterExpressions[expression->Table()->Name()] = expression;
+                version = EndianConverter::ToBigEndian<uint32_t>(data, index);
+                versionRequested = true;
             }
         }
     }
-    catch (const FilterExpressionParserException& ex)
-    {
-        m_parent->DispatchErrorMessage("Failed to parse subscriber provided meta-data filter expressions: FilterExpressionParser exception: " + string(ex.what()));
-    }
-    catch (const ExpressionTreeException& ex)
-    {
-        m_parent->DispatchErrorMessage("Failed to parse subscriber provided meta-data filter expressions: ExpressionTree exception: " + string(ex.what()));
-    }
     catch (...)
     {
         m_parent->DispatchErrorMessage("Failed to parse subscriber provided meta-data filter expressions: " + boost::current_exception_diagnostic_information(true));
@@ -948,25 +1095,87 @@ void SubscriberConnection::HandleMetadataRefresh(uint8_t* data, uint32_t length)
 
     try
     {
-        const DataSetPtr metadata = FilterClientMetadata(filterExpressions);
-        const vector<uint8_t> serializedMetadata = SerializeMetadata(metadata);
-        vector<DataTablePtr> tables = metadata->Tables();
-        uint64_t rowCount = 0;
+        // Response depends only on metadata version, serialization and compression options and filters, so it can be shared with other subscribers
+        const uint32_t serializationModes = GetOperationalModes() & (OperationalModes::UseCommonSerializationFormat | OperationalModes::UseBinaryMetadataFormat | OperationalModes::CompressMetadata | CompressionModes::GZip);
+        const string serializationKey = ToString(serializationModes) + ";" + ToString(m_parent->GetCompressionLevel()) + ";" + ToString(m_parent->GetMaxCompressionThreads());
+        DataPublisher::MetadataResponsePtr response;
+        bool deltaResponse = false;
+
+        // Versioned responses require binary format, filtered meta-data is always sent in full
+        if (versionRequested && (serializationModes & OperationalModes::UseBinaryMetadataFormat) > 0)
+        {
+            VersionedMetadata versionedMetadata = m_parent->GetVersionedMetadata(historyID, version);
+            deltaResponse = versionedMetadata.Metadata == nullptr && metadataFilters.empty();
 
-        for (size_t i = 0; i < tables.size(); i++)
-            rowCount += tables[i]->RowCount();
+            const string versionKey = deltaResponse ? "delta:" + ToString(versionedMetadata.BaseVersion) : "full";
 
-        if (rowCount > 0)
+            response = m_parent->GetMetadataResponse(serializationKey + ";" + versionKey + ";" + metadataFilters, [&,this]
+            {
+                const SharedPtr<DataPublisher::MetadataResponse> preparedResponse = NewSharedPtr<DataPublisher::MetadataResponse>();
+                preparedResponse->RowCount = 0;
+
+                if (deltaResponse)
+                {
+                    preparedResponse->TableCount = versionedMetadata.Deltas.size();
+
+                    for (const auto& delta : versionedMetadata.Deltas)
+                        preparedResponse->RowCount += delta->GetRowCount();
+                }
+                else
+                {
+                    versionedMetadata.BaseVersion = 0U;
+                    versionedMetadata.Deltas.clear();
+                    versionedMetadata.Metadata = FilterClientMetadata(ParseMetadataFilters(metadataFilters));
+
+                    vector<DataTablePtr> tables = versionedMetadata.Metadata->Tables();
+                    preparedResponse->TableCount = tables.size();
+
+                    for (size_t i = 0; i < tables.size(); i++)
+                        preparedResponse->RowCount += tables[i]->RowCount();
+                }
+
+                vector<uint8_t> serializationBuffer;
+                versionedMetadata.Write(serializationBuffer);
+                preparedResponse->Buffer = CompressMetadata(serializationBuffer);
+
+                return preparedResponse;
+            });
+        }
+        else
+        {
+            response = m_parent->GetMetadataResponse(serializationKey + ";" + metadataFilters, [&,this]
+            {
+                const DataSetPtr metadata = FilterClientMetadata(ParseMetadataFilters(metadataFilters));
+                const SharedPtr<DataPublisher::MetadataResponse> preparedResponse = NewSharedPtr<DataPublisher::MetadataResponse>();
+                vector<DataTablePtr> tables = metadata->Tables();
+
+                preparedResponse->Buffer = SerializeMetadata(metadata);
+                preparedResponse->RowCount = 0;
+                preparedResponse->TableCount = tables.size();
+
+                for (size_t i = 0; i < tables.size(); i++)
+                    preparedResponse->RowCount += tables[i]->RowCount();
+
+                return preparedResponse;
+            });
+        }
+
+        if (deltaResponse)
+        {
+            const TimeSpan elapsedTime = UtcNow() - startTime;
+            m_parent->DispatchStatusMessage(ToString(response->RowCount) + " changed records spanning " + ToString(response->TableCount) + " meta-data versions prepared in " + ToString(elapsedTime) + ", sending response to " + GetConnectionID() + "...");
+        }
+        else if (response->RowCount > 0)
         {
             const TimeSpan elapsedTime = UtcNow() - startTime;
-            m_parent->DispatchStatusMessage(ToString(rowCount) + " records spanning " + ToString(tables.size()) + " tables of meta-data prepared in " + ToString(elapsedTime) + ", sending response to " + GetConnectionID() + "...");
+            m_parent->DispatchStatusMessage(ToString(response->RowCount) + " records spanning " + ToString(response->TableCount) + " tables of meta-data prepared in " + ToString(elapsedTime) + ", sending response to " + GetConnectionID() + "...");
         }
         else
         {
-            m_parent->DispatchStatusMessage("No meta-data is available" + string(filterExpressions.empty() ? "" : " due to user applied meta-data filters") + ", sending an empty response to " + GetConnectionID() + "...");
+            m_parent->DispatchStatusMessage("No meta-data is available" + string(metadataFilters.empty() ? "" : " due to user applied meta-data filters") + ", sending an empty response to " + GetConnectionID() + "...");
         }
 
-        SendResponse(ServerResponse::Succeeded, ServerCommand::MetadataRefresh, serializedMetadata);
+        SendResponse(ServerResponse::Succeeded, ServerCommand::MetadataRefresh, response->Buffer);
     }
     catch (const FilterExpressionParserException& ex)
     {
@@ -1092,8 +1301,8 @@ SignalIndexCachePtr SubscriberConnection::ParseSubscriptionRequest(const string&
 
     const DataTablePtr& activeMeasurements = m_parent->m_filteringMetadata->Table("ActiveMeasurements");
     const vector<DataRowPtr>& rows = parser->FilteredRows();
-    const int32_t idColumn = DataPublisher::GetColumnIndex(activeMeasurements, "ID");
-    const int32_t signalIDColumn = DataPublisher::GetColumnIndex(activeMeasurements, "SignalID");
+    const DataColumnHandle idColumn = DataPublisher::GetColumnHandle(activeMeasurements, "ID");
+    const DataColumnHandle signalIDColumn = DataPublisher::GetColumnHandle(activeMeasurements, "SignalID");
 
     // Create a new signal index cache for filtered measurements
     SignalIndexCachePtr signalIndexCache = NewSharedPtr<SignalIndexCache>();
@@ -1101,11 +1310,11 @@ SignalIndexCachePtr SubscriberConnection::ParseSubscriptionRequest(const string&
     for (size_t i = 0; i < rows.size(); i++)
     {
         const DataRowPtr& row = rows[i];
-        const Guid& signalID = row->ValueAsGuid(signalIDColumn).GetValueOrDefault();        
+        const Guid signalID = row->GetGuidValue(signalIDColumn);
         string source;
         uint32_t id;
 
-        ParseMeasurementKey(row->ValueAsString(idColumn).GetValueOrDefault(), source, id);
+        ParseMeasurementKey(string(row->GetStringValue(idColumn)), source, id);
         signalIndexCache->AddMeasurementKey(uint16_t(i), signalID, source, id, charSizeEstimate);
     }
 
@@ -1113,8 +1322,10 @@ SignalIndexCachePtr SubscriberConnection::ParseSubscriptionRequest(const string&
     return signalIndexCache;
 }
 
-void SubscriberConnection::PublishCompactMeasurements(const std::vector<MeasurementPtr>& measurements)
+template<typename T>
+void SubscriberConnection::PublishCompactMeasurements(const std::vector<T>& measurements)
 {
+    MetricTimer encodeTimer(*m_encodeTime);
     CompactMeasurement serializer(m_signalIndexCache, m_baseTimeOffsets, m_includeTime, m_useMillisecondResolution, m_timeIndex);
     vector<uint8_t> packet, buffer;
     int32_t count = 0;
@@ -1124,17 +1335,20 @@ void SubscriberConnection::PublishCompactMeasurements(const std::vector<Measurem
 
     for (size_t i = 0; i < measurements.size(); i++)
     {
-        const Measurement& measurement = *measurements[i];
-        const int64_t timestamp = measurement.Timestamp;
-        const uint16_t runtimeID = m_signalIndexCache->GetSignalIndex(measurement.SignalID);
+        const T& measurement = measurements[i];
+        const int64_t timestamp = TimestampOf(measurement);
+        const uint16_t runtimeID = m_signalIndexCache->GetSignalIndex(SignalIDOf(measurement));
 
         if (runtimeID == UInt16::MaxValue)
             continue;
 
-        if (m_isNaNFiltered && isnan(measurement.Value))
+        if (m_isNaNFiltered && isnan(ValueOf(measurement)))
+        {
+            m_totalMeasurementsFiltered->Add();
             continue;
+        }
 
-        const uint32_t length = serializer.SerializeMeasurement(measurement, buffer, runtimeID);
+        const uint32_t length = serializer.SerializeMeasurement(timestamp, AdjustedValueOf(measurement), FlagsOf(measurement), buffer, runtimeID);
 
         if (packet.size() + length > MaxPacketSize)
         {
@@ -1177,11 +1391,13 @@ void SubscriberConnection::PublishCompactDataPacket(const vector<uint8_t>& packe
     m_lastPublishTime = UtcNow();
 
     // Track total number of published measurements
-    m_totalMeasurementsSent += count;
+    m_totalMeasurementsSent->Add(count);
 }
 
-void SubscriberConnection::PublishTSSCMeasurements(const std::vector<MeasurementPtr>& measurements)
+template<typename T>
+void SubscriberConnection::PublishTSSCMeasurements(const std::vector<T>& measurements)
 {
+    MetricTimer encodeTimer(*m_encodeTime);
     m_tsscEncoderLock.lock();
 
     if (m_tsscResetRequested)
@@ -1205,14 +1421,17 @@ void SubscriberConnection::PublishTSSCMeasurements(const std::vector<Measurement
 
     for (const auto& measurement : measurements)
     {
-        const uint16_t index = m_signalIndexCache->GetSignalIndex(measurement->SignalID);
+        const uint16_t index = m_signalIndexCache->GetSignalIndex(SignalIDOf(measurement));
+        const int64_t timestamp = TimestampOf(measurement);
+        const uint32_t flags = FlagsOf(measurement);
+        const float32_t value = AdjustedValueOf(measurement);
 
-        if (!m_tsscEncoder.TryAddMeasurement(index, measurement->Timestamp, static_cast<uint32_t>(measurement->Flags), static_cast<float32_t>(measurement->AdjustedValue())))
+        if (!m_tsscEncoder.TryAddMeasurement(index, timestamp, flags, value))
         {
             PublishTSSCDataPacket(count);
             count = 0;
             m_tsscEncoder.SetBuffer(m_tsscWorkingBuffer, 0, TSSCBufferSize);
-            m_tsscEncoder.TryAddMeasurement(index, measurement->Timestamp, static_cast<uint32_t>(measurement->Flags), static_cast<float32_t>(measurement->AdjustedValue()));
+            m_tsscEncoder.TryAddMeasurement(index, timestamp, flags, value);
         }
 
         count++; //-V127
@@ -1256,7 +1475,7 @@ void SubscriberConnection::PublishTSSCDataPacket(int32_t count)
     m_lastPublishTime = UtcNow();
 
     // Track total number of published measurements
-    m_totalMeasurementsSent += count;
+    m_totalMeasurementsSent->Add(count);
 }
 
 bool SubscriberConnection::SendDataStartTime(uint64_t timestamp)
@@ -1369,14 +1588,15 @@ void SubscriberConnection::ParseCommand(const ErrorCode& error, uint32_t bytesTr
         switch (command)
         {
             case ServerCommand::Subscribe:
-                HandleSubscribe(data, bytesTransferred);
-                break;
+                // Subscription parsing evaluates filter expressions over metadata, so it is handled by a command worker
+                QueueCommand(&SubscriberConnection::HandleSubscribe, data, bytesTransferred);
+                return;
             case ServerCommand::Unsubscribe:
                 HandleUnsubscribe();
                 break;
             case ServerCommand::MetadataRefresh:
-                HandleMetadataRefresh(data, bytesTransferred);
-                break;
+                QueueCommand(&SubscriberConnection::HandleMetadataRefresh, data, bytesTransferred);
+                return;
             case ServerCommand::RotateCipherKeys:
                 HandleRotateCipherKeys();
                 break;
@@ -1429,6 +1649,45 @@ void SubscriberConnection::ParseCommand(const ErrorCode& error, uint32_t bytesTr
     ReadCommandChannel();
 }
 
+// Queued commands are handled by a command worker. Reading of command channel for this connection is
+// suspended until handler completes, preserving command order and keeping read buffer data valid.
+void SubscriberConnection::QueueCommand(void (SubscriberConnection::*handler)(uint8_t*, uint32_t), uint8_t* data, uint32_t length)
+{
+    SubscriberConnectionPtr connection = shared_from_this();
+
+    m_parent->QueueCommandWork([connection, handler, data, length]
+    {
+        // Resume reading on command channel thread, since socket operations are not thread-safe,
+        // however handler completes so that a failed command never stalls the command channel
+        struct ResumeReading
+        {
+            SubscriberConnectionPtr Connection;
+
+            ~ResumeReading()
+            {
+                post(Connection->m_commandChannelService, [connection = Connection]
+                {
+                    connection->ReadCommandChannel();
+                });
+            }
+        }
+        resumeReading { connection };
+
+        try
+        {
+            ((*connection).*handler)(data, length);
+        }
+        catch (const std::exception& ex)
+        {
+            connection->m_parent->DispatchErrorMessage("Encountered an exception while processing received client data: " + string(ex.what()));
+        }
+        catch (...)
+        {
+            connection->m_parent->DispatchErrorMessage("Encountered an exception while processing received client data: " + boost::current_exception_diagnostic_information(true));
+        }
+    });
+}
+
 std::vector<uint8_t> SubscriberConnection::SerializeSignalIndexCache(SignalIndexCache& signalIndexCache) const
 {
     vector<uint8_t> serializationBuffer;
@@ -1446,14 +1705,8 @@ std::vector<uint8_t> SubscriberConnection::SerializeSignalIndexCache(SignalIndex
 
     if (compressSignalIndexCache && useGZipCompression)
     {
-        const MemoryStream memoryStream(serializationBuffer);
-        StreamBuffer streamBuffer;
-
-        streamBuffer.push(GZipCompressor());
-        streamBuffer.push(memoryStream);
-
         vector<uint8_t> compressedBuffer;
-        CopyStream(&streamBuffer, compressedBuffer);
+        GZipCompress(serializationBuffer, compressedBuffer, m_parent->GetCompressionLevel());
         return compressedBuffer;
     }
 
@@ -1466,31 +1719,111 @@ std::vector<uint8_t> SubscriberConnection::SerializeMetadata(const GSF::Data::Da
 
     const uint32_t operationalModes = GetOperationalModes();
     const bool useCommonSerializationFormat = (operationalModes & OperationalModes::UseCommonSerializationFormat) > 0;
-    const bool compressMetadata = (operationalModes & OperationalModes::CompressMetadata) > 0;
-    const bool useGZipCompression = (operationalModes & CompressionModes::GZip) > 0;
+    const bool useBinaryMetadataFormat = (operationalModes & OperationalModes::UseBinaryMetadataFormat) > 0;
 
     if (!useCommonSerializationFormat)
         throw PublisherException("DataPublisher only supports common serialization format");
 
-    metadata->WriteXml(serializationBuffer);
+    if (useBinaryMetadataFormat)
+        metadata->WriteBinary(serializationBuffer);
+    else
+        metadata->WriteXml(serializationBuffer);
 
-    if (compressMetadata && useGZipCompression)
-    {
-        const MemoryStream memoryStream(serializationBuffer);
-        StreamBuffer streamBuffer;
+    return CompressMetadata(serializationBuffer);
+}
 
-        streamBuffer.push(GZipCompressor());
-        streamBuffer.push(memoryStream);
+std::vector<uint8_t> SubscriberConnection::CompressMetadata(const std::vector<uint8_t>& serializationBuffer) const
+{
+    const uint32_t operationalModes = GetOperationalModes();
+    const bool compressMetadata = (operationalModes & OperationalModes::CompressMetadata) > 0;
+    const bool useGZipCompression = (operationalModes & CompressionModes::GZip) > 0;
 
+    if (compressMetadata && useGZipCompression)
+    {
         vector<uint8_t> compressionBuffer;
-        CopyStream(&streamBuffer, compressionBuffer);
-
+        GZipCompress(serializationBuffer, compressionBuffer, m_parent->GetCompressionLevel(), m_parent->GetMaxCompressionThreads());
         return compressionBuffer;
     }
 
     return serializationBuffer;
 }
 
+StringMap<ExpressionTreePtr> SubscriberConnection::ParseMetadataFilters(const string& metadataFilters) const
+{
+    StringMap<ExpressionTreePtr> filterExpressions;
+
+    if (metadataFilters.empty())
+        return filterExpressions;
+
+    try
+    {
+        // Note that these client provided meta-data filter expressions are applied only to the
+        // in-memory DataSet and therefore are not subject to SQL injection attacks
+        const vector<ExpressionTreePtr> expressions = FilterExpressions::FilterExpressionParser::GenerateExpressionTrees(m_parent->m_metadata, "MeasurementDetail", metadataFilters);
+
+        // Go through each subscriber specified filter expressions and add it to dictionary
+        for (const auto& expression : expressions)
+            filterExpressions[expression->Table()->Name()] = expression;
+    }
+    catch (const FilterExpressionParserException& ex)
+    {
+        m_parent->DispatchErrorMessage("Failed to parse subscriber provided meta-data filter expressions: FilterExpressionParser exception: " + string(ex.what()));
+    }
+    catch (const ExpressionTreeException& ex)
+    {
+        m_parent->DispatchErrorMessage("Failed to parse subscriber provided meta-data filter expressions: ExpressionTree exception: " + string(ex.what()));
+    }
+    catch (...)
+    {
+        m_parent->DispatchErrorMessage("Failed to parse subscriber provided meta-data filter expressions: " + boost::current_exception_diagnostic_information(true));
+    }
+
+    return filterExpressions;
+}
+
+// Normalizes filter expressions so that requests differing only by whitespace share a cached response
+string SubscriberConnection::NormalizeMetadataFilters(const string& metadataFilters)
+{
+    string normalizedFilters;
+    bool inLiteral = false;
+    bool pendingSpace = false;
+
+    normalizedFilters.reserve(metadataFilters.size());
+
+    for (const char value : metadataFilters)
+    {
+        if (!inLiteral && isspace(static_cast<unsigned char>(value)))
+        {
+            pendingSpace = !normalizedFilters.empty() && normalizedFilters.back() != ';';
+            continue;
+        }
+
+        if (!inLiteral && value == ';')
+        {
+            // Skip empty statements
+            if (!normalizedFilters.empty() && normalizedFilters.back() != ';')
+                normalizedFilters.push_back(';');
+
+            pendingSpace = false;
+            continue;
+        }
+
+        if (pendingSpace)
+            normalizedFilters.push_back(' ');
+
+        if (value == '\'')
+            inLiteral = !inLiteral;
+
+        normalizedFilters.push_back(value);
+        pendingSpace = false;
+    }
+
+    if (!normalizedFilters.empty() && normalizedFilters.back() == ';')
+        normalizedFilters.pop_back();
+
+    return normalizedFilters;
+}
+
 DataSetPtr SubscriberConnection::FilterClientMetadata(const StringMap<ExpressionTreePtr>& filterExpressions) const
 {
     if (filterExpressions.empty())
@@ -1542,6 +1875,7 @@ void SubscriberConnection::CommandChannelWriteHandler(const ErrorCode& error, si
         return;
 
     m_tcpWriteBuffers.pop_front();
+    m_writeQueueDepth->Add(-1);
 
     // Stop cleanly, i.e., don't report, on these errors
     if (error == error::connection_aborted || error == error::connection_reset || error == error::eof)
@@ -1583,6 +1917,7 @@ void SubscriberConnection::DataChannelWriteHandler(const ErrorCode& error, size_
         return;
 
     m_udpWriteBuffers.pop_front();
+    m_writeQueueDepth->Add(-1);
 
     // Stop cleanly, i.e., don't report, on these errors
     if (error == error::connection_aborted || error == error::connection_reset || error == error::eof)
@@ -1674,7 +2009,8 @@ bool SubscriberConnection::SendResponse(uint8_t responseCode, uint8_t commandCod
         // Data packets and buffer blocks can be published on a UDP data channel, so check for this...
         if (useDataChannel)
         {
-            m_totalDataChannelBytesSent += buffer.size();
+            m_totalDataChannelBytesSent->Add(buffer.size());
+            m_writeQueueDepth->Add(1);
 
             post(m_udpWriteStrand, [this, bufferPtr] {
                 m_udpWriteBuffers.push_back(bufferPtr);
@@ -1687,7 +2023,8 @@ bool SubscriberConnection::SendResponse(uint8_t responseCode, uint8_t commandCod
         }
         else
         {
-            m_totalCommandChannelBytesSent += buffer.size();
+            m_totalCommandChannelBytesSent->Add(buffer.size());
+            m_writeQueueDepth->Add(1);
 
             post(m_tcpWriteStrand, [this, bufferPtr] {
                 m_tcpWriteBuffers.push_back(bufferPtr);
@@ -1697,10 +2034,12 @@ bool SubscriberConnection::SendResponse(uint8_t responseCode, uint8_t commandCod
             });
         }
 
+        m_totalPacketsSent->Add();
         success = true;
     }
     catch (...)
     {
+        m_totalPacketsDropped->Add();
         m_parent->DispatchErrorMessage("Failed to send subscriber response: " + boost::current_exception_diagnostic_information(true));
     }
 
@@ -26,10 +26,12 @@
 
 #include "../Common/CommonTypes.h"
 #include "../Common/Timer.h"
+#include "../Common/Metrics.h"
 #include "../Data/DataSet.h"
 #include "SignalIndexCache.h"
 #include "TransportTypes.h"
 #include "TSSCEncoder.h"
+#include <atomic>
 #include <deque>
 
 namespace GSF {
@@ -77,6 +79,19 @@ namespace Transport
         volatile bool m_dataChannelActive;
         volatile bool m_stopped;
 
+        // Live data for temporal subscriptions is dropped while history is replayed and
+        // buffered while replay hands off to real-time data, see TemporalReplay
+        enum class LiveDataState
+        {
+            Dropped,
+            Buffered,
+            Published
+        };
+
+        std::atomic<LiveDataState> m_liveDataState;
+        std::vector<MeasurementPtr> m_bufferedLiveMeasurements;
+        GSF::Mutex m_liveDataLock;
+
         // Command channel
         GSF::TcpSocket m_commandChannelSocket;
         std::vector<uint8_t> m_readBuffer;
@@ -96,9 +111,15 @@ namespace Transport
         std::vector<uint8_t> m_ivs[2];
 
         // Statistics counters
-        uint64_t m_totalCommandChannelBytesSent;
-        uint64_t m_totalDataChannelBytesSent;
-        uint64_t m_totalMeasurementsSent;
+        GSF::MetricsRegistry m_metrics;
+        GSF::MetricCounterPtr m_totalCommandChannelBytesSent;
+        GSF::MetricCounterPtr m_totalDataChannelBytesSent;
+        GSF::MetricCounterPtr m_totalMeasurementsSent;
+        GSF::MetricCounterPtr m_totalPacketsSent;
+        GSF::MetricCounterPtr m_totalPacketsDropped;
+        GSF::MetricCounterPtr m_totalMeasurementsFiltered;
+        GSF::MetricGaugePtr m_writeQueueDepth;
+        GSF::MetricHistogramPtr m_encodeTime;
 
         // Measurement parsing
         SignalIndexCachePtr m_signalIndexCache;
@@ -127,16 +148,20 @@ namespace Transport
         void HandleUserCommand(uint32_t command, uint8_t* data, uint32_t length);
 
         SignalIndexCachePtr ParseSubscriptionRequest(const std::string& filterExpression, bool& success);
-        void PublishCompactMeasurements(const std::vector<MeasurementPtr>& measurements);
+        template<typename T> void PublishCompactMeasurements(const std::vector<T>& measurements);
         void PublishCompactDataPacket(const std::vector<uint8_t>& packet, int32_t count);
-        void PublishTSSCMeasurements(const std::vector<MeasurementPtr>& measurements);
+        template<typename T> void PublishTSSCMeasurements(const std::vector<T>& measurements);
         void PublishTSSCDataPacket(int32_t count);
         bool SendDataStartTime(uint64_t timestamp);
         void ReadCommandChannel();
         void ReadPayloadHeader(const ErrorCode& error, size_t bytesTransferred);
         void ParseCommand(const ErrorCode& error, uint32_t bytesTransferred);
+        void QueueCommand(void (SubscriberConnection::*handler)(uint8_t*, uint32_t), uint8_t* data, uint32_t length);
         std::vector<uint8_t> SerializeSignalIndexCache(SignalIndexCache& signalIndexCache) const;
         std::vector<uint8_t> SerializeMetadata(const GSF::Data::DataSetPtr& metadata) const;
+        std::vector<uint8_t> CompressMetadata(const std::vector<uint8_t>& serializationBuffer) const;
+        StringMap<GSF::FilterExpressions::ExpressionTreePtr> ParseMetadataFilters(const std::string& metadataFilters) const;
+        static std::string NormalizeMetadataFilters(const std::string& metadataFilters);
         GSF::Data::DataSetPtr FilterClientMetadata(const StringMap<GSF::FilterExpressions::ExpressionTreePtr>& filterExpressions) const;
         void CommandChannelSendAsync();
         void CommandChannelWriteHandler(const ErrorCode& error, size_t bytesTransferred);
@@ -256,6 +281,10 @@ namespace Transport
         uint64_t GetTotalDataChannelBytesSent() const;
         uint64_t GetTotalMeasurementsSent() const;
 
+        // Gets a snapshot of connection metrics, e.g., packets, bytes and measurements sent, write
+        // queue depth, measurements dropped by NaN filtering and packet encoding time
+        GSF::MetricsSnapshot GetMetricsSnapshot() const;
+
         bool CipherKeysDefined() const;
         std::vector<uint8_t> Keys(int32_t cipherIndex);
         std::vector<uint8_t> IVs(int32_t cipherIndex);
@@ -264,8 +293,21 @@ namespace Transport
         void Stop(bool shutdownSocket = true);
 
         void PublishMeasurements(const std::vector<MeasurementPtr>& measurements);
+        void PublishMeasurements(const std::vector<RoutedMeasurementRecord>& measurements);
         void CancelTemporalSubscription();
 
+        // Publishes routed live measurements, temporal subscriptions only receive live
+        // data once temporal replay has handed off to real-time data
+        void PublishLiveMeasurements(const std::vector<MeasurementPtr>& measurements);
+        void PublishLiveMeasurements(const std::vector<RoutedMeasurementRecord>& measurements);
+
+        // Hands off a temporal subscription to real-time data: live measurements are buffered once handoff
+        // begins, completing handoff publishes buffered measurements and makes subscription real-time,
+        // canceling handoff discards buffered measurements
+        void BeginLiveDataHandoff();
+        void CompleteLiveDataHandoff();
+        void CancelLiveDataHandoff();
+
         bool SendResponse(uint8_t responseCode, uint8_t commandCode);
         bool SendResponse(uint8_t responseCode, uint8_t commandCode, const std::string& message);
         bool SendResponse(uint8_t responseCode, uint8_t commandCode, const std::vector<uint8_t>& data);
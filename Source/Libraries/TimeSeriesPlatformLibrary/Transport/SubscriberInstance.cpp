@@ -24,13 +24,19 @@
 #include "SubscriberInstance.h"
 #include "Constants.h"
 #include "../Common/Convert.h"
+#include "../Common/Compression.h"
 #include "../Common/EndianConverter.h"
 #include "../Common/pugixml.hpp"
+#include "../Data/DataSet.h"
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <fstream>
 #include <iostream>
 
 using namespace std;
 using namespace pugi;
 using namespace GSF;
+using namespace GSF::Data;
 using namespace GSF::TimeSeries;
 using namespace GSF::TimeSeries::Transport;
 
@@ -45,11 +51,18 @@ SubscriberInstance::SubscriberInstance() :
     m_filterExpression(SubscribeAllNoStatsExpression),
     m_startTime(""),
     m_stopTime(""),
+    m_metadataHistoryID(Empty::Guid),
+    m_metadataVersion(0U),
+    m_metadataDeltaSyncEnabled(true),
+    m_metadataChanged(true),
     m_userData(nullptr)
 {
     // Reference this SubscriberInstance in DataSubsciber user data
     m_subscriber = NewSharedPtr<DataSubscriber>();
     m_subscriber->SetUserData(this);
+
+    // Metadata parsing handles binary and XML formats, so binary format is requested by default
+    m_subscriber->SetMetadataBinaryFormat(true);
 }
 
 // public functions
@@ -174,18 +187,15 @@ void SubscriberInstance::Connect()
         m_subscriptionInfo.DataChannelLocalPort = m_udpPort;
     }
 
+    // Load last received metadata from local cache, if any, so subscription does not wait on metadata transfer
+    if (m_autoParseMetadata && m_metadata == nullptr && !m_metadataCachePath.empty())
+        LoadMetadataCache();
+
     // Connect and subscribe to publisher
     if (connector.Connect(*m_subscriber, m_subscriptionInfo))
     {
         ConnectionEstablished();
-
-        // If automatically parsing metadata, request metadata upon successful connection,
-        // after metadata is handled the SubscriberInstance will then initiate subscribe;
-        // otherwise, initiate subscribe immediately
-        if (m_autoParseMetadata)
-            SendMetadataRefreshCommand();
-        else
-            m_subscriber->Subscribe();
+        StartSubscription();
     }
     else
     {
@@ -237,6 +247,36 @@ void SubscriberInstance::SetMetadataCompressed(bool compressed) const
     m_subscriber->SetMetadataCompressed(compressed);
 }
 
+bool SubscriberInstance::IsMetadataBinaryFormat() const
+{
+    return m_subscriber->IsMetadataBinaryFormat();
+}
+
+void SubscriberInstance::SetMetadataBinaryFormat(bool binaryFormat) const
+{
+    m_subscriber->SetMetadataBinaryFormat(binaryFormat);
+}
+
+const string& SubscriberInstance::GetMetadataCachePath() const
+{
+    return m_metadataCachePath;
+}
+
+void SubscriberInstance::SetMetadataCachePath(const string& metadataCachePath)
+{
+    m_metadataCachePath = metadataCachePath;
+}
+
+bool SubscriberInstance::IsMetadataDeltaSyncEnabled() const
+{
+    return m_metadataDeltaSyncEnabled;
+}
+
+void SubscriberInstance::SetMetadataDeltaSyncEnabled(bool enabled)
+{
+    m_metadataDeltaSyncEnabled = enabled;
+}
+
 bool SubscriberInstance::IsSignalIndexCacheCompressed() const
 {
     return m_subscriber->IsSignalIndexCacheCompressed();
@@ -262,6 +302,11 @@ uint64_t SubscriberInstance::GetTotalMeasurementsReceived() const
     return m_subscriber->GetTotalMeasurementsReceived();
 }
 
+MetricsSnapshot SubscriberInstance::GetMetricsSnapshot() const
+{
+    return m_subscriber->GetMetricsSnapshot();
+}
+
 bool SubscriberInstance::IsConnected() const
 {
     return m_subscriber->IsConnected();
@@ -577,85 +622,206 @@ void SubscriberInstance::ReceivedMetadata(const vector<uint8_t>& payload)
         return;
     }
 
-    vector<uint8_t>* uncompressesBuffer;
+    vector<uint8_t> uncompressedBuffer;
+    vector<uint8_t>* metadataBuffer;
 
     // Step 1: Decompress meta-data if needed
     if (IsMetadataCompressed())
     {
         // Perform zlib decompression on buffer
-        const MemoryStream memoryStream(payload);
-        StreamBuffer streamBuffer;
-
-        streamBuffer.push(GZipDecompressor());
-        streamBuffer.push(memoryStream);
-
-        uncompressesBuffer = new vector<uint8_t>();
-        CopyStream(&streamBuffer, *uncompressesBuffer);
+        GZipDecompress(payload, uncompressedBuffer);
+        metadataBuffer = &uncompressedBuffer;
     }
     else
     {
-        uncompressesBuffer = const_cast<vector<uint8_t>*>(&payload);
+        metadataBuffer = const_cast<vector<uint8_t>*>(&payload);
     }
 
-    // Step 2: Load string into an XML parser
-    xml_document document;
+    // Step 2: Parse meta-data records, format depends on publisher support for versioned and binary data set formats
+    if (VersionedMetadata::IsVersionedMetadata(metadataBuffer->data(), ConvertUInt32(metadataBuffer->size())))
+    {
+        ReceivedVersionedMetadata(*metadataBuffer);
+        return;
+    }
 
-    const xml_parse_result result = document.load_buffer_inplace(static_cast<void*>(uncompressesBuffer->data()), uncompressesBuffer->size());
+    StringMap<DeviceMetadataPtr> devices;
+    vector<MeasurementMetadataPtr> measurementRecords;
+    vector<PhasorMetadataPtr> phasorRecords;
 
-    if (result.status != xml_parse_status::status_ok)
+    if (DataSet::IsBinary(metadataBuffer->data(), ConvertUInt32(metadataBuffer->size())))
     {
-        if (IsMetadataCompressed())
-            delete uncompressesBuffer;
+        try
+        {
+            ParseMetadata(DataSet::FromBinary(*metadataBuffer), devices, measurementRecords, phasorRecords);
+        }
+        catch (const DataSetException& ex)
+        {
+            ErrorMessage("Failed to parse meta data binary data set: " + string(ex.what()));
+            return;
+        }
+    }
+    else if (!ParseXmlMetadata(*metadataBuffer, devices, measurementRecords, phasorRecords))
+    {
+        return;
+    }
 
-        stringstream errorMessageStream;
-        errorMessageStream << "Failed to parse meta data XML, status code = " << ToHex(result.status);
-        ErrorMessage(errorMessageStream.str());
+    // Meta-data without a version cannot be used as a base for deltas
+    SetMetadataVersion(nullptr, Empty::Guid, 0U);
+    LoadMetadata(devices, measurementRecords, phasorRecords);
+}
+
+void SubscriberInstance::ReceivedVersionedMetadata(const vector<uint8_t>& buffer)
+{
+    VersionedMetadata versionedMetadata;
+
+    try
+    {
+        versionedMetadata.Read(buffer.data(), ConvertUInt32(buffer.size()));
+    }
+    catch (const DataSetException& ex)
+    {
+        ErrorMessage("Failed to parse versioned meta data: " + string(ex.what()));
         return;
     }
 
-    // Find root node
-    xml_node rootNode = document.document_element();
+    if (versionedMetadata.Metadata != nullptr)
+    {
+        StringMap<DeviceMetadataPtr> devices;
+        vector<MeasurementMetadataPtr> measurementRecords;
+        vector<PhasorMetadataPtr> phasorRecords;
 
-    // Query DeviceDetail records from metadata
-    StringMap<DeviceMetadataPtr> devices;
+        ParseMetadata(versionedMetadata.Metadata, devices, measurementRecords, phasorRecords);
+        SetMetadataVersion(versionedMetadata.Metadata, versionedMetadata.HistoryID, versionedMetadata.Version);
+        LoadMetadata(devices, measurementRecords, phasorRecords);
 
-    for (xml_node device = rootNode.child("DeviceDetail"); device; device = device.next_sibling("DeviceDetail"))
+        if (!m_metadataCachePath.empty())
+            SaveMetadataCache();
+
+        return;
+    }
+
+    try
     {
-        DeviceMetadataPtr deviceMetadata = NewSharedPtr<DeviceMetadata>();
+        if (m_metadata == nullptr || versionedMetadata.HistoryID != m_metadataHistoryID || versionedMetadata.BaseVersion != m_metadataVersion)
+            throw DataSetException("received delta base version " + ToString(versionedMetadata.BaseVersion) + " does not match local version " + ToString(m_metadataVersion));
 
-        deviceMetadata->Acronym = device.child_value("Acronym");
-        deviceMetadata->Name = device.child_value("Name");
-        deviceMetadata->UniqueID = ParseGuid(device.child_value("UniqueID"));
-        deviceMetadata->AccessID = stoi(Coalesce(device.child_value("AccessID"), "0"));
-        deviceMetadata->ParentAcronym = device.child_value("ParentAcronym");
-        deviceMetadata->ProtocolName = device.child_value("ProtocolName");
-        deviceMetadata->FramesPerSecond = stoi(Coalesce(device.child_value("FramesPerSecond"), "30"));
-        deviceMetadata->CompanyAcronym = device.child_value("CompanyAcronym");
-        deviceMetadata->VendorAcronym = device.child_value("vendorAcronym");
-        deviceMetadata->VendorDeviceName = device.child_value("VendorDeviceName");
-        deviceMetadata->Longitude = stod(Coalesce(device.child_value("Longitude"), "0.0"));
-        deviceMetadata->Latitude = stod(Coalesce(device.child_value("Latitude"), "0.0"));
-        deviceMetadata->UpdatedOn = ParseTimestamp(device.child_value("UpdatedOn"));
+        DeviceAcronymSet deviceAcronyms;
+        uint64_t changedRecords = 0;
 
-        devices.insert_or_assign(deviceMetadata->Acronym, deviceMetadata);
+        for (const auto& delta : versionedMetadata.Deltas)
+        {
+            GetChangedDeviceAcronyms(delta, deviceAcronyms);
+            delta->Apply(m_metadata);
+            changedRecords += delta->GetRowCount();
+        }
+
+        const bool versionChanged = versionedMetadata.Version != m_metadataVersion;
+
+        SetMetadataVersion(m_metadata, versionedMetadata.HistoryID, versionedMetadata.Version);
+        UpdateMetadata(deviceAcronyms, changedRecords);
+
+        if (versionChanged && !m_metadataCachePath.empty())
+            SaveMetadataCache();
     }
+    catch (const DataSetException& ex)
+    {
+        // Local meta-data is no longer usable as a base for deltas, request full meta-data
+        ErrorMessage("Failed to apply meta data delta, requesting full meta data: " + string(ex.what()));
+        SetMetadataVersion(nullptr, Empty::Guid, 0U);
+        SendMetadataRefreshCommand();
+    }
+}
+
+// Replaces all loaded meta-data with new records
+void SubscriberInstance::LoadMetadata(StringMap<DeviceMetadataPtr>& devices, const vector<MeasurementMetadataPtr>& measurementRecords, const vector<PhasorMetadataPtr>& phasorRecords)
+{
+    m_metadataChanged = true;
 
-    // Query MeasurementDetail records from metadata
     unordered_map<Guid, MeasurementMetadataPtr> measurements;
+    const uint16_t phasorCount = AssociateMetadata(devices, measurementRecords, phasorRecords, measurements);
 
-    for (xml_node device = rootNode.child("MeasurementDetail"); device; device = device.next_sibling("MeasurementDetail"))
+    // Construct a "configuration frame" for each of the devices
+    StringMap<ConfigurationFramePtr> configurationFrames;
+    ConstructConfigurationFrames(devices, measurements, configurationFrames);
+
+    m_configurationUpdateLock.lock();
+
+    m_configurationFrames = configurationFrames;    // Replace the configuration frames list
+    m_devices = devices;                            // Replace the device metadata list
+    m_measurements = measurements;                  // Replace the measurement metadata list
+
+    m_configurationUpdateLock.unlock();
+
+    stringstream message;
+    message << "Loaded " << devices.size() << " devices, " << measurements.size() << " measurements and " << phasorCount << " phasors from GEP meta data...";
+    StatusMessage(message.str());
+
+    // Notify derived class that meta-data has been parsed and is now available
+    ParsedMetadata();
+}
+
+// Reloads meta-data records of changed devices from local meta-data, records and configuration frames of other devices are reused
+void SubscriberInstance::UpdateMetadata(const DeviceAcronymSet& deviceAcronyms, const uint64_t changedRecords)
+{
+    m_metadataChanged = changedRecords > 0;
+
+    m_configurationUpdateLock.lock();
+
+    StringMap<ConfigurationFramePtr> configurationFrames = m_configurationFrames;
+    StringMap<DeviceMetadataPtr> devices = m_devices;
+    unordered_map<Guid, MeasurementMetadataPtr> measurements = m_measurements;
+
+    m_configurationUpdateLock.unlock();
+
+    for (const auto& deviceAcronym : deviceAcronyms)
     {
-        MeasurementMetadataPtr measurementMetadata = NewSharedPtr<MeasurementMetadata>();
+        configurationFrames.erase(deviceAcronym);
+        devices.erase(deviceAcronym);
+    }
 
-        measurementMetadata->DeviceAcronym = device.child_value("DeviceAcronym");
-        measurementMetadata->ID = device.child_value("ID");
-        measurementMetadata->SignalID = ParseGuid(device.child_value("SignalID"));
-        measurementMetadata->PointTag = device.child_value("PointTag");
-        measurementMetadata->Reference = SignalReference(string(device.child_value("SignalReference")));
-        measurementMetadata->PhasorSourceIndex = stoi(Coalesce(device.child_value("PhasorSourceIndex"), "0"));
-        measurementMetadata->Description = device.child_value("Description");
-        measurementMetadata->UpdatedOn = ParseTimestamp(device.child_value("UpdatedOn"));
+    for (auto iterator = measurements.begin(); iterator != measurements.end();)
+    {
+        if (deviceAcronyms.find(iterator->second->DeviceAcronym) == deviceAcronyms.end())
+            ++iterator;
+        else
+            iterator = measurements.erase(iterator);
+    }
+
+    StringMap<DeviceMetadataPtr> changedDevices;
+    vector<MeasurementMetadataPtr> measurementRecords;
+    vector<PhasorMetadataPtr> phasorRecords;
 
+    ParseMetadata(m_metadata, changedDevices, measurementRecords, phasorRecords, &deviceAcronyms);
+    AssociateMetadata(changedDevices, measurementRecords, phasorRecords, measurements);
+
+    StringMap<ConfigurationFramePtr> changedConfigurationFrames;
+    ConstructConfigurationFrames(changedDevices, measurements, changedConfigurationFrames);
+
+    configurationFrames.insert(changedConfigurationFrames.begin(), changedConfigurationFrames.end());
+    devices.insert(changedDevices.begin(), changedDevices.end());
+
+    m_configurationUpdateLock.lock();
+
+    m_configurationFrames = configurationFrames;
+    m_devices = devices;
+    m_measurements = measurements;
+
+    m_configurationUpdateLock.unlock();
+
+    stringstream message;
+    message << "Applied " << changedRecords << " GEP meta data changes affecting " << deviceAcronyms.size() << " devices, " << devices.size() << " devices and " << measurements.size() << " measurements are now loaded...";
+    StatusMessage(message.str());
+
+    // Notify derived class that meta-data has been parsed and is now available
+    ParsedMetadata();
+}
+
+// Associates measurement and phasor records with their devices, returns number of associated phasors
+uint16_t SubscriberInstance::AssociateMetadata(StringMap<DeviceMetadataPtr>& devices, const vector<MeasurementMetadataPtr>& measurementRecords, const vector<PhasorMetadataPtr>& phasorRecords, unordered_map<Guid, MeasurementMetadataPtr>& measurements)
+{
+    // Associate measurements with devices
+    for (const auto& measurementMetadata : measurementRecords)
+    {
         measurements.insert_or_assign(measurementMetadata->SignalID, measurementMetadata);
 
         // Lookup associated device
@@ -669,20 +835,11 @@ void SubscriberInstance::ReceivedMetadata(const vector<uint8_t>& payload)
         }
     }
 
-    // Query PhasorDetail records from metadata
+    // Associate phasors with devices
     uint16_t phasorCount = 0;
 
-    for (xml_node device = rootNode.child("PhasorDetail"); device; device = device.next_sibling("PhasorDetail"))
+    for (const auto& phasorMetadata : phasorRecords)
     {
-        PhasorMetadataPtr phasorMetadata = NewSharedPtr<PhasorMetadata>();
-
-        phasorMetadata->DeviceAcronym = device.child_value("DeviceAcronym");
-        phasorMetadata->Label = device.child_value("Label");
-        phasorMetadata->Type = device.child_value("Type");
-        phasorMetadata->Phase = device.child_value("Phase");
-        phasorMetadata->SourceIndex = stoi(Coalesce(device.child_value("SourceIndex"), "0"));
-        phasorMetadata->UpdatedOn = ParseTimestamp(device.child_value("UpdatedOn"));
-
         // Create a new phasor reference
         PhasorReferencePtr phasorReference = NewSharedPtr<PhasorReference>();
         phasorReference->Phasor = phasorMetadata;
@@ -740,52 +897,414 @@ void SubscriberInstance::ReceivedMetadata(const vector<uint8_t>& payload)
         phasorCount++;
     }
 
-    // Construct a "configuration frame" for each of the devices
-    StringMap<ConfigurationFramePtr> configurationFrames;
-    ConstructConfigurationFrames(devices, measurements, configurationFrames);
+    return phasorCount;
+}
 
-    m_configurationUpdateLock.lock();
+// Gets acronyms of devices with changed meta-data records, including prior device of a changed measurement
+void SubscriberInstance::GetChangedDeviceAcronyms(const MetadataDeltaPtr& delta, DeviceAcronymSet& deviceAcronyms) const
+{
+    for (const auto& dataSet : { delta->GetUpserts(), delta->GetDeletes() })
+    {
+        for (const auto& table : dataSet->Tables())
+        {
+            const bool deviceDetail = IsEqual(table->Name(), "DeviceDetail");
+            const DataColumnHandle deviceAcronym = table->ColumnHandle(deviceDetail ? "Acronym" : "DeviceAcronym");
+            const DataColumnHandle signalID = IsEqual(table->Name(), "MeasurementDetail") ? table->ColumnHandle("SignalID") : DataColumnHandle();
 
-    m_configurationFrames = configurationFrames;    // Replace the configuration frames list
-    m_devices = devices;                            // Replace the device metadata list
-    m_measurements = measurements;                  // Replace the measurement metadata list
+            if (!deviceAcronym.IsValid())
+                continue;
 
-    m_configurationUpdateLock.unlock();
+            for (int32_t i = 0; i < table->RowCount(); i++)
+            {
+                const DataRowPtr& row = table->Row(i);
+                deviceAcronyms.emplace(row->GetStringValue(deviceAcronym));
 
-    stringstream message;
-    message << "Loaded " << devices.size() << " devices, " << measurements.size() << " measurements and " << phasorCount << " phasors from GEP meta data...";
-    StatusMessage(message.str());
+                if (!signalID.IsValid())
+                    continue;
 
-    // Release uncompressed buffer
-    if (IsMetadataCompressed())
-        delete uncompressesBuffer;
+                const auto iterator = m_measurements.find(row->GetGuidValue(signalID));
 
-    // Notify derived class that meta-data has been parsed and is now available
-    ParsedMetadata();
+                if (iterator != m_measurements.end())
+                    deviceAcronyms.insert(iterator->second->DeviceAcronym);
+            }
+        }
+    }
+}
+
+// Loads meta-data records from XML data set
+bool SubscriberInstance::ParseXmlMetadata(vector<uint8_t>& buffer, StringMap<DeviceMetadataPtr>& devices, vector<MeasurementMetadataPtr>& measurements, vector<PhasorMetadataPtr>& phasors)
+{
+    // Load string into an XML parser
+    xml_document document;
+
+    const xml_parse_result result = document.load_buffer_inplace(static_cast<void*>(buffer.data()), buffer.size());
+
+    if (result.status != xml_parse_status::status_ok)
+    {
+        stringstream errorMessageStream;
+        errorMessageStream << "Failed to parse meta data XML, status code = " << ToHex(result.status);
+        ErrorMessage(errorMessageStream.str());
+        return false;
+    }
+
+    // Find root node
+    xml_node rootNode = document.document_element();
+
+    // Query DeviceDetail records from metadata
+    for (xml_node device = rootNode.child("DeviceDetail"); device; device = device.next_sibling("DeviceDetail"))
+    {
+        DeviceMetadataPtr deviceMetadata = NewSharedPtr<DeviceMetadata>();
+
+        deviceMetadata->Acronym = device.child_value("Acronym");
+        deviceMetadata->Name = device.child_value("Name");
+        deviceMetadata->UniqueID = ParseGuid(device.child_value("UniqueID"));
+        deviceMetadata->AccessID = stoi(Coalesce(device.child_value("AccessID"), "0"));
+        deviceMetadata->ParentAcronym = device.child_value("ParentAcronym");
+        deviceMetadata->ProtocolName = device.child_value("ProtocolName");
+        deviceMetadata->FramesPerSecond = stoi(Coalesce(device.child_value("FramesPerSecond"), "30"));
+        deviceMetadata->CompanyAcronym = device.child_value("CompanyAcronym");
+        deviceMetadata->VendorAcronym = device.child_value("vendorAcronym");
+        deviceMetadata->VendorDeviceName = device.child_value("VendorDeviceName");
+        deviceMetadata->Longitude = stod(Coalesce(device.child_value("Longitude"), "0.0"));
+        deviceMetadata->Latitude = stod(Coalesce(device.child_value("Latitude"), "0.0"));
+        deviceMetadata->UpdatedOn = ParseTimestamp(device.child_value("UpdatedOn"));
+
+        devices.insert_or_assign(deviceMetadata->Acronym, deviceMetadata);
+    }
+
+    // Query MeasurementDetail records from metadata
+    for (xml_node device = rootNode.child("MeasurementDetail"); device; device = device.next_sibling("MeasurementDetail"))
+    {
+        MeasurementMetadataPtr measurementMetadata = NewSharedPtr<MeasurementMetadata>();
+
+        measurementMetadata->DeviceAcronym = device.child_value("DeviceAcronym");
+        measurementMetadata->ID = device.child_value("ID");
+        measurementMetadata->SignalID = ParseGuid(device.child_value("SignalID"));
+        measurementMetadata->PointTag = device.child_value("PointTag");
+        measurementMetadata->Reference = SignalReference(string(device.child_value("SignalReference")));
+        measurementMetadata->PhasorSourceIndex = stoi(Coalesce(device.child_value("PhasorSourceIndex"), "0"));
+        measurementMetadata->Description = device.child_value("Description");
+        measurementMetadata->UpdatedOn = ParseTimestamp(device.child_value("UpdatedOn"));
+
+        measurements.push_back(measurementMetadata);
+    }
+
+    // Query PhasorDetail records from metadata
+    for (xml_node device = rootNode.child("PhasorDetail"); device; device = device.next_sibling("PhasorDetail"))
+    {
+        PhasorMetadataPtr phasorMetadata = NewSharedPtr<PhasorMetadata>();
+
+        phasorMetadata->DeviceAcronym = device.child_value("DeviceAcronym");
+        phasorMetadata->Label = device.child_value("Label");
+        phasorMetadata->Type = device.child_value("Type");
+        phasorMetadata->Phase = device.child_value("Phase");
+        phasorMetadata->SourceIndex = stoi(Coalesce(device.child_value("SourceIndex"), "0"));
+        phasorMetadata->UpdatedOn = ParseTimestamp(device.child_value("UpdatedOn"));
+
+        phasors.push_back(phasorMetadata);
+    }
+
+    return true;
+}
+
+// Loads meta-data records from data set, optionally only records of specified devices
+void SubscriberInstance::ParseMetadata(const DataSetPtr& metadata, StringMap<DeviceMetadataPtr>& devices, vector<MeasurementMetadataPtr>& measurements, vector<PhasorMetadataPtr>& phasors, const DeviceAcronymSet* deviceAcronyms)
+{
+    // Query DeviceDetail records from metadata
+    const DataTablePtr& deviceDetail = metadata->Table("DeviceDetail");
+
+    if (deviceDetail != nullptr)
+    {
+        const DataColumnHandle acronym = deviceDetail->ColumnHandle("Acronym");
+        const DataColumnHandle name = deviceDetail->ColumnHandle("Name");
+        const DataColumnHandle uniqueID = deviceDetail->ColumnHandle("UniqueID");
+        const DataColumnHandle accessID = deviceDetail->ColumnHandle("AccessID");
+        const DataColumnHandle parentAcronym = deviceDetail->ColumnHandle("ParentAcronym");
+        const DataColumnHandle protocolName = deviceDetail->ColumnHandle("ProtocolName");
+        const DataColumnHandle framesPerSecond = deviceDetail->ColumnHandle("FramesPerSecond");
+        const DataColumnHandle companyAcronym = deviceDetail->ColumnHandle("CompanyAcronym");
+        const DataColumnHandle vendorAcronym = deviceDetail->ColumnHandle("VendorAcronym");
+        const DataColumnHandle vendorDeviceName = deviceDetail->ColumnHandle("VendorDeviceName");
+        const DataColumnHandle longitude = deviceDetail->ColumnHandle("Longitude");
+        const DataColumnHandle latitude = deviceDetail->ColumnHandle("Latitude");
+        const DataColumnHandle updatedOn = deviceDetail->ColumnHandle("UpdatedOn");
+
+        for (int32_t i = 0; i < deviceDetail->RowCount(); i++)
+        {
+            const DataRowPtr& row = deviceDetail->Row(i);
+            string deviceAcronym(row->GetStringValue(acronym));
+
+            if (deviceAcronyms != nullptr && deviceAcronyms->find(deviceAcronym) == deviceAcronyms->end())
+                continue;
+
+            DeviceMetadataPtr deviceMetadata = NewSharedPtr<DeviceMetadata>();
+
+            deviceMetadata->Acronym = std::move(deviceAcronym);
+            deviceMetadata->Name = row->GetStringValue(name);
+            deviceMetadata->UniqueID = row->GetGuidValue(uniqueID);
+            deviceMetadata->AccessID = row->GetInt32Value(accessID);
+            deviceMetadata->ParentAcronym = row->GetStringValue(parentAcronym);
+            deviceMetadata->ProtocolName = row->GetStringValue(protocolName);
+            deviceMetadata->FramesPerSecond = row->GetInt32Value(framesPerSecond, 30);
+            deviceMetadata->CompanyAcronym = row->GetStringValue(companyAcronym);
+            deviceMetadata->VendorAcronym = row->GetStringValue(vendorAcronym);
+            deviceMetadata->VendorDeviceName = row->GetStringValue(vendorDeviceName);
+            deviceMetadata->Longitude = row->GetDecimalValue(longitude).convert_to<float64_t>();
+            deviceMetadata->Latitude = row->GetDecimalValue(latitude).convert_to<float64_t>();
+            deviceMetadata->UpdatedOn = row->GetDateTimeValue(updatedOn);
+
+            devices.insert_or_assign(deviceMetadata->Acronym, deviceMetadata);
+        }
+    }
+
+    // Query MeasurementDetail records from metadata
+    const DataTablePtr& measurementDetail = metadata->Table("MeasurementDetail");
+
+    if (measurementDetail != nullptr)
+    {
+        const DataColumnHandle deviceAcronym = measurementDetail->ColumnHandle("DeviceAcronym");
+        const DataColumnHandle id = measurementDetail->ColumnHandle("ID");
+        const DataColumnHandle signalID = measurementDetail->ColumnHandle("SignalID");
+        const DataColumnHandle pointTag = measurementDetail->ColumnHandle("PointTag");
+        const DataColumnHandle signalReference = measurementDetail->ColumnHandle("SignalReference");
+        const DataColumnHandle phasorSourceIndex = measurementDetail->ColumnHandle("PhasorSourceIndex");
+        const DataColumnHandle description = measurementDetail->ColumnHandle("Description");
+        const DataColumnHandle updatedOn = measurementDetail->ColumnHandle("UpdatedOn");
+
+        if (deviceAcronyms == nullptr)
+            measurements.reserve(measurementDetail->RowCount());
+
+        for (int32_t i = 0; i < measurementDetail->RowCount(); i++)
+        {
+            const DataRowPtr& row = measurementDetail->Row(i);
+            string measurementDeviceAcronym(row->GetStringValue(deviceAcronym));
+
+            if (deviceAcronyms != nullptr && deviceAcronyms->find(measurementDeviceAcronym) == deviceAcronyms->end())
+                continue;
+
+            MeasurementMetadataPtr measurementMetadata = NewSharedPtr<MeasurementMetadata>();
+
+            measurementMetadata->DeviceAcronym = std::move(measurementDeviceAcronym);
+            measurementMetadata->ID = row->GetStringValue(id);
+            measurementMetadata->SignalID = row->GetGuidValue(signalID);
+            measurementMetadata->PointTag = row->GetStringValue(pointTag);
+            measurementMetadata->Reference = SignalReference(string(row->GetStringValue(signalReference)));
+            measurementMetadata->PhasorSourceIndex = static_cast<uint16_t>(row->GetInt32Value(phasorSourceIndex));
+            measurementMetadata->Description = row->GetStringValue(description);
+            measurementMetadata->UpdatedOn = row->GetDateTimeValue(updatedOn);
+
+            measurements.push_back(measurementMetadata);
+        }
+    }
+
+    // Query PhasorDetail records from metadata
+    const DataTablePtr& phasorDetail = metadata->Table("PhasorDetail");
+
+    if (phasorDetail != nullptr)
+    {
+        const DataColumnHandle deviceAcronym = phasorDetail->ColumnHandle("DeviceAcronym");
+        const DataColumnHandle label = phasorDetail->ColumnHandle("Label");
+        const DataColumnHandle type = phasorDetail->ColumnHandle("Type");
+        const DataColumnHandle phase = phasorDetail->ColumnHandle("Phase");
+        const DataColumnHandle sourceIndex = phasorDetail->ColumnHandle("SourceIndex");
+        const DataColumnHandle updatedOn = phasorDetail->ColumnHandle("UpdatedOn");
+
+        for (int32_t i = 0; i < phasorDetail->RowCount(); i++)
+        {
+            const DataRowPtr& row = phasorDetail->Row(i);
+            string phasorDeviceAcronym(row->GetStringValue(deviceAcronym));
+
+            if (deviceAcronyms != nullptr && deviceAcronyms->find(phasorDeviceAcronym) == deviceAcronyms->end())
+                continue;
+
+            PhasorMetadataPtr phasorMetadata = NewSharedPtr<PhasorMetadata>();
+
+            phasorMetadata->DeviceAcronym = std::move(phasorDeviceAcronym);
+            phasorMetadata->Label = row->GetStringValue(label);
+            phasorMetadata->Type = row->GetStringValue(type);
+            phasorMetadata->Phase = row->GetStringValue(phase);
+            phasorMetadata->SourceIndex = static_cast<uint16_t>(row->GetInt32Value(sourceIndex));
+            phasorMetadata->UpdatedOn = row->GetDateTimeValue(updatedOn);
+
+            phasors.push_back(phasorMetadata);
+        }
+    }
 }
 
 void SubscriberInstance::SendMetadataRefreshCommand()
 {
-    if (m_metadataFilters.empty())
+    const bool requestDelta = m_metadataDeltaSyncEnabled && IsMetadataBinaryFormat();
+
+    if (m_metadataFilters.empty() && !requestDelta)
     {
         m_subscriber->SendServerCommand(ServerCommand::MetadataRefresh);
         return;
     }
 
-    // Send meta-data filters when some are specified
+    // Send meta-data filters when some are specified, followed by local meta-data
+    // version when requesting only the changes since that version
     vector<uint8_t> buffer;
     
     const uint8_t* metadataFiltersPtr = reinterpret_cast<uint8_t*>(&m_metadataFilters[0]);
     const uint32_t metadataFiltersSize = ConvertUInt32(m_metadataFilters.size() * sizeof(char));
-    const uint32_t bufferSize = 4 + metadataFiltersSize;
+    const uint32_t bufferSize = 4 + metadataFiltersSize + (requestDelta ? 20 : 0);
 
     buffer.reserve(bufferSize);
     EndianConverter::WriteBigEndianBytes(buffer, metadataFiltersSize);
     WriteBytes(buffer, metadataFiltersPtr, 0, metadataFiltersSize);
 
+    if (requestDelta)
+    {
+        ScopeLock lock(m_configurationUpdateLock);
+        buffer.insert(buffer.end(), m_metadataHistoryID.begin(), m_metadataHistoryID.end());
+        EndianConverter::WriteBigEndianBytes(buffer, m_metadataVersion);
+    }
+
     m_subscriber->SendServerCommand(ServerCommand::MetadataRefresh, &buffer[0], 0, bufferSize);
 }
 
+void SubscriberInstance::StartSubscription()
+{
+    // If automatically parsing metadata, request metadata upon successful connection,
+    // after metadata is handled the SubscriberInstance will then initiate subscribe;
+    // otherwise, initiate subscribe immediately. When versioned metadata is already
+    // available, subscribe immediately and revalidate metadata in the background.
+    if (!m_autoParseMetadata)
+    {
+        m_subscriber->Subscribe();
+        return;
+    }
+
+    if (m_metadata != nullptr && m_metadataDeltaSyncEnabled)
+        m_subscriber->Subscribe();
+
+    SendMetadataRefreshCommand();
+}
+
+// Metadata cache file format: signature "GSFC", format version (uint8), publisher hostname length (uint16),
+// hostname, publisher port (uint16), then versioned meta-data holding full meta-data, all values are big-endian
+static const uint8_t MetadataCacheSignature[4] = { 'G', 'S', 'F', 'C' };
+static const uint8_t MetadataCacheFormat = 1;
+
+bool SubscriberInstance::LoadMetadataCache()
+{
+    VersionedMetadata versionedMetadata;
+    StringMap<DeviceMetadataPtr> devices;
+    vector<MeasurementMetadataPtr> measurementRecords;
+    vector<PhasorMetadataPtr> phasorRecords;
+
+    try
+    {
+        if (!boost::filesystem::exists(m_metadataCachePath))
+            return false;
+
+        // Cache is mapped rather than read so meta-data is parsed directly from file pages, an empty
+        // file cannot be mapped and is reported as truncated. Mapping is released once parsing completes.
+        if (boost::filesystem::file_size(m_metadataCachePath) == 0)
+            throw DataSetException("cache file is truncated");
+
+        const boost::iostreams::mapped_file_source cacheFile(m_metadataCachePath);
+        const uint8_t* buffer = reinterpret_cast<const uint8_t*>(cacheFile.data());
+        const uint32_t length = ConvertUInt32(cacheFile.size());
+        uint32_t offset = sizeof(MetadataCacheSignature) + 1;
+
+        if (length < offset + 2 || memcmp(buffer, MetadataCacheSignature, sizeof(MetadataCacheSignature)) != 0 || buffer[sizeof(MetadataCacheSignature)] != MetadataCacheFormat)
+            throw DataSetException("unrecognized cache file format");
+
+        const uint16_t hostnameLength = EndianConverter::ToBigEndian<uint16_t>(buffer, offset);
+        offset += 2;
+
+        if (length < offset + hostnameLength + 2)
+            throw DataSetException("cache file is truncated");
+
+        const string hostname(reinterpret_cast<const char*>(buffer + offset), hostnameLength);
+        offset += hostnameLength;
+
+        const uint16_t port = EndianConverter::ToBigEndian<uint16_t>(buffer, offset);
+        offset += 2;
+
+        // Cached meta-data from another publisher is not used
+        if (!IsEqual(hostname, m_hostname) || port != m_port)
+            return false;
+
+        versionedMetadata.Read(buffer + offset, length - offset);
+
+        if (versionedMetadata.Metadata == nullptr)
+            throw DataSetException("cache file does not contain full meta data");
+
+        // Corrupt values are found while parsing, before any cached meta-data is applied
+        ParseMetadata(versionedMetadata.Metadata, devices, measurementRecords, phasorRecords);
+    }
+    catch (const DataSetException& ex)
+    {
+        ErrorMessage("Failed to load meta data cache \"" + m_metadataCachePath + "\": " + string(ex.what()));
+        return false;
+    }
+    catch (const std::exception& ex)
+    {
+        ErrorMessage("Failed to load meta data cache \"" + m_metadataCachePath + "\": " + string(ex.what()));
+        return false;
+    }
+    catch (...)
+    {
+        ErrorMessage("Failed to load meta data cache \"" + m_metadataCachePath + "\": " + boost::current_exception_diagnostic_information(true));
+        return false;
+    }
+
+    SetMetadataVersion(versionedMetadata.Metadata, versionedMetadata.HistoryID, versionedMetadata.Version);
+
+    StatusMessage("Loaded meta data version " + ToString(versionedMetadata.Version) + " from local cache...");
+    LoadMetadata(devices, measurementRecords, phasorRecords);
+
+    return true;
+}
+
+void SubscriberInstance::SaveMetadataCache()
+{
+    VersionedMetadata versionedMetadata;
+    versionedMetadata.HistoryID = m_metadataHistoryID;
+    versionedMetadata.Version = m_metadataVersion;
+    versionedMetadata.Metadata = m_metadata;
+
+    vector<uint8_t> buffer;
+    const uint16_t hostnameLength = static_cast<uint16_t>(min(m_hostname.size(), static_cast<size_t>(UInt16::MaxValue)));
+
+    buffer.insert(buffer.end(), begin(MetadataCacheSignature), end(MetadataCacheSignature));
+    buffer.push_back(MetadataCacheFormat);
+    EndianConverter::WriteBigEndianBytes(buffer, hostnameLength);
+    buffer.insert(buffer.end(), m_hostname.begin(), m_hostname.begin() + hostnameLength);
+    EndianConverter::WriteBigEndianBytes(buffer, m_port);
+    versionedMetadata.Write(buffer);
+
+    // Write to a temporary file first so an interrupted write does not corrupt existing cache
+    const string tempPath = m_metadataCachePath + ".tmp";
+
+    try
+    {
+        {
+            ofstream cacheFile(tempPath, ios::binary | ios::trunc);
+            cacheFile.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+
+            if (!cacheFile)
+                throw runtime_error("failed to write file");
+        }
+
+        boost::filesystem::rename(tempPath, m_metadataCachePath);
+    }
+    catch (const std::exception& ex)
+    {
+        ErrorMessage("Failed to save meta data cache \"" + m_metadataCachePath + "\": " + string(ex.what()));
+    }
+}
+
+void SubscriberInstance::SetMetadataVersion(const DataSetPtr& metadata, const Guid& historyID, const uint32_t version)
+{
+    ScopeLock lock(m_configurationUpdateLock);
+    m_metadata = metadata;
+    m_metadataHistoryID = historyID;
+    m_metadataVersion = version;
+}
+
 void SubscriberInstance::ConstructConfigurationFrames(const StringMap<DeviceMetadataPtr>& devices, const unordered_map<Guid, MeasurementMetadataPtr>& measurements, StringMap<ConfigurationFramePtr>& configurationFrames)
 {
     for (auto const& deviceMapRecord : devices)
@@ -1030,14 +1549,7 @@ void SubscriberInstance::HandleResubscribe(DataSubscriber* source)
     {
         instance->StatusMessage("Reconnected. Subscribing to data...");
         instance->ConnectionEstablished();
-
-        // If automatically parsing metadata, request metadata upon successful connection,
-        // after metadata is handled the SubscriberInstance will then initiate subscribe;
-        // otherwise, initiate subscribe immediately
-        if (instance->m_autoParseMetadata)
-            instance->SendMetadataRefreshCommand();
-        else
-            source->Subscribe();
+        instance->StartSubscription();
     }
     else
     {
@@ -1077,8 +1589,9 @@ void SubscriberInstance::HandleMetadata(DataSubscriber* source, const vector<uin
     // Call virtual method to handle metadata payload
     instance->ReceivedMetadata(payload);
 
-    // When auto-parsing metadata, start subscription after successful user meta-data handling
-    if (instance->m_autoParseMetadata)
+    // When auto-parsing metadata, start subscription after successful user meta-data handling,
+    // an active subscription is only renewed when meta-data has changed
+    if (instance->m_autoParseMetadata && (!source->IsSubscribed() || instance->m_metadataChanged))
         source->Subscribe();
 }
 
@@ -25,6 +25,7 @@
 #define __SUBSCRIBERINSTANCE_H
 
 #include "DataSubscriber.h"
+#include "MetadataDelta.h"
 
 namespace GSF {
 namespace TimeSeries {
@@ -52,11 +53,30 @@ namespace Transport
         GSF::StringMap<DeviceMetadataPtr> m_devices;
         GSF::StringMap<ConfigurationFramePtr> m_configurationFrames;
 
+        // Local copy of versioned meta-data, maintained for delta synchronization
+        GSF::Data::DataSetPtr m_metadata;
+        GSF::Guid m_metadataHistoryID;
+        uint32_t m_metadataVersion;
+        bool m_metadataDeltaSyncEnabled;
+        bool m_metadataChanged;
+        std::string m_metadataCachePath;
+
         Mutex m_configurationUpdateLock;
         void* m_userData;
 
-        void SendMetadataRefreshCommand();
+        typedef std::unordered_set<std::string, GSF::StringHash, GSF::StringEqual> DeviceAcronymSet;
 
+        void SendMetadataRefreshCommand();
+        void StartSubscription();
+        void SetMetadataVersion(const GSF::Data::DataSetPtr& metadata, const GSF::Guid& historyID, uint32_t version);
+
+        void ReceivedVersionedMetadata(const std::vector<uint8_t>& buffer);
+        void LoadMetadata(GSF::StringMap<DeviceMetadataPtr>& devices, const std::vector<MeasurementMetadataPtr>& measurementRecords, const std::vector<PhasorMetadataPtr>& phasorRecords);
+        void UpdateMetadata(const DeviceAcronymSet& deviceAcronyms, uint64_t changedRecords);
+        uint16_t AssociateMetadata(GSF::StringMap<DeviceMetadataPtr>& devices, const std::vector<MeasurementMetadataPtr>& measurementRecords, const std::vector<PhasorMetadataPtr>& phasorRecords, std::unordered_map<Guid, MeasurementMetadataPtr>& measurements);
+        void GetChangedDeviceAcronyms(const MetadataDeltaPtr& delta, DeviceAcronymSet& deviceAcronyms) const;
+        bool ParseXmlMetadata(std::vector<uint8_t>& buffer, GSF::StringMap<DeviceMetadataPtr>& devices, std::vector<MeasurementMetadataPtr>& measurements, std::vector<PhasorMetadataPtr>& phasors);
+        static void ParseMetadata(const GSF::Data::DataSetPtr& metadata, GSF::StringMap<DeviceMetadataPtr>& devices, std::vector<MeasurementMetadataPtr>& measurements, std::vector<PhasorMetadataPtr>& phasors, const DeviceAcronymSet* deviceAcronyms = nullptr);
         static void ConstructConfigurationFrames(const GSF::StringMap<DeviceMetadataPtr>& devices, const std::unordered_map<Guid, MeasurementMetadataPtr>& measurements, GSF::StringMap<ConfigurationFramePtr>& configurationFrames);
         static bool TryFindMeasurement(const std::vector<MeasurementMetadataPtr>& measurements, SignalKind kind, uint16_t index, MeasurementMetadataPtr& measurementMetadata);
         static bool TryFindMeasurement(const std::vector<MeasurementMetadataPtr>& measurements, SignalKind kind, MeasurementMetadataPtr& measurementMetadata);
@@ -88,6 +108,13 @@ namespace Transport
         virtual void ConnectionEstablished();
         virtual void ConnectionTerminated();
 
+        // Loads meta-data cached for the current publisher, returns false when cache is missing, from another
+        // publisher or unreadable, in which case full meta-data will be requested from publisher
+        bool LoadMetadataCache();
+
+        // Saves current meta-data, with its version, to the meta-data cache path
+        void SaveMetadataCache();
+
         SubscriberInstance();
 
     public:
@@ -160,6 +187,12 @@ namespace Transport
         const std::string& GetMetadataFilters() const;
         void SetMetadataFilters(const std::string& metadataFilters);
 
+        // Defines file path of a local metadata cache, disabled when empty. Cached metadata from the
+        // same publisher is loaded on connect so that data can be subscribed to immediately, metadata
+        // is then revalidated against the publisher in the background. Requires delta synchronization.
+        const std::string& GetMetadataCachePath() const;
+        void SetMetadataCachePath(const std::string& metadataCachePath);
+
         // Starts the connection cycle to a GEP publisher. Upon connection, meta-data will be requested,
         // when received, a subscription will be established
         void Connect();
@@ -191,6 +224,17 @@ namespace Transport
         bool IsMetadataCompressed() const;
         void SetMetadataCompressed(bool compressed) const;
 
+        // Gets or sets value that determines whether the metadata transfer
+        // requests binary data set format instead of XML, defaults to true.
+        bool IsMetadataBinaryFormat() const;
+        void SetMetadataBinaryFormat(bool binaryFormat) const;
+
+        // Gets or sets value that determines whether metadata refresh requests
+        // send local metadata version so that publisher can respond with only
+        // the changes since that version, requires binary format, defaults to true.
+        bool IsMetadataDeltaSyncEnabled() const;
+        void SetMetadataDeltaSyncEnabled(bool enabled);
+
         // Gets or sets value that determines whether the
         // signal index cache is compressed using GZip.
         bool IsSignalIndexCacheCompressed() const;
@@ -200,6 +244,7 @@ namespace Transport
         uint64_t GetTotalCommandChannelBytesReceived() const;
         uint64_t GetTotalDataChannelBytesReceived() const;
         uint64_t GetTotalMeasurementsReceived() const;
+        GSF::MetricsSnapshot GetMetricsSnapshot() const;
         bool IsConnected() const;
         bool IsSubscribed() const;
 
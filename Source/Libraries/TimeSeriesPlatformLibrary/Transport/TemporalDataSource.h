@@ -0,0 +1,82 @@
+//******************************************************************************************************
+//  TemporalDataSource.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __TEMPORAL_DATA_SOURCE_H
+#define __TEMPORAL_DATA_SOURCE_H
+
+#include "../Common/CommonTypes.h"
+#include <unordered_set>
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Fixed-size historical measurement record, signal handles are defined by the data source
+#pragma pack(push, 1)
+    struct ArchiveRecord
+    {
+        int64_t Timestamp;
+        uint32_t SignalHandle;
+        uint32_t Flags;
+        float64_t Value;
+    };
+#pragma pack(pop)
+
+    // Forward-only cursor over historical records for a time range
+    class TemporalDataReader // NOLINT
+    {
+    public:
+        virtual ~TemporalDataReader() = default;
+
+        // Reads next record within time range, returns false when no more records are available
+        virtual bool ReadNext(ArchiveRecord& record) = 0;
+    };
+
+    typedef SharedPtr<TemporalDataReader> TemporalDataReaderPtr;
+
+    // Defines a source of historical measurements that can be used to serve temporal subscriptions
+    class TemporalDataSource // NOLINT
+    {
+    public:
+        virtual ~TemporalDataSource() = default;
+
+        // Gets the range of timestamps currently available from the source
+        virtual bool TryGetTimeRange(int64_t& startTime, int64_t& stopTime) = 0;
+
+        // Gets the signal ID for the specified signal handle
+        virtual GSF::Guid GetSignalID(uint32_t signalHandle) = 0;
+
+        // Gets the position following the last record added to the source. Positions increase in the order records
+        // are added, regardless of their timestamps, so a reader can continue from where a previous reader stopped.
+        virtual uint64_t GetPosition() = 0;
+
+        // Creates a reader for records in the specified time range, inclusive, for the given signal IDs.
+        // An empty signal ID set reads all available signals. Only records added at or after the start
+        // position and before the stop position are read.
+        virtual TemporalDataReaderPtr CreateReader(int64_t startTime, int64_t stopTime, const std::unordered_set<GSF::Guid>& signalIDs = {}, uint64_t startPosition = 0ULL, uint64_t stopPosition = UInt64::MaxValue) = 0;
+    };
+
+    typedef SharedPtr<TemporalDataSource> TemporalDataSourcePtr;
+}}}
+
+#endif
@@ -0,0 +1,207 @@
+//******************************************************************************************************
+//  TemporalReplay.cpp - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "TemporalReplay.h"
+#include "DataPublisher.h"
+#include "../Common/Convert.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+TemporalReplay::TemporalReplay(TemporalDataSourcePtr dataSource, SubscriberConnectionPtr connection) :
+    m_dataSource(std::move(dataSource)),
+    m_connection(std::move(connection)),
+    m_replayThread(nullptr),
+    m_stopped(true)
+{
+    if (m_dataSource == nullptr)
+        throw PublisherException("Cannot replay temporal subscription, no temporal data source was defined");
+}
+
+TemporalReplay::~TemporalReplay()
+{
+    Stop();
+}
+
+const SubscriberConnectionPtr& TemporalReplay::GetConnection() const
+{
+    return m_connection;
+}
+
+void TemporalReplay::Start()
+{
+    Stop();
+
+    m_stopped = false;
+    m_replayThread = NewSharedPtr<GSF::Thread>(boost::bind(&TemporalReplay::ReplayData, this));
+}
+
+void TemporalReplay::Stop()
+{
+    m_stopped = true;
+
+    if (m_replayThread != nullptr)
+    {
+        m_replayThread->interrupt();
+
+        if (boost::this_thread::get_id() != m_replayThread->get_id())
+            m_replayThread->join();
+    }
+
+    m_replayThread.reset();
+}
+
+bool TemporalReplay::GetIsStopped() const
+{
+    return m_stopped;
+}
+
+const Guid& TemporalReplay::GetSignalID(const uint32_t signalHandle)
+{
+    // Cache signal handle lookups locally to avoid data source lock contention during replay
+    while (signalHandle >= m_signalIDs.size())
+        m_signalIDs.push_back(m_dataSource->GetSignalID(ConvertUInt32(m_signalIDs.size())));
+
+    return m_signalIDs[signalHandle];
+}
+
+void TemporalReplay::ReplayRange(const int64_t startTime, const int64_t stopTime, const unordered_set<Guid>& signalIDs, const uint64_t startPosition, const uint64_t stopPosition)
+{
+    const TemporalDataReaderPtr reader = m_dataSource->CreateReader(startTime, stopTime, signalIDs, startPosition, stopPosition);
+    vector<MeasurementPtr> measurements;
+    ArchiveRecord record;
+    bool recordAvailable = reader->ReadNext(record);
+
+    while (recordAvailable && !m_stopped)
+    {
+        const int64_t frameTimestamp = record.Timestamp;
+
+        // Group consecutive records with the same timestamp into a frame
+        while (recordAvailable && record.Timestamp == frameTimestamp)
+        {
+            MeasurementPtr measurement = NewSharedPtr<Measurement>();
+
+            measurement->SignalID = GetSignalID(record.SignalHandle);
+            measurement->Timestamp = record.Timestamp;
+            measurement->Flags = static_cast<MeasurementStateFlags>(record.Flags);
+            measurement->Value = record.Value;
+
+            measurements.push_back(measurement);
+            recordAvailable = reader->ReadNext(record);
+        }
+
+        const int32_t processingInterval = m_connection->GetProcessingInterval();
+
+        // When processing as fast as possible, multiple frames are published together
+        if (processingInterval == 0 && recordAvailable && measurements.size() < MaximumBatchSize)
+            continue;
+
+        m_connection->PublishMeasurements(measurements);
+        measurements.clear();
+
+        if (!recordAvailable)
+            break;
+
+        if (processingInterval > 0)
+            boost::this_thread::sleep(boost::posix_time::milliseconds(processingInterval));
+        else if (processingInterval < 0 && record.Timestamp > frameTimestamp)
+            boost::this_thread::sleep(boost::posix_time::milliseconds((record.Timestamp - frameTimestamp) / Ticks::PerMillisecond));
+    }
+}
+
+void TemporalReplay::TransitionToRealTime(const int64_t startTime, const int64_t stopTime, const unordered_set<Guid>& signalIDs, const uint64_t position)
+{
+    // Live data is buffered from handoff position on, so final pass replays all earlier records
+    const uint64_t handoffPosition = m_connection->GetParent()->BeginLiveDataHandoff(m_connection, m_dataSource);
+
+    if (!signalIDs.empty())
+        ReplayRange(startTime, stopTime, signalIDs, position, handoffPosition);
+
+    // Replay is marked stopped in the same step as checking for a stop request so that Stop cannot be missed
+    if (m_stopped.exchange(true))
+    {
+        m_connection->CancelLiveDataHandoff();
+        return;
+    }
+
+    m_connection->CompleteLiveDataHandoff();
+    m_connection->GetParent()->DispatchStatusMessage("Temporal replay for subscriber \"" + m_connection->GetConnectionID() + "\" caught up with available history, switched to real-time data.");
+}
+
+void TemporalReplay::ReplayData()
+{
+    try
+    {
+        const int64_t startTime = ToTicks(m_connection->GetStartTimeConstraint());
+        const int64_t stopTime = ToTicks(m_connection->GetStopTimeConstraint());
+        const bool openEnded = m_connection->GetStopTimeConstraint() == DateTime::MaxValue;
+        const SignalIndexCachePtr& signalIndexCache = m_connection->GetSignalIndexCache();
+        unordered_set<Guid> signalIDs;
+        uint64_t position = 0ULL;
+        uint64_t stopPosition = m_dataSource->GetPosition();
+
+        // An empty signal ID set would read all signals, so there is nothing to replay without subscribed signals
+        if (signalIndexCache != nullptr && signalIndexCache->Count() > 0)
+        {
+            signalIDs = signalIndexCache->GetSignalIDs();
+            ReplayRange(startTime, stopTime, signalIDs, position, stopPosition);
+
+            // Replay any data that arrived while history was being replayed
+            for (int32_t i = 0; openEnded && !m_stopped; i++)
+            {
+                position = stopPosition;
+                stopPosition = m_dataSource->GetPosition();
+
+                if (stopPosition - position <= MaximumHandoffRecords)
+                    break;
+
+                if (i == MaximumCatchUpPasses)
+                    throw PublisherException("Replay could not catch up with available history after " + ToString(MaximumCatchUpPasses) + " passes, it is still " + ToString(stopPosition - position) + " records behind");
+
+                ReplayRange(startTime, stopTime, signalIDs, position, stopPosition);
+            }
+        }
+
+        if (openEnded && !m_stopped)
+        {
+            TransitionToRealTime(startTime, stopTime, signalIDs, position);
+            return;
+        }
+    }
+    catch (boost::thread_interrupted&)
+    {
+        m_connection->CancelLiveDataHandoff();
+        return;
+    }
+    catch (...)
+    {
+        m_connection->CancelLiveDataHandoff();
+        m_connection->GetParent()->DispatchErrorMessage("Temporal replay for subscriber \"" + m_connection->GetConnectionID() + "\" failed: " + boost::current_exception_diagnostic_information(true));
+    }
+
+    // Notify subscriber that processing is complete
+    if (!m_stopped.exchange(true))
+        m_connection->CancelTemporalSubscription();
+}
@@ -0,0 +1,83 @@
+//******************************************************************************************************
+//  TemporalReplay.h - Gbtc
+//
+//  Copyright © 2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Gbtc
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __TEMPORAL_REPLAY_H
+#define __TEMPORAL_REPLAY_H
+
+#include "../Common/CommonTypes.h"
+#include "TemporalDataSource.h"
+#include "SubscriberConnection.h"
+#include <atomic>
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Replays historical measurements to a temporal subscription. Records between the subscriber's start and stop
+    // time constraints are grouped into frames by timestamp and published at the subscriber's processing interval:
+    // a positive interval delays that many milliseconds between frames, 0 publishes as fast as possible in large
+    // batches and -1 replays at the original data rate. Interval changes take effect on the next frame.
+    //
+    // When the subscription has no stop time constraint, replay catches up with records added to the data source
+    // while it was replaying, tracked by data source position so late or out of order records are included, and
+    // then hands off the subscription to real-time data. Live data is buffered during the final pass so that no
+    // measurement is missed or sent twice. Replay fails when it cannot catch up with the data source.
+    class TemporalReplay // NOLINT
+    {
+    private:
+        const TemporalDataSourcePtr m_dataSource;
+        const SubscriberConnectionPtr m_connection;
+        SharedPtr<GSF::Thread> m_replayThread;
+        std::vector<GSF::Guid> m_signalIDs;
+        std::atomic<bool> m_stopped;
+
+        void ReplayData();
+        void ReplayRange(int64_t startTime, int64_t stopTime, const std::unordered_set<GSF::Guid>& signalIDs, uint64_t startPosition, uint64_t stopPosition);
+        void TransitionToRealTime(int64_t startTime, int64_t stopTime, const std::unordered_set<GSF::Guid>& signalIDs, uint64_t position);
+        const GSF::Guid& GetSignalID(uint32_t signalHandle);
+
+    public:
+        TemporalReplay(TemporalDataSourcePtr dataSource, SubscriberConnectionPtr connection);
+        ~TemporalReplay();
+
+        const SubscriberConnectionPtr& GetConnection() const;
+
+        void Start();
+        void Stop();
+
+        bool GetIsStopped() const;
+
+        // Maximum number of measurements published per data packet when processing as fast as possible
+        static constexpr const size_t MaximumBatchSize = 10000;
+
+        // Maximum number of catch-up passes an open-ended replay makes before it fails to catch up
+        static constexpr const int32_t MaximumCatchUpPasses = 10;
+
+        // Maximum number of records an open-ended replay can be behind the data source when it hands off to real-time
+        static constexpr const uint64_t MaximumHandoffRecords = 10000ULL;
+    };
+
+    typedef SharedPtr<TemporalReplay> TemporalReplayPtr;
+}}}
+
+#endif
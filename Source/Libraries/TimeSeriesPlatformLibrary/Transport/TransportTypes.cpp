@@ -76,6 +76,15 @@ void Measurement::GetUnixTime(time_t& unixSOC, uint16_t& milliseconds) const
     ToUnixTime(Timestamp, unixSOC, milliseconds);
 }
 
+MeasurementRecord::MeasurementRecord() :
+    SignalHandle(InvalidSignalHandle),
+    Flags(MeasurementStateFlags::Normal),
+    Timestamp(0),
+    Value(NAN),
+    SignalID(Empty::Guid)
+{
+}
+
 MeasurementPtr TimeSeries::ToPtr(const Measurement& source)
 {
     MeasurementPtr destination = NewSharedPtr<Measurement>();
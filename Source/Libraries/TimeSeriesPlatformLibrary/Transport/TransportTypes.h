@@ -107,6 +107,34 @@ namespace TimeSeries
     typedef SharedPtr<Measurement> MeasurementPtr;
     MeasurementPtr ToPtr(const Measurement& source);
 
+    // Lightweight value-type measurement used to publish contiguous blocks of
+    // measurements directly from caller owned memory, i.e., without allocating
+    // a shared pointer per measurement. Value is published as-is, there is no
+    // adder or multiplier.
+    struct MeasurementRecord
+    {
+        // Publisher assigned signal handle, see DataPublisher::GetSignalHandle. When
+        // handle is InvalidSignalHandle, measurement is identified by SignalID.
+        uint32_t SignalHandle;
+        MeasurementStateFlags Flags;
+        int64_t Timestamp;
+        float64_t Value;
+        Guid SignalID;
+
+        // Creates a new instance.
+        MeasurementRecord();
+
+        static constexpr const uint32_t InvalidSignalHandle = 0xFFFFFFFFU;
+    };
+
+    // Measurement record paired with its resolved signal ID, both
+    // referencing memory owned by the caller of a publish operation
+    struct RoutedMeasurementRecord
+    {
+        const Guid* SignalID;
+        const MeasurementRecord* Record;
+    };
+
     enum SignalKind : int16_t
     {
         Angle,			// Phase angle